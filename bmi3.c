@@ -49,11 +49,35 @@
 #include "stdio.h"
 #endif
 
+/*! Vector FIFO decoder and unit conversion kernels. Define BMI3_FIFO_SIMD_DISABLE to build the scalar code only */
+#if !defined(BMI3_FIFO_SIMD_DISABLE) && !defined(__KERNEL__)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define BMI3_FIFO_SIMD_SSE2
+#elif defined(__ARM_NEON) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#include <arm_neon.h>
+#define BMI3_FIFO_SIMD_NEON
+#endif
+#endif
+
+/*! Number of FIFO frames decoded per vector block */
+#define BMI3_FIFO_SIMD_FRAMES  UINT8_C(8)
+
+/*! Number of raw samples converted per vector block */
+#define BMI3_CONVERT_SIMD_SAMPLES  UINT8_C(8)
+
+/*! Macro to define a feature field from its base address, word offset, bit name, bit position and
+ *  the member of the configuration structure it is stored in */
+#define BMI3_FEATURE_FIELD(base_addr, word, bitname, pos, type, member) \
+    { base_addr, word, bitname##_MASK, pos, (uint8_t)offsetof(struct type, member), \
+      (uint8_t)sizeof(((struct type *)0)->member) }
+
 /***************************************************************************/
 
 /*!              Static Variable
  ****************************************************************************/
 
+#ifndef BMI3_ENHANCED_FLEXIBILITY_DISABLE
 /*! Array to store config array code */
 static uint8_t bmi3_config_array_code[] = {
     0x48, 0x02, 0x94, 0x01, 0x01, 0x2e, 0xa0, 0xf2, 0x09, 0xbc, 0x20, 0x50, 0x0d, 0xb8, 0x03, 0x2e, 0xd0, 0x03, 0x01,
@@ -111,6 +135,118 @@ static uint8_t bmi3_config_array_table[] = {
 static uint8_t bmi3_config_version[] = {
     0xad, 0x00, 0x01, 0x00, 0x08, 0x08
 };
+#endif
+
+/*! Array to store the feature engine location of every configuration field, indexed by BMI3_FIELD_* */
+static const struct bmi3_feature_field bmi3_feature_fields[BMI3_FIELD_MAX] = {
+    /* Any-motion */
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_ANY_MOTION, 0, BMI3_ANY_NO_SLOPE_THRESHOLD,
+                       0, bmi3_any_motion_config, slope_thres),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_ANY_MOTION, 0, BMI3_ANY_NO_ACC_REF_UP,
+                       BMI3_ANY_NO_ACC_REF_UP_POS, bmi3_any_motion_config, acc_ref_up),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_ANY_MOTION, 1, BMI3_ANY_NO_HYSTERESIS, 0, bmi3_any_motion_config, hysteresis),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_ANY_MOTION, 2, BMI3_ANY_NO_DURATION, 0, bmi3_any_motion_config, duration),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_ANY_MOTION, 2, BMI3_ANY_NO_WAIT_TIME,
+                       BMI3_ANY_NO_WAIT_TIME_POS, bmi3_any_motion_config, wait_time),
+    /* No-motion */
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_NO_MOTION, 0, BMI3_ANY_NO_SLOPE_THRESHOLD, 0, bmi3_no_motion_config, slope_thres),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_NO_MOTION, 0, BMI3_ANY_NO_ACC_REF_UP,
+                       BMI3_ANY_NO_ACC_REF_UP_POS, bmi3_no_motion_config, acc_ref_up),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_NO_MOTION, 1, BMI3_ANY_NO_HYSTERESIS, 0, bmi3_no_motion_config, hysteresis),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_NO_MOTION, 2, BMI3_ANY_NO_DURATION, 0, bmi3_no_motion_config, duration),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_NO_MOTION, 2, BMI3_ANY_NO_WAIT_TIME,
+                       BMI3_ANY_NO_WAIT_TIME_POS, bmi3_no_motion_config, wait_time),
+    /* Flat */
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_FLAT, 0, BMI3_FLAT_THETA, 0, bmi3_flat_config, theta),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_FLAT, 0, BMI3_FLAT_BLOCKING, BMI3_FLAT_BLOCKING_POS, bmi3_flat_config, blocking),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_FLAT, 0, BMI3_FLAT_HOLD_TIME,
+                       BMI3_FLAT_HOLD_TIME_POS, bmi3_flat_config, hold_time),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_FLAT, 1, BMI3_FLAT_SLOPE_THRES, 0, bmi3_flat_config, slope_thres),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_FLAT, 1, BMI3_FLAT_HYST, BMI3_FLAT_HYST_POS, bmi3_flat_config, hysteresis),
+    /* Sig-motion */
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_SIG_MOTION, 0, BMI3_SIG_BLOCK_SIZE, 0, bmi3_sig_motion_config, block_size),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_SIG_MOTION, 1, BMI3_SIG_P2P_MIN, 0, bmi3_sig_motion_config, peak_2_peak_min),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_SIG_MOTION, 1, BMI3_SIG_MCR_MIN,
+                       BMI3_SIG_MCR_MIN_POS, bmi3_sig_motion_config, mcr_min),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_SIG_MOTION, 2, BMI3_SIG_P2P_MAX, 0, bmi3_sig_motion_config, peak_2_peak_max),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_SIG_MOTION, 2, BMI3_MCR_MAX, BMI3_MCR_MAX_POS, bmi3_sig_motion_config, mcr_max),
+    /* Step counter */
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_STEP_CNT, 0, BMI3_STEP_WATERMARK, 0, bmi3_step_counter_config, watermark_level),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_STEP_CNT, 0, BMI3_STEP_RESET_COUNTER,
+                       BMI3_STEP_RESET_COUNTER_POS, bmi3_step_counter_config, reset_counter),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_STEP_CNT, 1, BMI3_STEP_ENV_MIN_DIST_UP,
+                       0, bmi3_step_counter_config, env_min_dist_up),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_STEP_CNT, 2, BMI3_STEP_ENV_COEF_UP, 0, bmi3_step_counter_config, env_coef_up),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_STEP_CNT, 3, BMI3_STEP_ENV_MIN_DIST_DOWN,
+                       0, bmi3_step_counter_config, env_min_dist_down),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_STEP_CNT, 4, BMI3_STEP_ENV_COEF_DOWN, 0, bmi3_step_counter_config, env_coef_down),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_STEP_CNT, 5, BMI3_STEP_MEAN_VAL_DECAY,
+                       0, bmi3_step_counter_config, mean_val_decay),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_STEP_CNT, 6, BMI3_STEP_MEAN_STEP_DUR, 0, bmi3_step_counter_config, mean_step_dur),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_STEP_CNT, 7, BMI3_STEP_BUFFER_SIZE,
+                       0, bmi3_step_counter_config, step_buffer_size),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_STEP_CNT, 7, BMI3_STEP_FILTER_CASCADE_ENABLED,
+                       BMI3_STEP_FILTER_CASCADE_ENABLED_POS, bmi3_step_counter_config, filter_cascade_enabled),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_STEP_CNT, 7, BMI3_STEP_COUNTER_INCREMENT,
+                       BMI3_STEP_COUNTER_INCREMENT_POS, bmi3_step_counter_config, step_counter_increment),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_STEP_CNT, 8, BMI3_STEP_PEAK_DURATION_MIN_WALKING,
+                       0, bmi3_step_counter_config, peak_duration_min_walking),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_STEP_CNT, 8, BMI3_STEP_PEAK_DURATION_MIN_RUNNING,
+                       BMI3_STEP_PEAK_DURATION_MIN_RUNNING_POS, bmi3_step_counter_config, peak_duration_min_running),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_STEP_CNT, 9, BMI3_STEP_ACTIVITY_DETECTION_FACTOR,
+                       0, bmi3_step_counter_config, activity_detection_factor),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_STEP_CNT, 9, BMI3_STEP_ACTIVITY_DETECTION_THRESHOLD,
+                       BMI3_STEP_ACTIVITY_DETECTION_THRESHOLD_POS, bmi3_step_counter_config, activity_detection_thres),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_STEP_CNT, 10, BMI3_STEP_DURATION_MAX,
+                       0, bmi3_step_counter_config, step_duration_max),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_STEP_CNT, 10, BMI3_STEP_DURATION_WINDOW,
+                       BMI3_STEP_DURATION_WINDOW_POS, bmi3_step_counter_config, step_duration_window),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_STEP_CNT, 11, BMI3_STEP_DURATION_PP_ENABLED,
+                       0, bmi3_step_counter_config, step_duration_pp_enabled),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_STEP_CNT, 11, BMI3_STEP_DURATION_THRESHOLD,
+                       BMI3_STEP_DURATION_THRESHOLD_POS, bmi3_step_counter_config, step_duration_thres),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_STEP_CNT, 11, BMI3_STEP_MEAN_CROSSING_PP_ENABLED,
+                       BMI3_STEP_MEAN_CROSSING_PP_ENABLED_POS, bmi3_step_counter_config, mean_crossing_pp_enabled),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_STEP_CNT, 11, BMI3_STEP_MCR_THRESHOLD,
+                       BMI3_STEP_MCR_THRESHOLD_POS, bmi3_step_counter_config, mcr_threshold),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_STEP_CNT, 11, BMI3_STEP_SC_12_RES,
+                       BMI3_STEP_SC_12_RES_POS, bmi3_step_counter_config, sc_12_res),
+    /* Orientation */
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_ORIENT, 0, BMI3_ORIENT_UD_EN, 0, bmi3_orientation_config, ud_en),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_ORIENT, 0, BMI3_ORIENT_MODE, BMI3_ORIENT_MODE_POS, bmi3_orientation_config, mode),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_ORIENT, 0, BMI3_ORIENT_BLOCKING,
+                       BMI3_ORIENT_BLOCKING_POS, bmi3_orientation_config, blocking),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_ORIENT, 0, BMI3_ORIENT_THETA,
+                       BMI3_ORIENT_THETA_POS, bmi3_orientation_config, theta),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_ORIENT, 0, BMI3_ORIENT_HOLD_TIME,
+                       BMI3_ORIENT_HOLD_TIME_POS, bmi3_orientation_config, hold_time),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_ORIENT, 1, BMI3_ORIENT_SLOPE_THRES, 0, bmi3_orientation_config, slope_thres),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_ORIENT, 1, BMI3_ORIENT_HYST,
+                       BMI3_ORIENT_HYST_POS, bmi3_orientation_config, hysteresis),
+    /* Tap */
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_TAP, 0, BMI3_TAP_AXIS_SEL, 0, bmi3_tap_detector_config, axis_sel),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_TAP, 0, BMI3_TAP_WAIT_FR_TIME_OUT,
+                       BMI3_TAP_WAIT_FR_TIME_OUT_POS, bmi3_tap_detector_config, wait_for_timeout),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_TAP, 0, BMI3_TAP_MAX_PEAKS,
+                       BMI3_TAP_MAX_PEAKS_POS, bmi3_tap_detector_config, max_peaks_for_tap),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_TAP, 0, BMI3_TAP_MODE, BMI3_TAP_MODE_POS, bmi3_tap_detector_config, mode),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_TAP, 1, BMI3_TAP_PEAK_THRES, 0, bmi3_tap_detector_config, tap_peak_thres),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_TAP, 1, BMI3_TAP_MAX_GEST_DUR,
+                       BMI3_TAP_MAX_GEST_DUR_POS, bmi3_tap_detector_config, max_gest_dur),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_TAP, 2, BMI3_TAP_MAX_DUR_BW_PEAKS,
+                       0, bmi3_tap_detector_config, max_dur_between_peaks),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_TAP, 2, BMI3_TAP_SHOCK_SETT_DUR,
+                       BMI3_TAP_SHOCK_SETT_DUR_POS, bmi3_tap_detector_config, tap_shock_settling_dur),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_TAP, 2, BMI3_TAP_MIN_QUITE_DUR_BW_TAPS,
+                       BMI3_TAP_MIN_QUITE_DUR_BW_TAPS_POS, bmi3_tap_detector_config, min_quite_dur_between_taps),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_TAP, 2, BMI3_TAP_QUITE_TIME_AFTR_GEST,
+                       BMI3_TAP_QUITE_TIME_AFTR_GEST_POS, bmi3_tap_detector_config, quite_time_after_gest),
+    /* Tilt */
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_TILT, 0, BMI3_TILT_SEGMENT_SIZE, 0, bmi3_tilt_config, segment_size),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_TILT, 0, BMI3_TILT_MIN_TILT_ANGLE,
+                       BMI3_TILT_MIN_TILT_ANGLE_POS, bmi3_tilt_config, min_tilt_angle),
+    BMI3_FEATURE_FIELD(BMI3_BASE_ADDR_TILT, 1, BMI3_TILT_BETA_ACC_MEAN, 0, bmi3_tilt_config, beta_acc_mean)
+};
 
 /******************************************************************************/
 
@@ -286,6 +422,7 @@ static int8_t validate_gyr_odr_range(uint8_t *odr, uint8_t *range, struct bmi3_d
  */
 static int8_t get_gyro_sensor_data(struct bmi3_sens_axes_data *data, uint8_t reg_addr, struct bmi3_dev *dev);
 
+#ifndef BMI3_STEP_COUNTER_DISABLE
 /*!
  * @brief This internal API gets the step counter data from the register.
  *
@@ -300,7 +437,9 @@ static int8_t get_gyro_sensor_data(struct bmi3_sens_axes_data *data, uint8_t reg
  *
  */
 static int8_t get_step_counter_sensor_data(uint32_t *step_count, uint8_t reg_addr, struct bmi3_dev *dev);
+#endif
 
+#ifndef BMI3_ORIENTATION_DISABLE
 /*!
  * @brief This internal API gets the orientation output data from the register.
  *
@@ -316,6 +455,7 @@ static int8_t get_step_counter_sensor_data(uint32_t *step_count, uint8_t reg_add
  */
 static int8_t get_orient_output_data(struct bmi3_orientation_output *orient_out, uint8_t reg_addr,
                                      struct bmi3_dev *dev);
+#endif
 
 /*!
  * @brief This internal API gets gyroscope configurations like ODR, gyro mode,
@@ -371,10 +511,13 @@ static void get_gyr_data(struct bmi3_sens_axes_data *data, const uint16_t *reg_d
 static int8_t null_ptr_check(const struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API is used to set the feature.
+ * @brief This internal API reads data from the given register address on the bus,
+ * after writing out the queued writes.
  *
- * @param[in] dev    : Structure instance of bmi3_dev.
- * @param[in] enable : Structure instance of bmi3_feature_enable.
+ * @param[in] reg_addr : Register address
+ * @param[out] data    : Read data
+ * @param[in] len      : Number of bytes
+ * @param[in] dev      : Structure instance of bmi3_dev
  *
  * @return Result of API execution status
  *
@@ -382,13 +525,16 @@ static int8_t null_ptr_check(const struct bmi3_dev *dev);
  * @return < 0 -> Fail
  *
  */
-static int8_t set_feature_enable(const struct bmi3_feature_enable *enable, struct bmi3_dev *dev);
+static int8_t read_regs(uint8_t reg_addr, uint8_t *data, uint16_t len, struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API is used to get the feature.
+ * @brief This internal API writes data to the given register address, either on the bus
+ * or into the transaction queue.
  *
- * @param[in] dev    : Structure instance of bmi3_dev.
- * @param[in] enable : Structure instance of bmi3_feature_enable.
+ * @param[in] reg_addr : Register address
+ * @param[in] data     : Data to be written
+ * @param[in] len      : Number of bytes
+ * @param[in] dev      : Structure instance of bmi3_dev
  *
  * @return Result of API execution status
  *
@@ -396,89 +542,31 @@ static int8_t set_feature_enable(const struct bmi3_feature_enable *enable, struc
  * @return < 0 -> Fail
  *
  */
-static int8_t get_feature_enable(struct bmi3_feature_enable *enable, struct bmi3_dev *dev);
+static int8_t send_regs(uint8_t reg_addr, const uint8_t *data, uint16_t len, struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API gets any-motion configurations like slope_thres,
- * duration, hysteresis, accel ref up and wait time.
- *
- * @param[out]      config     : Structure instance of bmi3_any_motion_config.
- * @param[in, out] dev         : Structure instance of bmi3_dev.
- *
- * @verbatim
- *----------------------------------------------------------------------------
- *  bmi3_any_motion_config  |
- *  Structure parameters    |                   Description
- *--------------------------|--------------------------------------------------
- *                          | Minimum slope of acceleration signal for
- *                          | motion detection.
- *   slope_thres            | Default value = 10, Range = 0 to 4095, Unit = 1.953mg.
- *                          |
- * -------------------------|---------------------------------------------------
- *   accel reference up     |  Mode of the acceleration reference update
- * -------------------------|---------------------------------------------------
- *                          | Hysteresis for the slope of the acceleration
- *   hysteresis             | signal. Default value = 2, Range = 0 to 1023,
- *                          | Unit = 1.953mg.
- * -------------------------|---------------------------------------------------
- *                          | Defines the number of  consecutive data points for
- *                          | which the threshold condition must be respected,
- *                          | for interrupt assertion.
- *   duration               | unit is 20ms, range
- *                          | Default value is 10 = 2000ms.
- * -------------------------|---------------------------------------------------
- *                          |
- *   wait time              | Wait time for clearing the event after slope
- *                          | is below threshold. Default value = 3, Range = 0 to 7, Unit =
- *                          | 20ms.
- * -----------------------------------------------------------------------------
- *
- * @endverbatim
+ * @brief This internal API takes the lock of the device, if bmi3_lock_enable set one.
  *
- * @return Result of API execution status
+ * @param[in] dev      : Structure instance of bmi3_dev
  *
- * @return 0 -> Success
- * @return < 0 -> Fail
+ */
+static void lock_dev(const struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API releases the lock of the device, if bmi3_lock_enable set one.
+ *
+ * @param[in] dev      : Structure instance of bmi3_dev
  *
  */
-static int8_t get_any_motion_config(struct bmi3_any_motion_config *config, struct bmi3_dev *dev);
-
-/*!
- * @brief This internal API sets any-motion configurations like slope threshold,
- * duration, hysteresis, accel ref up and wait time.
- *
- * @param[in]      config      : Structure instance of bmi3_any_motion_config.
- * @param[in, out] dev         : Structure instance of bmi3_dev.
- *
- * @verbatim
- *----------------------------------------------------------------------------
- *  bmi3_any_motion_config  |
- *  Structure parameters    |                   Description
- *--------------------------|--------------------------------------------------
- *                          | Minimum slope of acceleration signal for
- *                          | motion detection.
- *   slope_thres            | Default value = 10, Range = 0 to 4095, Unit = 1.953mg.
- *                          |
- * -------------------------|---------------------------------------------------
- *   accel reference up     |  Mode of the acceleration reference update
- * -------------------------|---------------------------------------------------
- *                          | Hysteresis for the slope of the acceleration
- *   hysteresis             | signal. Default value = 2, Range = 0 to 1023,
- *                          | Unit = 1.953mg.
- * -------------------------|---------------------------------------------------
- *                          | Defines the number of  consecutive data points for
- *                          | which the threshold condition must be respected,
- *                          | for interrupt assertion.
- *   duration               | unit is 20ms, range
- *                          | Default value is 10 = 2000ms.
- * -------------------------|---------------------------------------------------
- *                          |
- *   wait time              | Wait time for clearing the event after slope
- *                          | is below threshold. Default value = 3, Range = 0 to 7, Unit =
- *                          | 20ms.
- * -----------------------------------------------------------------------------
- *
- * @endverbatim
+static void unlock_dev(const struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API reads registers through the shadow cache.
+ *
+ * @param[in] reg_addr : Register address
+ * @param[out] data    : Read data
+ * @param[in] len      : Number of bytes
+ * @param[in] dev      : Structure instance of bmi3_dev
  *
  * @return Result of API execution status
  *
@@ -486,44 +574,15 @@ static int8_t get_any_motion_config(struct bmi3_any_motion_config *config, struc
  * @return < 0 -> Fail
  *
  */
-static int8_t set_any_motion_config(const struct bmi3_any_motion_config *config, struct bmi3_dev *dev);
-
-/*!
- * @brief This internal API gets no-motion configurations like slope threshold,
- * duration, hysteresis, accel ref up and wait time.
- *
- * @param[out]      config     : Structure instance of bmi3_no_motion_config.
- * @param[in, out] dev         : Structure instance of bmi3_dev.
- *
- * @verbatim
- *----------------------------------------------------------------------------
- *  bmi3_no_motion_config   |
- *  Structure parameters    |                   Description
- *--------------------------|--------------------------------------------------
- *                          | Minimum slope of acceleration signal for
- *                          | motion detection.
- *   slope_thres            | Default value = 10, Range = 0 to 4095, Unit = 1.953mg.
- *                          |
- * -------------------------|---------------------------------------------------
- *   accel reference up     |  Mode of the acceleration reference update
- * -------------------------|---------------------------------------------------
- *                          | Hysteresis for the slope of the acceleration
- *   hysteresis             | signal. Default value = 2, Range = 0 to 1023,
- *                          | Unit = 1.953mg.
- * -------------------------|---------------------------------------------------
- *                          | Defines the number of  consecutive data points for
- *                          | which the threshold condition must be respected,
- *                          | for interrupt assertion.
- *   duration               | unit is 20ms, range
- *                          | Default value is 10 = 2000ms.
- * -------------------------|---------------------------------------------------
- *                          |
- *   wait time              | Wait time for clearing the event after slope
- *                          | is below threshold. Default value = 3, Range = 0 to 7, Unit =
- *                          | 20ms.
- * -----------------------------------------------------------------------------
- *
- * @endverbatim
+static int8_t shadow_get_regs(uint8_t reg_addr, uint8_t *data, uint16_t len, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API writes registers through the shadow cache.
+ *
+ * @param[in] reg_addr : Register address
+ * @param[in] data     : Data to be written
+ * @param[in] len      : Number of bytes
+ * @param[in] dev      : Structure instance of bmi3_dev
  *
  * @return Result of API execution status
  *
@@ -531,44 +590,13 @@ static int8_t set_any_motion_config(const struct bmi3_any_motion_config *config,
  * @return < 0 -> Fail
  *
  */
-static int8_t get_no_motion_config(struct bmi3_no_motion_config *config, struct bmi3_dev *dev);
-
-/*!
- * @brief This internal API sets no-motion configurations like slope threshold,
- * duration, hysteresis, accel ref up and wait time.
- *
- * @param[in]      config      : Structure instance of bmi3_no_motion_config.
- * @param[in, out] dev         : Structure instance of bmi3_dev.
- *
- * @verbatim
- *----------------------------------------------------------------------------
- *  bmi3_no_motion_config   |
- *  Structure parameters    |                   Description
- *--------------------------|--------------------------------------------------
- *                          | Minimum slope of acceleration signal for
- *                          | motion detection.
- *   slope_thres            | Default value = 10, Range = 0 to 4095, Unit = 1.953mg.
- *                          |
- * -------------------------|---------------------------------------------------
- *   accel reference up     |  Mode of the acceleration reference update
- * -------------------------|---------------------------------------------------
- *                          | Hysteresis for the slope of the acceleration
- *   hysteresis             | signal. Default value = 2, Range = 0 to 1023,
- *                          | Unit = 1.953mg.
- * -------------------------|---------------------------------------------------
- *                          | Defines the number of  consecutive data points for
- *                          | which the threshold condition must be respected,
- *                          | for interrupt assertion.
- *   duration               | unit is 20ms, range
- *                          | Default value is 10 = 2000ms.
- * -------------------------|---------------------------------------------------
- *                          |
- *   wait time              | Wait time for clearing the event after slope
- *                          | is below threshold. Default value = 3, Range = 0 to 7, Unit =
- *                          | 20ms.
- * -----------------------------------------------------------------------------
- *
- * @endverbatim
+static int8_t shadow_set_regs(uint8_t reg_addr, const uint8_t *data, uint16_t len, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API writes the deferred feature engine address to
+ * BMI3_REG_FEATURE_DATA_ADDR if the data port of the device points elsewhere.
+ *
+ * @param[in] dev      : Structure instance of bmi3_dev
  *
  * @return Result of API execution status
  *
@@ -576,167 +604,64 @@ static int8_t get_no_motion_config(struct bmi3_no_motion_config *config, struct
  * @return < 0 -> Fail
  *
  */
-static int8_t set_no_motion_config(const struct bmi3_no_motion_config *config, struct bmi3_dev *dev);
-
-/*!
- * @brief This internal API gets flat configurations like theta, blocking,
- * hold-time, hysteresis, and slope threshold.
- *
- * @param[out]     config           : Structure instance of bmi3_flat_config.
- * @param[in, out] dev              : Structure instance of bmi3_dev.
- *
- * @verbatim
- *----------------------------------------------------------------------------
- *      bmi3_flat_config    |
- *      Structure parameters|               Description
- *--------------------------|--------------------------------------------------
- *                          | Theta angle, used for detecting flat
- *                          | position.
- *      theta               | Theta = 64 * (tan(angle)^2);
- *                          | Default value is 8, equivalent to 20 degrees angle
- * -------------------------|---------------------------------------------------
- *                          | Hysteresis for Theta Flat detection.
- *      hysteresis          | Default value is 9 = 2.5 degrees, corresponding
- *                          | to the default Theta angle of 20 degrees.
- * -------------------------|---------------------------------------------------
- *                          | Sets the blocking mode. If blocking is set, no
- *                          | Flat interrupt will be triggered.
- *      blocking            | Default value is 2, the most restrictive blocking
- *                          | mode.
- * -------------------------|---------------------------------------------------
- *                          | Holds the duration in 50Hz samples for which the
- *                          | condition has to be respected.
- *      hold-time           | Default value is 32 = 640 m-sec.
- *                          | Range is 0 to 5.1 sec.
- * -------------------------|---------------------------------------------------
- *                          | Minimum slope between consecutive acceleration
- *      slope_thres         | samples to prevent the change of flat status during
- *                          | large movement. Default value is 0xcd = 400.365mg,
- *                          | Range = 498.015mg, Unit = 1.953mg.
- * -------------------------|---------------------------------------------------
- * @endverbatim
+static int8_t shadow_sync_port(struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API copies words from the shadow cache if all of them are valid.
  *
- * @return Result of API execution status
+ * @param[in] shadow   : Shadow cache
+ * @param[in] page     : BMI3_SHADOW_PAGE_REG or BMI3_SHADOW_PAGE_FEATURE
+ * @param[in] addr     : Address of the first word
+ * @param[out] data    : Cached data
+ * @param[in] len      : Number of bytes
  *
- * @return 0 -> Success
- * @return < 0 -> Fail
+ * @return BMI3_TRUE if data was served from the cache, else BMI3_FALSE
  *
  */
-static int8_t get_flat_config(struct bmi3_flat_config *config, struct bmi3_dev *dev);
-
-/*!
- * @brief This internal API sets flat configurations like theta, blocking,
- * hold-time, hysteresis, and slope threshold.
- *
- * @param[in]     config           : Structure instance of bmi3_flat_config.
- * @param[in, out] dev             : Structure instance of bmi3_dev.
- *
- * @verbatim
- *----------------------------------------------------------------------------
- *      bmi3_flat_config    |
- *      Structure parameters|               Description
- *--------------------------|--------------------------------------------------
- *                          | Theta angle, used for detecting flat
- *                          | position.
- *      theta               | Theta = 64 * (tan(angle)^2);
- *                          | Default value is 8, equivalent to 20 degrees angle
- * -------------------------|---------------------------------------------------
- *                          | Hysteresis for Theta Flat detection.
- *      hysteresis          | Default value is 9 = 2.5 degrees, corresponding
- *                          | to the default Theta angle of 20 degrees.
- * -------------------------|---------------------------------------------------
- *                          | Sets the blocking mode. If blocking is set, no
- *                          | Flat interrupt will be triggered.
- *      blocking            | Default value is 2, the most restrictive blocking
- *                          | mode.
- * -------------------------|---------------------------------------------------
- *                          | Holds the duration in 50Hz samples for which the
- *                          | condition has to be respected.
- *      hold-time           | Default value is 32 = 640 m-sec.
- *                          | Range is 0 to 5.1 sec.
- * -------------------------|---------------------------------------------------
- *                          | Minimum slope between consecutive acceleration
- *      slope_threshold     | samples to prevent the change of flat status during
- *                          | large movement. Default value is 0xcd = 400.365mg,
- *                          | Range = 498.015mg, Unit = 1.953mg.
- * -------------------------|---------------------------------------------------
- * @endverbatim
- *
- * @return Result of API execution status
+static uint8_t shadow_lookup(const struct bmi3_shadow *shadow, uint8_t page, uint16_t addr, uint8_t *data,
+                             uint16_t len);
+
+/*!
+ * @brief This internal API stores the cacheable words of a transfer in the shadow cache.
  *
- * @return 0 -> Success
- * @return < 0 -> Fail
+ * @param[in] shadow   : Shadow cache
+ * @param[in] page     : BMI3_SHADOW_PAGE_REG or BMI3_SHADOW_PAGE_FEATURE
+ * @param[in] addr     : Address of the first word
+ * @param[in] data     : Transferred data
+ * @param[in] len      : Number of bytes
  *
  */
-static int8_t set_flat_config(const struct bmi3_flat_config *config, struct bmi3_dev *dev);
+static void shadow_update(struct bmi3_shadow *shadow, uint8_t page, uint16_t addr, const uint8_t *data,
+                          uint16_t len);
 
 /*!
- * @brief This internal API gets sig-motion configurations like block-size,
- * peak_2_peak_min, mcr_min, peak_2_peak_max and mcr_max parameters.
+ * @brief This internal API tells whether a word only changes when the host writes it.
+ * Data, status and self-clearing registers, and the feature engine words written by the
+ * feature engine itself, are never cached.
  *
- * @param[out]      config    : Structure instance of bmi3_sig_motion_config.
- * @param[in, out]  dev       : Structure instance of bmi3_dev.
+ * @param[in] page     : BMI3_SHADOW_PAGE_REG or BMI3_SHADOW_PAGE_FEATURE
+ * @param[in] addr     : Register or feature engine address
  *
- *----------------------------------------------------------------------------
- *  bmi3_sig_motion_config  |
- *  Structure parameters    |                   Description
- * -------------------------|---------------------------------------------------
- *                          | Defines the duration after which the significant
- *  block_size              | motion interrupt is triggered. It is expressed in
- *                          | 50 Hz samples (20 ms). Default value is 0xFA=5sec.
- *--------------------------|---------------------------------------------------
- *                          | Minimum value of the peak to peak acceleration
- *  peak_2_peak_min         | magnitude. Default value 0x26 = 74.214mg, Range = 0 to 1023,
- *                          | Unit = 1.953mg
- *--------------------------|---------------------------------------------------
- *                          | Minimum number of mean crossing per second in accel
- *  mcr_min                 | magnitude. Default value = 17, Range = 0 to 63.
- *--------------------------|---------------------------------------------------
- *                          | Maximum value of the peak to peak acceleration
- *  peak_2_peak_max         | magnitude. Default value 0x253 = 1162.035mg, Range = 0 to 1023,
- *                          | Unit = 1.953mg
- *--------------------------|---------------------------------------------------
- *                          | Maximum number of mean crossing per second in accel
- *  mcr_max                 | magnitude. Default value = 17, Range = 0 to 63.
- *--------------------------|---------------------------------------------------
+ * @return BMI3_TRUE if the word can be cached, else BMI3_FALSE
  *
- * @return Result of API execution status
+ */
+static uint8_t shadow_cacheable(uint8_t page, uint16_t addr);
+
+/*!
+ * @brief This internal API drops all entries of the shadow cache.
  *
- * @return 0 -> Success
- * @return < 0 -> Fail
+ * @param[in] shadow   : Shadow cache
  *
  */
-static int8_t get_sig_motion_config(struct bmi3_sig_motion_config *config, struct bmi3_dev *dev);
-
-/*!
- * @brief This internal API sets sig-motion configurations like block-size,
- * peak_2_peak_min, mcr_min, peak_2_peak_max and mcr_max parameters.
- *
- * @param[in]      config    : Structure instance of bmi3_sig_motion_config.
- * @param[in, out]  dev      : Structure instance of bmi3_dev.
- *
- *----------------------------------------------------------------------------
- *  bmi3_sig_motion_config  |
- *  Structure parameters    |                   Description
- * -------------------------|---------------------------------------------------
- *                          | Defines the duration after which the significant
- *  block_size              | motion interrupt is triggered. It is expressed in
- *                          | 50 Hz samples (20 ms). Default value is 0xFA=5sec.
- *--------------------------|---------------------------------------------------
- *                          | Minimum value of the peak to peak acceleration
- *  peak_2_peak_min         | magnitude. Default value 0x26 = 74.214mg, Range = 0 to 1023,
- *                          | Unit = 1.953mg
- *--------------------------|---------------------------------------------------
- *                          | Minimum number of mean crossing per second in accel
- *  mcr_min                 | magnitude. Default value = 17, Range = 0 to 63.
- *--------------------------|---------------------------------------------------
- *                          | Maximum value of the peak to peak acceleration
- *  peak_2_peak_max         | magnitude. Default value 0x253 = 1162.035mg, Range = 0 to 1023,
- *                          | Unit = 1.953mg
- *--------------------------|---------------------------------------------------
- *                          | Maximum number of mean crossing per second in accel
- *  mcr_max                 | magnitude. Default value = 17, Range = 0 to 63.
- *--------------------------|---------------------------------------------------
+static void shadow_invalidate(struct bmi3_shadow *shadow);
+
+/*!
+ * @brief This internal API writes data to the given register address on the bus.
+ *
+ * @param[in] reg_addr : Register address
+ * @param[in] data     : Data to be written
+ * @param[in] len      : Number of bytes
+ * @param[in] dev      : Structure instance of bmi3_dev
  *
  * @return Result of API execution status
  *
@@ -744,14 +669,16 @@ static int8_t get_sig_motion_config(struct bmi3_sig_motion_config *config, struc
  * @return < 0 -> Fail
  *
  */
-static int8_t set_sig_motion_config(const struct bmi3_sig_motion_config *config, struct bmi3_dev *dev);
+static int8_t write_regs(uint8_t reg_addr, const uint8_t *data, uint16_t len, struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API gets the latch mode from register address
- *
- * @param[out]      int_cfg   : Structure instance of bmi3_int_pin_config.
- * @param[in, out]  dev       : Structure instance of bmi3_dev.
+ * @brief This internal API records a register write in the transaction queue,
+ * merging it with the previous write where the device sees the same result.
  *
+ * @param[in] reg_addr : Register address
+ * @param[in] data     : Data to be written
+ * @param[in] len      : Number of bytes
+ * @param[in] dev      : Structure instance of bmi3_dev
  *
  * @return Result of API execution status
  *
@@ -759,14 +686,13 @@ static int8_t set_sig_motion_config(const struct bmi3_sig_motion_config *config,
  * @return < 0 -> Fail
  *
  */
-static int8_t get_latch_mode(struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev);
+static int8_t queue_regs(uint8_t reg_addr, const uint8_t *data, uint16_t len, struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API sets the latch mode to register address
- *
- * @param[out]      int_cfg   : Structure instance of bmi3_int_pin_config.
- * @param[in, out]  dev       : Structure instance of bmi3_dev.
+ * @brief This internal API writes out the transaction queue in bursts of at most
+ * dev->read_write_len bytes.
  *
+ * @param[in] dev      : Structure instance of bmi3_dev
  *
  * @return Result of API execution status
  *
@@ -774,71 +700,23 @@ static int8_t get_latch_mode(struct bmi3_int_pin_config *int_cfg, struct bmi3_de
  * @return < 0 -> Fail
  *
  */
-static int8_t set_latch_mode(const struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev);
+static int8_t flush_batch(struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API gets tilt configurations like segment size, minimum tilt angle
- * and beta accel mean.
- *
- * @param[out]      config        : Structure instance of bmi3_tilt_config.
- * @param[in, out] dev            : Structure instance of bmi3_dev.
- *
- * @verbatim
- *----------------------------------------------------------------------------
- *  bmi3_tilt_config        |
- *  Structure parameters    |                   Description
- *------------------------- |--------------------------------------------------
- *                          | Duration for which the acceleration vector is
- *                          | averaged to be reference vector. Default value = 100, Range = 0
- *   segment size           | to 255, Unit = 20ms.
- * ------------------------ |---------------------------------------------------
- *                          | Minimum angle by which the device shall be
- *                          | tilted for event detection.
- *  minimum tilt angle      | Angle is computed as 256 * cos(angle).
- *                          | Default value = 210, Range = 0 to 255.
- * ------------------------ |---------------------------------------------------
- *                          | Exponential smoothing coefficient for
- *  beta accel mean         | computing low-pass mean of acceleration vector.
- *                          | Coefficient is computed as beta * 65536.
- *                          | Default value = 61545, Range = 0 to 65535.
- * ------------------------ |---------------------------------------------------
- * @endverbatim
- *
- * @return Result of API execution status
+ * @brief This internal API writes out the queued register writes before waiting, so that the
+ * device acts on them during the delay rather than after it.
  *
- * @return 0 -> Success
- * @return < 0 -> Fail
+ * @param[in] period   : Delay in microseconds
+ * @param[in] dev      : Structure instance of bmi3_dev
  *
  */
-static int8_t get_tilt_config(struct bmi3_tilt_config *config, struct bmi3_dev *dev);
-
-/*!
- * @brief This internal API sets tilt configurations like segment size, minimum tilt angle
- * and beta accel mean.
- *
- * @param[in]      config         : Structure instance of bmi3_tilt_config.
- * @param[in, out] dev            : Structure instance of bmi3_dev.
- *
- * @verbatim
- *----------------------------------------------------------------------------
- *  bmi3_tilt_config        |
- *  Structure parameters    |                   Description
- *------------------------- |--------------------------------------------------
- *                          | Duration for which the acceleration vector is
- *                          | averaged to be reference vector. Default value = 100, Range = 0
- *   segment size           | to 255, Unit = 20ms.
- * ------------------------ |---------------------------------------------------
- *                          | Minimum angle by which the device shall be
- *                          | tilted for event detection.
- *  minimum tilt angle      | Angle is computed as 256 * cos(angle).
- *                          | Default value = 210, Range = 0 to 255.
- * ------------------------ |---------------------------------------------------
- *                          | Exponential smoothing coefficient for
- *  beta accel mean         | computing low-pass mean of acceleration vector.
- *                          | Coefficient is computed as beta * 65536.
- *                          | Default value = 61545, Range = 0 to 65535.
- * ------------------------ |---------------------------------------------------
- * @endverbatim
+static void flush_and_delay(uint32_t period, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API is used to set the feature.
+ *
+ * @param[in] dev    : Structure instance of bmi3_dev.
+ * @param[in] enable : Structure instance of bmi3_feature_enable.
  *
  * @return Result of API execution status
  *
@@ -846,50 +724,13 @@ static int8_t get_tilt_config(struct bmi3_tilt_config *config, struct bmi3_dev *
  * @return < 0 -> Fail
  *
  */
-static int8_t set_tilt_config(const struct bmi3_tilt_config *config, struct bmi3_dev *dev);
-
-/*!
- * @brief This internal API gets orientation configurations like upside/down
- * enable, symmetrical modes, blocking mode, theta, hysteresis, slope threshold and
- * hold time configuration.
- *
- * @param[out]      config        : Structure instance of bmi3_orientation_config.
- * @param[in, out] dev            : Structure instance of bmi3_dev.
- *
- * @verbatim
- *-----------------------------------------------------------------------------
- *   bmi3_orientation_config|
- *   Structure parameters   |               Description
- *--------------------------|--------------------------------------------------
- *  upside/down             |  Enables upside/down detection, if set to 1.
- *  detection               |
- * -------------------------|---------------------------------------------------
- *                          | Sets the mode:
- *  mode                    | Values 0 or 3 - symmetrical.
- *                          | Value 1       - high asymmetrical
- *                          | Value 2       - low asymmetrical
- * -------------------------|---------------------------------------------------
- *                          | Enable - no orientation interrupt will be set.
- *  blocking                | Default value: 3, the most restrictive blocking.
- * -------------------------|---------------------------------------------------
- *                          | Threshold angle used in blocking mode.
- *  theta                   | Theta = 64 * (tan(angle)^2)
- *                          | Default value: 39, range 0 to 63.
- * -------------------------|---------------------------------------------------
- *                          | Hysteresis of acceleration in orientation change
- *  hysteresis              | change detection.
- *                          | Default value = 32, range 0 to 255, unit = 1.93mg.
- * -------------------------|---------------------------------------------------
- *                          | Minimum duration the device shall be in new orientation
- *  hold_time               | for change detection. default value = 5, range 0 to 255,
- *                          | unit = 20ms.
- * -------------------------|---------------------------------------------------
- *                          | Minimum slope between consecutive acceleration samples to
- *  slope_thres             | prevent the change of orientation during large movement.
- *                          | Default value = 205, range = 0 t0 255, uint = 1.953mg.
- * -------------------------|---------------------------------------------------
- *
- * @endverbatim
+static int8_t set_feature_enable(const struct bmi3_feature_enable *enable, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API is used to get the feature.
+ *
+ * @param[in] dev    : Structure instance of bmi3_dev.
+ * @param[in] enable : Structure instance of bmi3_feature_enable.
  *
  * @return Result of API execution status
  *
@@ -897,50 +738,16 @@ static int8_t set_tilt_config(const struct bmi3_tilt_config *config, struct bmi3
  * @return < 0 -> Fail
  *
  */
-static int8_t get_orientation_config(struct bmi3_orientation_config *config, struct bmi3_dev *dev);
-
-/*!
- * @brief This internal API sets orientation configurations like upside/down
- * enable, symmetrical modes, blocking mode, theta, hysteresis, slope threshold and
- * hold time configuration.
- *
- * @param[in]      config         : Structure instance of bmi3_orientation_config.
- * @param[in, out] dev            : Structure instance of bmi3_dev.
- *
- * @verbatim
- *-----------------------------------------------------------------------------
- *   bmi3_orientation_config|
- *   Structure parameters   |               Description
- *--------------------------|--------------------------------------------------
- *  upside/down             |  Enables upside/down detection, if set to 1.
- *  detection               |
- * -------------------------|---------------------------------------------------
- *                          | Sets the mode:
- *  mode                    | Values 0 or 3 - symmetrical.
- *                          | Value 1       - high asymmetrical
- *                          | Value 2       - low asymmetrical
- * -------------------------|---------------------------------------------------
- *                          | Enable - no orientation interrupt will be set.
- *  blocking                | Default value: 3, the most restrictive blocking.
- * -------------------------|---------------------------------------------------
- *                          | Threshold angle used in blocking mode.
- *  theta                   | Theta = 64 * (tan(angle)^2)
- *                          | Default value: 39, range 0 to 63.
- * -------------------------|---------------------------------------------------
- *                          | Hysteresis of acceleration in orientation change
- *  hysteresis              | change detection.
- *                          | Default value = 32, range 0 to 255, unit = 1.93mg.
- * -------------------------|---------------------------------------------------
- *                          | Minimum duration the device shall be in new orientation
- *  hold_time               | for change detection. default value = 5, range 0 to 255,
- *                          | unit = 20ms.
- * -------------------------|---------------------------------------------------
- *                          | Minimum slope between consecutive acceleration samples to
- *  slope_thres             | prevent the change of orientation during large movement.
- *                          | Default value = 205, range = 0 t0 255, uint = 1.953mg.
- * -------------------------|---------------------------------------------------
- *
- * @endverbatim
+static int8_t get_feature_enable(struct bmi3_feature_enable *enable, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API reads the words of a feature and unpacks its fields into the
+ * configuration structure, as described by bmi3_feature_fields.
+ *
+ * @param[in]  first_field : First field of the feature, e.g. BMI3_FIELD_ANY_MOTION_SLOPE_THRES.
+ * @param[in]  end_field   : First field after the feature.
+ * @param[out] config      : Configuration structure of the feature.
+ * @param[in]  dev         : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
  *
@@ -948,67 +755,33 @@ static int8_t get_orientation_config(struct bmi3_orientation_config *config, str
  * @return < 0 -> Fail
  *
  */
-static int8_t set_orientation_config(const struct bmi3_orientation_config *config, struct bmi3_dev *dev);
+static int8_t get_feature_config(uint8_t first_field, uint8_t end_field, void *config, struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API gets step counter/detector/activity configurations.
+ * @brief This internal API packs the fields of a configuration structure into the words of a
+ * feature, as described by bmi3_feature_fields, and writes all words of the feature.
  *
- * @param[out] config     : Structure instance of bmi3_step_counter_config.
+ * @param[in] first_field : First field of the feature, e.g. BMI3_FIELD_ANY_MOTION_SLOPE_THRES.
+ * @param[in] end_field   : First field after the feature.
+ * @param[in] config      : Configuration structure of the feature.
  * @param[in] dev         : Structure instance of bmi3_dev.
  *
- *---------------------------------------------------------------------------
- *  bmi3_step_counter_config|
- *  Structure parameters    |                 Description
- *--------------------------|--------------------------------------------------
- *                          | The Step-counter will trigger output every time
- *                          | the number of steps are counted. Holds implicitly
- *  water-mark level        | a 20x factor, so the range is 0 to 20460,
- *                          | with resolution of 20 steps. If 0 output disabled.
- * -------------------------|---------------------------------------------------
- *  reset counter           | Flag to reset the counted steps.
- * -------------------------|---------------------------------------------------
- *  step_counter_params     | 1 - 19 step_counter parameters for different settings.
- * -------------------------|---------------------------------------------------
- *                          | Switch between the devices.
- *                          | value 0 = Smart phone
- *  sc_12_res               | value 1 = Wrist wearable
- *                          | value 2 = Hearable
- * -------------------------|---------------------------------------------------
- * @endverbatim
- *
  * @return Result of API execution status
  *
  * @return 0 -> Success
  * @return < 0 -> Fail
  *
  */
-static int8_t get_step_config(struct bmi3_step_counter_config *config, struct bmi3_dev *dev);
+static int8_t set_feature_config(uint8_t first_field, uint8_t end_field, const void *config, struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API sets step counter/detector/activity configurations.
+ * @brief This internal API validates a list of fields and gets the range of feature engine
+ * words they span.
  *
- * @param[in] config      : Structure instance of bmi3_step_counter_config.
- * @param[in] dev         : Structure instance of bmi3_dev.
- *
- *---------------------------------------------------------------------------
- *  bmi3_step_counter_config|
- *  Structure parameters    |                 Description
- *--------------------------|--------------------------------------------------
- *                          | The Step-counter will trigger output every time
- *                          | the number of steps are counted. Holds implicitly
- *  water-mark level        | a 20x factor, so the range is 0 to 20460,
- *                          | with resolution of 20 steps. If 0 output disabled.
- * -------------------------|---------------------------------------------------
- *  reset counter           | Flag to reset the counted steps.
- * -------------------------|---------------------------------------------------
- *  step_counter_params     | 1 - 19 step_counter parameters for different settings.
- * -------------------------|---------------------------------------------------
- *                          | Switch between the devices.
- *                          | value 0 = Smart phone
- *  sc_12_res               | value 1 = Wrist wearable
- *                          | value 2 = Hearable
- * -------------------------|---------------------------------------------------
- * @endverbatim
+ * @param[in]  field_id   : List of fields, BMI3_FIELD_*.
+ * @param[in]  n_fields   : Number of fields.
+ * @param[out] first_addr : Feature engine address of the first word.
+ * @param[out] num_words  : Number of words.
  *
  * @return Result of API execution status
  *
@@ -1016,65 +789,25 @@ static int8_t get_step_config(struct bmi3_step_counter_config *config, struct bm
  * @return < 0 -> Fail
  *
  */
-static int8_t set_step_config(const struct bmi3_step_counter_config *config, struct bmi3_dev *dev);
+static int8_t get_field_span(const uint8_t *field_id, uint8_t n_fields, uint8_t *first_addr, uint8_t *num_words);
+
+/*!
+ * @brief This internal API gets the bits of a feature engine word that are covered by the fields
+ * of bmi3_feature_fields.
+ *
+ * @param[in] addr : Feature engine address of the word.
+ *
+ * @return Mask of the defined bits
+ *
+ */
+static uint16_t feature_word_mask(uint8_t addr);
 
 /*!
- * @brief This internal API gets wake-up configurations like axis sel, wait for time out,
- * max peaks for tap, mode, tap peaks threshold, max gesture duration, max dur between peaks,
- * tap_shock_settling_dur, min_quite_dur_between_taps, quite_time_after_gesture.
+ * @brief This internal API gets the latch mode from register address
  *
- * @param[out]      config    : Structure instance of bmi3_tap_detector_config.
+ * @param[out]      int_cfg   : Structure instance of bmi3_int_pin_config.
  * @param[in, out]  dev       : Structure instance of bmi3_dev.
  *
- * @verbatim
- *-----------------------------|------------------------------------------------
- *  bmi3_tap_detector_config   |
- *  Structure parameters       |               Description
- *-----------------------------|--------------------------------------------------
- *                             | Accelerometer sensing axis selection for tap
- *                             | detection. Default value = 2 (z-axis)
- *  axis_sel                   | Value  Name    Description
- *                             | 00    axis_x   Use x-axis for tap detection
- *                             | 01    axis_y   Use y-axis for tap detection
- *                             | 10    axis_z   Use z-axis for tap detection
- * ----------------------------|---------------------------------------------------
- *                             | Perform gesture confirmation with wait time
- *  wait_for_time_out          | set by max_gesture_dur. Default value = 1 (Enabled)
- * ----------------------------|---------------------------------------------------
- *                             | Maximum number of zero crossing expected
- *  max_peaks_for_tap          | around a tap. Default value = 6, Range = 0 to 7
- *                             |
- * ----------------------------|---------------------------------------------------
- *                             | Mode for detection of tap gesture. Default value = Normal.
- *  mode                       | In stable position of device, to improve detection accuracy,
- *                             | sensitive mode can be used.
- *                             | Under noisy scenarios, the false detection can be suppressed with Robust mode.
- *                             | Value    Name        Description
- *                             |  00     sensitive  Sensitive detection mode
- *                             |  01     normal     Normal detection mode
- *                             |  10     robust     Robust detection mode
- * ----------------------------|---------------------------------------------------
- *                             | Minimum threshold for peak resulting from the tap.
- *  tap_peak_threshold         | Default value 2d = 87.885mg, Range = 1997.919mg, Resolution = 1.953mg
- * ----------------------------|---------------------------------------------------
- *                             | Maximum duration from first tap within the
- *  max_gest_duration          | second and/or third tap is expected to happen.
- *                             | Default value = 16(640ms), Range = 2.520s Resolution = 40ms
- * ----------------------------|---------------------------------------------------
- *                             | Maximum duration between positive and negative peaks to tap.
- *  max_dur_between_peaks      |  Default value = 4(20ms), Range = 75ms, Resolution = 5ms
- * ----------------------------|---------------------------------------------------
- *                             | Maximum duration for which tap impact is observed.
- *  tap_shock_settling_dur     | Default value = 6(30ms), Range = 75ms, Resolution = 5ms
- * ----------------------------|---------------------------------------------------
- *                             | Minimum duration between two tap impact.
- *  min_quite_dur_between_taps | Default value = 8(40ms), Range = 1.2s, Resolution = 5ms.
- * ----------------------------|---------------------------------------------------
- *                             | Minimum quite duration between two gestures.
- *  quite_time_after_gesture   | Default value = 6(240ms), Range = 600ms , Resolution = 40ms.
- * ----------------------------|---------------------------------------------------
- *
- * @endverbatim
  *
  * @return Result of API execution status
  *
@@ -1082,65 +815,14 @@ static int8_t set_step_config(const struct bmi3_step_counter_config *config, str
  * @return < 0 -> Fail
  *
  */
-static int8_t get_tap_config(struct bmi3_tap_detector_config *config, struct bmi3_dev *dev);
-
-/*!
- * @brief This internal API sets wake-up configurations like axis sel, wait for time out,
- * max peaks for tap, mode, tap peaks threshold, max gesture duration, max dur between peaks,
- * tap_shock_settling_dur, min_quite_dur_between_taps, quite_time_after_gesture.
- *
- * @param[in]      config    : Structure instance of bmi3_tap_detector_config.
- * @param[in, out]  dev      : Structure instance of bmi3_dev.
- *
- * @verbatim
- *-----------------------------|------------------------------------------------
- *  bmi3_tap_detector_config   |
- *  Structure parameters       |               Description
- *-----------------------------|--------------------------------------------------
- *                             | Accelerometer sensing axis selection for tap
- *                             | detection. Default value = 2 (z-axis)
- *  axis_sel                   | Value  Name    Description
- *                             | 00    axis_x   Use x-axis for tap detection
- *                             | 01    axis_y   Use y-axis for tap detection
- *                             | 10    axis_z   Use z-axis for tap detection
- * ----------------------------|---------------------------------------------------
- *                             | Perform gesture confirmation with wait time
- *  wait_for_time_out          | set by max_gesture_dur. Default value = 1 (Enabled)
- * ----------------------------|---------------------------------------------------
- *                             | Maximum number of zero crossing expected
- *  max_peaks_for_tap          | around a tap. Default value = 6, Range = 0 to 7
- *                             |
- * ----------------------------|---------------------------------------------------
- *                             | Mode for detection of tap gesture. Default value = Normal.
- *  mode                       | In stable position of device, to improve detection accuracy,
- *                             | sensitive mode can be used.
- *                             | Under noisy scenarios, the false detection can be suppressed with Robust mode.
- *                             | Value    Name        Description
- *                             |  00     sensitive  Sensitive detection mode
- *                             |  01     normal     Normal detection mode
- *                             |  10     robust     Robust detection mode
- * ----------------------------|---------------------------------------------------
- *                             | Minimum threshold for peak resulting from the tap.
- *  tap_peak_threshold         | Default value 2d = 87.885mg, Range = 1997.919mg, Resolution = 1.953mg
- * ----------------------------|---------------------------------------------------
- *                             | Maximum duration from first tap within the
- *  max_gest_duration          | second and/or third tap is expected to happen.
- *                             | Default value = 16(640ms), Range = 2.520s Resolution = 40ms
- * ----------------------------|---------------------------------------------------
- *                             | Maximum duration between positive and negative peaks to tap.
- *  max_dur_between_peaks      |  Default value = 4(20ms), Range = 75ms, Resolution = 5ms
- * ----------------------------|---------------------------------------------------
- *                             | Maximum duration for which tap impact is observed.
- *  tap_shock_settling_dur     | Default value = 6(30ms), Range = 75ms, Resolution = 5ms
- * ----------------------------|---------------------------------------------------
- *                             | Minimum duration between two tap impact.
- *  min_quite_dur_between_taps | Default value = 8(40ms), Range = 1.2s, Resolution = 5ms.
- * ----------------------------|---------------------------------------------------
- *                             | Minimum quite duration between two gestures.
- *  quite_time_after_gesture   | Default value = 6(240ms), Range = 600ms , Resolution = 40ms.
- * ----------------------------|---------------------------------------------------
- *
- * @endverbatim
+static int8_t get_latch_mode(struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API sets the latch mode to register address
+ *
+ * @param[out]      int_cfg   : Structure instance of bmi3_int_pin_config.
+ * @param[in, out]  dev       : Structure instance of bmi3_dev.
+ *
  *
  * @return Result of API execution status
  *
@@ -1148,7 +830,7 @@ static int8_t get_tap_config(struct bmi3_tap_detector_config *config, struct bmi
  * @return < 0 -> Fail
  *
  */
-static int8_t set_tap_config(const struct bmi3_tap_detector_config *config, struct bmi3_dev *dev);
+static int8_t set_latch_mode(const struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev);
 
 /*!
  * @brief This internal API is used to parse accelerometer data from the FIFO
@@ -1242,6 +924,7 @@ static int8_t unpack_fifo_data_frame(void *fifo_data,
  */
 static void update_data_index(uint16_t *idx, uint16_t *updated_frm_idx, uint8_t len, int8_t rslt);
 
+#ifndef BMI3_SELF_TEST_DISABLE
 /*!
  * @brief This internal API sets the precondition settings such as alternate accelerometer and
  * gyroscope enable bits, accelerometer mode and output data rate.
@@ -1287,6 +970,7 @@ static int8_t get_set_st_dma(uint8_t st_selection, struct bmi3_dev *dev);
  *
  */
 static int8_t self_test_conditions(uint8_t st_selection, struct bmi3_dev *dev);
+#endif
 
 /*!
  * @brief This internal API is used to disable alternate config accel and gyro mode for self-test precondition.
@@ -1301,6 +985,7 @@ static int8_t self_test_conditions(uint8_t st_selection, struct bmi3_dev *dev);
  */
 static int8_t disable_alt_conf_acc_gyr_mode(struct bmi3_dev *dev);
 
+#ifndef BMI3_SELF_TEST_DISABLE
 /*!
  * @brief This internal API gets status of self-test and the result of self-test along with
  * the feature engine error status.
@@ -1317,6 +1002,43 @@ static int8_t disable_alt_conf_acc_gyr_mode(struct bmi3_dev *dev);
  */
 static int8_t get_st_status_rslt(uint8_t st_selection, struct bmi3_st_result *st_result_status, struct bmi3_dev *dev);
 
+/*!
+ * @brief This internal API prepares the self-test (gyro filter coefficients, self-test
+ * selection, accel configuration to restore) and triggers it.
+ *
+ * @param[in] st_selection : Variable denoting the self-test mode.
+ * @param[out] acc_cfg     : Accel configuration to restore after the self-test.
+ * @param[in] dev          : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
+ *
+ */
+static int8_t start_self_test(uint8_t st_selection, struct bmi3_accel_config *acc_cfg, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API reads the self-test status once and, if the self-test is
+ * complete, its result.
+ *
+ * @param[in] st_selection      : Variable denoting the self-test mode.
+ * @param[out] st_result_status : Structure instance of bmi3_st_result.
+ * @param[out] done             : BMI3_TRUE once the self-test is complete.
+ * @param[in] dev               : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
+ *
+ */
+static int8_t check_st_status(uint8_t st_selection,
+                              struct bmi3_st_result *st_result_status,
+                              uint8_t *done,
+                              struct bmi3_dev *dev);
+#endif
+
 /*!
  * @brief This internal API gets status of self-calibration and the result of self-calibration along with the feature
  * engine error status.
@@ -1332,6 +1054,41 @@ static int8_t get_st_status_rslt(uint8_t st_selection, struct bmi3_st_result *st
  */
 static int8_t get_sc_gyro_rslt(struct bmi3_self_calib_rslt *sc_rslt, struct bmi3_dev *dev);
 
+/*!
+ * @brief This internal API saves the accel configuration, sets the self-calibration
+ * preconditions and triggers the self-calibration.
+ *
+ * @param[in] sc_selection : Variable denoting the self-calibration mode.
+ * @param[in] apply_corr   : Variable choosing to apply correction.
+ * @param[out] get_config  : Accel configuration to restore after the self-calibration.
+ * @param[in] dev          : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
+ *
+ */
+static int8_t start_gyro_sc(uint8_t sc_selection,
+                            uint8_t apply_corr,
+                            struct bmi3_sens_config *get_config,
+                            struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API reads the self-calibration status and error status once.
+ *
+ * @param[out] sc_rslt : Structure instance of bmi3_self_calib_rslt.
+ * @param[out] done    : BMI3_TRUE once the self-calibration is complete.
+ * @param[in] dev      : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
+ *
+ */
+static int8_t check_sc_status(struct bmi3_self_calib_rslt *sc_rslt, uint8_t *done, struct bmi3_dev *dev);
+
 /*!
  * @brief This internal API gets and sets the self-calibration mode given
  *  by the user in the self-calibration dma register.
@@ -1348,6 +1105,7 @@ static int8_t get_sc_gyro_rslt(struct bmi3_self_calib_rslt *sc_rslt, struct bmi3
  */
 static int8_t get_set_sc_dma(uint8_t sc_selection, uint8_t apply_corr, struct bmi3_dev *dev);
 
+#ifndef BMI3_I3C_SYNC_DISABLE
 /*!
  * @brief This internal API gets the i3c sync accelerometer data from the register.
  *
@@ -1392,6 +1150,7 @@ static int8_t get_i3c_sync_gyro_sensor_data(struct bmi3_i3c_sync_data *data, str
  *
  */
 static int8_t get_i3c_sync_temp_data(struct bmi3_i3c_sync_data *data, struct bmi3_dev *dev);
+#endif
 
 /*!
  * @brief This internal API sets alternate accelerometer configurations like ODR,
@@ -1453,6 +1212,7 @@ static int8_t set_alternate_gyro_config(const struct bmi3_alt_gyro_config *confi
  */
 static int8_t get_alternate_gyro_config(struct bmi3_alt_gyro_config *config, struct bmi3_dev *dev);
 
+#ifndef BMI3_ALT_CONFIG_DISABLE
 /*!
  * @brief This internal API gets alternate auto configurations for feature interrupts
  *
@@ -1480,6 +1240,7 @@ static int8_t get_alternate_auto_config(struct bmi3_auto_config_change *config,
  *
  */
 static int8_t set_alternate_auto_config(const struct bmi3_auto_config_change *config, struct bmi3_dev *dev);
+#endif
 
 /*!
  * @brief This internal API is used to monitor the accel power mode during the axis remap.
@@ -1495,6 +1256,50 @@ static int8_t set_alternate_auto_config(const struct bmi3_auto_config_change *co
  */
 static int8_t axes_remap_acc_power_mode_status(struct bmi3_sens_config config, struct bmi3_dev *dev);
 
+/*!
+ * @brief This internal API writes the re-mapped axes to the feature engine.
+ *
+ * @param[in] remapped_axis : Structure instance of bmi3_axes_remap.
+ * @param[in] dev           : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
+ *
+ */
+static int8_t write_remap_axes(const struct bmi3_axes_remap remapped_axis, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API reads the feature engine error status once and reports whether
+ * the axis map update is complete.
+ *
+ * @param[out] done : BMI3_TRUE once the axis map update is complete.
+ * @param[in] dev   : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
+ *
+ */
+static int8_t check_axis_map_status(uint8_t *done, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API powers the accelerometer up again after the axis map update.
+ *
+ * @param[in] config : Accel configuration to restore.
+ * @param[in] dev    : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
+ *
+ */
+static int8_t restore_accel_after_remap(const struct bmi3_sens_config *config, struct bmi3_dev *dev);
+
+#ifndef BMI3_FOC_DISABLE
 /*!
  * @brief This internal API is used to verify the right position of the sensor before doing accel FOC
  *
@@ -1594,80 +1399,267 @@ static int8_t perform_accel_foc(const struct bmi3_accel_foc_g_value *accel_g_val
                                 struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API converts the range value into accelerometer
- * corresponding integer value.
+ * @brief This internal API checks the averaged sensor data against the FOC position given by the user.
  *
- * @param[in] range_in      : Input range value.
- * @param[out] range_out    : Stores the integer value of range.
+ * @param[in] sens_list         : Sensor type
+ * @param[in] accel_g_axis      : Accel Foc axis and sign input
+ * @param[in,out] temp_foc_data : Averaged sensor data
+ * @param[in] dev               : Structure instance of bmi3_dev
  *
- * @return None
- * @retval None
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
  */
-static void map_accel_range(uint8_t range_in, uint8_t *range_out);
+static int8_t validate_foc_average(uint8_t sens_list,
+                                   const struct bmi3_accel_foc_g_value *accel_g_axis,
+                                   struct bmi3_foc_temp_value *temp_foc_data,
+                                   struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API compensate the accelerometer data against gravity.
+ * @brief This internal API reads one sample of sensor data and adds it to the FOC sums.
  *
- * @param[in] lsb_per_g     : LSB value per 1g.
- * @param[in] g_val         : Gravity reference value of all axis.
- * @param[in] data          : Accelerometer data
- * @param[out] comp_data    : Stores the data that is compensated by taking the
- *                            difference in accelerometer data and lsb_per_g
- *                            value.
+ * @param[in] sens_list         : Sensor type
+ * @param[in,out] temp_foc_data : Sums of the data samples
+ * @param[in] dev               : Structure instance of bmi3_dev
  *
- * @return None
- * @retval None
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
  */
-static void comp_for_gravity(uint16_t lsb_per_g,
-                             const struct bmi3_accel_foc_g_value *g_val,
-                             const struct bmi3_sens_axes_data *data,
-                             struct bmi3_offset_delta *comp_data);
+static int8_t accumulate_foc_sample(uint8_t sens_list, struct bmi3_foc_temp_value *temp_foc_data, struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API scales the compensated accelerometer data according
- * to the offset register resolution.
+ * @brief This internal API computes the accel offsets from the summed FOC samples and
+ * writes them to the offset compensation registers.
  *
- * @param[in] range         : Gravity range of the accelerometer.
- * @param[out] comp_data    : Data that is compensated by taking the
- *                            difference in accelerometer data and lsb_per_g
- *                            value.
- * @param[out] data         : Stores accel offset data
+ * @param[in] accel_g_value : Accel FOC axis and sign
+ * @param[in] temp          : Sums of BMI3_FOC_SAMPLE_LIMIT accel samples
+ * @param[out] acc_cfg      : Accelerometer configuration value
  * @param[in] dev           : Structure instance of bmi3_dev.
  *
- * @return None
- * @retval None
- */
-static void scale_accel_offset(uint8_t range,
-                               const struct bmi3_offset_delta *comp_data,
-                               struct bmi3_acc_dp_gain_offset *data,
-                               const struct bmi3_dev *dev);
-
-/*!
- * @brief This internal API inverts the accelerometer offset data.
- *
- * @param[out] offset_data  : Stores the inverted offset data
+ * @return Result of API execution status
  *
- * @return None
- * @retval None
+ * @return 0 -> Success
+ * @return < 0 -> Fail
  */
-static void invert_accel_offset(struct bmi3_acc_dp_gain_offset *offset_data);
+static int8_t apply_accel_foc(const struct bmi3_accel_foc_g_value *accel_g_value,
+                              const struct bmi3_foc_temp_value *temp,
+                              struct bmi3_accel_config *acc_cfg,
+                              struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API is used to calculate the power of a value.
+ * @brief This internal API sets the accelerometer and FIFO configurations for the FIFO
+ * based accelerometer FOC and flushes the FIFO.
  *
- * @param[in] base          : Base for power calculation.
- * @param[in] resolution    : Exponent for power calculation.
+ * @param[in] dev : Structure instance of bmi3_dev.
  *
- * @return the calculated power
- * @retval the power value
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
  */
-static int32_t power(int16_t base, uint8_t resolution);
+static int8_t set_accel_foc_fifo_config(struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API sets the individual gyroscope
- * filter coefficients in the respective dma registers.
+ * @brief This internal API drains BMI3_FOC_SAMPLE_LIMIT accelerometer frames from the FIFO
+ * and sums them.
  *
- * @param[in] dev          : Structure instance of bmi3_dev.
+ * @param[out] temp : Sums of the accelerometer samples
+ * @param[in] dev   : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
+ */
+static int8_t get_accel_foc_fifo_samples(struct bmi3_foc_temp_value *temp, struct bmi3_dev *dev);
+#endif
+
+#ifndef BMI3_SELF_TEST_DISABLE
+/*!
+ * @brief This internal API advances the self-test by one status poll.
+ *
+ * @param[in,out] op : State of the operation
+ * @param[in] dev    : Structure instance of bmi3_dev
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Done
+ * @return BMI3_W_IN_PROGRESS -> Call again after op->wait_us
+ * @return < 0 -> Fail
+ */
+static int8_t step_self_test(struct bmi3_async_op *op, struct bmi3_dev *dev);
+#endif
+
+/*!
+ * @brief This internal API advances the gyro self-calibration by one status poll.
+ *
+ * @param[in,out] op : State of the operation
+ * @param[in] dev    : Structure instance of bmi3_dev
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Done
+ * @return BMI3_W_IN_PROGRESS -> Call again after op->wait_us
+ * @return < 0 -> Fail
+ */
+static int8_t step_gyro_sc(struct bmi3_async_op *op, struct bmi3_dev *dev);
+
+#ifndef BMI3_FOC_DISABLE
+/*!
+ * @brief This internal API advances the accel FOC by one data ready poll or sample.
+ *
+ * @param[in,out] op : State of the operation
+ * @param[in] dev    : Structure instance of bmi3_dev
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Done
+ * @return BMI3_W_IN_PROGRESS -> Call again after op->wait_us
+ * @return < 0 -> Fail
+ */
+static int8_t step_accel_foc(struct bmi3_async_op *op, struct bmi3_dev *dev);
+#endif
+
+/*!
+ * @brief This internal API advances the axis remap by one status poll.
+ *
+ * @param[in,out] op : State of the operation
+ * @param[in] dev    : Structure instance of bmi3_dev
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Done
+ * @return BMI3_W_IN_PROGRESS -> Call again after op->wait_us
+ * @return < 0 -> Fail
+ */
+static int8_t step_axes_remap(struct bmi3_async_op *op, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API reads the FIFO of one member of a device group into its ring
+ * and updates the statistics.
+ *
+ * @param[in,out] group  : Device group
+ * @param[in] index      : Index of the member
+ * @param[in] now_us     : Current time in microseconds
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return BMI3_W_FIFO_EMPTY -> No data
+ * @return < 0 -> Fail
+ */
+static int8_t drain_group_member(struct bmi3_dev_group *group, uint8_t index, uint64_t now_us);
+
+/*!
+ * @brief This internal API advances the long-running operation of one member of a device
+ * group if it is due.
+ *
+ * @param[in,out] group  : Device group
+ * @param[in] index      : Index of the member
+ * @param[in] now_us     : Current time in microseconds
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success, or nothing due
+ * @return < 0 -> Fail
+ */
+static int8_t step_group_member(struct bmi3_dev_group *group, uint8_t index, uint64_t now_us);
+
+/*!
+ * @brief This internal API computes the water-mark meeting the goal of the acquisition engine
+ * and writes it if it changed.
+ *
+ * @param[in,out] acq    : Acquisition engine
+ * @param[in] dev        : Structure instance of bmi3_dev
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
+ */
+static int8_t tune_acq_wm(struct bmi3_acq *acq, struct bmi3_dev *dev);
+
+#ifndef BMI3_FOC_DISABLE
+/*!
+ * @brief This internal API converts the range value into accelerometer
+ * corresponding integer value.
+ *
+ * @param[in] range_in      : Input range value.
+ * @param[out] range_out    : Stores the integer value of range.
+ *
+ * @return None
+ * @retval None
+ */
+static void map_accel_range(uint8_t range_in, uint8_t *range_out);
+
+/*!
+ * @brief This internal API compensate the accelerometer data against gravity.
+ *
+ * @param[in] lsb_per_g     : LSB value per 1g.
+ * @param[in] g_val         : Gravity reference value of all axis.
+ * @param[in] data          : Accelerometer data
+ * @param[out] comp_data    : Stores the data that is compensated by taking the
+ *                            difference in accelerometer data and lsb_per_g
+ *                            value.
+ *
+ * @return None
+ * @retval None
+ */
+static void comp_for_gravity(uint16_t lsb_per_g,
+                             const struct bmi3_accel_foc_g_value *g_val,
+                             const struct bmi3_sens_axes_data *data,
+                             struct bmi3_offset_delta *comp_data);
+
+/*!
+ * @brief This internal API scales the compensated accelerometer data according
+ * to the offset register resolution.
+ *
+ * @param[in] range         : Gravity range of the accelerometer.
+ * @param[out] comp_data    : Data that is compensated by taking the
+ *                            difference in accelerometer data and lsb_per_g
+ *                            value.
+ * @param[out] data         : Stores accel offset data
+ * @param[in] dev           : Structure instance of bmi3_dev.
+ *
+ * @return None
+ * @retval None
+ */
+static void scale_accel_offset(uint8_t range,
+                               const struct bmi3_offset_delta *comp_data,
+                               struct bmi3_acc_dp_gain_offset *data,
+                               const struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API inverts the accelerometer offset data.
+ *
+ * @param[out] offset_data  : Stores the inverted offset data
+ *
+ * @return None
+ * @retval None
+ */
+static void invert_accel_offset(struct bmi3_acc_dp_gain_offset *offset_data);
+
+/*!
+ * @brief This internal API is used to calculate the power of a value.
+ *
+ * @param[in] base          : Base for power calculation.
+ * @param[in] resolution    : Exponent for power calculation.
+ *
+ * @return the calculated power
+ * @retval the power value
+ */
+static int32_t power(int16_t base, uint8_t resolution);
+#endif
+
+#ifndef BMI3_SELF_TEST_DISABLE
+/*!
+ * @brief This internal API sets the individual gyroscope
+ * filter coefficients in the respective dma registers.
+ *
+ * @param[in] dev          : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
  *
@@ -1676,6 +1668,7 @@ static int32_t power(int16_t base, uint8_t resolution);
  *
  */
 static int8_t set_gyro_filter_coefficients(struct bmi3_dev *dev);
+#endif
 
 /*!
  * @brief This internal API check the data index for the fifo
@@ -1692,6 +1685,183 @@ static int8_t set_gyro_filter_coefficients(struct bmi3_dev *dev);
  */
 static int8_t check_data_index(uint16_t data_index, const struct bmi3_fifo_frame *fifo);
 
+/*!
+ * @brief This internal API returns the length of one headerless FIFO frame.
+ *
+ * @param[in] available_fifo_sens : FIFO frame configuration
+ *
+ * @return Frame length in bytes
+ */
+static uint16_t get_fifo_frame_length(uint16_t available_fifo_sens);
+
+/*!
+ * @brief This internal API gets the FIFO frame configuration, from the copy kept in the
+ * device structure if it is valid and from the sensor otherwise.
+ *
+ * @param[out] available_fifo_sens : FIFO frame configuration
+ * @param[in] dev                  : Structure instance of bmi3_dev
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
+ */
+static int8_t get_fifo_sens(uint16_t *available_fifo_sens, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API updates the copy of the FIFO configuration register kept in the
+ * device structure from a register write covering it, and drops it on a command.
+ *
+ * @param[in] reg_addr : Register address of the write
+ * @param[in] data     : Data written
+ * @param[in] len      : Number of bytes written
+ * @param[in,out] dev  : Structure instance of bmi3_dev
+ *
+ * @return None
+ */
+static void track_fifo_conf(uint8_t reg_addr, const uint8_t *data, uint16_t len, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API finds the end of the FIFO data in a read beyond the fill level.
+ * The end is the first frame of which all accelerometer and gyroscope words read as
+ * BMI3_FIFO_EMPTY_WORD.
+ *
+ * @param[in] data                : FIFO data without interface dummy bytes
+ * @param[in] length              : Number of bytes read, a multiple of the frame length
+ * @param[in] available_fifo_sens : FIFO frame configuration
+ *
+ * @return Number of bytes of FIFO data
+ */
+static uint16_t find_fifo_end(const uint8_t *data, uint16_t length, uint16_t available_fifo_sens);
+
+/*!
+ * @brief This internal API reads a little-endian word from FIFO data.
+ *
+ * @param[in] data : Pointer to the LSB of the word
+ *
+ * @return Word value
+ */
+static uint16_t get_fifo_word(const uint8_t *data);
+
+/*!
+ * @brief This internal API walks headerless FIFO frames once and demultiplexes
+ * accelerometer, gyroscope, temperature and sensor time data.
+ *
+ * @param[in] data                : FIFO data without interface dummy bytes
+ * @param[in] length              : Number of FIFO bytes
+ * @param[in] available_fifo_sens : FIFO frame configuration
+ * @param[in,out] demux           : Output arrays and callback, the frames are
+ *                                 appended to the ones already counted
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return > 0 -> Warning
+ *
+ */
+static int8_t demux_fifo_frames(const uint8_t *data,
+                                uint16_t length,
+                                uint16_t available_fifo_sens,
+                                struct bmi3_fifo_demux *demux);
+
+/*!
+ * @brief This internal API clears the frame counters of the FIFO demultiplexer.
+ *
+ * @param[out] demux : Output arrays and callback
+ *
+ * @return None
+ */
+static void reset_fifo_demux(struct bmi3_fifo_demux *demux);
+
+/*!
+ * @brief This internal API returns the anchor of the FIFO timestamp reconstruction
+ * extended to 64 bits.
+ *
+ * @param[in] sync : Timestamp reconstruction state
+ *
+ * @return Unwrapped sensor time of the anchor
+ */
+static uint64_t get_unwrapped_anchor(const struct bmi3_fifo_time_sync *sync);
+
+/*!
+ * @brief This internal API returns the number of FIFO data bytes following the
+ * interface dummy bytes, bounded by the FIFO fill level if it is known.
+ *
+ * @param[in] fifo : Structure instance of bmi3_fifo_frame
+ * @param[in] dev  : Structure instance of bmi3_dev
+ *
+ * @return Number of FIFO bytes
+ */
+static uint16_t get_fifo_data_length(const struct bmi3_fifo_frame *fifo, const struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API deinterleaves the axes of one sensor from headerless
+ * FIFO frames into struct-of-arrays buffers, including dummy frames.
+ *
+ * @param[in] data        : FIFO data without interface dummy bytes
+ * @param[in] length      : Number of FIFO bytes
+ * @param[in] stride      : Frame length in bytes
+ * @param[in] offset      : Byte offset of the sensor in a frame
+ * @param[in] time_offset : Byte offset of the sensor time in a frame, 0 if not present
+ * @param[in] dummy_frame : Dummy frame marker of the sensor
+ * @param[in,out] soa     : Output buffers
+ *
+ * @return None
+ */
+static void decode_fifo_axes(const uint8_t *data,
+                             uint16_t length,
+                             uint16_t stride,
+                             uint16_t offset,
+                             uint16_t time_offset,
+                             uint16_t dummy_frame,
+                             struct bmi3_fifo_axes_soa *soa);
+
+/*!
+ * @brief This internal API extracts the non-dummy frames of one sensor from FIFO data
+ * into struct-of-arrays buffers.
+ *
+ * @param[in,out] soa   : Output buffers
+ * @param[in] sensor    : BMI3_FIFO_HEAD_LESS_ACC_FRM or BMI3_FIFO_HEAD_LESS_GYR_FRM
+ * @param[in] fifo      : Structure instance of bmi3_fifo_frame
+ * @param[in] dev       : Structure instance of bmi3_dev
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return > 0 -> Warning
+ * @return < 0 -> Fail
+ *
+ */
+static int8_t extract_axes_soa(struct bmi3_fifo_axes_soa *soa,
+                               uint16_t sensor,
+                               const struct bmi3_fifo_frame *fifo,
+                               const struct bmi3_dev *dev);
+
+#if defined(BMI3_FIFO_SIMD_SSE2) || defined(BMI3_FIFO_SIMD_NEON)
+
+/*!
+ * @brief This internal API deinterleaves BMI3_FIFO_SIMD_FRAMES headerless FIFO
+ * frames with vector instructions.
+ *
+ * @param[in] data        : First frame of the block, at least 16 readable bytes per frame
+ * @param[in] stride      : Frame length in bytes
+ * @param[in] offset      : Byte offset of the sensor in a frame
+ * @param[in] time_offset : Byte offset of the sensor time in a frame, 0 if not present
+ * @param[in] dummy_frame : Dummy frame marker of the sensor
+ * @param[in] idx         : Index of the first frame in the output buffers
+ * @param[in,out] soa     : Output buffers
+ *
+ * @return None
+ */
+static void decode_fifo_block(const uint8_t *data,
+                              uint16_t stride,
+                              uint16_t offset,
+                              uint16_t time_offset,
+                              uint16_t dummy_frame,
+                              uint16_t idx,
+                              struct bmi3_fifo_axes_soa *soa);
+#endif
+
 /*!
  * @brief This internal API is used to validate ODR and AVG combinations for accel
  *
@@ -1748,6 +1918,7 @@ static int8_t validate_gyr_odr_avg(uint8_t gyr_odr, uint8_t gyr_avg);
  */
 static int8_t gyro_skipped_samples_check(float odr, float avg);
 
+#ifndef BMI3_ENHANCED_FLEXIBILITY_DISABLE
 /*!
  * @brief This internal API writes the command register value to enable cfg res.
  *
@@ -1777,6 +1948,7 @@ static int8_t config_array_set_value_one_page(struct bmi3_dev *dev);
 /*!
  * @brief This internal API writes the config array in cfg res.
  *
+ * @param[in,out] upload    : Upload options and statistics, may be NULL.
  * @param[in,out] dev       : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
@@ -1785,13 +1957,15 @@ static int8_t config_array_set_value_one_page(struct bmi3_dev *dev);
  * @return < 0 -> Fail
  *
  */
-static int8_t write_config_array(struct bmi3_dev *dev);
+static int8_t write_config_array(struct bmi3_config_upload *upload, struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API writes config array.
+ * @brief This internal API writes config array. The base address is set once and the data
+ * is streamed through the auto-incrementing data port in bursts of dev->read_write_len bytes.
  *
  * @param[in] config_array  : Pointer variable to store config array.
  * @param[in] config_size   : Variable to store size of config array.
+ * @param[in,out] upload    : Upload options and statistics, may be NULL.
  * @param[in,out] dev       : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
@@ -1800,13 +1974,18 @@ static int8_t write_config_array(struct bmi3_dev *dev);
  * @return < 0 -> Fail
  *
  */
-static int8_t load_config_array(const uint8_t *config_array, uint16_t config_size, struct bmi3_dev *dev);
+static int8_t load_config_array(const uint8_t *config_array,
+                                uint16_t config_size,
+                                struct bmi3_config_upload *upload,
+                                struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API writes config array.
+ * @brief This internal API reads back a config array from the feature engine and compares
+ * it with the array written.
  *
  * @param[in] config_array  : Pointer variable to store config array.
  * @param[in] config_size   : Variable to store size of config array.
+ * @param[in,out] upload    : Upload options and statistics.
  * @param[in,out] dev       : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
@@ -1815,11 +1994,16 @@ static int8_t load_config_array(const uint8_t *config_array, uint16_t config_siz
  * @return < 0 -> Fail
  *
  */
-static int8_t upload_file(uint16_t config_base_addr, const uint8_t *config_array, uint16_t indx, struct bmi3_dev *dev);
+static int8_t verify_config_array(const uint8_t *config_array,
+                                  uint16_t config_size,
+                                  struct bmi3_config_upload *upload,
+                                  struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API writes config version array to feature engine register.
+ * @brief This internal API unlocks the config page and writes the config array, config
+ * array table and config version.
  *
+ * @param[in,out] upload    : Upload options and statistics, may be NULL.
  * @param[in,out] dev       : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
@@ -1828,7 +2012,8 @@ static int8_t upload_file(uint16_t config_base_addr, const uint8_t *config_array
  * @return < 0 -> Fail
  *
  */
-static int8_t write_config_version(struct bmi3_dev *dev);
+static int8_t enhanced_flexibility_upload(struct bmi3_config_upload *upload, struct bmi3_dev *dev);
+#endif
 
 /******************************************************************************/
 /*!  @name      User Interface Definitions                            */
@@ -1852,6 +2037,12 @@ int8_t bmi3_init(struct bmi3_dev *dev)
     if (rslt == BMI3_OK)
     {
         dev->chip_id = 0;
+        dev->batch = NULL;
+        dev->shadow = NULL;
+        dev->lock = NULL;
+        dev->unlock = NULL;
+        dev->lock_ctx = NULL;
+        dev->fifo_conf_valid = BMI3_FALSE;
 
         /* An extra dummy byte is read during SPI read */
         if (dev->intf == BMI3_SPI_INTF)
@@ -1909,39 +2100,23 @@ int8_t bmi3_get_regs(uint8_t reg_addr, uint8_t *data, uint16_t len, struct bmi3_
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to define temporary buffer */
-    uint8_t temp_buf[BMI3_MAX_LEN];
-
-    /* Variable to define loop */
-    uint16_t index = 0;
-
     /* Null-pointer check */
     rslt = null_ptr_check(dev);
 
     if ((rslt == BMI3_OK) && (data != NULL))
     {
-        /* Configuring reg_addr for SPI Interface */
-        if (dev->intf == BMI3_SPI_INTF)
-        {
-            reg_addr = (reg_addr | BMI3_SPI_RD_MASK);
-        }
+        lock_dev(dev);
 
-        dev->intf_rslt = dev->read(reg_addr, temp_buf, len + dev->dummy_byte, dev->intf_ptr);
-        dev->delay_us(2, dev->intf_ptr);
-
-        if (dev->intf_rslt == BMI3_INTF_RET_SUCCESS)
+        if (dev->shadow != NULL)
         {
-            /* Read the data from the position next to dummy byte */
-            while (index < len)
-            {
-                data[index] = temp_buf[index + dev->dummy_byte];
-                index++;
-            }
+            rslt = shadow_get_regs(reg_addr, data, len, dev);
         }
         else
         {
-            rslt = BMI3_E_COM_FAIL;
+            rslt = read_regs(reg_addr, data, len, dev);
         }
+
+        unlock_dev(dev);
     }
     else
     {
@@ -1964,19 +2139,27 @@ int8_t bmi3_set_regs(uint8_t reg_addr, const uint8_t *data, uint16_t len, struct
 
     if ((rslt == BMI3_OK) && (data != NULL))
     {
-        /* Configuring reg_addr for SPI Interface */
-        if (dev->intf == BMI3_SPI_INTF)
+        lock_dev(dev);
+
+        if (dev->shadow != NULL)
         {
-            reg_addr = (reg_addr & BMI3_SPI_WR_MASK);
+            rslt = shadow_set_regs(reg_addr, data, len, dev);
+        }
+        else
+        {
+            rslt = send_regs(reg_addr, data, len, dev);
         }
 
-        dev->intf_rslt = dev->write(reg_addr, data, len, dev->intf_ptr);
-        dev->delay_us(2, dev->intf_ptr);
-
-        if (dev->intf_rslt != BMI3_INTF_RET_SUCCESS)
+        if (rslt == BMI3_OK)
         {
-            rslt = BMI3_E_COM_FAIL;
+            track_fifo_conf(reg_addr, data, len, dev);
+        }
+        else
+        {
+            dev->fifo_conf_valid = BMI3_FALSE;
         }
+
+        unlock_dev(dev);
     }
     else
     {
@@ -1987,136 +2170,120 @@ int8_t bmi3_set_regs(uint8_t reg_addr, const uint8_t *data, uint16_t len, struct
 }
 
 /*!
- * @brief This API resets bmi3 sensor. All registers are overwritten with
- * their default values.
+ * @brief This API starts recording register writes in a transaction queue.
  */
-int8_t bmi3_soft_reset(struct bmi3_dev *dev)
+int8_t bmi3_batch_begin(struct bmi3_batch *batch, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to read the dummy byte */
-    uint8_t dummy_byte[2] = { 0 };
-
-    /* Variable to store feature data array */
-    uint8_t feature_data[2] = { 0x2c, 0x01 };
-
-    /* Variable to enable feature engine bit */
-    uint8_t feature_engine_en[2] = { BMI3_ENABLE, 0 };
-
-    /* Variable to store status value for feature engine enable */
-    uint8_t reg_data[2] = { 0 };
-
-    /* Array variable to store feature IO status */
-    uint8_t feature_io_status[2] = { BMI3_ENABLE, 0 };
-
-    uint8_t loop = 1;
-
     /* Null-pointer check */
     rslt = null_ptr_check(dev);
 
-    if (rslt == BMI3_OK)
+    if ((rslt == BMI3_OK) && (batch != NULL))
     {
-        /* Reset bmi3 device */
-        rslt = bmi3_set_command_register(BMI3_CMD_SOFT_RESET, dev);
-        dev->delay_us(BMI3_SOFT_RESET_DELAY, dev->intf_ptr);
-
-        /* Performing a dummy read after a soft-reset */
-        if ((rslt == BMI3_OK) && (dev->intf == BMI3_SPI_INTF))
-        {
-            rslt = bmi3_get_regs(BMI3_REG_CHIP_ID, dummy_byte, 2, dev);
-        }
-
-        /* Enabling Feature engine */
-        if (rslt == BMI3_OK)
-        {
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_IO2, feature_data, 2, dev);
-        }
+        lock_dev(dev);
 
-        if (rslt == BMI3_OK)
+        /* Writes queued in a previous batch go out first */
+        if (dev->batch != NULL)
         {
-            /* Enabling feature status bit */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_IO_STATUS, feature_io_status, 2, dev);
+            rslt = flush_batch(dev);
         }
 
         if (rslt == BMI3_OK)
         {
-            /* Enable feature engine bit */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_CTRL, feature_engine_en, 2, dev);
+            batch->num_ops = 0;
+            batch->data_len = 0;
+            batch->feature_addr_valid = BMI3_FALSE;
+            batch->write_count = 0;
+            batch->burst_count = 0;
+            dev->batch = batch;
         }
 
-        if (rslt == BMI3_OK)
-        {
-            /* Checking the status bit for feature engine enable */
-            while (loop <= 10)
-            {
-                dev->delay_us(100000, dev->intf_ptr);
+        unlock_dev(dev);
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
-                rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO1, reg_data, 2, dev);
+    return rslt;
+}
 
-                if (rslt == BMI3_OK)
-                {
-                    if (reg_data[0] & BMI3_FEATURE_ENGINE_ENABLE_MASK)
-                    {
-                        rslt = BMI3_OK;
+/*!
+ * @brief This API writes out the queued register writes and keeps queuing.
+ */
+int8_t bmi3_batch_flush(struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-                        break;
-                    }
-                    else
-                    {
-                        rslt = BMI3_E_FEATURE_ENGINE_STATUS;
-                    }
-                }
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-                loop++;
-            }
-        }
+    if ((rslt == BMI3_OK) && (dev->batch != NULL))
+    {
+        lock_dev(dev);
+        rslt = flush_batch(dev);
+        unlock_dev(dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API writes the available sensor specific commands to the sensor.
+ * @brief This API writes out the queued register writes and stops queuing.
  */
-int8_t bmi3_set_command_register(uint16_t command, struct bmi3_dev *dev)
+int8_t bmi3_batch_end(struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array variable to store command value */
-    uint8_t reg_data[2] = { 0 };
-
-    reg_data[0] = (uint8_t)(command & BMI3_SET_LOW_BYTE);
-    reg_data[1] = (uint8_t)((command & BMI3_SET_HIGH_BYTE) >> 8);
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-    /* Set the command in the command register */
-    rslt = bmi3_set_regs(BMI3_REG_CMD, reg_data, 2, dev);
+    if ((rslt == BMI3_OK) && (dev->batch != NULL))
+    {
+        lock_dev(dev);
+        rslt = flush_batch(dev);
+        dev->batch = NULL;
+        unlock_dev(dev);
+    }
 
     return rslt;
 }
 
 /*!
- * @brief This API gets the interrupt 1 status of both feature and data
- * interrupts
+ * @brief This API serves register reads from a write-through shadow cache.
  */
-int8_t bmi3_get_int1_status(uint16_t *int_status, struct bmi3_dev *dev)
+int8_t bmi3_shadow_enable(struct bmi3_shadow *shadow, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to store data */
-    uint8_t data_array[2] = { 0 };
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-    if (int_status != NULL)
+    if ((rslt == BMI3_OK) && (shadow != NULL))
     {
-        /* Get the interrupt status */
-        rslt = bmi3_get_regs(BMI3_REG_INT_STATUS_INT1, data_array, 2, dev);
+        lock_dev(dev);
+
+        /* A deferred feature engine address of the previous cache goes out first */
+        if (dev->shadow != NULL)
+        {
+            rslt = shadow_sync_port(dev);
+        }
 
         if (rslt == BMI3_OK)
         {
-            *int_status = (uint16_t)(data_array[0] | ((uint16_t)data_array[1] << 8));
+            shadow_invalidate(shadow);
+            shadow->user_page = BMI3_TRUE;
+            shadow->hits = 0;
+            shadow->misses = 0;
+            dev->shadow = shadow;
         }
+
+        unlock_dev(dev);
     }
     else
     {
@@ -2127,87 +2294,65 @@ int8_t bmi3_get_int1_status(uint16_t *int_status, struct bmi3_dev *dev)
 }
 
 /*!
- * @brief This API gets the interrupt 2 status of both feature and data
- * interrupts
+ * @brief This API stops using the shadow cache.
  */
-int8_t bmi3_get_int2_status(uint16_t *int_status, struct bmi3_dev *dev)
+int8_t bmi3_shadow_disable(struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to store data */
-    uint8_t data_array[2] = { 0 };
-
-    if (int_status != NULL)
-    {
-        /* Get the interrupt status */
-        rslt = bmi3_get_regs(BMI3_REG_INT_STATUS_INT2, data_array, 2, dev);
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-        if (rslt == BMI3_OK)
-        {
-            *int_status = (uint16_t)(data_array[0] | ((uint16_t)data_array[1] << 8));
-        }
-    }
-    else
+    if ((rslt == BMI3_OK) && (dev->shadow != NULL))
     {
-        rslt = BMI3_E_NULL_PTR;
+        lock_dev(dev);
+        rslt = shadow_sync_port(dev);
+        dev->shadow = NULL;
+        unlock_dev(dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API gets the re-mapped x, y and z axes from the sensor and
- * updates the values in the device structure.
- *
- * @note: XYZ axis denotes x = x, y = y, z = z
- * Similarly,
- *    YXZ, x = y, y = x, z = z
- *
+ * @brief This API drops all entries of the shadow cache.
  */
-int8_t bmi3_get_remap_axes(struct bmi3_axes_remap *remapped_axis, struct bmi3_dev *dev)
+int8_t bmi3_shadow_invalidate(struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array variable to get remapped axis data */
-    uint8_t remap_data[4];
-
-    /* Array variable to store base address of remap axis data */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_AXIS_REMAP, 0 };
-
-    /* Variable to store axis remap data */
-    uint8_t reg_data;
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-    if (remapped_axis != NULL)
+    if ((rslt == BMI3_OK) && (dev->shadow != NULL))
     {
-        /* Set the configuration to feature engine register */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
-
-        if (rslt == BMI3_OK)
-        {
-            /* Get the configuration from the feature engine register where axis
-             * re-mapping feature resides
-             */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, remap_data, 4, dev);
-
-            if (rslt == BMI3_OK)
-            {
-                reg_data = remap_data[0];
+        lock_dev(dev);
+        rslt = shadow_sync_port(dev);
+        shadow_invalidate(dev->shadow);
+        unlock_dev(dev);
+    }
 
-                /* Get the re-mapped axis */
-                remapped_axis->axis_map = BMI3_GET_BIT_POS0(reg_data, BMI3_XYZ_AXIS);
+    return rslt;
+}
 
-                /* Get the re-mapped x-axis polarity */
-                remapped_axis->invert_x = BMI3_GET_BITS(reg_data, BMI3_X_AXIS_SIGN);
+/*!
+ * @brief This API sets the lock hooks that serialize the accesses to the device.
+ */
+int8_t bmi3_lock_enable(bmi3_lock_fptr_t lock, bmi3_lock_fptr_t unlock, void *lock_ctx, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-                /* Get the re-mapped y-axis polarity */
-                remapped_axis->invert_y = BMI3_GET_BITS(reg_data, BMI3_Y_AXIS_SIGN);
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-                /* Get the re-mapped z-axis polarity */
-                remapped_axis->invert_z = BMI3_GET_BITS(reg_data, BMI3_Z_AXIS_SIGN);
-            }
-        }
+    if ((rslt == BMI3_OK) && (lock != NULL) && (unlock != NULL))
+    {
+        dev->lock_ctx = lock_ctx;
+        dev->lock = lock;
+        dev->unlock = unlock;
     }
     else
     {
@@ -2218,142 +2363,86 @@ int8_t bmi3_get_remap_axes(struct bmi3_axes_remap *remapped_axis, struct bmi3_de
 }
 
 /*!
- * @brief This API sets the re-mapped x, y and z axes to the sensor and
- * updates them in the device structure.
+ * @brief This API removes the lock hooks.
  */
-int8_t bmi3_set_remap_axes(const struct bmi3_axes_remap remapped_axis, struct bmi3_dev *dev)
+int8_t bmi3_lock_disable(struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Structure instance of sensor config */
-    struct bmi3_sens_config config = { 0 };
-
-    /* Variable to set the re-mapped axes in the sensor */
-    uint8_t axis_map;
-
-    /* Variable to set the re-mapped x-axes sign in the sensor */
-    uint8_t invert_x;
-
-    /* Variable to set the re-mapped y-axes sign in the sensor */
-    uint8_t invert_y;
-
-    /* Variable to set the re-mapped z-axes sign in the sensor */
-    uint8_t invert_z;
-
-    /* Variable to define the register address */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_AXIS_REMAP, 0 };
-
-    /* Array variable to get remapped axis data */
-    uint8_t remap_data[4];
-
-    /* Set the configuration to feature engine register */
-    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
     if (rslt == BMI3_OK)
     {
-        /* Set the value of re-mapped axis */
-        axis_map = remapped_axis.axis_map & BMI3_XYZ_AXIS_MASK;
-
-        /* Set the value of re-mapped x-axis sign */
-        invert_x = ((remapped_axis.invert_x << BMI3_X_AXIS_SIGN_POS) & BMI3_X_AXIS_SIGN_MASK);
-
-        /* Set the value of re-mapped y-axis sign */
-        invert_y = ((remapped_axis.invert_y << BMI3_Y_AXIS_SIGN_POS) & BMI3_Y_AXIS_SIGN_MASK);
+        dev->lock = NULL;
+        dev->unlock = NULL;
+        dev->lock_ctx = NULL;
+    }
 
-        /* Set the value of re-mapped z-axis sign */
-        invert_z = ((remapped_axis.invert_z << BMI3_Z_AXIS_SIGN_POS) & BMI3_Z_AXIS_SIGN_MASK);
+    return rslt;
+}
 
-        remap_data[0] = (axis_map | invert_x | invert_y | invert_z);
+/*!
+ * @brief This API takes the lock of the device to make a sequence of API calls atomic.
+ */
+int8_t bmi3_dev_lock(struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-        /* Set the configuration back to the page */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, remap_data, 2, dev);
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-        if (rslt == BMI3_OK)
-        {
-            rslt = axes_remap_acc_power_mode_status(config, dev);
-        }
+    if (rslt == BMI3_OK)
+    {
+        lock_dev(dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API sets the sensor/feature configuration.
+ * @brief This API releases the lock taken by bmi3_dev_lock.
  */
-int8_t bmi3_set_sensor_config(struct bmi3_sens_config *sens_cfg, uint8_t n_sens, struct bmi3_dev *dev)
+int8_t bmi3_dev_unlock(struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to define loop */
-    uint8_t loop;
-
     /* Null-pointer check */
     rslt = null_ptr_check(dev);
 
-    if ((rslt == BMI3_OK) && (sens_cfg != NULL))
+    if (rslt == BMI3_OK)
     {
-        for (loop = 0; loop < n_sens; loop++)
-        {
-            switch (sens_cfg[loop].type)
-            {
-                case BMI3_ACCEL:
-                    rslt = set_accel_config(&sens_cfg[loop].cfg.acc, dev);
-                    break;
+        unlock_dev(dev);
+    }
 
-                case BMI3_GYRO:
-                    rslt = set_gyro_config(&sens_cfg[loop].cfg.gyr, dev);
-                    break;
-
-                case BMI3_ANY_MOTION:
-                    rslt = set_any_motion_config(&sens_cfg[loop].cfg.any_motion, dev);
-                    break;
-
-                case BMI3_NO_MOTION:
-                    rslt = set_no_motion_config(&sens_cfg[loop].cfg.no_motion, dev);
-                    break;
-
-                case BMI3_SIG_MOTION:
-                    rslt = set_sig_motion_config(&sens_cfg[loop].cfg.sig_motion, dev);
-                    break;
-
-                case BMI3_FLAT:
-                    rslt = set_flat_config(&sens_cfg[loop].cfg.flat, dev);
-                    break;
-
-                case BMI3_TILT:
-                    rslt = set_tilt_config(&sens_cfg[loop].cfg.tilt, dev);
-                    break;
-
-                case BMI3_ORIENTATION:
-                    rslt = set_orientation_config(&sens_cfg[loop].cfg.orientation, dev);
-                    break;
-
-                case BMI3_STEP_COUNTER:
-                    rslt = set_step_config(&sens_cfg[loop].cfg.step_counter, dev);
-                    break;
-
-                case BMI3_TAP:
-                    rslt = set_tap_config(&sens_cfg[loop].cfg.tap, dev);
-                    break;
-
-                case BMI3_ALT_ACCEL:
-                    rslt = set_alternate_accel_config(&sens_cfg[loop].cfg.alt_acc, dev);
-                    break;
-
-                case BMI3_ALT_GYRO:
-                    rslt = set_alternate_gyro_config(&sens_cfg[loop].cfg.alt_gyr, dev);
-                    break;
+    return rslt;
+}
 
-                case BMI3_ALT_AUTO_CONFIG:
-                    rslt = set_alternate_auto_config(&sens_cfg[loop].cfg.alt_auto_cfg, dev);
-                    break;
+/*!
+ * @brief This API initializes a single-producer/single-consumer ring of FIFO frames.
+ */
+int8_t bmi3_sample_ring_init(struct bmi3_sample_ring *ring, struct bmi3_fifo_frame_sample *buf, uint16_t size)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
 
-                default:
-                    rslt = BMI3_E_INVALID_SENSOR;
-                    break;
-            }
+    if ((ring != NULL) && (buf != NULL))
+    {
+        /* Free-running 16-bit indices need a power of 2 size of at most half their range */
+        if ((size == 0) || (size > UINT16_C(32768)) || ((size & (size - 1)) != 0))
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+        else
+        {
+            ring->buf = buf;
+            ring->size = size;
+            ring->head = 0;
+            ring->tail = 0;
+            ring->dropped = 0;
         }
     }
     else
@@ -2365,81 +2454,36 @@ int8_t bmi3_set_sensor_config(struct bmi3_sens_config *sens_cfg, uint8_t n_sens,
 }
 
 /*!
- * @brief This API gets the sensor/feature configuration.
+ * @brief This API adds a frame to the ring. Called by the producer thread only.
  */
-int8_t bmi3_get_sensor_config(struct bmi3_sens_config *sens_cfg, uint8_t n_sens, struct bmi3_dev *dev)
+int8_t bmi3_sample_ring_push(struct bmi3_sample_ring *ring, const struct bmi3_fifo_frame_sample *sample)
 {
     /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Variable to define loop */
-    uint8_t loop = 0;
+    int8_t rslt = BMI3_OK;
 
-    /* Null-pointer check */
-    rslt = null_ptr_check(dev);
+    /* Variable to store the producer index */
+    uint16_t head;
 
-    if ((rslt == BMI3_OK) && (sens_cfg != NULL))
+    if ((ring != NULL) && (sample != NULL))
     {
-        for (loop = 0; loop < n_sens; loop++)
-        {
-            switch (sens_cfg[loop].type)
-            {
-                case BMI3_ACCEL:
-                    rslt = get_accel_config(&sens_cfg[loop].cfg.acc, dev);
-                    break;
-
-                case BMI3_GYRO:
-                    rslt = get_gyro_config(&sens_cfg[loop].cfg.gyr, dev);
-                    break;
-
-                case BMI3_ANY_MOTION:
-                    rslt = get_any_motion_config(&sens_cfg[loop].cfg.any_motion, dev);
-                    break;
-
-                case BMI3_NO_MOTION:
-                    rslt = get_no_motion_config(&sens_cfg[loop].cfg.no_motion, dev);
-                    break;
-
-                case BMI3_SIG_MOTION:
-                    rslt = get_sig_motion_config(&sens_cfg[loop].cfg.sig_motion, dev);
-                    break;
-
-                case BMI3_FLAT:
-                    rslt = get_flat_config(&sens_cfg[loop].cfg.flat, dev);
-                    break;
-
-                case BMI3_TILT:
-                    rslt = get_tilt_config(&sens_cfg[loop].cfg.tilt, dev);
-                    break;
-
-                case BMI3_ORIENTATION:
-                    rslt = get_orientation_config(&sens_cfg[loop].cfg.orientation, dev);
-                    break;
-
-                case BMI3_STEP_COUNTER:
-                    rslt = get_step_config(&sens_cfg[loop].cfg.step_counter, dev);
-                    break;
-
-                case BMI3_TAP:
-                    rslt = get_tap_config(&sens_cfg[loop].cfg.tap, dev);
-                    break;
+        head = ring->head;
 
-                case BMI3_ALT_ACCEL:
-                    rslt = get_alternate_accel_config(&sens_cfg[loop].cfg.alt_acc, dev);
-                    break;
+        if ((uint16_t)(head - ring->tail) >= ring->size)
+        {
+            ring->dropped++;
+            rslt = BMI3_W_RING_FULL;
+        }
+        else
+        {
+            /* The slot was released by the consumer before it advanced tail */
+            BMI3_MEMORY_BARRIER();
 
-                case BMI3_ALT_GYRO:
-                    rslt = get_alternate_gyro_config(&sens_cfg[loop].cfg.alt_gyr, dev);
-                    break;
+            ring->buf[head & (ring->size - 1)] = *sample;
 
-                case BMI3_ALT_AUTO_CONFIG:
-                    rslt = get_alternate_auto_config(&sens_cfg[loop].cfg.alt_auto_cfg, dev);
-                    break;
+            /* The frame has to be visible before the consumer sees the new head */
+            BMI3_MEMORY_BARRIER();
 
-                default:
-                    rslt = BMI3_E_INVALID_SENSOR;
-                    break;
-            }
+            ring->head = (uint16_t)(head + 1);
         }
     }
     else
@@ -2451,79 +2495,61 @@ int8_t bmi3_get_sensor_config(struct bmi3_sens_config *sens_cfg, uint8_t n_sens,
 }
 
 /*!
- * @brief This API maps/un-maps data interrupts to that of interrupt pins.
+ * @brief This API adds a frame to the ring given as cb_ctx, to be used as frame_cb of
+ * bmi3_fifo_demux.
  */
-int8_t bmi3_map_interrupt(struct bmi3_map_int map_int, struct bmi3_dev *dev)
+void bmi3_sample_ring_push_cb(const struct bmi3_fifo_frame_sample *sample, void *cb_ctx)
+{
+    (void)bmi3_sample_ring_push((struct bmi3_sample_ring *)cb_ctx, sample);
+}
+
+/*!
+ * @brief This API takes up to max_samples frames from the ring. Called by the consumer thread only.
+ */
+int8_t bmi3_sample_ring_pop(struct bmi3_sample_ring *ring,
+                            struct bmi3_fifo_frame_sample *samples,
+                            uint16_t max_samples,
+                            uint16_t *num_samples)
 {
     /* Variable to store result of API */
-    int8_t rslt;
+    int8_t rslt = BMI3_OK;
 
-    /* Variable to store register data */
-    uint8_t reg_data[4] = { 0 };
+    /* Variable to store the consumer index */
+    uint16_t tail;
 
-    uint16_t no_motion_out, any_motion_out, flat_out, orientation_out, step_detector_out, step_counter_out,
-             sig_motion_out, tilt_out;
-    uint16_t tap_out, i3c_out, err_status, temp, gyr, acc, fwm, ffull;
+    /* Variable to store the number of frames available */
+    uint16_t avail;
 
-    /* Read interrupt map1 and map2 and register */
-    rslt = bmi3_get_regs(BMI3_REG_INT_MAP1, reg_data, 4, dev);
+    /* Variable to define loop */
+    uint16_t index;
 
-    if (rslt == BMI3_OK)
+    if ((ring != NULL) && (samples != NULL) && (num_samples != NULL))
     {
-        no_motion_out =
-            (BMI3_SET_BIT_POS0(reg_data[0], BMI3_NO_MOTION_OUT, map_int.no_motion_out) & BMI3_NO_MOTION_OUT_MASK);
-        any_motion_out =
-            (BMI3_SET_BITS(reg_data[0], BMI3_ANY_MOTION_OUT, map_int.any_motion_out) & BMI3_ANY_MOTION_OUT_MASK);
-        flat_out = (BMI3_SET_BITS(reg_data[0], BMI3_FLAT_OUT, map_int.flat_out) & BMI3_FLAT_OUT_MASK);
-        orientation_out =
-            (BMI3_SET_BITS(reg_data[0], BMI3_ORIENTATION_OUT, map_int.orientation_out) & BMI3_ORIENTATION_OUT_MASK);
-        step_detector_out =
-            (BMI3_SET_BITS(reg_data[1], BMI3_STEP_DETECTOR_OUT,
-                           map_int.step_detector_out) & BMI3_STEP_DETECTOR_OUT_MASK);
-        step_counter_out =
-            (BMI3_SET_BITS(reg_data[1], BMI3_STEP_COUNTER_OUT, map_int.step_counter_out) & BMI3_STEP_COUNTER_OUT_MASK);
-        sig_motion_out =
-            (BMI3_SET_BITS(reg_data[1], BMI3_SIG_MOTION_OUT, map_int.sig_motion_out) & BMI3_SIG_MOTION_OUT_MASK);
-        tilt_out = (BMI3_SET_BITS(reg_data[1], BMI3_TILT_OUT, map_int.tilt_out) & BMI3_TILT_OUT_MASK);
-
-        reg_data[0] = (uint8_t)(no_motion_out | any_motion_out | flat_out | orientation_out);
-        reg_data[1] = (uint8_t)((step_detector_out | step_counter_out | sig_motion_out | tilt_out) >> 8);
-
-        tap_out = (BMI3_SET_BIT_POS0(reg_data[2], BMI3_TAP_OUT, map_int.tap_out) & BMI3_TAP_OUT_MASK);
-        i3c_out = (BMI3_SET_BITS(reg_data[2], BMI3_I3C_OUT, map_int.i3c_out) & BMI3_I3C_OUT_MASK);
-        err_status = (BMI3_SET_BITS(reg_data[2], BMI3_ERR_STATUS, map_int.err_status) & BMI3_ERR_STATUS_MASK);
-        temp = (BMI3_SET_BITS(reg_data[2], BMI3_TEMP_DRDY_INT, map_int.temp_drdy_int) & BMI3_TEMP_DRDY_INT_MASK);
-        gyr = (BMI3_SET_BITS(reg_data[3], BMI3_GYR_DRDY_INT, map_int.gyr_drdy_int) & BMI3_GYR_DRDY_INT_MASK);
-        acc = (BMI3_SET_BITS(reg_data[3], BMI3_ACC_DRDY_INT, map_int.acc_drdy_int) & BMI3_ACC_DRDY_INT_MASK);
-        fwm =
-            (BMI3_SET_BITS(reg_data[3], BMI3_FIFO_WATERMARK_INT,
-                           map_int.fifo_watermark_int) & BMI3_FIFO_WATERMARK_INT_MASK);
-        ffull = (BMI3_SET_BITS(reg_data[3], BMI3_FIFO_FULL_INT, map_int.fifo_full_int) & BMI3_FIFO_FULL_INT_MASK);
+        tail = ring->tail;
+        avail = (uint16_t)(ring->head - tail);
 
-        reg_data[2] = (uint8_t)(tap_out | i3c_out | err_status | temp);
-        reg_data[3] = (uint8_t)((gyr | acc | fwm | ffull) >> 8);
+        if (avail > max_samples)
+        {
+            avail = max_samples;
+        }
 
-        rslt = bmi3_set_regs(BMI3_REG_INT_MAP1, reg_data, 4, dev);
-    }
+        /* The frames are read after the head that published them */
+        BMI3_MEMORY_BARRIER();
 
-    return rslt;
-}
+        for (index = 0; index < avail; index++)
+        {
+            samples[index] = ring->buf[(uint16_t)(tail + index) & (ring->size - 1)];
+        }
 
-/*!
- * @brief This API selects the sensors/features to be enabled or disabled.
- */
-int8_t bmi3_select_sensor(struct bmi3_feature_enable *enable, struct bmi3_dev *dev)
-{
-    /* Variable to store result of API */
-    int8_t rslt;
+        /* The frames have to be copied out before the producer may reuse their slots */
+        BMI3_MEMORY_BARRIER();
 
-    if (enable != NULL)
-    {
-        rslt = set_feature_enable(enable, dev);
+        ring->tail = (uint16_t)(tail + avail);
+        *num_samples = avail;
 
-        if (rslt == BMI3_OK)
+        if (avail == 0)
         {
-            rslt = get_feature_enable(enable, dev);
+            rslt = BMI3_W_RING_EMPTY;
         }
     }
     else
@@ -2535,122 +2561,158 @@ int8_t bmi3_select_sensor(struct bmi3_feature_enable *enable, struct bmi3_dev *d
 }
 
 /*!
- * @brief This API gets the sensor/feature data for accelerometer, gyroscope,
- * step counter, orientation, i3c sync accel, i3c sync gyro and i3c sync temperature.
+ * @brief This API resets bmi3 sensor. All registers are overwritten with
+ * their default values.
  */
-int8_t bmi3_get_sensor_data(struct bmi3_sensor_data *sensor_data, uint8_t n_sens, struct bmi3_dev *dev)
+int8_t bmi3_soft_reset(struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to define loop */
-    uint8_t loop;
-
-    /* Null-pointer check */
-    rslt = null_ptr_check(dev);
+    /* Variable to read the dummy byte */
+    uint8_t dummy_byte[2] = { 0 };
 
-    if ((rslt == BMI3_OK) && (sensor_data != NULL))
-    {
-        for (loop = 0; loop < n_sens; loop++)
-        {
-            switch (sensor_data[loop].type)
-            {
-                case BMI3_ACCEL:
-                    rslt = get_accel_sensor_data(&sensor_data[loop].sens_data.acc, BMI3_REG_ACC_DATA_X, dev);
-                    break;
+    /* Variable to store feature data array */
+    uint8_t feature_data[2] = { 0x2c, 0x01 };
 
-                case BMI3_GYRO:
-                    rslt = get_gyro_sensor_data(&sensor_data[loop].sens_data.gyr, BMI3_REG_GYR_DATA_X, dev);
-                    break;
+    /* Variable to enable feature engine bit */
+    uint8_t feature_engine_en[2] = { BMI3_ENABLE, 0 };
 
-                case BMI3_STEP_COUNTER:
-                    rslt = get_step_counter_sensor_data(&sensor_data[loop].sens_data.step_counter_output,
-                                                        BMI3_REG_FEATURE_IO2,
-                                                        dev);
-                    break;
+    /* Variable to store status value for feature engine enable */
+    uint8_t reg_data[2] = { 0 };
 
-                case BMI3_ORIENTATION:
-                    rslt = get_orient_output_data(&sensor_data[loop].sens_data.orient_output,
-                                                  BMI3_REG_FEATURE_EVENT_EXT,
-                                                  dev);
-                    break;
+    /* Array variable to store feature IO status */
+    uint8_t feature_io_status[2] = { BMI3_ENABLE, 0 };
 
-                case BMI3_I3C_SYNC_ACCEL:
-                    rslt = get_i3c_sync_accel_sensor_data(&sensor_data[loop].sens_data.i3c_sync, dev);
-                    break;
+    /* Variable to store the current poll interval */
+    uint32_t poll_us = BMI3_FEATURE_ENGINE_POLL_MIN_US;
 
-                case BMI3_I3C_SYNC_GYRO:
-                    rslt = get_i3c_sync_gyro_sensor_data(&sensor_data[loop].sens_data.i3c_sync, dev);
-                    break;
+    /* Variable to store the time waited since the soft-reset command */
+    uint32_t waited_us = BMI3_SOFT_RESET_DELAY;
 
-                case BMI3_I3C_SYNC_TEMP:
-                    rslt = get_i3c_sync_temp_data(&sensor_data[loop].sens_data.i3c_sync, dev);
-                    break;
+    /* Variable to store the feature engine readiness */
+    uint8_t ready = BMI3_FALSE;
 
-                default:
-                    rslt = BMI3_E_INVALID_SENSOR;
-                    break;
-            }
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-            /* Return error if any of the get sensor data fails */
-            if (rslt != BMI3_OK)
-            {
-                break;
-            }
-        }
-    }
-    else
+    if (rslt == BMI3_OK)
     {
-        rslt = BMI3_E_NULL_PTR;
-    }
+        /* Nothing else may access the device until it is up again */
+        lock_dev(dev);
 
-    return rslt;
-}
+        dev->feature_ready_us = 0;
 
-/*!
- *  @brief This API reads the error status from the sensor.
- */
-int8_t bmi3_get_error_status(struct bmi3_err_reg *err_reg, struct bmi3_dev *dev)
-{
-    /* Variable to store result of API */
-    int8_t rslt;
+        /* The FIFO configuration goes back to its default */
+        dev->fifo_conf_valid = BMI3_FALSE;
 
-    /* Array variable to get error status from register */
-    uint8_t data[2] = { 0 };
+        /* Reset bmi3 device */
+        rslt = bmi3_set_command_register(BMI3_CMD_SOFT_RESET, dev);
+        flush_and_delay(BMI3_SOFT_RESET_DELAY, dev);
 
-    uint16_t reg_data;
+        /* Performing a dummy read after a soft-reset */
+        if ((rslt == BMI3_OK) && (dev->intf == BMI3_SPI_INTF))
+        {
+            rslt = bmi3_get_regs(BMI3_REG_CHIP_ID, dummy_byte, 2, dev);
+        }
 
-    if (err_reg != NULL)
-    {
-        /* Read the error codes */
-        rslt = bmi3_get_regs(BMI3_REG_ERR_REG, data, 2, dev);
+        /* Enabling Feature engine */
+        if (rslt == BMI3_OK)
+        {
+            rslt = bmi3_set_regs(BMI3_REG_FEATURE_IO2, feature_data, 2, dev);
+        }
 
         if (rslt == BMI3_OK)
         {
-            reg_data = data[0];
+            /* Enabling feature status bit */
+            rslt = bmi3_set_regs(BMI3_REG_FEATURE_IO_STATUS, feature_io_status, 2, dev);
+        }
 
-            /* Fatal error */
-            err_reg->fatal_err = BMI3_GET_BIT_POS0(reg_data, BMI3_FATAL_ERR);
+        if (rslt == BMI3_OK)
+        {
+            /* Enable feature engine bit */
+            rslt = bmi3_set_regs(BMI3_REG_FEATURE_CTRL, feature_engine_en, 2, dev);
+        }
 
-            /* Interrupt request overrun error */
-            err_reg->feat_eng_ovrld = BMI3_GET_BITS(reg_data, BMI3_FEAT_ENG_OVRLD);
+        if (rslt == BMI3_OK)
+        {
+            /* Checking the status bit for feature engine enable, backing off exponentially */
+            do
+            {
+                flush_and_delay(poll_us, dev);
+                waited_us += poll_us;
 
-            /* Indicates watch cell code */
-            err_reg->feat_eng_wd = BMI3_GET_BITS(reg_data, BMI3_FEAT_ENG_WD);
+                rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO1, reg_data, 2, dev);
 
-            /* Indicates accel configuration error */
-            err_reg->acc_conf_err = BMI3_GET_BITS(reg_data, BMI3_ACC_CONF_ERR);
+                if (rslt == BMI3_OK)
+                {
+                    if (reg_data[0] & BMI3_FEATURE_ENGINE_ENABLE_MASK)
+                    {
+                        ready = BMI3_TRUE;
+                        dev->feature_ready_us = waited_us;
+                    }
+                    else
+                    {
+                        rslt = BMI3_E_FEATURE_ENGINE_STATUS;
+                    }
+                }
 
-            /* Indicates gyro configuration error */
-            err_reg->gyr_conf_err = BMI3_GET_BITS(reg_data, BMI3_GYR_CONF_ERR);
+                poll_us = poll_us * 2;
 
-            reg_data = data[1];
+                if (poll_us > BMI3_FEATURE_ENGINE_POLL_MAX_US)
+                {
+                    poll_us = BMI3_FEATURE_ENGINE_POLL_MAX_US;
+                }
+            } while ((ready == BMI3_FALSE) &&
+                     (waited_us < (BMI3_SOFT_RESET_DELAY + BMI3_FEATURE_ENGINE_READY_TIMEOUT_US)));
+        }
 
-            /* Indicates SDR parity error */
-            err_reg->i3c_error0 = BMI3_GET_BITS(reg_data, BMI3_I3C_ERROR0);
+        unlock_dev(dev);
+    }
 
-            /* Indicates I3C error */
-            err_reg->i3c_error3 = BMI3_GET_BITS(reg_data, BMI3_I3C_ERROR3);
+    return rslt;
+}
+
+/*!
+ * @brief This API writes the available sensor specific commands to the sensor.
+ */
+int8_t bmi3_set_command_register(uint16_t command, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array variable to store command value */
+    uint8_t reg_data[2] = { 0 };
+
+    reg_data[0] = (uint8_t)(command & BMI3_SET_LOW_BYTE);
+    reg_data[1] = (uint8_t)((command & BMI3_SET_HIGH_BYTE) >> 8);
+
+    /* Set the command in the command register */
+    rslt = bmi3_set_regs(BMI3_REG_CMD, reg_data, 2, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the interrupt 1 status of both feature and data
+ * interrupts
+ */
+int8_t bmi3_get_int1_status(uint16_t *int_status, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to store data */
+    uint8_t data_array[2] = { 0 };
+
+    if (int_status != NULL)
+    {
+        /* Get the interrupt status */
+        rslt = bmi3_get_regs(BMI3_REG_INT_STATUS_INT1, data_array, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            *int_status = (uint16_t)(data_array[0] | ((uint16_t)data_array[1] << 8));
         }
     }
     else
@@ -2662,28 +2724,25 @@ int8_t bmi3_get_error_status(struct bmi3_err_reg *err_reg, struct bmi3_dev *dev)
 }
 
 /*!
- *  @brief This API reads the feature engine error status from the sensor.
+ * @brief This API gets the interrupt 2 status of both feature and data
+ * interrupts
  */
-int8_t bmi3_get_feature_engine_error_status(uint8_t *feature_engine_err_reg_lsb,
-                                            uint8_t *feature_engine_err_reg_msb,
-                                            struct bmi3_dev *dev)
+int8_t bmi3_get_int2_status(uint16_t *int_status, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array variable to get error status from register */
-    uint8_t data[2];
+    /* Array to store data */
+    uint8_t data_array[2] = { 0 };
 
-    if ((feature_engine_err_reg_lsb != NULL) && (feature_engine_err_reg_msb != NULL))
+    if (int_status != NULL)
     {
-        /* Read the feature engine error codes */
-        rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO1, data, 2, dev);
+        /* Get the interrupt status */
+        rslt = bmi3_get_regs(BMI3_REG_INT_STATUS_INT2, data_array, 2, dev);
 
         if (rslt == BMI3_OK)
         {
-            *feature_engine_err_reg_lsb = data[0];
-
-            *feature_engine_err_reg_msb = data[1];
+            *int_status = (uint16_t)(data_array[0] | ((uint16_t)data_array[1] << 8));
         }
     }
     else
@@ -2695,94 +2754,57 @@ int8_t bmi3_get_feature_engine_error_status(uint8_t *feature_engine_err_reg_lsb,
 }
 
 /*!
- * @brief This API sets:
- *        1) The output configuration of the selected interrupt pin:
- *           INT1 or INT2.
- *        2) The interrupt mode: permanently latched or non-latched.
+ * @brief This API gets the re-mapped x, y and z axes from the sensor and
+ * updates the values in the device structure.
+ *
+ * @note: XYZ axis denotes x = x, y = y, z = z
+ * Similarly,
+ *    YXZ, x = y, y = x, z = z
+ *
  */
-int8_t bmi3_set_int_pin_config(const struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev)
+int8_t bmi3_get_remap_axes(struct bmi3_axes_remap *remapped_axis, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to define data array */
-    uint8_t data_array[3] = { 0 };
-
-    /* Variable to store register data */
-    uint16_t reg_data = 0;
-
-    /* Variable to define type of interrupt pin  */
-    uint8_t int_pin = 0;
+    /* Array variable to get remapped axis data */
+    uint8_t remap_data[4];
 
-    uint16_t lvl, od, output_en;
+    /* Array variable to store base address of remap axis data */
+    uint8_t base_addr[2] = { BMI3_BASE_ADDR_AXIS_REMAP, 0 };
 
-    /* Null-pointer check */
-    rslt = null_ptr_check(dev);
+    /* Variable to store axis remap data */
+    uint8_t reg_data;
 
-    if ((rslt == BMI3_OK) && (int_cfg != NULL))
+    if (remapped_axis != NULL)
     {
-        /* Copy the pin type to a local variable */
-        int_pin = int_cfg->pin_type;
+        /* Set the configuration to feature engine register */
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
 
-        if ((int_pin > BMI3_INT_NONE) && (int_pin < BMI3_INT_PIN_MAX))
+        if (rslt == BMI3_OK)
         {
-            /* Get the previous configuration data */
-            rslt = bmi3_get_regs(BMI3_REG_IO_INT_CTRL, data_array, 2, dev);
+            /* Get the configuration from the feature engine register where axis
+             * re-mapping feature resides
+             */
+            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, remap_data, 4, dev);
 
             if (rslt == BMI3_OK)
             {
-                /* Set interrupt pin 1 configuration */
-                if (int_pin == BMI3_INT1)
-                {
-                    reg_data = data_array[0];
-
-                    /* Configure active low or high */
-                    lvl = BMI3_SET_BIT_POS0(reg_data, BMI3_INT1_LVL, int_cfg->pin_cfg[0].lvl);
-
-                    /* Configure push-pull or open drain */
-                    od = BMI3_SET_BITS(reg_data, BMI3_INT1_OD, int_cfg->pin_cfg[0].od);
-
-                    /* Configure output enable */
-                    output_en = BMI3_SET_BITS(reg_data, BMI3_INT1_OUTPUT_EN, int_cfg->pin_cfg[0].output_en);
-
-                    /* Copy the data to be written in the respective array */
-                    data_array[0] = (uint8_t)(lvl | od | output_en);
-                }
-
-                /* Set interrupt pin 2 configuration */
-                if (int_pin == BMI3_INT2)
-                {
-                    reg_data = ((uint16_t)data_array[1] << 8);
-
-                    /* Configure active low or high */
-                    lvl = BMI3_SET_BITS(reg_data, BMI3_INT2_LVL, int_cfg->pin_cfg[1].lvl);
-
-                    /* Configure push-pull or open drain */
-                    od = BMI3_SET_BITS(reg_data, BMI3_INT2_OD, int_cfg->pin_cfg[1].od);
+                reg_data = remap_data[0];
 
-                    /* Configure output enable */
-                    output_en = BMI3_SET_BITS(reg_data, BMI3_INT2_OUTPUT_EN, int_cfg->pin_cfg[1].output_en);
+                /* Get the re-mapped axis */
+                remapped_axis->axis_map = BMI3_GET_BIT_POS0(reg_data, BMI3_XYZ_AXIS);
 
-                    /* Copy the data to be written in the respective array */
-                    data_array[1] = (uint8_t)((lvl | od | output_en) >> 8);
-                }
+                /* Get the re-mapped x-axis polarity */
+                remapped_axis->invert_x = BMI3_GET_BITS(reg_data, BMI3_X_AXIS_SIGN);
 
-                /* Set the configurations simultaneously as
-                 * INT1_IO_CTRL, INT2_IO_CTRL, and INT_LATCH lie
-                 * in consecutive addresses
-                 */
-                rslt = bmi3_set_regs(BMI3_REG_IO_INT_CTRL, data_array, 2, dev);
+                /* Get the re-mapped y-axis polarity */
+                remapped_axis->invert_y = BMI3_GET_BITS(reg_data, BMI3_Y_AXIS_SIGN);
 
-                if (rslt == BMI3_OK)
-                {
-                    rslt = set_latch_mode(int_cfg, dev);
-                }
+                /* Get the re-mapped z-axis polarity */
+                remapped_axis->invert_z = BMI3_GET_BITS(reg_data, BMI3_Z_AXIS_SIGN);
             }
         }
-        else
-        {
-            rslt = BMI3_E_INVALID_INT_PIN;
-        }
     }
     else
     {
@@ -2793,63 +2815,136 @@ int8_t bmi3_set_int_pin_config(const struct bmi3_int_pin_config *int_cfg, struct
 }
 
 /*!
- * @brief This API gets:
- *        1) The output configuration of the selected interrupt pin:
- *           INT1 or INT2.
- *        2) The interrupt mode: permanently latched or non-latched.
+ * @brief This API sets the re-mapped x, y and z axes to the sensor and
+ * updates them in the device structure.
  */
-int8_t bmi3_get_int_pin_config(struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev)
+int8_t bmi3_set_remap_axes(const struct bmi3_axes_remap remapped_axis, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to define data array */
-    uint8_t data_array[3] = { 0 };
-
-    /* Variable to define type of interrupt pin  */
-    uint8_t int_pin = 0;
+    /* Structure instance of sensor config */
+    struct bmi3_sens_config config = { 0 };
 
-    uint16_t reg_data;
+    /* Set the re-mapped axes in the feature engine */
+    rslt = write_remap_axes(remapped_axis, dev);
 
-    if (int_cfg != NULL)
+    if (rslt == BMI3_OK)
     {
-        /* Copy the pin type to a local variable */
-        int_pin = int_cfg->pin_type;
+        rslt = axes_remap_acc_power_mode_status(config, dev);
+    }
 
-        /* Get the previous configuration data */
-        rslt = bmi3_get_regs(BMI3_REG_IO_INT_CTRL, data_array, 3, dev);
+    return rslt;
+}
 
-        if (rslt == BMI3_OK)
+/*!
+ * @brief This API sets the sensor/feature configuration.
+ */
+int8_t bmi3_set_sensor_config(struct bmi3_sens_config *sens_cfg, uint8_t n_sens, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to define loop */
+    uint8_t loop;
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (sens_cfg != NULL))
+    {
+        for (loop = 0; loop < n_sens; loop++)
         {
-            /* Get interrupt pin 1 configuration */
-            if (int_pin == BMI3_INT1)
+            switch (sens_cfg[loop].type)
             {
-                /* Get active low or high */
-                int_cfg->pin_cfg[0].lvl = BMI3_GET_BIT_POS0(data_array[0], BMI3_INT1_LVL);
+                case BMI3_ACCEL:
+                    rslt = set_accel_config(&sens_cfg[loop].cfg.acc, dev);
+                    break;
 
-                /* Get push-pull or open drain */
-                int_cfg->pin_cfg[0].od = BMI3_GET_BITS(data_array[0], BMI3_INT1_OD);
+                case BMI3_GYRO:
+                    rslt = set_gyro_config(&sens_cfg[loop].cfg.gyr, dev);
+                    break;
 
-                /* Get output enable */
-                int_cfg->pin_cfg[0].output_en = BMI3_GET_BITS(data_array[0], BMI3_INT1_OUTPUT_EN);
-            }
+                case BMI3_ANY_MOTION:
+                    rslt = set_feature_config(BMI3_FIELD_ANY_MOTION_SLOPE_THRES,
+                                              BMI3_FIELD_NO_MOTION_SLOPE_THRES,
+                                              &sens_cfg[loop].cfg.any_motion,
+                                              dev);
+                    break;
 
-            /* Get interrupt pin 2 configuration */
-            if (int_pin == BMI3_INT2)
-            {
-                reg_data = ((uint16_t)data_array[1] << 8);
+                case BMI3_NO_MOTION:
+                    rslt = set_feature_config(BMI3_FIELD_NO_MOTION_SLOPE_THRES,
+                                              BMI3_FIELD_FLAT_THETA,
+                                              &sens_cfg[loop].cfg.no_motion,
+                                              dev);
+                    break;
 
-                /* Get active low or high */
-                int_cfg->pin_cfg[1].lvl = BMI3_GET_BITS(reg_data, BMI3_INT2_LVL);
+                case BMI3_SIG_MOTION:
+                    rslt = set_feature_config(BMI3_FIELD_SIG_MOTION_BLOCK_SIZE,
+                                              BMI3_FIELD_STEP_WATERMARK_LEVEL,
+                                              &sens_cfg[loop].cfg.sig_motion,
+                                              dev);
+                    break;
 
-                /* Get push-pull or open drain */
-                int_cfg->pin_cfg[1].od = BMI3_GET_BITS(reg_data, BMI3_INT2_OD);
+                case BMI3_FLAT:
+                    rslt = set_feature_config(BMI3_FIELD_FLAT_THETA,
+                                              BMI3_FIELD_SIG_MOTION_BLOCK_SIZE,
+                                              &sens_cfg[loop].cfg.flat,
+                                              dev);
+                    break;
 
-                /* Get output enable */
-                int_cfg->pin_cfg[1].output_en = BMI3_GET_BITS(reg_data, BMI3_INT2_OUTPUT_EN);
-            }
+                case BMI3_TILT:
+                    rslt = set_feature_config(BMI3_FIELD_TILT_SEGMENT_SIZE,
+                                              BMI3_FIELD_MAX,
+                                              &sens_cfg[loop].cfg.tilt,
+                                              dev);
+                    break;
 
-            rslt = get_latch_mode(int_cfg, dev);
+#ifndef BMI3_ORIENTATION_DISABLE
+                case BMI3_ORIENTATION:
+                    rslt = set_feature_config(BMI3_FIELD_ORIENT_UD_EN,
+                                              BMI3_FIELD_TAP_AXIS_SEL,
+                                              &sens_cfg[loop].cfg.orientation,
+                                              dev);
+                    break;
+#endif
+
+#ifndef BMI3_STEP_COUNTER_DISABLE
+                case BMI3_STEP_COUNTER:
+                    rslt = set_feature_config(BMI3_FIELD_STEP_WATERMARK_LEVEL,
+                                              BMI3_FIELD_ORIENT_UD_EN,
+                                              &sens_cfg[loop].cfg.step_counter,
+                                              dev);
+                    break;
+#endif
+
+#ifndef BMI3_TAP_DISABLE
+                case BMI3_TAP:
+                    rslt = set_feature_config(BMI3_FIELD_TAP_AXIS_SEL,
+                                              BMI3_FIELD_TILT_SEGMENT_SIZE,
+                                              &sens_cfg[loop].cfg.tap,
+                                              dev);
+                    break;
+#endif
+
+#ifndef BMI3_ALT_CONFIG_DISABLE
+                case BMI3_ALT_ACCEL:
+                    rslt = set_alternate_accel_config(&sens_cfg[loop].cfg.alt_acc, dev);
+                    break;
+
+                case BMI3_ALT_GYRO:
+                    rslt = set_alternate_gyro_config(&sens_cfg[loop].cfg.alt_gyr, dev);
+                    break;
+
+                case BMI3_ALT_AUTO_CONFIG:
+                    rslt = set_alternate_auto_config(&sens_cfg[loop].cfg.alt_auto_cfg, dev);
+                    break;
+#endif
+
+                default:
+                    rslt = BMI3_E_INVALID_SENSOR;
+                    break;
+            }
         }
     }
     else
@@ -2861,24 +2956,113 @@ int8_t bmi3_get_int_pin_config(struct bmi3_int_pin_config *int_cfg, struct bmi3_
 }
 
 /*!
- * @brief This API is used to get the sensor time.
+ * @brief This API gets the sensor/feature configuration.
  */
-int8_t bmi3_get_sensor_time(uint32_t *sensor_time, struct bmi3_dev *dev)
+int8_t bmi3_get_sensor_config(struct bmi3_sens_config *sens_cfg, uint8_t n_sens, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    uint8_t reg_data[4] = { 0 };
+    /* Variable to define loop */
+    uint8_t loop = 0;
 
-    if (sensor_time != NULL)
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (sens_cfg != NULL))
     {
-        rslt = bmi3_get_regs(BMI3_REG_SENSOR_TIME_0, reg_data, 4, dev);
-        if (rslt == BMI3_OK)
+        for (loop = 0; loop < n_sens; loop++)
         {
-            *sensor_time =
-                (uint32_t)(reg_data[0] | (uint32_t)reg_data[1] << 8 | (uint32_t)reg_data[2] << 16 |
-                           (uint32_t)reg_data[3] <<
-                    24);
+            switch (sens_cfg[loop].type)
+            {
+                case BMI3_ACCEL:
+                    rslt = get_accel_config(&sens_cfg[loop].cfg.acc, dev);
+                    break;
+
+                case BMI3_GYRO:
+                    rslt = get_gyro_config(&sens_cfg[loop].cfg.gyr, dev);
+                    break;
+
+                case BMI3_ANY_MOTION:
+                    rslt = get_feature_config(BMI3_FIELD_ANY_MOTION_SLOPE_THRES,
+                                              BMI3_FIELD_NO_MOTION_SLOPE_THRES,
+                                              &sens_cfg[loop].cfg.any_motion,
+                                              dev);
+                    break;
+
+                case BMI3_NO_MOTION:
+                    rslt = get_feature_config(BMI3_FIELD_NO_MOTION_SLOPE_THRES,
+                                              BMI3_FIELD_FLAT_THETA,
+                                              &sens_cfg[loop].cfg.no_motion,
+                                              dev);
+                    break;
+
+                case BMI3_SIG_MOTION:
+                    rslt = get_feature_config(BMI3_FIELD_SIG_MOTION_BLOCK_SIZE,
+                                              BMI3_FIELD_STEP_WATERMARK_LEVEL,
+                                              &sens_cfg[loop].cfg.sig_motion,
+                                              dev);
+                    break;
+
+                case BMI3_FLAT:
+                    rslt = get_feature_config(BMI3_FIELD_FLAT_THETA,
+                                              BMI3_FIELD_SIG_MOTION_BLOCK_SIZE,
+                                              &sens_cfg[loop].cfg.flat,
+                                              dev);
+                    break;
+
+                case BMI3_TILT:
+                    rslt = get_feature_config(BMI3_FIELD_TILT_SEGMENT_SIZE,
+                                              BMI3_FIELD_MAX,
+                                              &sens_cfg[loop].cfg.tilt,
+                                              dev);
+                    break;
+
+#ifndef BMI3_ORIENTATION_DISABLE
+                case BMI3_ORIENTATION:
+                    rslt = get_feature_config(BMI3_FIELD_ORIENT_UD_EN,
+                                              BMI3_FIELD_TAP_AXIS_SEL,
+                                              &sens_cfg[loop].cfg.orientation,
+                                              dev);
+                    break;
+#endif
+
+#ifndef BMI3_STEP_COUNTER_DISABLE
+                case BMI3_STEP_COUNTER:
+                    rslt = get_feature_config(BMI3_FIELD_STEP_WATERMARK_LEVEL,
+                                              BMI3_FIELD_ORIENT_UD_EN,
+                                              &sens_cfg[loop].cfg.step_counter,
+                                              dev);
+                    break;
+#endif
+
+#ifndef BMI3_TAP_DISABLE
+                case BMI3_TAP:
+                    rslt = get_feature_config(BMI3_FIELD_TAP_AXIS_SEL,
+                                              BMI3_FIELD_TILT_SEGMENT_SIZE,
+                                              &sens_cfg[loop].cfg.tap,
+                                              dev);
+                    break;
+#endif
+
+#ifndef BMI3_ALT_CONFIG_DISABLE
+                case BMI3_ALT_ACCEL:
+                    rslt = get_alternate_accel_config(&sens_cfg[loop].cfg.alt_acc, dev);
+                    break;
+
+                case BMI3_ALT_GYRO:
+                    rslt = get_alternate_gyro_config(&sens_cfg[loop].cfg.alt_gyr, dev);
+                    break;
+
+                case BMI3_ALT_AUTO_CONFIG:
+                    rslt = get_alternate_auto_config(&sens_cfg[loop].cfg.alt_auto_cfg, dev);
+                    break;
+#endif
+
+                default:
+                    rslt = BMI3_E_INVALID_SENSOR;
+                    break;
+            }
         }
     }
     else
@@ -2890,25 +3074,57 @@ int8_t bmi3_get_sensor_time(uint32_t *sensor_time, struct bmi3_dev *dev)
 }
 
 /*!
- * @brief This API reads the raw temperature data from the register and can be
- * converted into degree celsius.
+ * @brief This API writes consecutive words of the feature engine configuration.
  */
-int8_t bmi3_get_temperature_data(uint16_t *temp_data, struct bmi3_dev *dev)
+int8_t bmi3_set_feature_words(uint8_t base_addr, const uint16_t *words, uint8_t num_words, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define data stored in register */
-    uint8_t reg_data[2] = { 0 };
+    /* Array to set the base address of the words */
+    uint8_t feature_addr[2] = { 0 };
 
-    if (temp_data != NULL)
+    /* Array to store one burst of words */
+    uint8_t data[BMI3_FEATURE_WORDS_BURST * 2] = { 0 };
+
+    /* Variable to store the index of the next word */
+    uint8_t index = 0;
+
+    /* Variable to store the number of words in a burst */
+    uint8_t burst;
+
+    /* Variable to define loop */
+    uint8_t idx;
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (words != NULL))
     {
-        /* Read the sensor data */
-        rslt = bmi3_get_regs(BMI3_REG_TEMP_DATA, reg_data, 2, dev);
+        feature_addr[0] = base_addr;
 
-        if (rslt == BMI3_OK)
+        /* Set the base address to feature engine transmission address to start DMA transaction */
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, feature_addr, 2, dev);
+
+        /* The feature address auto-increments over consecutive bursts */
+        while ((rslt == BMI3_OK) && (index < num_words))
         {
-            *temp_data = (uint16_t)(reg_data[0] | ((uint16_t)reg_data[1] << 8));
+            burst = num_words - index;
+
+            if (burst > BMI3_FEATURE_WORDS_BURST)
+            {
+                burst = BMI3_FEATURE_WORDS_BURST;
+            }
+
+            for (idx = 0; idx < burst; idx++)
+            {
+                data[idx * 2] = BMI3_GET_LSB(words[index + idx]);
+                data[(idx * 2) + 1] = BMI3_GET_MSB(words[index + idx]);
+            }
+
+            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, data, (uint16_t)(burst * 2), dev);
+
+            index += burst;
         }
     }
     else
@@ -2920,46 +3136,62 @@ int8_t bmi3_get_temperature_data(uint16_t *temp_data, struct bmi3_dev *dev)
 }
 
 /*!
- * @brief This API reads the FIFO data.
+ * @brief This API reads consecutive words of the feature engine configuration.
  */
-int8_t bmi3_read_fifo_data(struct bmi3_fifo_frame *fifo, struct bmi3_dev *dev)
+int8_t bmi3_get_feature_words(uint8_t base_addr, uint16_t *words, uint8_t num_words, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to store FIFO configuration data */
-    uint8_t config_data[2] = { 0 };
+    /* Array to set the base address of the words */
+    uint8_t feature_addr[2] = { 0 };
 
-    /* Variable to store FIFO data address */
-    uint8_t reg_addr = BMI3_REG_FIFO_DATA;
+    /* Array to store one burst of words */
+    uint8_t data[BMI3_FEATURE_WORDS_BURST * 2] = { 0 };
+
+    /* Variable to store the index of the next word */
+    uint8_t index = 0;
+
+    /* Variable to store the number of words in a burst */
+    uint8_t burst;
+
+    /* Variable to define loop */
+    uint8_t idx;
 
     /* Null-pointer check */
-    if (fifo != NULL)
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (words != NULL))
     {
-        /* Get the set FIFO frame configurations */
-        rslt = bmi3_get_regs(BMI3_REG_FIFO_CONF, config_data, 2, dev);
+        feature_addr[0] = base_addr;
 
-        if (rslt == BMI3_OK)
+        /* Keep the address and the data transfers together */
+        lock_dev(dev);
+
+        /* Set the base address to feature engine transmission address to start DMA transaction */
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, feature_addr, 2, dev);
+
+        /* The feature address auto-increments over consecutive bursts */
+        while ((rslt == BMI3_OK) && (index < num_words))
         {
-            /* Get sensor enable status, of which the data is to be read */
-            fifo->available_fifo_sens =
-                (uint16_t)(((config_data[0]) | ((uint16_t) config_data[1] << 8)) & BMI3_FIFO_ALL_EN);
+            burst = num_words - index;
 
-            if (fifo->length != 0)
+            if (burst > BMI3_FEATURE_WORDS_BURST)
             {
-                /* Read FIFO data */
-                if (dev->intf == BMI3_SPI_INTF)
-                {
-                    reg_addr = (reg_addr | BMI3_SPI_RD_MASK);
-                }
-
-                rslt = dev->read(reg_addr, fifo->data, (uint32_t)fifo->length, dev->intf_ptr);
+                burst = BMI3_FEATURE_WORDS_BURST;
             }
-            else
+
+            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, data, (uint16_t)(burst * 2), dev);
+
+            for (idx = 0; (rslt == BMI3_OK) && (idx < burst); idx++)
             {
-                rslt = BMI3_E_COM_FAIL;
+                words[index + idx] = (uint16_t)(data[idx * 2] | ((uint16_t)data[(idx * 2) + 1] << 8));
             }
+
+            index += burst;
         }
+
+        unlock_dev(dev);
     }
     else
     {
@@ -2970,257 +3202,151 @@ int8_t bmi3_read_fifo_data(struct bmi3_fifo_frame *fifo, struct bmi3_dev *dev)
 }
 
 /*!
- * @brief This API parses and extracts the accelerometer frames from FIFO data
- * read by the "bmi3_read_fifo_data" API and stores it in the "accel_data"
- * structure instance.
+ * @brief This API reads any set of feature engine configuration fields in one burst.
  */
-int8_t bmi3_extract_accel(struct bmi3_fifo_sens_axes_data *accel_data,
-                          struct bmi3_fifo_frame *fifo,
-                          const struct bmi3_dev *dev)
+int8_t bmi3_get_feature_fields(const uint8_t *field_id, uint16_t *value, uint8_t n_fields, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to index the bytes */
-    uint16_t data_index = 0;
+    /* Array to store the words spanned by the fields */
+    uint16_t words[BMI3_FEATURE_CONFIG_WORDS] = { 0 };
 
-    /* Variable to index accelerometer frames */
-    uint16_t accel_index = 0;
+    /* Pointer to the field descriptor */
+    const struct bmi3_feature_field *field;
 
-    /* Variable to define the data enable byte */
-    uint16_t data_enable = 0;
+    /* Variables to store the range of words */
+    uint8_t first_addr = 0, num_words = 0;
 
-    rslt = null_ptr_check(dev);
+    /* Variable to define loop */
+    uint8_t idx;
 
-    /* Null-pointer check */
-    if ((rslt == BMI3_OK) && (accel_data != NULL) && (fifo != NULL))
+    if ((field_id != NULL) && (value != NULL))
     {
-        data_index = dev->dummy_byte;
-
-        /* Convert word to byte since all sensor enables are in a byte */
-        data_enable = fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_ACC_FRM;
+        rslt = get_field_span(field_id, n_fields, &first_addr, &num_words);
 
-        for (; (data_index < fifo->length);)
+        if (rslt == BMI3_OK)
         {
-            rslt = check_data_index(data_index, fifo);
+            rslt = bmi3_get_feature_words(first_addr, words, num_words, dev);
+        }
 
-            if (rslt == BMI3_OK)
-            {
-                /* Unpack frame to get the accelerometer data */
-                rslt = unpack_fifo_data_frame(accel_data, &data_index, &accel_index, data_enable, fifo);
-            }
-
-            if (rslt != BMI3_W_PARTIAL_READ)
-            {
-                if (fifo->available_fifo_sens == BMI3_FIFO_HEAD_LESS_ACC_FRM)
-                {
-                    data_index = data_index + BMI3_LENGTH_FIFO_ACC;
-                }
-
-                /* If gyro enable with the accel, increment the accel index by 6
-                 * since gyro frame has 6 bytes of data
-                 */
-                if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_GYR_FRM)
-                {
-                    data_index = data_index + BMI3_LENGTH_FIFO_GYR;
-                }
-
-                /* If sensor time enable with the accel, increment the accel index by 2
-                 * since sensor time frame has 2 bytes of data
-                 */
-                if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
-                {
-                    data_index = data_index + BMI3_LENGTH_SENSOR_TIME;
-                }
-
-                /* If temperature enable with the accel, increment the accel index by 2
-                 * since temperature frame has 2 bytes of data
-                 */
-                if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_TEMP_FRM)
-                {
-                    data_index = data_index + BMI3_LENGTH_TEMPERATURE;
-                }
-            }
-        }
-
-        /* Update number of accelerometer frames to be read */
-        (fifo->avail_fifo_accel_frames) = accel_index;
-
-        if (fifo->avail_fifo_accel_frames != 0)
-        {
-            rslt = BMI3_OK;
-        }
-    }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
-    }
+        for (idx = 0; (rslt == BMI3_OK) && (idx < n_fields); idx++)
+        {
+            field = &bmi3_feature_fields[field_id[idx]];
+            value[idx] = (uint16_t)((words[field->base_addr + field->word - first_addr] & field->mask) >> field->pos);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
     return rslt;
 }
 
 /*!
- * @brief This API parses and extracts the temperature frames from FIFO data
- * read by the "bmi3_read_fifo_data" API and stores it in the "temp_data"
- * structure instance.
+ * @brief This API writes any set of feature engine configuration fields, transferring only the words they touch.
  */
-int8_t bmi3_extract_temperature(struct bmi3_fifo_temperature_data *temp_data,
-                                struct bmi3_fifo_frame *fifo,
-                                const struct bmi3_dev *dev)
+int8_t bmi3_set_feature_fields(const uint8_t *field_id, const uint16_t *value, uint8_t n_fields, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to index the bytes */
-    uint16_t data_index = 0;
+    /* Array to store the words spanned by the fields */
+    uint16_t words[BMI3_FEATURE_CONFIG_WORDS] = { 0 };
 
-    /* Variable to index temperature frames */
-    uint16_t temp_index = 0;
+    /* Array to store the bits of each word that are updated */
+    uint16_t update[BMI3_FEATURE_CONFIG_WORDS] = { 0 };
 
-    /* Variable to define the data enable byte */
-    uint16_t data_enable = 0;
+    /* Array to store whether the other fields of a word have to be read */
+    uint8_t partial[BMI3_FEATURE_CONFIG_WORDS] = { 0 };
 
-    rslt = null_ptr_check(dev);
+    /* Pointer to the field descriptor */
+    const struct bmi3_feature_field *field;
 
-    /* Null-pointer check */
-    if ((rslt == BMI3_OK) && (temp_data != NULL) && (fifo != NULL))
-    {
-        data_index = dev->dummy_byte;
+    /* Variable to store the index of a word */
+    uint8_t word;
 
-        /* Convert word to byte since all sensor enables are in a byte */
-        data_enable = fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_TEMP_FRM;
+    /* Variables to store the range of words */
+    uint8_t first_addr = 0, num_words = 0;
 
-        for (; (data_index < fifo->length);)
-        {
-            /* If accel enable with the temperature, increment the temperature index by 6
-             * since accel frame has 6 bytes of data
-             */
-            if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_ACC_FRM)
-            {
-                data_index = data_index + BMI3_LENGTH_FIFO_ACC;
-            }
+    /* Variables to store a run of consecutive words */
+    uint8_t start, end;
 
-            /* If gyro enable with the temperature, increment the temperature index by 6
-             * since gyro frame has 6 bytes of data
-             */
-            if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_GYR_FRM)
-            {
-                data_index = data_index + BMI3_LENGTH_FIFO_GYR;
-            }
+    /* Variable to define loop */
+    uint8_t idx;
 
-            rslt = check_data_index(data_index, fifo);
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-            if (rslt == BMI3_OK)
+    if ((rslt == BMI3_OK) && (field_id != NULL) && (value != NULL))
+    {
+        rslt = get_field_span(field_id, n_fields, &first_addr, &num_words);
+
+        if (rslt == BMI3_OK)
+        {
+            for (idx = 0; idx < n_fields; idx++)
             {
-                /* Unpack frame to get the temperature data */
-                rslt = unpack_fifo_data_frame(temp_data, &data_index, &temp_index, data_enable, fifo);
+                field = &bmi3_feature_fields[field_id[idx]];
+                word = (uint8_t)(field->base_addr + field->word - first_addr);
+                update[word] |= field->mask;
             }
 
-            if (rslt != BMI3_W_PARTIAL_READ)
+            /* A word needs to be read only if some of its fields are kept; reserved bits are written as zero */
+            for (idx = 0; idx < num_words; idx++)
             {
-                /* If sensor time enable with the temperature, increment the temperature index by 2
-                 * since sensor time frame has 2 bytes of data
-                 */
-                if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
+                if ((update[idx] != 0) && ((feature_word_mask((uint8_t)(first_addr + idx)) & ~update[idx]) != 0))
                 {
-                    data_index = data_index + BMI3_LENGTH_SENSOR_TIME;
+                    partial[idx] = BMI3_TRUE;
                 }
             }
-        }
-
-        /* Update number of temperature frames to be read */
-        (fifo->avail_fifo_temp_frames) = temp_index;
-
-        if (fifo->avail_fifo_temp_frames != 0)
-        {
-            rslt = BMI3_OK;
-        }
-    }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This API parses and extracts the gyro frames from FIFO data
- * read by the "bmi3_read_fifo_data" API and stores it in the "gyro_data"
- * structure instance.
- */
-int8_t bmi3_extract_gyro(struct bmi3_fifo_sens_axes_data *gyro_data,
-                         struct bmi3_fifo_frame *fifo,
-                         const struct bmi3_dev *dev)
-{
-    /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Variable to index the bytes */
-    uint16_t data_index = 0;
-
-    /* Variable to index gyro frames */
-    uint16_t gyro_index = 0;
-
-    /* Variable to define the data enable byte */
-    uint16_t data_enable = 0;
 
-    rslt = null_ptr_check(dev);
+            /* No other access may slip in between the read and the write back */
+            lock_dev(dev);
 
-    /* Null-pointer check */
-    if ((rslt == BMI3_OK) && (gyro_data != NULL) && (fifo != NULL))
-    {
-        data_index = dev->dummy_byte;
+            /* Read each run of partially updated words */
+            for (start = 0; (rslt == BMI3_OK) && (start < num_words); start = end)
+            {
+                end = (uint8_t)(start + 1);
 
-        /* Convert word to byte since all sensor enables are in a byte */
-        data_enable = fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_GYR_FRM;
+                while ((end < num_words) && (partial[end] == partial[start]))
+                {
+                    end++;
+                }
 
-        for (; (data_index < fifo->length);)
-        {
-            if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_ACC_FRM)
-            {
-                data_index = data_index + BMI3_LENGTH_FIFO_ACC;
+                if (partial[start] == BMI3_TRUE)
+                {
+                    rslt = bmi3_get_feature_words((uint8_t)(first_addr + start), &words[start],
+                                                  (uint8_t)(end - start), dev);
+                }
             }
 
-            rslt = check_data_index(data_index, fifo);
-
-            if (rslt == BMI3_OK)
+            /* Put the new fields into the words */
+            for (idx = 0; (rslt == BMI3_OK) && (idx < n_fields); idx++)
             {
-                /* Unpack frame to get the gyro data */
-                rslt = unpack_fifo_data_frame(gyro_data, &data_index, &gyro_index, data_enable, fifo);
+                field = &bmi3_feature_fields[field_id[idx]];
+                word = (uint8_t)(field->base_addr + field->word - first_addr);
+                words[word] = (uint16_t)((words[word] & ~field->mask) | ((value[idx] << field->pos) & field->mask));
             }
 
-            if (rslt != BMI3_W_PARTIAL_READ)
+            /* Write each run of updated words, the words in between are left alone */
+            for (start = 0; (rslt == BMI3_OK) && (start < num_words); start = end)
             {
-                if (fifo->available_fifo_sens == BMI3_FIFO_HEAD_LESS_GYR_FRM)
-                {
-                    data_index = data_index + BMI3_LENGTH_FIFO_GYR;
-                }
+                end = (uint8_t)(start + 1);
 
-                /* If sensor time enable with the gyro, increment the sensor time index by 2
-                 * since sensor time frame has 2 bytes of data
-                 */
-                if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
+                while ((end < num_words) && ((update[end] != 0) == (update[start] != 0)))
                 {
-                    data_index = data_index + BMI3_LENGTH_SENSOR_TIME;
+                    end++;
                 }
 
-                /* If temperature enable with the gyro, increment the temperature index by 2
-                 * since temperature frame has 2 bytes of data
-                 */
-                if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_TEMP_FRM)
+                if (update[start] != 0)
                 {
-                    data_index = data_index + BMI3_LENGTH_TEMPERATURE;
+                    rslt = bmi3_set_feature_words((uint8_t)(first_addr + start), &words[start],
+                                                  (uint8_t)(end - start), dev);
                 }
             }
-        }
-
-        /* Update number of gyro frames to be read */
-        (fifo->avail_fifo_gyro_frames) = gyro_index;
 
-        if (fifo->avail_fifo_gyro_frames != 0)
-        {
-            rslt = BMI3_OK;
+            unlock_dev(dev);
         }
     }
     else
@@ -3232,49 +3358,79 @@ int8_t bmi3_extract_gyro(struct bmi3_fifo_sens_axes_data *gyro_data,
 }
 
 /*!
- * @brief This API sets the FIFO water-mark level in words.
+ * @brief This API maps/un-maps data interrupts to that of interrupt pins.
  */
-int8_t bmi3_set_fifo_wm(uint16_t fifo_wm, struct bmi3_dev *dev)
+int8_t bmi3_map_interrupt(struct bmi3_map_int map_int, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to store data */
-    uint8_t data[2] = { 0 };
+    /* Variable to store register data */
+    uint8_t reg_data[4] = { 0 };
 
-    uint16_t fifo_watermark = fifo_wm & BMI3_FIFO_WATERMARK_MASK;
+    uint16_t no_motion_out, any_motion_out, flat_out, orientation_out, step_detector_out, step_counter_out,
+             sig_motion_out, tilt_out;
+    uint16_t tap_out, i3c_out, err_status, temp, gyr, acc, fwm, ffull;
 
-    /* Get LSB value of FIFO water-mark */
-    data[0] = BMI3_GET_LSB(fifo_watermark);
+    /* Read interrupt map1 and map2 and register */
+    rslt = bmi3_get_regs(BMI3_REG_INT_MAP1, reg_data, 4, dev);
 
-    /* Get MSB value of FIFO water-mark */
-    data[1] = BMI3_GET_MSB(fifo_watermark);
+    if (rslt == BMI3_OK)
+    {
+        no_motion_out =
+            (BMI3_SET_BIT_POS0(reg_data[0], BMI3_NO_MOTION_OUT, map_int.no_motion_out) & BMI3_NO_MOTION_OUT_MASK);
+        any_motion_out =
+            (BMI3_SET_BITS(reg_data[0], BMI3_ANY_MOTION_OUT, map_int.any_motion_out) & BMI3_ANY_MOTION_OUT_MASK);
+        flat_out = (BMI3_SET_BITS(reg_data[0], BMI3_FLAT_OUT, map_int.flat_out) & BMI3_FLAT_OUT_MASK);
+        orientation_out =
+            (BMI3_SET_BITS(reg_data[0], BMI3_ORIENTATION_OUT, map_int.orientation_out) & BMI3_ORIENTATION_OUT_MASK);
+        step_detector_out =
+            (BMI3_SET_BITS(reg_data[1], BMI3_STEP_DETECTOR_OUT,
+                           map_int.step_detector_out) & BMI3_STEP_DETECTOR_OUT_MASK);
+        step_counter_out =
+            (BMI3_SET_BITS(reg_data[1], BMI3_STEP_COUNTER_OUT, map_int.step_counter_out) & BMI3_STEP_COUNTER_OUT_MASK);
+        sig_motion_out =
+            (BMI3_SET_BITS(reg_data[1], BMI3_SIG_MOTION_OUT, map_int.sig_motion_out) & BMI3_SIG_MOTION_OUT_MASK);
+        tilt_out = (BMI3_SET_BITS(reg_data[1], BMI3_TILT_OUT, map_int.tilt_out) & BMI3_TILT_OUT_MASK);
 
-    /* Set the FIFO water-mark level */
-    rslt = bmi3_set_regs(BMI3_REG_FIFO_WATERMARK, data, BMI3_LENGTH_FIFO_WM, dev);
+        reg_data[0] = (uint8_t)(no_motion_out | any_motion_out | flat_out | orientation_out);
+        reg_data[1] = (uint8_t)((step_detector_out | step_counter_out | sig_motion_out | tilt_out) >> 8);
+
+        tap_out = (BMI3_SET_BIT_POS0(reg_data[2], BMI3_TAP_OUT, map_int.tap_out) & BMI3_TAP_OUT_MASK);
+        i3c_out = (BMI3_SET_BITS(reg_data[2], BMI3_I3C_OUT, map_int.i3c_out) & BMI3_I3C_OUT_MASK);
+        err_status = (BMI3_SET_BITS(reg_data[2], BMI3_ERR_STATUS, map_int.err_status) & BMI3_ERR_STATUS_MASK);
+        temp = (BMI3_SET_BITS(reg_data[2], BMI3_TEMP_DRDY_INT, map_int.temp_drdy_int) & BMI3_TEMP_DRDY_INT_MASK);
+        gyr = (BMI3_SET_BITS(reg_data[3], BMI3_GYR_DRDY_INT, map_int.gyr_drdy_int) & BMI3_GYR_DRDY_INT_MASK);
+        acc = (BMI3_SET_BITS(reg_data[3], BMI3_ACC_DRDY_INT, map_int.acc_drdy_int) & BMI3_ACC_DRDY_INT_MASK);
+        fwm =
+            (BMI3_SET_BITS(reg_data[3], BMI3_FIFO_WATERMARK_INT,
+                           map_int.fifo_watermark_int) & BMI3_FIFO_WATERMARK_INT_MASK);
+        ffull = (BMI3_SET_BITS(reg_data[3], BMI3_FIFO_FULL_INT, map_int.fifo_full_int) & BMI3_FIFO_FULL_INT_MASK);
+
+        reg_data[2] = (uint8_t)(tap_out | i3c_out | err_status | temp);
+        reg_data[3] = (uint8_t)((gyr | acc | fwm | ffull) >> 8);
+
+        rslt = bmi3_set_regs(BMI3_REG_INT_MAP1, reg_data, 4, dev);
+    }
 
     return rslt;
 }
 
 /*!
- * @brief This API reads the FIFO water-mark level in words.
+ * @brief This API selects the sensors/features to be enabled or disabled.
  */
-int8_t bmi3_get_fifo_wm(uint16_t *fifo_wm, struct bmi3_dev *dev)
+int8_t bmi3_select_sensor(struct bmi3_feature_enable *enable, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to to store data */
-    uint8_t data[2] = { 0 };
-
-    if (fifo_wm != NULL)
+    if (enable != NULL)
     {
-        /* Read the FIFO water-mark level */
-        rslt = bmi3_get_regs(BMI3_REG_FIFO_WATERMARK, data, BMI3_LENGTH_FIFO_WM, dev);
+        rslt = set_feature_enable(enable, dev);
 
         if (rslt == BMI3_OK)
         {
-            (*fifo_wm) = (uint16_t)((data[0] | (uint16_t) data[1] << 8));
+            rslt = get_feature_enable(enable, dev);
         }
     }
     else
@@ -3286,59 +3442,74 @@ int8_t bmi3_get_fifo_wm(uint16_t *fifo_wm, struct bmi3_dev *dev)
 }
 
 /*!
- * @brief This API sets the FIFO configuration in the sensor.
+ * @brief This API gets the sensor/feature data for accelerometer, gyroscope,
+ * step counter, orientation, i3c sync accel, i3c sync gyro and i3c sync temperature.
  */
-int8_t bmi3_set_fifo_config(uint16_t config, uint8_t enable, struct bmi3_dev *dev)
+int8_t bmi3_get_sensor_data(struct bmi3_sensor_data *sensor_data, uint8_t n_sens, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array variable to store fifo config data */
-    uint8_t data[2] = { 0 };
-
-    /* Variable to store data of FIFO configuration register */
-    uint16_t fifo_config = config & BMI3_FIFO_CONFIG_MASK;
+    /* Variable to define loop */
+    uint8_t loop;
 
-    rslt = bmi3_get_regs(BMI3_REG_FIFO_CONF, data, 2, dev);
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-    if (rslt == BMI3_OK)
+    if ((rslt == BMI3_OK) && (sensor_data != NULL))
     {
-        if (enable == BMI3_ENABLE)
-        {
-            data[0] = data[0] | (uint8_t)fifo_config;
-            data[1] = data[1] | (uint8_t)(fifo_config >> 8);
-        }
-        else
+        for (loop = 0; loop < n_sens; loop++)
         {
-            data[0] = data[0] & (~fifo_config);
-            data[1] = data[1] & (~(fifo_config >> 8));
-        }
+            switch (sensor_data[loop].type)
+            {
+                case BMI3_ACCEL:
+                    rslt = get_accel_sensor_data(&sensor_data[loop].sens_data.acc, BMI3_REG_ACC_DATA_X, dev);
+                    break;
 
-        rslt = bmi3_set_regs(BMI3_REG_FIFO_CONF, data, 2, dev);
-    }
+                case BMI3_GYRO:
+                    rslt = get_gyro_sensor_data(&sensor_data[loop].sens_data.gyr, BMI3_REG_GYR_DATA_X, dev);
+                    break;
 
-    return rslt;
-}
+#ifndef BMI3_STEP_COUNTER_DISABLE
+                case BMI3_STEP_COUNTER:
+                    rslt = get_step_counter_sensor_data(&sensor_data[loop].sens_data.step_counter_output,
+                                                        BMI3_REG_FEATURE_IO2,
+                                                        dev);
+                    break;
+#endif
 
-/*!
- * @brief This API reads the FIFO configuration from the sensor.
- */
-int8_t bmi3_get_fifo_config(uint16_t *fifo_config, struct bmi3_dev *dev)
-{
-    /* Variable to store result of API */
-    int8_t rslt;
+#ifndef BMI3_ORIENTATION_DISABLE
+                case BMI3_ORIENTATION:
+                    rslt = get_orient_output_data(&sensor_data[loop].sens_data.orient_output,
+                                                  BMI3_REG_FEATURE_EVENT_EXT,
+                                                  dev);
+                    break;
+#endif
 
-    /* Array to store data */
-    uint8_t data[2] = { 0 };
+#ifndef BMI3_I3C_SYNC_DISABLE
+                case BMI3_I3C_SYNC_ACCEL:
+                    rslt = get_i3c_sync_accel_sensor_data(&sensor_data[loop].sens_data.i3c_sync, dev);
+                    break;
 
-    if (fifo_config != NULL)
-    {
-        /* Get the FIFO configuration value */
-        rslt = bmi3_get_regs(BMI3_REG_FIFO_CONF, data, 2, dev);
+                case BMI3_I3C_SYNC_GYRO:
+                    rslt = get_i3c_sync_gyro_sensor_data(&sensor_data[loop].sens_data.i3c_sync, dev);
+                    break;
 
-        if (rslt == BMI3_OK)
-        {
-            (*fifo_config) = ((data[0] & BMI3_FIFO_CONFIG_MASK) | (((uint16_t)data[1] << 8) & BMI3_FIFO_CONFIG_MASK));
+                case BMI3_I3C_SYNC_TEMP:
+                    rslt = get_i3c_sync_temp_data(&sensor_data[loop].sens_data.i3c_sync, dev);
+                    break;
+#endif
+
+                default:
+                    rslt = BMI3_E_INVALID_SENSOR;
+                    break;
+            }
+
+            /* Return error if any of the get sensor data fails */
+            if (rslt != BMI3_OK)
+            {
+                break;
+            }
         }
     }
     else
@@ -3350,41 +3521,47 @@ int8_t bmi3_get_fifo_config(uint16_t *fifo_config, struct bmi3_dev *dev)
 }
 
 /*!
- * @brief This API gets the length of FIFO data available in the sensor in
- * words.
+ * @brief This API reads the sensor status, accelerometer, gyroscope, temperature,
+ * sensor time, saturation flags and interrupt 1 status in one transaction.
  */
-int8_t bmi3_get_fifo_length(uint16_t *fifo_avail_len, struct bmi3_dev *dev)
+int8_t bmi3_get_sensor_burst_data(struct bmi3_sensor_burst_data *data, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to define byte index */
-    uint16_t reg_data;
+    /* Array to define data stored in register */
+    uint8_t reg_data[BMI3_BURST_NUM_BYTES] = { 0 };
 
-    /* Array to store FIFO data length */
-    uint8_t data[BMI3_LENGTH_FIFO_DATA] = { 0 };
+    /* Stores the x, y and z axis data, sensor time and saturation flags from register */
+    uint16_t sens_data[6];
 
-    if (fifo_avail_len != NULL)
+    if (data != NULL)
     {
-        /* Read FIFO length */
-        rslt = bmi3_get_regs(BMI3_REG_FIFO_FILL_LEVEL, data, BMI3_LENGTH_FIFO_DATA, dev);
+        /* Read from BMI3_REG_STATUS to BMI3_REG_INT_STATUS_INT1 */
+        rslt = bmi3_get_regs(BMI3_REG_STATUS, reg_data, BMI3_BURST_NUM_BYTES, dev);
 
         if (rslt == BMI3_OK)
         {
-            /* Get the MSB byte of FIFO length */
-            data[0] = BMI3_GET_BIT_POS0(data[0], BMI3_FIFO_FILL_LEVEL);
+            data->status = (uint16_t)(reg_data[0] | ((uint16_t)reg_data[1] << 8));
 
-            reg_data = ((uint16_t)data[1] << 8);
+            /* Sensor time and saturation flags are shared by accel and gyro */
+            sens_data[3] = (reg_data[16] | (uint16_t)reg_data[17] << 8);
+            sens_data[4] = (reg_data[18] | (uint16_t)reg_data[19] << 8);
+            sens_data[5] = reg_data[20];
 
-            reg_data = BMI3_GET_BIT_POS0(reg_data, BMI3_FIFO_FILL_LEVEL);
+            sens_data[0] = (reg_data[2] | (uint16_t)reg_data[3] << 8);
+            sens_data[1] = (reg_data[4] | (uint16_t)reg_data[5] << 8);
+            sens_data[2] = (reg_data[6] | (uint16_t)reg_data[7] << 8);
+            get_acc_data(&data->acc, sens_data);
 
-            /* Get total FIFO length */
-            *fifo_avail_len = (uint16_t)(reg_data | data[0]);
+            sens_data[0] = (reg_data[8] | (uint16_t)reg_data[9] << 8);
+            sens_data[1] = (reg_data[10] | (uint16_t)reg_data[11] << 8);
+            sens_data[2] = (reg_data[12] | (uint16_t)reg_data[13] << 8);
+            get_gyr_data(&data->gyr, sens_data);
 
-            if (*fifo_avail_len == 0)
-            {
-                rslt = BMI3_W_FIFO_EMPTY;
-            }
+            data->temp_data = (uint16_t)(reg_data[14] | ((uint16_t)reg_data[15] << 8));
+            data->sens_time = data->acc.sens_time;
+            data->int1_status = (uint16_t)(reg_data[22] | ((uint16_t)reg_data[23] << 8));
         }
     }
     else
@@ -3396,89 +3573,49 @@ int8_t bmi3_get_fifo_length(uint16_t *fifo_avail_len, struct bmi3_dev *dev)
 }
 
 /*!
- * @brief This API is used to perform the self-test for either accel or gyro or both.
+ *  @brief This API reads the error status from the sensor.
  */
-int8_t bmi3_perform_self_test(uint8_t st_selection, struct bmi3_st_result *st_result_status, struct bmi3_dev *dev)
+int8_t bmi3_get_error_status(struct bmi3_err_reg *err_reg, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    uint16_t reg_data[9];
-
-    uint8_t data_array[18] = { 0 };
-
-    /* Variable to store gyro filter coefficient base address */
-    uint8_t gyro_filter_coeff_base_addr[2] = { BMI3_BASE_ADDR_GYRO_SC_ST_COEFFICIENTS, 0 };
+    /* Array variable to get error status from register */
+    uint8_t data[2] = { 0 };
 
-    /* Get accel configurations */
-    struct bmi3_accel_config acc_cfg = { 0 };
+    uint16_t reg_data;
 
-    if (st_result_status != NULL)
+    if (err_reg != NULL)
     {
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, gyro_filter_coeff_base_addr, 2, dev);
+        /* Read the error codes */
+        rslt = bmi3_get_regs(BMI3_REG_ERR_REG, data, 2, dev);
 
         if (rslt == BMI3_OK)
         {
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, data_array, 18, dev);
-
-            if (rslt == BMI3_OK)
-            {
-                rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, gyro_filter_coeff_base_addr, 2, dev);
+            reg_data = data[0];
 
-                if (rslt == BMI3_OK)
-                {
-                    rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, data_array, 18, dev);
-                }
-            }
-        }
+            /* Fatal error */
+            err_reg->fatal_err = BMI3_GET_BIT_POS0(reg_data, BMI3_FATAL_ERR);
 
-        reg_data[0] = (uint16_t)(data_array[0] | (uint16_t)data_array[1] << 8);
-        reg_data[1] = (uint16_t)(data_array[2] | (uint16_t)data_array[3] << 8);
-        reg_data[2] = (uint16_t)(data_array[4] | (uint16_t)data_array[5] << 8);
-        reg_data[3] = (uint16_t)(data_array[6] | (uint16_t)data_array[7] << 8);
-        reg_data[4] = (uint16_t)(data_array[8] | (uint16_t)data_array[9] << 8);
-        reg_data[5] = (uint16_t)(data_array[10] | (uint16_t)data_array[11] << 8);
-        reg_data[6] = (uint16_t)(data_array[12] | (uint16_t)data_array[13] << 8);
-        reg_data[7] = (uint16_t)(data_array[14] | (uint16_t)data_array[15] << 8);
-        reg_data[8] = (uint16_t)(data_array[16] | (uint16_t)data_array[17] << 8);
+            /* Interrupt request overrun error */
+            err_reg->feat_eng_ovrld = BMI3_GET_BITS(reg_data, BMI3_FEAT_ENG_OVRLD);
 
-        if ((reg_data[3] != BMI3_SC_ST_VALUE_3) &&
-            ((reg_data[0] != BMI3_SC_ST_VALUE_0) || (reg_data[1] != BMI3_SC_ST_VALUE_1) ||
-             (reg_data[2] != BMI3_SC_ST_VALUE_2) || (reg_data[4] != BMI3_SC_ST_VALUE_4) ||
-             (reg_data[5] != BMI3_SC_ST_VALUE_5) || (reg_data[6] != BMI3_SC_ST_VALUE_6) ||
-             (reg_data[7] != BMI3_SC_ST_VALUE_7) || (reg_data[8] != BMI3_SC_ST_VALUE_8)))
-        {
-            rslt = set_gyro_filter_coefficients(dev);
-        }
+            /* Indicates watch cell code */
+            err_reg->feat_eng_wd = BMI3_GET_BITS(reg_data, BMI3_FEAT_ENG_WD);
 
-        if (rslt == BMI3_OK)
-        {
-            /* Get and set the self-test mode given by the user in the self-test dma register. */
-            rslt = get_set_st_dma(st_selection, dev);
-        }
+            /* Indicates accel configuration error */
+            err_reg->acc_conf_err = BMI3_GET_BITS(reg_data, BMI3_ACC_CONF_ERR);
 
-        if (rslt == BMI3_OK)
-        {
-            /* Get default accel configurations */
-            rslt = get_accel_config(&acc_cfg, dev);
-        }
+            /* Indicates gyro configuration error */
+            err_reg->gyr_conf_err = BMI3_GET_BITS(reg_data, BMI3_GYR_CONF_ERR);
 
-        if (rslt == BMI3_OK)
-        {
-            /* Sets the self-test preconditions and triggers the self-test in the
-             * command register. */
-            rslt = self_test_conditions(st_selection, dev);
+            reg_data = data[1];
 
-            if (rslt == BMI3_OK)
-            {
-                rslt = get_st_status_rslt(st_selection, st_result_status, dev);
-            }
+            /* Indicates SDR parity error */
+            err_reg->i3c_error0 = BMI3_GET_BITS(reg_data, BMI3_I3C_ERROR0);
 
-            if (rslt == BMI3_OK)
-            {
-                /* Restore accel configurations */
-                rslt = set_accel_config(&acc_cfg, dev);
-            }
+            /* Indicates I3C error */
+            err_reg->i3c_error3 = BMI3_GET_BITS(reg_data, BMI3_I3C_ERROR3);
         }
     }
     else
@@ -3490,162 +3627,126 @@ int8_t bmi3_perform_self_test(uint8_t st_selection, struct bmi3_st_result *st_re
 }
 
 /*!
- * @brief This API writes the config array and config version in cfg res.
+ *  @brief This API reads the feature engine error status from the sensor.
  */
-int8_t bmi3_configure_enhanced_flexibility(struct bmi3_dev *dev)
+int8_t bmi3_get_feature_engine_error_status(uint8_t *feature_engine_err_reg_lsb,
+                                            uint8_t *feature_engine_err_reg_msb,
+                                            struct bmi3_dev *dev)
 {
-    /* Variable to define error */
+    /* Variable to store result of API */
     int8_t rslt;
 
-    /* Null-pointer check */
-    rslt = null_ptr_check(dev);
+    /* Array variable to get error status from register */
+    uint8_t data[2];
 
-    if (rslt == BMI3_OK)
+    if ((feature_engine_err_reg_lsb != NULL) && (feature_engine_err_reg_msb != NULL))
     {
-        /* Bytes written are multiples of 2 */
-        if ((dev->read_write_len % 2) != 0)
-        {
-            dev->read_write_len = dev->read_write_len - 1;
-        }
-
-        /* BMI3 has 16 bit address and hence the minimum read write length should be 2 bytes */
-        if (dev->read_write_len < 2)
-        {
-            dev->read_write_len = 2;
-        }
-
-        rslt = config_array_set_command(dev);
+        /* Read the feature engine error codes */
+        rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO1, data, 2, dev);
 
         if (rslt == BMI3_OK)
         {
-            rslt = config_array_set_value_one_page(dev);
+            *feature_engine_err_reg_lsb = data[0];
 
-            if (rslt == BMI3_OK)
-            {
-                /* Write the config array */
-                rslt = write_config_array(dev);
-            }
+            *feature_engine_err_reg_msb = data[1];
         }
     }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to get the config version.
+ * @brief This API sets:
+ *        1) The output configuration of the selected interrupt pin:
+ *           INT1 or INT2.
+ *        2) The interrupt mode: permanently latched or non-latched.
  */
-int8_t bmi3_get_config_version(struct bmi3_config_version *config_version, struct bmi3_dev *dev)
+int8_t bmi3_set_int_pin_config(const struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt = BMI3_OK;
+    int8_t rslt;
 
-    /* Array to store base address of config */
-    uint8_t data[2] = { BMI3_BASE_ADDR_CONFIG_VERSION, 0 };
+    /* Variable to define data array */
+    uint8_t data_array[3] = { 0 };
 
-    /* Variable to store version number */
-    uint8_t version[6];
+    /* Variable to store register data */
+    uint16_t reg_data = 0;
 
-    uint16_t lsb_msb;
+    /* Variable to define type of interrupt pin  */
+    uint8_t int_pin = 0;
 
-    if (config_version != NULL)
+    uint16_t lvl, od, output_en;
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (int_cfg != NULL))
     {
-        /* Set the config version base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, data, 2, dev);
+        /* Copy the pin type to a local variable */
+        int_pin = int_cfg->pin_type;
 
-        if (rslt == BMI3_OK)
+        if ((int_pin > BMI3_INT_NONE) && (int_pin < BMI3_INT_PIN_MAX))
         {
-            /* Get the configuration from the feature engine register */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, version, 6, dev);
+            /* Get the previous configuration data */
+            rslt = bmi3_get_regs(BMI3_REG_IO_INT_CTRL, data_array, 2, dev);
 
             if (rslt == BMI3_OK)
             {
-                /* Get word to calculate config major and minor version from same word */
-                lsb_msb = (uint16_t)(version[0] | ((uint16_t) version[1] << 8));
+                /* Set interrupt pin 1 configuration */
+                if (int_pin == BMI3_INT1)
+                {
+                    reg_data = data_array[0];
 
-                config_version->config1_minor_version = (uint8_t)(lsb_msb & BMI3_CONFIG_1_MINOR_MASK);
+                    /* Configure active low or high */
+                    lvl = BMI3_SET_BIT_POS0(reg_data, BMI3_INT1_LVL, int_cfg->pin_cfg[0].lvl);
 
-                config_version->config1_major_version = (lsb_msb & BMI3_CONFIG_1_MAJOR_MASK) >> BMI3_CONFIG_POS;
+                    /* Configure push-pull or open drain */
+                    od = BMI3_SET_BITS(reg_data, BMI3_INT1_OD, int_cfg->pin_cfg[0].od);
 
-                /* Get word to calculate config major and minor version from same word */
-                lsb_msb = (uint16_t)(version[2] | ((uint16_t) version[3] << 8));
+                    /* Configure output enable */
+                    output_en = BMI3_SET_BITS(reg_data, BMI3_INT1_OUTPUT_EN, int_cfg->pin_cfg[0].output_en);
 
-                config_version->config2_minor_version = (uint8_t)(lsb_msb & BMI3_CONFIG_2_MINOR_MASK);
+                    /* Copy the data to be written in the respective array */
+                    data_array[0] = (uint8_t)(lvl | od | output_en);
+                }
 
-                config_version->config2_major_version = (lsb_msb & BMI3_CONFIG_2_MAJOR_MASK) >> BMI3_CONFIG_POS;
-            }
-        }
-    }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This API is used to perform the self-calibration for either sensitivity or offset or both.
- */
-int8_t bmi3_perform_gyro_sc(uint8_t sc_selection,
-                            uint8_t apply_corr,
-                            struct bmi3_self_calib_rslt *sc_rslt,
-                            struct bmi3_dev *dev)
-{
-    /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Structure to store sensor configuration for accel */
-    struct bmi3_sens_config get_config, set_config;
-
-    if (sc_rslt != NULL)
-    {
-        get_config.type = BMI3_ACCEL;
-
-        /* Get accel configurations */
-        rslt = bmi3_get_sensor_config(&get_config, 1, dev);
-
-        if (rslt == BMI3_OK)
-        {
-            /* Enable accelerometer */
-            set_config.type = BMI3_ACCEL;
+                /* Set interrupt pin 2 configuration */
+                if (int_pin == BMI3_INT2)
+                {
+                    reg_data = ((uint16_t)data_array[1] << 8);
 
-            /* Definition of accel configuration which are the preconditions for self-calibration */
-            set_config.cfg.acc.acc_mode = BMI3_ACC_MODE_HIGH_PERF;
-            set_config.cfg.acc.odr = BMI3_ACC_ODR_100HZ;
-            set_config.cfg.acc.range = BMI3_ACC_RANGE_8G;
+                    /* Configure active low or high */
+                    lvl = BMI3_SET_BITS(reg_data, BMI3_INT2_LVL, int_cfg->pin_cfg[1].lvl);
 
-            /* Write the sensor configurations */
-            rslt = bmi3_set_sensor_config(&set_config, 1, dev);
-        }
+                    /* Configure push-pull or open drain */
+                    od = BMI3_SET_BITS(reg_data, BMI3_INT2_OD, int_cfg->pin_cfg[1].od);
 
-        if (rslt == BMI3_OK)
-        {
-            /* Disable alternate accel and gyro mode */
-            rslt = disable_alt_conf_acc_gyr_mode(dev);
-        }
+                    /* Configure output enable */
+                    output_en = BMI3_SET_BITS(reg_data, BMI3_INT2_OUTPUT_EN, int_cfg->pin_cfg[1].output_en);
 
-        if (rslt == BMI3_OK)
-        {
-            /* Get and set the self-calibration mode given by the user in the self-calibration dma register. */
-            rslt = get_set_sc_dma(sc_selection, apply_corr, dev);
+                    /* Copy the data to be written in the respective array */
+                    data_array[1] = (uint8_t)((lvl | od | output_en) >> 8);
+                }
 
-            if (rslt == BMI3_OK)
-            {
-                /* Trigger the self-calibration command */
-                rslt = bmi3_set_command_register(BMI3_CMD_SELF_CALIB_TRIGGER, dev);
+                /* Set the configurations simultaneously as
+                 * INT1_IO_CTRL, INT2_IO_CTRL, and INT_LATCH lie
+                 * in consecutive addresses
+                 */
+                rslt = bmi3_set_regs(BMI3_REG_IO_INT_CTRL, data_array, 2, dev);
 
                 if (rslt == BMI3_OK)
                 {
-                    /* Get the self-calibration status and result */
-                    rslt = get_sc_gyro_rslt(sc_rslt, dev);
+                    rslt = set_latch_mode(int_cfg, dev);
                 }
             }
         }
-
-        if (rslt == BMI3_OK)
+        else
         {
-            /* Restore accel configurations */
-            rslt = bmi3_set_sensor_config(&get_config, 1, dev);
+            rslt = BMI3_E_INVALID_INT_PIN;
         }
     }
     else
@@ -3657,60 +3758,63 @@ int8_t bmi3_perform_gyro_sc(uint8_t sc_selection,
 }
 
 /*!
- * @brief This API is used to set the data sample rate for i3c sync
+ * @brief This API gets:
+ *        1) The output configuration of the selected interrupt pin:
+ *           INT1 or INT2.
+ *        2) The interrupt mode: permanently latched or non-latched.
  */
-int8_t bmi3_set_i3c_tc_sync_tph(uint16_t sample_rate, struct bmi3_dev *dev)
+int8_t bmi3_get_int_pin_config(struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    uint16_t reg_data;
-
-    /* To get the second byte data in word calculation */
-    uint16_t tc_tph;
+    /* Variable to define data array */
+    uint8_t data_array[3] = { 0 };
 
-    /* Array to store data */
-    uint8_t data_array[2] = { 0 };
+    /* Variable to define type of interrupt pin  */
+    uint8_t int_pin = 0;
 
-    /* Get the data sample rate of i3c sync */
-    rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_TPH, data_array, 2, dev);
+    uint16_t reg_data;
 
-    if (rslt == BMI3_OK)
+    if (int_cfg != NULL)
     {
-        data_array[0] = (uint8_t)BMI3_SET_BIT_POS0(data_array[0], BMI3_I3C_TC_SYNC_TPH, sample_rate);
+        /* Copy the pin type to a local variable */
+        int_pin = int_cfg->pin_type;
 
-        reg_data = ((uint16_t)data_array[1] << 8);
+        /* Get the previous configuration data */
+        rslt = bmi3_get_regs(BMI3_REG_IO_INT_CTRL, data_array, 3, dev);
 
-        tc_tph = (uint8_t)BMI3_SET_BIT_POS0(reg_data, BMI3_I3C_TC_SYNC_TPH, sample_rate);
+        if (rslt == BMI3_OK)
+        {
+            /* Get interrupt pin 1 configuration */
+            if (int_pin == BMI3_INT1)
+            {
+                /* Get active low or high */
+                int_cfg->pin_cfg[0].lvl = BMI3_GET_BIT_POS0(data_array[0], BMI3_INT1_LVL);
 
-        data_array[1] = (uint8_t)(tc_tph >> 8);
+                /* Get push-pull or open drain */
+                int_cfg->pin_cfg[0].od = BMI3_GET_BITS(data_array[0], BMI3_INT1_OD);
 
-        rslt = bmi3_set_regs(BMI3_REG_I3C_TC_SYNC_TPH, data_array, 2, dev);
-    }
+                /* Get output enable */
+                int_cfg->pin_cfg[0].output_en = BMI3_GET_BITS(data_array[0], BMI3_INT1_OUTPUT_EN);
+            }
 
-    return rslt;
-}
+            /* Get interrupt pin 2 configuration */
+            if (int_pin == BMI3_INT2)
+            {
+                reg_data = ((uint16_t)data_array[1] << 8);
 
-/*!
- * @brief This API is used to get the data sample rate for i3c sync
- */
-int8_t bmi3_get_i3c_tc_sync_tph(uint16_t *sample_rate, struct bmi3_dev *dev)
-{
-    /* Variable to store result of API */
-    int8_t rslt;
+                /* Get active low or high */
+                int_cfg->pin_cfg[1].lvl = BMI3_GET_BITS(reg_data, BMI3_INT2_LVL);
 
-    /* Array to store data */
-    uint8_t data_array[2] = { 0 };
+                /* Get push-pull or open drain */
+                int_cfg->pin_cfg[1].od = BMI3_GET_BITS(reg_data, BMI3_INT2_OD);
 
-    if (sample_rate != NULL)
-    {
-        /* Get the data sample rate of i3c sync */
-        rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_TPH, data_array, 2, dev);
+                /* Get output enable */
+                int_cfg->pin_cfg[1].output_en = BMI3_GET_BITS(reg_data, BMI3_INT2_OUTPUT_EN);
+            }
 
-        if (rslt == BMI3_OK)
-        {
-            /* Get i3c sync tph sample rate */
-            *sample_rate = (uint16_t)(data_array[0] | (uint16_t)data_array[1] << 8);
+            rslt = get_latch_mode(int_cfg, dev);
         }
     }
     else
@@ -3722,51 +3826,54 @@ int8_t bmi3_get_i3c_tc_sync_tph(uint16_t *sample_rate, struct bmi3_dev *dev)
 }
 
 /*!
- * @brief This API is used set the TU(time unit) value is used to scale the delay time payload
- * according to the hosts needs
+ * @brief This API is used to get the sensor time.
  */
-int8_t bmi3_set_i3c_tc_sync_tu(uint8_t delay_time, struct bmi3_dev *dev)
+int8_t bmi3_get_sensor_time(uint32_t *sensor_time, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to define data array */
-    uint8_t data_array[2] = { 0 };
-
-    /* Get the i3c sync time unit */
-    rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_TU, data_array, 2, dev);
+    uint8_t reg_data[4] = { 0 };
 
-    if (rslt == BMI3_OK)
+    if (sensor_time != NULL)
     {
-        /* Set the i3c sync time unit */
-        data_array[0] = BMI3_SET_BIT_POS0(data_array[0], BMI3_I3C_TC_SYNC_TU, delay_time);
-
-        rslt = bmi3_set_regs(BMI3_REG_I3C_TC_SYNC_TU, data_array, 2, dev);
+        rslt = bmi3_get_regs(BMI3_REG_SENSOR_TIME_0, reg_data, 4, dev);
+        if (rslt == BMI3_OK)
+        {
+            *sensor_time =
+                (uint32_t)(reg_data[0] | (uint32_t)reg_data[1] << 8 | (uint32_t)reg_data[2] << 16 |
+                           (uint32_t)reg_data[3] <<
+                    24);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API is used get the TU(time unit) value is used to scale the delay time payload
- * according to the hosts needs
+ * @brief This API reads the raw temperature data from the register and can be
+ * converted into degree celsius.
  */
-int8_t bmi3_get_i3c_tc_sync_tu(uint8_t *delay_time, struct bmi3_dev *dev)
+int8_t bmi3_get_temperature_data(uint16_t *temp_data, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to define data array */
-    uint8_t data_array[2] = { 0 };
+    /* Array to define data stored in register */
+    uint8_t reg_data[2] = { 0 };
 
-    if (delay_time != NULL)
+    if (temp_data != NULL)
     {
-        /* Get the i3c sync time unit */
-        rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_TU, data_array, 2, dev);
+        /* Read the sensor data */
+        rslt = bmi3_get_regs(BMI3_REG_TEMP_DATA, reg_data, 2, dev);
 
         if (rslt == BMI3_OK)
         {
-            *delay_time = BMI3_GET_BIT_POS0(data_array[0], BMI3_I3C_TC_SYNC_TU);
+            *temp_data = (uint16_t)(reg_data[0] | ((uint16_t)reg_data[1] << 8));
         }
     }
     else
@@ -3778,50 +3885,52 @@ int8_t bmi3_get_i3c_tc_sync_tu(uint8_t *delay_time, struct bmi3_dev *dev)
 }
 
 /*!
- * @brief This API is used to set the i3c sync ODR.
+ * @brief This API reads the FIFO data.
  */
-int8_t bmi3_set_i3c_tc_sync_odr(uint8_t odr, struct bmi3_dev *dev)
+int8_t bmi3_read_fifo_data(struct bmi3_fifo_frame *fifo, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to define data array */
-    uint8_t data_array[2] = { 0 };
+    /* Variable to store FIFO data address */
+    uint8_t reg_addr = BMI3_REG_FIFO_DATA;
 
-    /* Get the i3c sync ODR */
-    rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_ODR, data_array, 2, dev);
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-    if (rslt == BMI3_OK)
+    if ((rslt == BMI3_OK) && (fifo != NULL))
     {
-        /* Set the i3c sync ODR */
-        data_array[0] = BMI3_SET_BIT_POS0(data_array[0], BMI3_I3C_TC_SYNC_ODR, odr);
-
-        rslt = bmi3_set_regs(BMI3_REG_I3C_TC_SYNC_ODR, data_array, 2, dev);
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This API is used to get the i3c sync ODR.
- */
-int8_t bmi3_get_i3c_tc_sync_odr(uint8_t *odr, struct bmi3_dev *dev)
-{
-    /* Variable to store result of API */
-    int8_t rslt;
+        /* The configuration and the data are read under one lock */
+        lock_dev(dev);
 
-    /* Array to store data */
-    uint8_t data_array[2] = { 0 };
+        /* Get sensor enable status, of which the data is to be read */
+        rslt = get_fifo_sens(&fifo->available_fifo_sens, dev);
 
-    if (odr != NULL)
-    {
-        /* Get the i3c sync ODR */
-        rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_ODR, data_array, 2, dev);
+        /* The FIFO data read has to see the queued writes, the cached configuration already does */
+        if ((rslt == BMI3_OK) && (dev->batch != NULL) && (dev->batch->num_ops != 0))
+        {
+            rslt = flush_batch(dev);
+        }
 
         if (rslt == BMI3_OK)
         {
-            *odr = BMI3_GET_BIT_POS0(data_array[0], BMI3_I3C_TC_SYNC_ODR);
+            if (fifo->length != 0)
+            {
+                /* Read FIFO data */
+                if (dev->intf == BMI3_SPI_INTF)
+                {
+                    reg_addr = (reg_addr | BMI3_SPI_RD_MASK);
+                }
+
+                rslt = dev->read(reg_addr, fifo->data, (uint32_t)fifo->length, dev->intf_ptr);
+            }
+            else
+            {
+                rslt = BMI3_E_COM_FAIL;
+            }
         }
+
+        unlock_dev(dev);
     }
     else
     {
@@ -3832,52 +3941,89 @@ int8_t bmi3_get_i3c_tc_sync_odr(uint8_t *odr, struct bmi3_dev *dev)
 }
 
 /*!
- * @brief This internal API gets i3c sync i3c_tc_res
+ * @brief This API parses and extracts the accelerometer frames from FIFO data
+ * read by the "bmi3_read_fifo_data" API and stores it in the "accel_data"
+ * structure instance.
  */
-int8_t bmi3_get_i3c_sync_i3c_tc_res(uint8_t *i3c_tc_res, struct bmi3_dev *dev)
+int8_t bmi3_extract_accel(struct bmi3_fifo_sens_axes_data *accel_data,
+                          struct bmi3_fifo_frame *fifo,
+                          const struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define the feature configuration */
-    uint8_t i3c_sync_i3c_tc_res[2] = { 0 };
+    /* Variable to index the bytes */
+    uint16_t data_index = 0;
 
-    /* Array to set the base address of i3c sync feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_I3C_SYNC, 0 };
+    /* Variable to index accelerometer frames */
+    uint16_t accel_index = 0;
 
-    /* Variable to define array offset */
-    uint8_t idx = 0;
+    /* Variable to define the data enable byte */
+    uint16_t data_enable = 0;
 
-    /* Variable to define LSB */
-    uint16_t lsb;
+    rslt = null_ptr_check(dev);
 
-    /* Variable to define MSB */
-    uint16_t msb;
-
-    /* Variable to define a word */
-    uint16_t lsb_msb;
-
-    if (i3c_tc_res != NULL)
+    /* Null-pointer check */
+    if ((rslt == BMI3_OK) && (accel_data != NULL) && (fifo != NULL))
     {
-        /* Set the tap base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        data_index = dev->dummy_byte;
 
-        if (rslt == BMI3_OK)
+        /* Convert word to byte since all sensor enables are in a byte */
+        data_enable = fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_ACC_FRM;
+
+        for (; (data_index < fifo->length);)
         {
-            /* Get the configuration from the feature engine register where tap feature resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, i3c_sync_i3c_tc_res, 2, dev);
+            rslt = check_data_index(data_index, fifo);
 
             if (rslt == BMI3_OK)
             {
-                /* Get word to calculate i3c_tc_res from the same word */
-                lsb = (uint16_t) i3c_sync_i3c_tc_res[idx++];
-                msb = ((uint16_t) i3c_sync_i3c_tc_res[idx++] << 8);
-                lsb_msb = lsb | msb;
+                /* Unpack frame to get the accelerometer data */
+                rslt = unpack_fifo_data_frame(accel_data, &data_index, &accel_index, data_enable, fifo);
+            }
 
-                /* Get i3c_tc_res */
-                *i3c_tc_res = (uint8_t)(lsb_msb & BMI3_I3C_SYNC_FILTER_EN_MASK);
+            if (rslt != BMI3_W_PARTIAL_READ)
+            {
+                /* A frame that was not unpacked still has to be skipped when it is the only
+                 * sensor in the FIFO, unpacked frames already advanced the index
+                 */
+                if ((fifo->available_fifo_sens == BMI3_FIFO_HEAD_LESS_ACC_FRM) && (rslt == BMI3_W_FIFO_INVALID_FRAME))
+                {
+                    data_index = data_index + BMI3_LENGTH_FIFO_ACC;
+                }
+
+                /* If gyro enable with the accel, increment the accel index by 6
+                 * since gyro frame has 6 bytes of data
+                 */
+                if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_GYR_FRM)
+                {
+                    data_index = data_index + BMI3_LENGTH_FIFO_GYR;
+                }
+
+                /* If sensor time enable with the accel, increment the accel index by 2
+                 * since sensor time frame has 2 bytes of data
+                 */
+                if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
+                {
+                    data_index = data_index + BMI3_LENGTH_SENSOR_TIME;
+                }
+
+                /* If temperature enable with the accel, increment the accel index by 2
+                 * since temperature frame has 2 bytes of data
+                 */
+                if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_TEMP_FRM)
+                {
+                    data_index = data_index + BMI3_LENGTH_TEMPERATURE;
+                }
             }
         }
+
+        /* Update number of accelerometer frames to be read */
+        (fifo->avail_fifo_accel_frames) = accel_index;
+
+        if (fifo->avail_fifo_accel_frames != 0)
+        {
+            rslt = BMI3_OK;
+        }
     }
     else
     {
@@ -3888,79 +4034,205 @@ int8_t bmi3_get_i3c_sync_i3c_tc_res(uint8_t *i3c_tc_res, struct bmi3_dev *dev)
 }
 
 /*!
- * @brief This internal API sets i3c sync i3c_tc_res
+ * @brief This API parses and extracts the temperature frames from FIFO data
+ * read by the "bmi3_read_fifo_data" API and stores it in the "temp_data"
+ * structure instance.
  */
-int8_t bmi3_set_i3c_sync_i3c_tc_res(uint8_t i3c_tc_res, struct bmi3_dev *dev)
+int8_t bmi3_extract_temperature(struct bmi3_fifo_temperature_data *temp_data,
+                                struct bmi3_fifo_frame *fifo,
+                                const struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define the feature configuration */
-    uint8_t i3c_sync_i3c_tc_res[2] = { 0 };
+    /* Variable to index the bytes */
+    uint16_t data_index = 0;
 
-    /* Array to set the base address of i3c sync feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_I3C_SYNC, 0 };
+    /* Variable to index temperature frames */
+    uint16_t temp_index = 0;
 
-    /* Set the tap base address to feature engine transmission address to start DMA transaction */
-    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+    /* Variable to define the data enable byte */
+    uint16_t data_enable = 0;
 
-    if (rslt == BMI3_OK)
+    rslt = null_ptr_check(dev);
+
+    /* Null-pointer check */
+    if ((rslt == BMI3_OK) && (temp_data != NULL) && (fifo != NULL))
     {
-        /* Set i3c_tc_res */
-        i3c_sync_i3c_tc_res[0] = BMI3_SET_BIT_POS0(i3c_sync_i3c_tc_res[0], BMI3_I3C_SYNC_FILTER_EN, i3c_tc_res);
+        data_index = dev->dummy_byte;
 
-        /* Left shift by 8 times so that we can set rest of the values of i3c_tc_res data in word */
-        i3c_sync_i3c_tc_res[1] = (uint8_t)(i3c_sync_i3c_tc_res[1] << 8);
+        /* Convert word to byte since all sensor enables are in a byte */
+        data_enable = fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_TEMP_FRM;
 
-        /* Set the configuration back to the feature engine register */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, i3c_sync_i3c_tc_res, 2, dev);
+        for (; (data_index < fifo->length);)
+        {
+            /* If accel enable with the temperature, increment the temperature index by 6
+             * since accel frame has 6 bytes of data
+             */
+            if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_ACC_FRM)
+            {
+                data_index = data_index + BMI3_LENGTH_FIFO_ACC;
+            }
+
+            /* If gyro enable with the temperature, increment the temperature index by 6
+             * since gyro frame has 6 bytes of data
+             */
+            if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_GYR_FRM)
+            {
+                data_index = data_index + BMI3_LENGTH_FIFO_GYR;
+            }
+
+            rslt = check_data_index(data_index, fifo);
+
+            if (rslt == BMI3_OK)
+            {
+                /* Unpack frame to get the temperature data */
+                rslt = unpack_fifo_data_frame(temp_data, &data_index, &temp_index, data_enable, fifo);
+            }
+
+            if (rslt != BMI3_W_PARTIAL_READ)
+            {
+                /* If sensor time enable with the temperature, increment the temperature index by 2
+                 * since sensor time frame has 2 bytes of data
+                 */
+                if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
+                {
+                    data_index = data_index + BMI3_LENGTH_SENSOR_TIME;
+                }
+            }
+        }
+
+        /* Update number of temperature frames to be read */
+        (fifo->avail_fifo_temp_frames) = temp_index;
+
+        if (fifo->avail_fifo_temp_frames != 0)
+        {
+            rslt = BMI3_OK;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to enable accel and gyro for alternate configuration
+ * @brief This API parses and extracts the gyro frames from FIFO data
+ * read by the "bmi3_read_fifo_data" API and stores it in the "gyro_data"
+ * structure instance.
  */
-int8_t bmi3_alternate_config_ctrl(uint8_t config_en, uint8_t alt_rst_conf, struct bmi3_dev *dev)
+int8_t bmi3_extract_gyro(struct bmi3_fifo_sens_axes_data *gyro_data,
+                         struct bmi3_fifo_frame *fifo,
+                         const struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    uint8_t data[2] = { 0 };
+    /* Variable to index the bytes */
+    uint16_t data_index = 0;
 
-    rslt = bmi3_get_regs(BMI3_REG_ALT_CONF, data, 2, dev);
+    /* Variable to index gyro frames */
+    uint16_t gyro_index = 0;
 
-    if (rslt == BMI3_OK)
+    /* Variable to define the data enable byte */
+    uint16_t data_enable = 0;
+
+    rslt = null_ptr_check(dev);
+
+    /* Null-pointer check */
+    if ((rslt == BMI3_OK) && (gyro_data != NULL) && (fifo != NULL))
     {
-        data[0] = (config_en & (BMI3_ALT_ACC_ENABLE | BMI3_ALT_GYR_ENABLE));
-        data[1] = (alt_rst_conf & BMI3_ALT_CONF_RESET_ON);
+        data_index = dev->dummy_byte;
 
-        rslt = bmi3_set_regs(BMI3_REG_ALT_CONF, data, 2, dev);
+        /* Convert word to byte since all sensor enables are in a byte */
+        data_enable = fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_GYR_FRM;
+
+        for (; (data_index < fifo->length);)
+        {
+            if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_ACC_FRM)
+            {
+                data_index = data_index + BMI3_LENGTH_FIFO_ACC;
+            }
+
+            rslt = check_data_index(data_index, fifo);
+
+            if (rslt == BMI3_OK)
+            {
+                /* Unpack frame to get the gyro data */
+                rslt = unpack_fifo_data_frame(gyro_data, &data_index, &gyro_index, data_enable, fifo);
+            }
+
+            if (rslt != BMI3_W_PARTIAL_READ)
+            {
+                /* A frame that was not unpacked still has to be skipped when it is the only
+                 * sensor in the FIFO, unpacked frames already advanced the index
+                 */
+                if ((fifo->available_fifo_sens == BMI3_FIFO_HEAD_LESS_GYR_FRM) && (rslt == BMI3_W_FIFO_INVALID_FRAME))
+                {
+                    data_index = data_index + BMI3_LENGTH_FIFO_GYR;
+                }
+
+                /* If sensor time enable with the gyro, increment the sensor time index by 2
+                 * since sensor time frame has 2 bytes of data
+                 */
+                if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
+                {
+                    data_index = data_index + BMI3_LENGTH_SENSOR_TIME;
+                }
+
+                /* If temperature enable with the gyro, increment the temperature index by 2
+                 * since temperature frame has 2 bytes of data
+                 */
+                if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_TEMP_FRM)
+                {
+                    data_index = data_index + BMI3_LENGTH_TEMPERATURE;
+                }
+            }
+        }
+
+        /* Update number of gyro frames to be read */
+        (fifo->avail_fifo_gyro_frames) = gyro_index;
+
+        if (fifo->avail_fifo_gyro_frames != 0)
+        {
+            rslt = BMI3_OK;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to read the status of alternate configuration
+ * @brief This API parses accelerometer, gyroscope, temperature and sensor time frames from
+ * FIFO data read by the "bmi3_read_fifo_data" API in a single pass.
  */
-int8_t bmi3_read_alternate_status(struct bmi3_alt_status *alt_status, struct bmi3_dev *dev)
+int8_t bmi3_extract_fifo_data(struct bmi3_fifo_demux *demux, struct bmi3_fifo_frame *fifo, const struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    uint8_t data[2] = { 0 };
+    /* Variable to store number of FIFO bytes after the dummy bytes */
+    uint16_t length;
 
-    if (alt_status != NULL)
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (demux != NULL) && (fifo != NULL) && (fifo->data != NULL))
     {
-        rslt = bmi3_get_regs(BMI3_REG_ALT_STATUS, data, 2, dev);
+        length = get_fifo_data_length(fifo, dev);
 
-        if (rslt == BMI3_OK)
-        {
-            alt_status->alt_accel_status = (data[0] & BMI3_ALT_ACCEL_STATUS_MASK);
-            alt_status->alt_gyro_status = (data[0] & BMI3_ALT_GYRO_STATUS_MASK) >> BMI3_ALT_GYRO_STATUS_POS;
-        }
+        reset_fifo_demux(demux);
+        rslt = demux_fifo_frames(&fifo->data[dev->dummy_byte], length, fifo->available_fifo_sens, demux);
+
+        fifo->avail_fifo_accel_frames = demux->accel_frames;
+        fifo->avail_fifo_gyro_frames = demux->gyro_frames;
+        fifo->avail_fifo_temp_frames = demux->temp_frames;
+        fifo->avail_fifo_sens_time_frames = (uint8_t)demux->sensor_time_frames;
     }
     else
     {
@@ -3971,40 +4243,41 @@ int8_t bmi3_read_alternate_status(struct bmi3_alt_status *alt_status, struct bmi
 }
 
 /*!
- * @brief This API gets offset dgain for the sensor which stores self-calibrated values for accel.
+ * @brief This API parses accelerometer, gyroscope, temperature and sensor time frames from
+ * a FIFO view returned by the "bmi3_read_fifo_view" API in a single pass.
  */
-int8_t bmi3_get_acc_dp_off_dgain(struct bmi3_acc_dp_gain_offset *acc_dp_gain_offset, struct bmi3_dev *dev)
+int8_t bmi3_extract_fifo_view(struct bmi3_fifo_demux *demux, const struct bmi3_fifo_view *view)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    uint8_t reg_data[12] = { 0 };
+    if ((demux != NULL) && (view != NULL) && ((view->data != NULL) || (view->length == 0)))
+    {
+        reset_fifo_demux(demux);
+        rslt = demux_fifo_frames(view->data, view->length, view->available_fifo_sens, demux);
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
-    uint16_t acc_dp_off_x, acc_dp_off_y, acc_dp_off_z;
-    uint8_t acc_dp_dgain_x, acc_dp_dgain_y, acc_dp_dgain_z;
+    return rslt;
+}
 
-    /* NULL pointer check */
-    if (acc_dp_gain_offset != NULL)
-    {
-        /* Get temperature user offset for accel */
-        rslt = bmi3_get_regs(BMI3_REG_ACC_DP_OFF_X, reg_data, 12, dev);
-
-        if (rslt == BMI3_OK)
-        {
-            acc_dp_off_x = (uint16_t)(((uint16_t)reg_data[1] << 8) | reg_data[0]);
-            acc_dp_dgain_x = reg_data[2];
-            acc_dp_off_y = (uint16_t)(((uint16_t)reg_data[5] << 8) | reg_data[4]);
-            acc_dp_dgain_y = reg_data[6];
-            acc_dp_off_z = (uint16_t)(((uint16_t)reg_data[9] << 8) | reg_data[8]);
-            acc_dp_dgain_z = reg_data[10];
+/*!
+ * @brief This API resets the state of the streaming FIFO parser.
+ */
+int8_t bmi3_fifo_stream_init(struct bmi3_fifo_stream *stream)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
 
-            acc_dp_gain_offset->acc_dp_off_x = (acc_dp_off_x & dev->accel_bit_width);
-            acc_dp_gain_offset->acc_dp_dgain_x = (acc_dp_dgain_x & BMI3_ACC_DP_DGAIN_X_MASK);
-            acc_dp_gain_offset->acc_dp_off_y = (acc_dp_off_y & dev->accel_bit_width);
-            acc_dp_gain_offset->acc_dp_dgain_y = (acc_dp_dgain_y & BMI3_ACC_DP_DGAIN_Y_MASK);
-            acc_dp_gain_offset->acc_dp_off_z = (acc_dp_off_z & dev->accel_bit_width);
-            acc_dp_gain_offset->acc_dp_dgain_z = (acc_dp_dgain_z & BMI3_ACC_DP_DGAIN_Z_MASK);
-        }
+    if (stream != NULL)
+    {
+        stream->available_fifo_sens = 0;
+        stream->tail_len = 0;
+        stream->sensor_time = 0;
+        stream->total_frames = 0;
     }
     else
     {
@@ -4015,39 +4288,92 @@ int8_t bmi3_get_acc_dp_off_dgain(struct bmi3_acc_dp_gain_offset *acc_dp_gain_off
 }
 
 /*!
- * @brief This API gets offset dgain for the sensor which stores self-calibrated values for gyro.
+ * @brief This API parses FIFO data read by the "bmi3_read_fifo_data" API in chunks of any
+ * length, carrying an incomplete frame at the end of one read over to the next.
  */
-int8_t bmi3_get_gyro_dp_off_dgain(struct bmi3_gyr_dp_gain_offset *gyr_dp_gain_offset, struct bmi3_dev *dev)
+int8_t bmi3_fifo_stream_parse(struct bmi3_fifo_stream *stream,
+                              struct bmi3_fifo_demux *demux,
+                              const struct bmi3_fifo_frame *fifo,
+                              const struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    uint8_t reg_data[12];
+    /* Variables to store number of FIFO bytes, frame length and bytes consumed */
+    uint16_t length, stride, used = 0, whole;
 
-    uint16_t gyr_dp_off_x, gyr_dp_off_y, gyr_dp_off_z;
-    uint8_t gyr_dp_dgain_x, gyr_dp_dgain_y, gyr_dp_dgain_z;
+    /* Pointer to FIFO data after the dummy bytes */
+    const uint8_t *data;
 
-    /* NULL pointer check */
-    if (gyr_dp_gain_offset != NULL)
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (stream != NULL) && (demux != NULL) && (fifo != NULL) && (fifo->data != NULL))
     {
-        /* Get temperature user offset for gyro */
-        rslt = bmi3_get_regs(BMI3_REG_GYR_DP_OFF_X, reg_data, 12, dev);
+        data = &fifo->data[dev->dummy_byte];
+        length = get_fifo_data_length(fifo, dev);
+        stride = get_fifo_frame_length(fifo->available_fifo_sens);
+
+        reset_fifo_demux(demux);
+
+        /* Pending bytes of another FIFO configuration can not be completed */
+        if (stream->available_fifo_sens != fifo->available_fifo_sens)
+        {
+            stream->available_fifo_sens = fifo->available_fifo_sens;
+            stream->tail_len = 0;
+        }
+
+        if (!(fifo->available_fifo_sens & (BMI3_FIFO_HEAD_LESS_ACC_FRM | BMI3_FIFO_HEAD_LESS_GYR_FRM)))
+        {
+            rslt = BMI3_W_FIFO_INVALID_FRAME;
+        }
+
+        /* Complete the frame left over from the previous read */
+        if ((rslt == BMI3_OK) && (stream->tail_len != 0))
+        {
+            while ((stream->tail_len < stride) && (used < length))
+            {
+                stream->tail[stream->tail_len++] = data[used++];
+            }
+
+            if (stream->tail_len == stride)
+            {
+                (void)demux_fifo_frames(stream->tail, stride, fifo->available_fifo_sens, demux);
+                stream->tail_len = 0;
+
+                if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
+                {
+                    stream->sensor_time = get_fifo_word(&stream->tail[stride - BMI3_LENGTH_SENSOR_TIME]);
+                }
+            }
+        }
 
         if (rslt == BMI3_OK)
         {
-            gyr_dp_off_x = (uint16_t)(((uint16_t)reg_data[1] << 8) | reg_data[0]);
-            gyr_dp_dgain_x = reg_data[2];
-            gyr_dp_off_y = (uint16_t)(((uint16_t)reg_data[5] << 8) | reg_data[4]);
-            gyr_dp_dgain_y = reg_data[6];
-            gyr_dp_off_z = (uint16_t)(((uint16_t)reg_data[9] << 8) | reg_data[8]);
-            gyr_dp_dgain_z = reg_data[10];
+            whole = (uint16_t)((length - used) - ((length - used) % stride));
 
-            gyr_dp_gain_offset->gyr_dp_off_x = BMI3_GET_BIT_POS0(gyr_dp_off_x, BMI3_GYR_DP_OFF_X);
-            gyr_dp_gain_offset->gyr_dp_dgain_x = BMI3_GET_BIT_POS0(gyr_dp_dgain_x, BMI3_GYR_DP_DGAIN_X);
-            gyr_dp_gain_offset->gyr_dp_off_y = BMI3_GET_BIT_POS0(gyr_dp_off_y, BMI3_GYR_DP_OFF_Y);
-            gyr_dp_gain_offset->gyr_dp_dgain_y = BMI3_GET_BIT_POS0(gyr_dp_dgain_y, BMI3_GYR_DP_DGAIN_Y);
-            gyr_dp_gain_offset->gyr_dp_off_z = BMI3_GET_BIT_POS0(gyr_dp_off_z, BMI3_GYR_DP_OFF_Z);
-            gyr_dp_gain_offset->gyr_dp_dgain_z = BMI3_GET_BIT_POS0(gyr_dp_dgain_z, BMI3_GYR_DP_DGAIN_Z);
+            if (whole != 0)
+            {
+                (void)demux_fifo_frames(&data[used], whole, fifo->available_fifo_sens, demux);
+                used = (uint16_t)(used + whole);
+
+                if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
+                {
+                    stream->sensor_time = get_fifo_word(&data[used - BMI3_LENGTH_SENSOR_TIME]);
+                }
+            }
+
+            /* Keep the incomplete frame for the next read */
+            while (used < length)
+            {
+                stream->tail[stream->tail_len++] = data[used++];
+            }
+
+            stream->total_frames += demux->total_frames;
+
+            if (demux->total_frames == 0)
+            {
+                rslt = (stream->tail_len == 0) ? BMI3_W_FIFO_EMPTY : BMI3_W_PARTIAL_READ;
+            }
         }
     }
     else
@@ -4059,49 +4385,53 @@ int8_t bmi3_get_gyro_dp_off_dgain(struct bmi3_gyr_dp_gain_offset *gyr_dp_gain_of
 }
 
 /*!
- * @brief This API sets offset dgain for the sensor which stores self-calibrated values for accel.
+ * @brief This API initializes the FIFO timestamp reconstruction.
  */
-int8_t bmi3_set_acc_dp_off_dgain(const struct bmi3_acc_dp_gain_offset *acc_dp_gain_offset, struct bmi3_dev *dev)
+int8_t bmi3_fifo_time_sync_init(struct bmi3_fifo_time_sync *sync, const struct bmi3_accel_config *acc_cfg)
 {
     /* Variable to store result of API */
-    int8_t rslt;
-
-    uint8_t acc_dp_gain_x, acc_dp_gain_y, acc_dp_gain_z;
-
-    uint16_t acc_dp_off_x1, acc_dp_off_y1, acc_dp_off_z1;
-
-    uint8_t acc_off_gain[12] = { 0 };
-
-    /* Null-pointer check */
-    rslt = null_ptr_check(dev);
+    int8_t rslt = BMI3_OK;
 
-    /* NULL pointer check */
-    if ((rslt == BMI3_OK) && (acc_dp_gain_offset != NULL))
+    if ((sync != NULL) && (acc_cfg != NULL))
     {
-        acc_dp_off_x1 = (acc_dp_gain_offset->acc_dp_off_x & dev->accel_bit_width);
-
-        acc_dp_gain_x = (uint8_t)(acc_dp_gain_offset->acc_dp_dgain_x & BMI3_ACC_DP_DGAIN_X_MASK);
-
-        acc_dp_off_y1 = (acc_dp_gain_offset->acc_dp_off_y & dev->accel_bit_width);
-
-        acc_dp_gain_y = (uint8_t)(acc_dp_gain_offset->acc_dp_dgain_y & BMI3_ACC_DP_DGAIN_Y_MASK);
+        if ((acc_cfg->odr >= BMI3_ACC_ODR_0_78HZ) && (acc_cfg->odr <= BMI3_ACC_ODR_6400HZ))
+        {
+            sync->frame_period = (uint32_t)BMI3_SENSOR_TIME_TICKS_6400HZ << (BMI3_ACC_ODR_6400HZ - acc_cfg->odr);
+            sync->last_time = 0;
+            sync->anchor = 0;
+            sync->anchor_pending = BMI3_FALSE;
+            sync->synced = BMI3_FALSE;
+        }
+        else
+        {
+            rslt = BMI3_E_ACC_INVALID_CFG;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
-        acc_dp_off_z1 = (acc_dp_gain_offset->acc_dp_off_z & dev->accel_bit_width);
+    return rslt;
+}
 
-        acc_dp_gain_z = (uint8_t)(acc_dp_gain_offset->acc_dp_dgain_z & BMI3_ACC_DP_DGAIN_Z_MASK);
+/*!
+ * @brief This API reads the full 32-bit sensor time once, to which the next FIFO
+ * batch is aligned.
+ */
+int8_t bmi3_fifo_time_sync_anchor(struct bmi3_fifo_time_sync *sync, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-        acc_off_gain[0] = (uint8_t)(acc_dp_off_x1 & BMI3_SET_LOW_BYTE);
-        acc_off_gain[1] = (acc_dp_off_x1 & BMI3_SET_HIGH_BYTE) >> 8;
-        acc_off_gain[2] = acc_dp_gain_x;
-        acc_off_gain[4] = (uint8_t)(acc_dp_off_y1 & BMI3_SET_LOW_BYTE);
-        acc_off_gain[5] = (acc_dp_off_y1 & BMI3_SET_HIGH_BYTE) >> 8;
-        acc_off_gain[6] = acc_dp_gain_y;
-        acc_off_gain[8] = (uint8_t)(acc_dp_off_z1 & BMI3_SET_LOW_BYTE);
-        acc_off_gain[9] = (acc_dp_off_z1 & BMI3_SET_HIGH_BYTE) >> 8;
-        acc_off_gain[10] = acc_dp_gain_z;
+    if (sync != NULL)
+    {
+        rslt = bmi3_get_sensor_time(&sync->anchor, dev);
 
-        /* Set dp offset for accel */
-        rslt = bmi3_set_regs(BMI3_REG_ACC_DP_OFF_X, acc_off_gain, 12, dev);
+        if (rslt == BMI3_OK)
+        {
+            sync->anchor_pending = BMI3_TRUE;
+        }
     }
     else
     {
@@ -4112,51 +4442,89 @@ int8_t bmi3_set_acc_dp_off_dgain(const struct bmi3_acc_dp_gain_offset *acc_dp_ga
 }
 
 /*!
- * @brief This API sets offset dgain for the sensor which stores self-calibrated values for gyro.
+ * @brief This API converts the 16-bit sensor time of a batch of FIFO frames into
+ * monotonic 64-bit sensor time.
  */
-int8_t bmi3_set_gyro_dp_off_dgain(const struct bmi3_gyr_dp_gain_offset *gyr_dp_gain_offset, struct bmi3_dev *dev)
+int8_t bmi3_fifo_time_sync_apply(struct bmi3_fifo_time_sync *sync,
+                                 const uint16_t *sensor_time,
+                                 uint64_t *timestamp,
+                                 uint16_t frames)
 {
     /* Variable to store result of API */
-    int8_t rslt;
+    int8_t rslt = BMI3_OK;
 
-    uint8_t gyr_dp_gain_x, gyr_dp_gain_y, gyr_dp_gain_z;
+    /* Variable to store the unwrapped anchor */
+    uint64_t anchor;
 
-    uint16_t gyr_dp_off_x1, gyr_dp_off_y1, gyr_dp_off_z1;
+    /* Variable to store the distance of a stamp from the anchor */
+    uint16_t delta;
 
-    uint16_t reg_data[6] = { 0 };
+    /* Variable to store the time from the first to the last frame of the batch */
+    uint64_t span = 0;
 
-    uint8_t gyr_off_gain[12] = { 0 };
+    /* Variable to index the frames */
+    uint16_t idx, pos;
 
-    /* NULL pointer check */
-    if (gyr_dp_gain_offset != NULL)
+    if ((sync != NULL) && (timestamp != NULL))
     {
-        gyr_dp_off_x1 = BMI3_SET_BIT_POS0(reg_data[0], BMI3_GYR_DP_OFF_X, gyr_dp_gain_offset->gyr_dp_off_x);
+        if ((sync->synced == BMI3_FALSE) && (sync->anchor_pending == BMI3_FALSE))
+        {
+            rslt = BMI3_E_INVALID_STATUS;
+        }
 
-        gyr_dp_gain_x =
-            (uint8_t)BMI3_SET_BIT_POS0(reg_data[1], BMI3_GYR_DP_DGAIN_X, gyr_dp_gain_offset->gyr_dp_dgain_x);
+        for (idx = 0; (rslt == BMI3_OK) && (idx < frames); idx++)
+        {
+            if (sync->anchor_pending == BMI3_TRUE)
+            {
+                anchor = get_unwrapped_anchor(sync);
 
-        gyr_dp_off_y1 = BMI3_SET_BIT_POS0(reg_data[2], BMI3_GYR_DP_OFF_Y, gyr_dp_gain_offset->gyr_dp_off_y);
+                if (sensor_time != NULL)
+                {
+                    /* The batch ends at the anchor as well: the last stamp is placed at the nearest position
+                     * around the anchor and the batch is walked back from it, one stamp distance at a time
+                     */
+                    delta = (uint16_t)((uint16_t)anchor - sensor_time[frames - 1]);
 
-        gyr_dp_gain_y =
-            (uint8_t)BMI3_SET_BIT_POS0(reg_data[3], BMI3_GYR_DP_DGAIN_Y, gyr_dp_gain_offset->gyr_dp_dgain_y);
+                    for (pos = (uint16_t)(frames - 1); pos > idx; pos--)
+                    {
+                        span += (uint16_t)(sensor_time[pos] - sensor_time[pos - 1]);
+                    }
 
-        gyr_dp_off_z1 = BMI3_SET_BIT_POS0(reg_data[4], BMI3_GYR_DP_OFF_Z, gyr_dp_gain_offset->gyr_dp_off_z);
+                    if (delta < UINT16_C(0x8000))
+                    {
+                        timestamp[idx] = anchor - delta - span;
+                    }
+                    else
+                    {
+                        timestamp[idx] = anchor + (uint16_t)(sensor_time[frames - 1] - (uint16_t)anchor) - span;
+                    }
+                }
+                else
+                {
+                    /* Without stamps the batch is assumed to end at the anchor */
+                    timestamp[idx] = anchor - (uint64_t)(frames - 1) * sync->frame_period;
+                }
 
-        gyr_dp_gain_z =
-            (uint8_t)BMI3_SET_BIT_POS0(reg_data[5], BMI3_GYR_DP_DGAIN_Z, gyr_dp_gain_offset->gyr_dp_dgain_z);
+                /* Never step back behind an already returned timestamp */
+                if ((sync->synced == BMI3_TRUE) && (timestamp[idx] <= sync->last_time))
+                {
+                    timestamp[idx] = sync->last_time + ((sensor_time != NULL) ? 1 : sync->frame_period);
+                }
 
-        gyr_off_gain[0] = (uint8_t)(gyr_dp_off_x1 & BMI3_SET_LOW_BYTE);
-        gyr_off_gain[1] = (gyr_dp_off_x1 & BMI3_SET_HIGH_BYTE) >> 8;
-        gyr_off_gain[2] = gyr_dp_gain_x;
-        gyr_off_gain[4] = (uint8_t)(gyr_dp_off_y1 & BMI3_SET_LOW_BYTE);
-        gyr_off_gain[5] = (gyr_dp_off_y1 & BMI3_SET_HIGH_BYTE) >> 8;
-        gyr_off_gain[6] = gyr_dp_gain_y;
-        gyr_off_gain[8] = (uint8_t)(gyr_dp_off_z1 & BMI3_SET_LOW_BYTE);
-        gyr_off_gain[9] = (gyr_dp_off_z1 & BMI3_SET_HIGH_BYTE) >> 8;
-        gyr_off_gain[10] = gyr_dp_gain_z;
+                sync->anchor_pending = BMI3_FALSE;
+                sync->synced = BMI3_TRUE;
+            }
+            else if (sensor_time != NULL)
+            {
+                timestamp[idx] = sync->last_time + (uint16_t)(sensor_time[idx] - (uint16_t)sync->last_time);
+            }
+            else
+            {
+                timestamp[idx] = sync->last_time + sync->frame_period;
+            }
 
-        /* Set dp offset for gyro */
-        rslt = bmi3_set_regs(BMI3_REG_GYR_DP_OFF_X, gyr_off_gain, 12, dev);
+            sync->last_time = timestamp[idx];
+        }
     }
     else
     {
@@ -4167,39 +4535,64 @@ int8_t bmi3_set_gyro_dp_off_dgain(const struct bmi3_gyr_dp_gain_offset *gyr_dp_g
 }
 
 /*!
- * @brief This API gets user offset dgain for the sensor which stores self-calibrated values for accel.
+ * @brief This API deinterleaves accelerometer and gyroscope frames from FIFO data read by the
+ * "bmi3_read_fifo_data" API into struct-of-arrays buffers.
  */
-int8_t bmi3_get_user_acc_off_dgain(struct bmi3_acc_usr_gain_offset *acc_usr_gain_offset, struct bmi3_dev *dev)
+int8_t bmi3_decode_fifo_frames(struct bmi3_fifo_axes_soa *acc,
+                               struct bmi3_fifo_axes_soa *gyr,
+                               const struct bmi3_fifo_frame *fifo,
+                               const struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    uint8_t reg_data[12];
+    /* Variable to store number of FIFO bytes after the dummy bytes */
+    uint16_t length;
 
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ACC_OFFSET_GAIN, 0 };
+    /* Variables to store frame length and byte offsets inside a frame */
+    uint16_t stride, gyr_offset, time_offset = 0;
 
-    /* NULL pointer check */
-    if (acc_usr_gain_offset != NULL)
-    {
-        /* Set the user accel offset base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+    rslt = null_ptr_check(dev);
 
-        if (rslt == BMI3_OK)
+    if ((rslt == BMI3_OK) && (fifo != NULL) && (fifo->data != NULL) && ((acc != NULL) || (gyr != NULL)))
+    {
+        if (((acc != NULL) && ((acc->x == NULL) || (acc->y == NULL) || (acc->z == NULL))) ||
+            ((gyr != NULL) && ((gyr->x == NULL) || (gyr->y == NULL) || (gyr->z == NULL))))
         {
-            /* Get the configuration from the feature engine register */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, 12, dev);
+            rslt = BMI3_E_NULL_PTR;
+        }
+        else if (((acc != NULL) && !(fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_ACC_FRM)) ||
+                 ((gyr != NULL) && !(fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_GYR_FRM)))
+        {
+            rslt = BMI3_W_FIFO_INVALID_FRAME;
+        }
+        else
+        {
+            length = get_fifo_data_length(fifo, dev);
+            stride = get_fifo_frame_length(fifo->available_fifo_sens);
 
-            if (rslt == BMI3_OK)
+            gyr_offset = (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_ACC_FRM) ? BMI3_LENGTH_FIFO_ACC : 0;
+
+            if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
             {
-                acc_usr_gain_offset->acc_usr_off_x =
-                    (uint16_t)((((uint16_t)reg_data[1] << 8) | reg_data[0]) & BMI3_ACC_USR_OFF_X_MASK);
-                acc_usr_gain_offset->acc_usr_off_y =
-                    (uint16_t)((((uint16_t)reg_data[3] << 8) | reg_data[2]) & BMI3_ACC_USR_OFF_Y_MASK);
-                acc_usr_gain_offset->acc_usr_off_z =
-                    (uint16_t)((((uint16_t)reg_data[5] << 8) | reg_data[4]) & BMI3_ACC_USR_OFF_Z_MASK);
-                acc_usr_gain_offset->acc_usr_gain_x = (uint8_t)(reg_data[6] & BMI3_ACC_USR_GAIN_X_MASK);
-                acc_usr_gain_offset->acc_usr_gain_y = (uint8_t)(reg_data[8] & BMI3_ACC_USR_GAIN_Y_MASK);
-                acc_usr_gain_offset->acc_usr_gain_z = (uint8_t)(reg_data[10] & BMI3_ACC_USR_GAIN_Z_MASK);
+                time_offset = (uint16_t)(stride - BMI3_LENGTH_SENSOR_TIME);
+            }
+
+            if (acc != NULL)
+            {
+                decode_fifo_axes(&fifo->data[dev->dummy_byte], length, stride, 0, time_offset,
+                                 BMI3_FIFO_ACCEL_DUMMY_FRAME, acc);
+            }
+
+            if (gyr != NULL)
+            {
+                decode_fifo_axes(&fifo->data[dev->dummy_byte], length, stride, gyr_offset, time_offset,
+                                 BMI3_FIFO_GYRO_DUMMY_FRAME, gyr);
+            }
+
+            if (length < stride)
+            {
+                rslt = (length == 0) ? BMI3_W_FIFO_EMPTY : BMI3_W_PARTIAL_READ;
             }
         }
     }
@@ -4212,71 +4605,147 @@ int8_t bmi3_get_user_acc_off_dgain(struct bmi3_acc_usr_gain_offset *acc_usr_gain
 }
 
 /*!
- * @brief This API sets user offset dgain for the sensor which stores self-calibrated values for accel.
+ * @brief This API extracts accelerometer frames from FIFO data read by the "bmi3_read_fifo_data"
+ * API into per-axis arrays.
  */
-int8_t bmi3_set_user_acc_off_dgain(const struct bmi3_acc_usr_gain_offset *acc_usr_gain_offset, struct bmi3_dev *dev)
+int8_t bmi3_extract_accel_soa(struct bmi3_fifo_axes_soa *accel_data,
+                              struct bmi3_fifo_frame *fifo,
+                              const struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    uint8_t acc_usr_gain_x, acc_usr_gain_y, acc_usr_gain_z;
-
-    uint16_t acc_usr_off_x1, acc_usr_off_y1, acc_usr_off_z1;
+    rslt = extract_axes_soa(accel_data, BMI3_FIFO_HEAD_LESS_ACC_FRM, fifo, dev);
 
-    uint16_t acc_usr_off_x2, acc_usr_off_y2, acc_usr_off_z2;
+    if (rslt >= BMI3_OK)
+    {
+        /* Update number of accelerometer frames to be read */
+        fifo->avail_fifo_accel_frames = accel_data->frames;
+    }
 
-    uint16_t acc_usr_off_x, acc_usr_off_y, acc_usr_off_z;
+    return rslt;
+}
 
-    uint8_t reg_data[12] = { 0 };
+/*!
+ * @brief This API extracts gyroscope frames from FIFO data read by the "bmi3_read_fifo_data"
+ * API into per-axis arrays.
+ */
+int8_t bmi3_extract_gyro_soa(struct bmi3_fifo_axes_soa *gyro_data,
+                             struct bmi3_fifo_frame *fifo,
+                             const struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-    uint8_t user_acc_off_gain[12] = { 0 };
+    rslt = extract_axes_soa(gyro_data, BMI3_FIFO_HEAD_LESS_GYR_FRM, fifo, dev);
 
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ACC_OFFSET_GAIN, 0 };
+    if (rslt >= BMI3_OK)
+    {
+        /* Update number of gyro frames to be read */
+        fifo->avail_fifo_gyro_frames = gyro_data->frames;
+    }
 
-    /* NULL pointer check */
-    if (acc_usr_gain_offset != NULL)
+    return rslt;
+}
+
+/*!
+ * @brief This API computes the unit conversion factors of a sensor configuration.
+ */
+int8_t bmi3_get_unit_scale(const struct bmi3_sens_config *config, struct bmi3_unit_scale *scale)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    if ((config != NULL) && (scale != NULL))
     {
-        /* Set the user accel offset base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        if ((config->type == BMI3_ACCEL) && (config->cfg.acc.range > BMI3_ACC_RANGE_16G))
+        {
+            rslt = BMI3_E_ACC_INVALID_CFG;
+        }
+        else if ((config->type == BMI3_GYRO) && (config->cfg.gyr.range > BMI3_GYR_RANGE_2000DPS))
+        {
+            rslt = BMI3_E_GYRO_INVALID_CFG;
+        }
+        else if (config->type == BMI3_ACCEL)
+        {
+            /* Full scale of 2 g << range over 16 bits */
+            scale->range = config->cfg.acc.range;
+            scale->si = ((float)(2 << scale->range) * BMI3_GRAVITY_EARTH) / 32768.0f;
+            scale->q31_mult = INT32_C(1) << (13 + scale->range);
+            scale->q15_shift = (uint8_t)(BMI3_ACC_RANGE_16G - scale->range);
+        }
+        else if (config->type == BMI3_GYRO)
+        {
+            /* Full scale of 125 dps << range over 16 bits */
+            scale->range = config->cfg.gyr.range;
+            scale->si = (float)(125 << scale->range) / 32768.0f;
+            scale->q31_mult = INT32_C(1) << (12 + scale->range);
+            scale->q15_shift = (uint8_t)(BMI3_GYR_RANGE_2000DPS - scale->range);
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_SENSOR;
+        }
 
         if (rslt == BMI3_OK)
         {
-            acc_usr_off_x1 = BMI3_SET_BIT_POS0(reg_data[0], BMI3_ACC_USR_OFF_X, acc_usr_gain_offset->acc_usr_off_x);
-
-            acc_usr_off_x = ((uint16_t)reg_data[1] << 8);
+            scale->type = config->type;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
-            acc_usr_off_x2 = BMI3_SET_BIT_POS0(acc_usr_off_x, BMI3_ACC_USR_OFF_X, acc_usr_gain_offset->acc_usr_off_x);
+    return rslt;
+}
 
-            acc_usr_off_y1 = BMI3_SET_BIT_POS0(reg_data[2], BMI3_ACC_USR_OFF_Y, acc_usr_gain_offset->acc_usr_off_y);
+/*!
+ * @brief This API converts raw samples to m/s^2 or dps.
+ */
+int8_t bmi3_convert_f32(const struct bmi3_unit_scale *scale, const int16_t *raw, uint16_t num, float *out)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
 
-            acc_usr_off_y = ((uint16_t)reg_data[3] << 8);
+    /* Variable to store the scale factor */
+    float si;
 
-            acc_usr_off_y2 = BMI3_SET_BIT_POS0(acc_usr_off_y, BMI3_ACC_USR_OFF_Y, acc_usr_gain_offset->acc_usr_off_y);
+    /* Variable to define loop */
+    uint16_t idx;
 
-            acc_usr_off_z1 = BMI3_SET_BIT_POS0(reg_data[4], BMI3_ACC_USR_OFF_Z, acc_usr_gain_offset->acc_usr_off_z);
+    if ((scale != NULL) && (raw != NULL) && (out != NULL))
+    {
+        si = scale->si;
+        idx = 0;
 
-            acc_usr_off_z = ((uint16_t)reg_data[5] << 8);
+#if defined(BMI3_FIFO_SIMD_SSE2)
+        for (; (idx + BMI3_CONVERT_SIMD_SAMPLES) <= num; idx += BMI3_CONVERT_SIMD_SAMPLES)
+        {
+            __m128i vec = _mm_loadu_si128((const __m128i *)&raw[idx]);
 
-            acc_usr_off_z2 = BMI3_SET_BIT_POS0(acc_usr_off_z, BMI3_ACC_USR_OFF_Z, acc_usr_gain_offset->acc_usr_off_z);
+            /* Sign extend to 32 bits by placing each sample in the upper half of a lane */
+            __m128i low = _mm_srai_epi32(_mm_unpacklo_epi16(vec, vec), 16);
+            __m128i high = _mm_srai_epi32(_mm_unpackhi_epi16(vec, vec), 16);
 
-            acc_usr_gain_x = BMI3_SET_BIT_POS0(reg_data[6], BMI3_ACC_USR_GAIN_X, acc_usr_gain_offset->acc_usr_gain_x);
+            _mm_storeu_ps(&out[idx], _mm_mul_ps(_mm_cvtepi32_ps(low), _mm_set1_ps(si)));
+            _mm_storeu_ps(&out[idx + 4], _mm_mul_ps(_mm_cvtepi32_ps(high), _mm_set1_ps(si)));
+        }
 
-            acc_usr_gain_y = BMI3_SET_BIT_POS0(reg_data[8], BMI3_ACC_USR_GAIN_Y, acc_usr_gain_offset->acc_usr_gain_y);
+#elif defined(BMI3_FIFO_SIMD_NEON)
+        for (; (idx + BMI3_CONVERT_SIMD_SAMPLES) <= num; idx += BMI3_CONVERT_SIMD_SAMPLES)
+        {
+            int16x8_t vec = vld1q_s16(&raw[idx]);
 
-            acc_usr_gain_z = BMI3_SET_BIT_POS0(reg_data[10], BMI3_ACC_USR_GAIN_Z, acc_usr_gain_offset->acc_usr_gain_z);
+            vst1q_f32(&out[idx], vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(vec))), si));
+            vst1q_f32(&out[idx + 4], vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(vec))), si));
+        }
 
-            user_acc_off_gain[0] = (uint8_t)acc_usr_off_x1;
-            user_acc_off_gain[1] = acc_usr_off_x2 >> 8;
-            user_acc_off_gain[2] = (uint8_t)acc_usr_off_y1;
-            user_acc_off_gain[3] = acc_usr_off_y2 >> 8;
-            user_acc_off_gain[4] = (uint8_t)acc_usr_off_z1;
-            user_acc_off_gain[5] = acc_usr_off_z2 >> 8;
-            user_acc_off_gain[6] = acc_usr_gain_x;
-            user_acc_off_gain[8] = acc_usr_gain_y;
-            user_acc_off_gain[10] = acc_usr_gain_z;
+#endif
 
-            /* Set the configuration to the feature engine register */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, user_acc_off_gain, 12, dev);
+        for (; idx < num; idx++)
+        {
+            out[idx] = (float)raw[idx] * si;
         }
     }
     else
@@ -4288,58 +4757,64 @@ int8_t bmi3_set_user_acc_off_dgain(const struct bmi3_acc_usr_gain_offset *acc_us
 }
 
 /*!
- * @brief This API performs Fast Offset Compensation for accelerometer.
+ * @brief This API converts raw samples to Q31 fractions of the full scale.
  */
-int8_t bmi3_perform_accel_foc(const struct bmi3_accel_foc_g_value *accel_g_value, struct bmi3_dev *dev)
+int8_t bmi3_convert_q31(const struct bmi3_unit_scale *scale, const int16_t *raw, uint16_t num, int32_t *out)
 {
     /* Variable to store result of API */
-    int8_t rslt;
+    int8_t rslt = BMI3_OK;
 
-    /* Structure to define the accelerometer configurations */
-    struct bmi3_accel_config acc_cfg = { 0 };
-    struct bmi3_sens_config config = { 0 };
+    /* Variable to store the scale factor */
+    int32_t mult;
 
-    /* Configure the type */
-    config.type = BMI3_ACCEL;
+    /* Variable to define loop */
+    uint16_t idx;
 
-    /* Null-pointer check */
-    rslt = null_ptr_check(dev);
+#if defined(BMI3_FIFO_SIMD_SSE2)
 
-    if ((rslt == BMI3_OK) && (accel_g_value != NULL))
+    /* Variable to store the scale factor as a shift */
+    int shift = 0;
+#endif
+
+    if ((scale != NULL) && (raw != NULL) && (out != NULL))
     {
-        /* Check for input validity */
-        if ((((BMI3_ABS(accel_g_value->x)) + (BMI3_ABS(accel_g_value->y)) + (BMI3_ABS(accel_g_value->z))) == 1) &&
-            ((accel_g_value->sign == 1) || (accel_g_value->sign == 0)))
+        mult = scale->q31_mult;
+        idx = 0;
+
+#if defined(BMI3_FIFO_SIMD_SSE2)
+
+        /* SSE2 has no 32-bit multiply: the factors of bmi3_get_unit_scale are powers of 2 and become a shift,
+         * any other factor is left to the scalar loop */
+        while ((shift < 30) && ((INT32_C(1) << shift) < mult))
         {
-            rslt = verify_foc_position(BMI3_ACCEL, accel_g_value, dev);
+            shift++;
+        }
 
-            if (rslt == BMI3_OK)
-            {
-                /* Get accelerometer configurations */
-                rslt = bmi3_get_sensor_config(&config, 1, dev);
-            }
+        for (; ((INT32_C(1) << shift) == mult) && ((idx + BMI3_CONVERT_SIMD_SAMPLES) <= num);
+             idx += BMI3_CONVERT_SIMD_SAMPLES)
+        {
+            __m128i vec = _mm_loadu_si128((const __m128i *)&raw[idx]);
+            __m128i low = _mm_srai_epi32(_mm_unpacklo_epi16(vec, vec), 16);
+            __m128i high = _mm_srai_epi32(_mm_unpackhi_epi16(vec, vec), 16);
 
-            /* Set configurations for FOC */
-            if (rslt == BMI3_OK)
-            {
-                rslt = set_accel_foc_config(dev);
-            }
+            _mm_storeu_si128((__m128i *)&out[idx], _mm_sll_epi32(low, _mm_cvtsi32_si128(shift)));
+            _mm_storeu_si128((__m128i *)&out[idx + 4], _mm_sll_epi32(high, _mm_cvtsi32_si128(shift)));
+        }
 
-            /* Perform accelerometer FOC */
-            if (rslt == BMI3_OK)
-            {
-                rslt = perform_accel_foc(accel_g_value, &acc_cfg, dev);
-            }
+#elif defined(BMI3_FIFO_SIMD_NEON)
+        for (; (idx + BMI3_CONVERT_SIMD_SAMPLES) <= num; idx += BMI3_CONVERT_SIMD_SAMPLES)
+        {
+            int16x8_t vec = vld1q_s16(&raw[idx]);
 
-            /* Set the configurations */
-            if (rslt == BMI3_OK)
-            {
-                rslt = bmi3_set_sensor_config(&config, 1, dev);
-            }
+            vst1q_s32(&out[idx], vmulq_n_s32(vmovl_s16(vget_low_s16(vec)), mult));
+            vst1q_s32(&out[idx + 4], vmulq_n_s32(vmovl_s16(vget_high_s16(vec)), mult));
         }
-        else
+
+#endif
+
+        for (; idx < num; idx++)
         {
-            rslt = BMI3_E_INVALID_INPUT;
+            out[idx] = (int32_t)raw[idx] * mult;
         }
     }
     else
@@ -4351,22 +4826,46 @@ int8_t bmi3_perform_accel_foc(const struct bmi3_accel_foc_g_value *accel_g_value
 }
 
 /*!
- * @brief This API gets the data ready status of power on reset, accelerometer, gyroscope
- * and temperature.
+ * @brief This API converts raw samples to Q15 fractions of the full scale.
  */
-int8_t bmi3_get_sensor_status(uint16_t *status, struct bmi3_dev *dev)
+int8_t bmi3_convert_q15(const struct bmi3_unit_scale *scale, const int16_t *raw, uint16_t num, int16_t *out)
 {
     /* Variable to store result of API */
-    int8_t rslt;
+    int8_t rslt = BMI3_OK;
 
-    uint8_t data[2] = { 0 };
+    /* Variable to store the scale factor */
+    uint8_t shift;
 
-    if (status != NULL)
+    /* Variable to define loop */
+    uint16_t idx;
+
+    if ((scale != NULL) && (raw != NULL) && (out != NULL))
     {
-        /* Read the status register */
-        rslt = bmi3_get_regs(BMI3_REG_STATUS, data, 2, dev);
+        shift = scale->q15_shift;
+        idx = 0;
 
-        *status = (uint16_t)(data[0] | ((uint16_t)data[1] << 8));
+#if defined(BMI3_FIFO_SIMD_SSE2)
+        for (; (idx + BMI3_CONVERT_SIMD_SAMPLES) <= num; idx += BMI3_CONVERT_SIMD_SAMPLES)
+        {
+            __m128i vec = _mm_loadu_si128((const __m128i *)&raw[idx]);
+
+            _mm_storeu_si128((__m128i *)&out[idx], _mm_sra_epi16(vec, _mm_cvtsi32_si128(shift)));
+        }
+
+#elif defined(BMI3_FIFO_SIMD_NEON)
+
+        /* A negative shift count shifts right */
+        for (; (idx + BMI3_CONVERT_SIMD_SAMPLES) <= num; idx += BMI3_CONVERT_SIMD_SAMPLES)
+        {
+            vst1q_s16(&out[idx], vshlq_s16(vld1q_s16(&raw[idx]), vdupq_n_s16((int16_t)-shift)));
+        }
+
+#endif
+
+        for (; idx < num; idx++)
+        {
+            out[idx] = (int16_t)(raw[idx] >> shift);
+        }
     }
     else
     {
@@ -4377,25 +4876,31 @@ int8_t bmi3_get_sensor_status(uint16_t *status, struct bmi3_dev *dev)
 }
 
 /*!
- * @brief This API gets the I3C IBI status of both feature and data
- * interrupts
+ * @brief This API converts FIFO frames to m/s^2 or dps.
  */
-int8_t bmi3_get_i3c_ibi_status(uint16_t *int_status, struct bmi3_dev *dev)
+int8_t bmi3_convert_axes_f32(const struct bmi3_unit_scale *scale,
+                             const struct bmi3_fifo_sens_axes_data *data,
+                             uint16_t num,
+                             float *out)
 {
     /* Variable to store result of API */
-    int8_t rslt;
+    int8_t rslt = BMI3_OK;
 
-    /* Array to store data */
-    uint8_t data_array[2] = { 0 };
+    /* Variable to store the scale factor */
+    float si;
 
-    if (int_status != NULL)
+    /* Variable to define loop */
+    uint16_t idx;
+
+    if ((scale != NULL) && (data != NULL) && (out != NULL))
     {
-        /* Get the interrupt status */
-        rslt = bmi3_get_regs(BMI3_REG_INT_STATUS_IBI, data_array, 2, dev);
+        si = scale->si;
 
-        if (rslt == BMI3_OK)
+        for (idx = 0; idx < num; idx++)
         {
-            *int_status = (uint16_t) data_array[0] | ((uint16_t) data_array[1] << 8);
+            out[(idx * 3)] = (float)data[idx].x * si;
+            out[(idx * 3) + 1] = (float)data[idx].y * si;
+            out[(idx * 3) + 2] = (float)data[idx].z * si;
         }
     }
     else
@@ -4407,55 +4912,31 @@ int8_t bmi3_get_i3c_ibi_status(uint16_t *int_status, struct bmi3_dev *dev)
 }
 
 /*!
- * @brief This API gets accel gyro offset gain reset values.
+ * @brief This API converts FIFO frames to Q31 fractions of the full scale.
  */
-int8_t bmi3_get_acc_gyr_off_gain_reset(uint8_t *acc_off_gain_reset, uint8_t *gyr_off_gain_reset, struct bmi3_dev *dev)
+int8_t bmi3_convert_axes_q31(const struct bmi3_unit_scale *scale,
+                             const struct bmi3_fifo_sens_axes_data *data,
+                             uint16_t num,
+                             int32_t *out)
 {
     /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Array to define the accel gyro user gain offset reset values */
-    uint8_t acc_gyr_off_gain_reset[2] = { 0 };
-
-    /* Array to set the base address of accel gyro offset and gain reset */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ACC_GYR_OFFSET_GAIN_RESET, 0 };
-
-    uint8_t idx = 0;
-
-    /* Variable to define LSB */
-    uint16_t lsb;
+    int8_t rslt = BMI3_OK;
 
-    /* Variable to define MSB */
-    uint16_t msb;
+    /* Variable to store the scale factor */
+    int32_t mult;
 
-    /* Variable to define a word */
-    uint16_t lsb_msb;
+    /* Variable to define loop */
+    uint16_t idx;
 
-    if ((acc_off_gain_reset != NULL) && (gyr_off_gain_reset != NULL))
+    if ((scale != NULL) && (data != NULL) && (out != NULL))
     {
-        /* Set the accel gyro offset and gain reset base address to feature engine transmission address to start DMA
-         * transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        mult = scale->q31_mult;
 
-        if (rslt == BMI3_OK)
+        for (idx = 0; idx < num; idx++)
         {
-            /* Get the configuration from the feature engine register where accel gyro offset and gain reset value
-             * resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, acc_gyr_off_gain_reset, 2, dev);
-
-            if (rslt == BMI3_OK)
-            {
-                /* Get word to calculate acc_off_gain_reset and gyr_off_gain_reset */
-                lsb = (uint16_t) acc_gyr_off_gain_reset[idx++];
-                msb = ((uint16_t) acc_gyr_off_gain_reset[idx++] << 8);
-                lsb_msb = (lsb | msb);
-
-                /* Get accel offset gain reset */
-                *acc_off_gain_reset = (uint8_t)(lsb_msb & BMI3_ACC_OFF_GAIN_RESET_MASK);
-
-                /* Get gyro offset gain reset */
-                *gyr_off_gain_reset = (uint8_t)(lsb_msb & BMI3_GYR_OFF_GAIN_RESET_MASK) >> BMI3_GYR_OFF_GAIN_RESET_POS;
-            }
+            out[(idx * 3)] = (int32_t)data[idx].x * mult;
+            out[(idx * 3) + 1] = (int32_t)data[idx].y * mult;
+            out[(idx * 3) + 2] = (int32_t)data[idx].z * mult;
         }
     }
     else
@@ -4467,114 +4948,85 @@ int8_t bmi3_get_acc_gyr_off_gain_reset(uint8_t *acc_off_gain_reset, uint8_t *gyr
 }
 
 /*!
- * @brief This API sets accel gyro offset gain reset values.
+ * @brief This API converts FIFO frames to Q15 fractions of the full scale.
  */
-int8_t bmi3_set_acc_gyr_off_gain_reset(uint8_t acc_off_gain_reset, uint8_t gyr_off_gain_reset, struct bmi3_dev *dev)
+int8_t bmi3_convert_axes_q15(const struct bmi3_unit_scale *scale,
+                             const struct bmi3_fifo_sens_axes_data *data,
+                             uint16_t num,
+                             int16_t *out)
 {
     /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Array to define the accel gyro user gain offset reset values */
-    uint8_t acc_gyr_off_gain_reset[2] = { 0 };
-
-    /* Array to set the base address of accel gyro offset and gain reset */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ACC_GYR_OFFSET_GAIN_RESET, 0 };
+    int8_t rslt = BMI3_OK;
 
-    uint8_t data_array[2] = { 0 };
+    /* Variable to store the scale factor */
+    uint8_t shift;
 
-    /* Set the accel gyro offset and gain reset base address to feature engine transmission address to start DMA
-     * transaction */
-    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+    /* Variable to define loop */
+    uint16_t idx;
 
-    if (rslt == BMI3_OK)
+    if ((scale != NULL) && (data != NULL) && (out != NULL))
     {
-        /* Set accel offset gain reset */
-        acc_off_gain_reset = BMI3_SET_BIT_POS0(data_array[0], BMI3_ACC_OFF_GAIN_RESET, acc_off_gain_reset);
-
-        /* Set gyro offset gain reset */
-        gyr_off_gain_reset = BMI3_SET_BITS(data_array[0], BMI3_GYR_OFF_GAIN_RESET, gyr_off_gain_reset);
-
-        acc_gyr_off_gain_reset[0] = (acc_off_gain_reset | gyr_off_gain_reset);
+        shift = scale->q15_shift;
 
-        /* Set the configurations back to the feature engine register */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, acc_gyr_off_gain_reset, 2, dev);
+        for (idx = 0; idx < num; idx++)
+        {
+            out[(idx * 3)] = (int16_t)(data[idx].x >> shift);
+            out[(idx * 3) + 1] = (int16_t)(data[idx].y >> shift);
+            out[(idx * 3) + 2] = (int16_t)(data[idx].z >> shift);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
     }
 
     return rslt;
 }
 
-/***************************************************************************/
-
-/*!                   Local Function Definitions
- ****************************************************************************/
-
 /*!
- * @brief This internal API sets accelerometer configurations like ODR, accel mode,
- * bandwidth, average samples and range.
+ * @brief This API sets the FIFO water-mark level in words.
  */
-static int8_t set_accel_config(struct bmi3_accel_config *config, struct bmi3_dev *dev)
+int8_t bmi3_set_fifo_wm(uint16_t fifo_wm, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to store data */
-    uint8_t reg_data[2] = { 0 };
-
-    uint16_t odr, range, bwp, avg_num, acc_mode;
+    /* Array to store data */
+    uint8_t data[2] = { 0 };
 
-    if (config != NULL)
-    {
-        /* Validate bandwidth and averaging samples */
-        rslt = validate_bw_avg_acc_mode(&config->bwp, &config->acc_mode, &config->avg_num, dev);
+    uint16_t fifo_watermark = fifo_wm & BMI3_FIFO_WATERMARK_MASK;
 
-        if (rslt == BMI3_OK)
-        {
-            /* Validate ODR and range */
-            rslt = validate_acc_odr_range(&config->odr, &config->range, dev);
-        }
-
-        if (rslt == BMI3_OK)
-        {
-            if (config->acc_mode == BMI3_ACC_MODE_LOW_PWR)
-            {
-                rslt = validate_acc_odr_avg(config->odr, config->avg_num);
-            }
-
-            if ((config->acc_mode == BMI3_ACC_MODE_NORMAL) || (config->acc_mode == BMI3_ACC_MODE_HIGH_PERF))
-            {
-                if ((config->odr >= BMI3_ACC_ODR_0_78HZ) && (config->odr <= BMI3_ACC_ODR_6_25HZ))
-                {
-                    rslt = BMI3_E_ACC_INVALID_CFG;
-                }
-            }
-        }
+    /* Get LSB value of FIFO water-mark */
+    data[0] = BMI3_GET_LSB(fifo_watermark);
 
-        if (rslt == BMI3_OK)
-        {
-            /* Set accelerometer ODR */
-            odr = BMI3_SET_BIT_POS0(reg_data[0], BMI3_ACC_ODR, config->odr);
+    /* Get MSB value of FIFO water-mark */
+    data[1] = BMI3_GET_MSB(fifo_watermark);
 
-            /* Set accelerometer range */
-            range = BMI3_SET_BITS(reg_data[0], BMI3_ACC_RANGE, config->range);
+    /* Set the FIFO water-mark level */
+    rslt = bmi3_set_regs(BMI3_REG_FIFO_WATERMARK, data, BMI3_LENGTH_FIFO_WM, dev);
 
-            /* Set accelerometer bandwidth */
-            bwp = BMI3_SET_BITS(reg_data[0], BMI3_ACC_BW, config->bwp);
+    return rslt;
+}
 
-            /* Set accelerometer average number of samples */
-            avg_num = BMI3_SET_BITS(reg_data[1], BMI3_ACC_AVG_NUM, config->avg_num);
+/*!
+ * @brief This API reads the FIFO water-mark level in words.
+ */
+int8_t bmi3_get_fifo_wm(uint16_t *fifo_wm, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-            /* Set accelerometer accel mode */
-            acc_mode = BMI3_SET_BITS(reg_data[1], BMI3_ACC_MODE, config->acc_mode);
+    /* Array to to store data */
+    uint8_t data[2] = { 0 };
 
-            reg_data[0] = (uint8_t)(odr | range | bwp);
-            reg_data[1] = (uint8_t)((avg_num | acc_mode) >> 8);
+    if (fifo_wm != NULL)
+    {
+        /* Read the FIFO water-mark level */
+        rslt = bmi3_get_regs(BMI3_REG_FIFO_WATERMARK, data, BMI3_LENGTH_FIFO_WM, dev);
 
-            /* Set configurations for accel */
-            rslt = bmi3_set_regs(BMI3_REG_ACC_CONF, reg_data, 2, dev);
-        }
-        else
+        if (rslt == BMI3_OK)
         {
-            rslt = BMI3_E_ACC_INVALID_CFG;
+            (*fifo_wm) = (uint16_t)((data[0] | (uint16_t) data[1] << 8));
         }
     }
     else
@@ -4586,78 +5038,62 @@ static int8_t set_accel_config(struct bmi3_accel_config *config, struct bmi3_dev
 }
 
 /*!
- * @brief This internal API gets accelerometer configurations like ODR,
- * bandwidth, accel mode, average samples and gravity range.
+ * @brief This API sets the FIFO configuration in the sensor.
  */
-static int8_t get_accel_config(struct bmi3_accel_config *config, struct bmi3_dev *dev)
+int8_t bmi3_set_fifo_config(uint16_t config, uint8_t enable, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to store data */
-    uint8_t data_array[2] = { 0 };
+    /* Array variable to store fifo config data */
+    uint8_t data[2] = { 0 };
 
-    uint16_t reg_data;
+    /* Variable to store data of FIFO configuration register */
+    uint16_t fifo_config = config & BMI3_FIFO_CONFIG_MASK;
 
-    if (config != NULL)
-    {
-        /* Read the sensor configuration details */
-        rslt = bmi3_get_regs(BMI3_REG_ACC_CONF, data_array, 2, dev);
+    rslt = bmi3_get_regs(BMI3_REG_FIFO_CONF, data, 2, dev);
 
-        if (rslt == BMI3_OK)
+    if (rslt == BMI3_OK)
+    {
+        if (enable == BMI3_ENABLE)
         {
-            reg_data = data_array[0];
-
-            /* Get accelerometer ODR */
-            config->odr = BMI3_GET_BIT_POS0(reg_data, BMI3_ACC_ODR);
-
-            /* Get accelerometer range */
-            config->range = BMI3_GET_BITS(reg_data, BMI3_ACC_RANGE);
-
-            /* Get accelerometer bandwidth */
-            config->bwp = BMI3_GET_BITS(reg_data, BMI3_ACC_BW);
-
-            reg_data = (uint16_t)data_array[1] << 8;
-
-            /* Get accelerometer average samples */
-            config->avg_num = BMI3_GET_BITS(reg_data, BMI3_ACC_AVG_NUM);
-
-            /* Get accel mode */
-            config->acc_mode = BMI3_GET_BITS(reg_data, BMI3_ACC_MODE);
+            data[0] = data[0] | (uint8_t)fifo_config;
+            data[1] = data[1] | (uint8_t)(fifo_config >> 8);
         }
-    }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
+        else
+        {
+            data[0] = data[0] & (~fifo_config);
+            data[1] = data[1] & (~(fifo_config >> 8));
+        }
+
+        rslt = bmi3_set_regs(BMI3_REG_FIFO_CONF, data, 2, dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API validates bandwidth and accel mode of the
- * accelerometer set by the user.
+ * @brief This API reads the FIFO configuration from the sensor.
  */
-static int8_t validate_bw_avg_acc_mode(uint8_t *bandwidth, uint8_t *acc_mode, uint8_t *avg_num, struct bmi3_dev *dev)
+int8_t bmi3_get_fifo_config(uint16_t *fifo_config, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    if ((bandwidth != NULL) && (acc_mode != NULL) && (avg_num != NULL))
+    /* Array to store data */
+    uint8_t data[2] = { 0 };
+
+    if (fifo_config != NULL)
     {
-        /* Validate and auto-correct accel mode */
-        rslt = check_boundary_val(acc_mode, BMI3_ACC_MODE_DISABLE, BMI3_ACC_MODE_HIGH_PERF, dev);
+        /* Get the FIFO configuration value */
+        rslt = bmi3_get_regs(BMI3_REG_FIFO_CONF, data, 2, dev);
 
         if (rslt == BMI3_OK)
         {
-            /* Validate for averaging number of samples */
-            rslt = check_boundary_val(avg_num, BMI3_ACC_AVG1, BMI3_ACC_AVG64, dev);
+            (*fifo_config) = ((data[0] & BMI3_FIFO_CONFIG_MASK) | (((uint16_t)data[1] << 8) & BMI3_FIFO_CONFIG_MASK));
 
-            if (rslt == BMI3_OK)
-            {
-                /* Validate bandwidth */
-                rslt = check_boundary_val(bandwidth, BMI3_ACC_BW_ODR_HALF, BMI3_ACC_BW_ODR_QUARTER, dev);
-            }
+            dev->fifo_conf = (uint16_t)(data[0] | ((uint16_t)data[1] << 8));
+            dev->fifo_conf_valid = BMI3_TRUE;
         }
     }
     else
@@ -4669,23 +5105,41 @@ static int8_t validate_bw_avg_acc_mode(uint8_t *bandwidth, uint8_t *acc_mode, ui
 }
 
 /*!
- * @brief This internal API validates ODR and range of the accelerometer set by
- * the user.
+ * @brief This API gets the length of FIFO data available in the sensor in
+ * words.
  */
-static int8_t validate_acc_odr_range(uint8_t *odr, uint8_t *range, struct bmi3_dev *dev)
+int8_t bmi3_get_fifo_length(uint16_t *fifo_avail_len, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    if ((odr != NULL) && (range != NULL))
+    /* Variable to define byte index */
+    uint16_t reg_data;
+
+    /* Array to store FIFO data length */
+    uint8_t data[BMI3_LENGTH_FIFO_DATA] = { 0 };
+
+    if (fifo_avail_len != NULL)
     {
-        /* Validate and auto correct ODR */
-        rslt = check_boundary_val(odr, BMI3_ACC_ODR_0_78HZ, BMI3_ACC_ODR_6400HZ, dev);
+        /* Read FIFO length */
+        rslt = bmi3_get_regs(BMI3_REG_FIFO_FILL_LEVEL, data, BMI3_LENGTH_FIFO_DATA, dev);
 
         if (rslt == BMI3_OK)
         {
-            /* Validate and auto correct Range */
-            rslt = check_boundary_val(range, BMI3_ACC_RANGE_2G, BMI3_ACC_RANGE_16G, dev);
+            /* Get the MSB byte of FIFO length */
+            data[0] = BMI3_GET_BIT_POS0(data[0], BMI3_FIFO_FILL_LEVEL);
+
+            reg_data = ((uint16_t)data[1] << 8);
+
+            reg_data = BMI3_GET_BIT_POS0(reg_data, BMI3_FIFO_FILL_LEVEL);
+
+            /* Get total FIFO length */
+            *fifo_avail_len = (uint16_t)(reg_data | data[0]);
+
+            if (*fifo_avail_len == 0)
+            {
+                rslt = BMI3_W_FIFO_EMPTY;
+            }
         }
     }
     else
@@ -4697,33 +5151,104 @@ static int8_t validate_acc_odr_range(uint8_t *odr, uint8_t *range, struct bmi3_d
 }
 
 /*!
- * @brief This internal API is used to validate the boundary conditions.
+ * @brief This API reads the FIFO data into the next buffer of a ring and returns a view
+ * on it without the interface dummy bytes.
  */
-static int8_t check_boundary_val(uint8_t *val, uint8_t min, uint8_t max, struct bmi3_dev *dev)
+int8_t bmi3_read_fifo_view(struct bmi3_fifo_buf_ring *ring, struct bmi3_fifo_view *view, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Null-pointer check */
+    /* Variable to store FIFO fill level in words */
+    uint16_t fifo_len = 0;
+
+    /* Variable to store number of FIFO bytes to be read */
+    uint16_t read_len = 0;
+
+    /* Variable to store the length of one frame */
+    uint16_t frame_len;
+
+    /* Variable to store FIFO data address */
+    uint8_t reg_addr = BMI3_REG_FIFO_DATA;
+
+    /* Pointer to the ring buffer in use */
+    uint8_t *buf;
+
     rslt = null_ptr_check(dev);
 
-    if ((rslt == BMI3_OK) && (val != NULL))
+    if ((rslt == BMI3_OK) && (ring != NULL) && (ring->buf != NULL) && (view != NULL))
     {
-        /* Check if value is below minimum value */
-        if (*val < min)
+        view->data = NULL;
+        view->length = 0;
+
+        if ((ring->num_buf == 0) || (ring->next >= ring->num_buf) || (ring->buf_size <= dev->dummy_byte))
         {
-            /* Auto correct the invalid value to minimum value */
-            *val = min;
-            dev->info |= BMI3_I_MIN_VALUE;
+            rslt = BMI3_E_INVALID_INPUT;
         }
 
-        /* Check if value is above maximum value */
-        if (*val > max)
+        /* The configuration, the fill level and the data are read under one lock */
+        lock_dev(dev);
+
+        if (rslt == BMI3_OK)
         {
-            /* Auto correct the invalid value to maximum value */
-            *val = max;
-            dev->info |= BMI3_I_MAX_VALUE;
+            /* Get the set FIFO frame configurations */
+            rslt = get_fifo_sens(&view->available_fifo_sens, dev);
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = bmi3_get_fifo_length(&fifo_len, dev);
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            read_len = (uint16_t)(fifo_len * 2);
+
+            /* Read only whole frames when the FIFO holds more than one buffer */
+            if (read_len > (ring->buf_size - dev->dummy_byte))
+            {
+                read_len = (uint16_t)(ring->buf_size - dev->dummy_byte);
+                frame_len = get_fifo_frame_length(view->available_fifo_sens);
+
+                if (frame_len != 0)
+                {
+                    read_len = (uint16_t)(read_len - (read_len % frame_len));
+                }
+            }
+
+            if ((read_len == 0) || (ring->buf[ring->next] == NULL))
+            {
+                rslt = BMI3_E_INVALID_INPUT;
+            }
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            buf = ring->buf[ring->next];
+
+            if (dev->intf == BMI3_SPI_INTF)
+            {
+                reg_addr = (reg_addr | BMI3_SPI_RD_MASK);
+            }
+
+            /* Burst-read straight into the ring buffer, dummy bytes included */
+            dev->intf_rslt = dev->read(reg_addr, buf, (uint32_t)read_len + dev->dummy_byte, dev->intf_ptr);
+
+            if (dev->intf_rslt == BMI3_INTF_RET_SUCCESS)
+            {
+                view->data = &buf[dev->dummy_byte];
+                view->length = read_len;
+                view->buf_idx = ring->next;
+
+                ring->next = (uint8_t)((ring->next + 1) % ring->num_buf);
+            }
+            else
+            {
+                rslt = BMI3_E_COM_FAIL;
+            }
         }
+
+        unlock_dev(dev);
     }
     else
     {
@@ -4734,65 +5259,125 @@ static int8_t check_boundary_val(uint8_t *val, uint8_t min, uint8_t max, struct
 }
 
 /*!
- * @brief This internal API sets gyroscope configurations like ODR,
- * bandwidth, gyro mode, average samples and dps range.
+ * @brief This API drains the FIFO into the next buffer of a ring in one bus transaction.
  */
-static int8_t set_gyro_config(struct bmi3_gyro_config *config, struct bmi3_dev *dev)
+int8_t bmi3_drain_fifo_view(struct bmi3_fifo_buf_ring *ring,
+                            struct bmi3_fifo_view *view,
+                            uint16_t max_len,
+                            struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to store data */
-    uint8_t reg_data[2] = { 0 };
+    /* Variable to store number of FIFO bytes to be read */
+    uint16_t read_len = 0;
 
-    uint16_t odr, range, bwp, avg_num, gyr_mode;
+    /* Variable to store the length of one frame */
+    uint16_t frame_len = 0;
 
-    if (config != NULL)
+    /* Variable to store FIFO data address */
+    uint8_t reg_addr = BMI3_REG_FIFO_DATA;
+
+    /* Pointer to the ring buffer in use */
+    uint8_t *buf;
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (ring != NULL) && (ring->buf != NULL) && (view != NULL))
     {
-        /* Validate bandwidth, average samples and mode */
-        rslt = validate_bw_avg_gyr_mode(&config->bwp, &config->gyr_mode, &config->avg_num, dev);
+        view->data = NULL;
+        view->length = 0;
 
-        if (rslt == BMI3_OK)
+        if ((ring->num_buf == 0) || (ring->next >= ring->num_buf) || (ring->buf_size <= dev->dummy_byte) ||
+            (ring->buf[ring->next] == NULL))
         {
-            /* Validate ODR and range */
-            rslt = validate_gyr_odr_range(&config->odr, &config->range, dev);
+            rslt = BMI3_E_INVALID_INPUT;
         }
 
+        lock_dev(dev);
+
         if (rslt == BMI3_OK)
         {
-            if (config->gyr_mode == BMI3_GYR_MODE_LOW_PWR)
-            {
-                rslt = validate_gyr_odr_avg(config->odr, config->avg_num);
-            }
+            rslt = get_fifo_sens(&view->available_fifo_sens, dev);
         }
 
-        if (rslt == BMI3_OK)
+        /* The FIFO data read has to see the queued writes, the cached configuration already does */
+        if ((rslt == BMI3_OK) && (dev->batch != NULL) && (dev->batch->num_ops != 0))
         {
-            /* Set gyroscope ODR */
-            odr = BMI3_SET_BIT_POS0(reg_data[0], BMI3_GYR_ODR, config->odr);
+            rslt = flush_batch(dev);
+        }
 
-            /* Set gyroscope range */
-            range = BMI3_SET_BITS(reg_data[0], BMI3_GYR_RANGE, config->range);
+        if (rslt == BMI3_OK)
+        {
+            frame_len = get_fifo_frame_length(view->available_fifo_sens);
 
-            /* Set gyroscope bandwidth */
-            bwp = BMI3_SET_BITS(reg_data[0], BMI3_GYR_BW, config->bwp);
+            /* Read whole frames, at most one buffer and the FIFO size */
+            read_len = (uint16_t)(ring->buf_size - dev->dummy_byte);
 
-            /* Set gyroscope average sample */
-            avg_num = BMI3_SET_BITS(reg_data[1], BMI3_GYR_AVG_NUM, config->avg_num);
+            if ((max_len != 0) && (max_len < read_len))
+            {
+                read_len = max_len;
+            }
 
-            /* Set gyroscope mode */
-            gyr_mode = BMI3_SET_BITS(reg_data[1], BMI3_GYR_MODE, config->gyr_mode);
+            if (read_len > (BMI3_FIFO_CAPACITY_WORDS * 2))
+            {
+                read_len = (uint16_t)(BMI3_FIFO_CAPACITY_WORDS * 2);
+            }
 
-            reg_data[0] = (uint8_t)(odr | range | bwp);
-            reg_data[1] = (uint8_t)((avg_num | gyr_mode) >> 8);
+            if (frame_len != 0)
+            {
+                read_len = (uint16_t)(read_len - (read_len % frame_len));
+            }
 
-            /* Set gyro configurations */
-            rslt = bmi3_set_regs(BMI3_REG_GYR_CONF, reg_data, 2, dev);
+            if ((frame_len == 0) || (read_len == 0))
+            {
+                rslt = BMI3_E_INVALID_INPUT;
+            }
         }
-        else
+
+        if (rslt == BMI3_OK)
         {
-            rslt = BMI3_E_GYRO_INVALID_CFG;
+            if (view->available_fifo_sens & (BMI3_FIFO_HEAD_LESS_ACC_FRM | BMI3_FIFO_HEAD_LESS_GYR_FRM))
+            {
+                buf = ring->buf[ring->next];
+
+                if (dev->intf == BMI3_SPI_INTF)
+                {
+                    reg_addr = (reg_addr | BMI3_SPI_RD_MASK);
+                }
+
+                /* Read past the fill level; the sensor returns empty words after the last frame */
+                dev->intf_rslt = dev->read(reg_addr, buf, (uint32_t)read_len + dev->dummy_byte, dev->intf_ptr);
+
+                if (dev->intf_rslt == BMI3_INTF_RET_SUCCESS)
+                {
+                    view->length = find_fifo_end(&buf[dev->dummy_byte], read_len, view->available_fifo_sens);
+
+                    if (view->length != 0)
+                    {
+                        view->data = &buf[dev->dummy_byte];
+                        view->buf_idx = ring->next;
+
+                        ring->next = (uint8_t)((ring->next + 1) % ring->num_buf);
+                    }
+                    else
+                    {
+                        rslt = BMI3_W_FIFO_EMPTY;
+                    }
+                }
+                else
+                {
+                    rslt = BMI3_E_COM_FAIL;
+                }
+            }
+            else
+            {
+                /* Temperature and sensor time words carry no end marker */
+                rslt = bmi3_read_fifo_view(ring, view, dev);
+            }
         }
+
+        unlock_dev(dev);
     }
     else
     {
@@ -4802,33 +5387,33 @@ static int8_t set_gyro_config(struct bmi3_gyro_config *config, struct bmi3_dev *
     return rslt;
 }
 
+#ifndef BMI3_SELF_TEST_DISABLE
 /*!
- * @brief This internal API validates bandwidth, average samples and gyr mode of the
- * gyroscope set by the user.
+ * @brief This API is used to perform the self-test for either accel or gyro or both.
  */
-static int8_t validate_bw_avg_gyr_mode(uint8_t *bandwidth,
-                                       uint8_t *gyr_mode,
-                                       const uint8_t *avg_num,
-                                       struct bmi3_dev *dev)
+int8_t bmi3_perform_self_test(uint8_t st_selection, struct bmi3_st_result *st_result_status, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    if ((bandwidth != NULL) && (gyr_mode != NULL) && (avg_num != NULL))
+    /* Get accel configurations */
+    struct bmi3_accel_config acc_cfg = { 0 };
+
+    if (st_result_status != NULL)
     {
-        /* Validate and auto-correct gyro mode */
-        rslt = check_boundary_val(gyr_mode, BMI3_GYR_MODE_DISABLE, BMI3_GYR_MODE_HIGH_PERF, dev);
+        /* Sets the self-test preconditions and triggers the self-test in the
+         * command register. */
+        rslt = start_self_test(st_selection, &acc_cfg, dev);
 
         if (rslt == BMI3_OK)
         {
-            /* Validate for averaging mode */
-            rslt = check_boundary_val(bandwidth, BMI3_GYR_AVG1, BMI3_GYR_AVG64, dev);
+            rslt = get_st_status_rslt(st_selection, st_result_status, dev);
+        }
 
-            if (rslt == BMI3_OK)
-            {
-                /* Validate for bandwidth */
-                rslt = check_boundary_val(bandwidth, BMI3_GYR_BW_ODR_HALF, BMI3_GYR_BW_ODR_QUARTER, dev);
-            }
+        if (rslt == BMI3_OK)
+        {
+            /* Restore accel configurations */
+            rslt = set_accel_config(&acc_cfg, dev);
         }
     }
     else
@@ -4838,65 +5423,72 @@ static int8_t validate_bw_avg_gyr_mode(uint8_t *bandwidth,
 
     return rslt;
 }
+#endif
 
+#ifndef BMI3_ENHANCED_FLEXIBILITY_DISABLE
 /*!
- * @brief This internal API validates ODR and range of the gyroscope set by
- * the user.
+ * @brief This API writes the config array and config version in cfg res.
  */
-static int8_t validate_gyr_odr_range(uint8_t *odr, uint8_t *range, struct bmi3_dev *dev)
+int8_t bmi3_configure_enhanced_flexibility(struct bmi3_dev *dev)
 {
-    /* Variable to store result of API */
+    /* Variable to define error */
     int8_t rslt;
 
-    if ((odr != NULL) && (range != NULL))
-    {
-        /* Validate and auto correct ODR */
-        rslt = check_boundary_val(odr, BMI3_GYR_ODR_0_78HZ, BMI3_GYR_ODR_6400HZ, dev);
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-        if (rslt == BMI3_OK)
-        {
-            /* Validate and auto correct Range */
-            rslt = check_boundary_val(range, BMI3_GYR_RANGE_125DPS, BMI3_GYR_RANGE_2000DPS, dev);
-        }
-    }
-    else
+    if (rslt == BMI3_OK)
     {
-        rslt = BMI3_E_NULL_PTR;
+        rslt = enhanced_flexibility_upload(NULL, dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API gets the accelerometer data from the register.
+ * @brief This API writes the config array and config version in cfg res, optionally reads
+ * them back, and reports the upload statistics.
  */
-static int8_t get_accel_sensor_data(struct bmi3_sens_axes_data *data, uint8_t reg_addr, struct bmi3_dev *dev)
+int8_t bmi3_configure_enhanced_flexibility_ext(struct bmi3_config_upload *upload, struct bmi3_dev *dev)
 {
-    /* Variable to store result of API */
+    /* Variable to define error */
     int8_t rslt;
 
-    /* Array to define data stored in register */
-    uint8_t reg_data[BMI3_ACC_NUM_BYTES] = { 0 };
+    /* Variables to store the sensor time before and after the upload */
+    uint32_t start_time = 0;
+    uint32_t end_time = 0;
 
-    /* Stores the accel x, y and z axis data from register */
-    uint16_t acc_data[6];
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-    if (data != NULL)
+    if ((rslt == BMI3_OK) && (upload != NULL))
     {
-        /* Read the sensor data */
-        rslt = bmi3_get_regs(reg_addr, reg_data, BMI3_ACC_NUM_BYTES, dev);
+        upload->bytes = 0;
+        upload->bursts = 0;
+        upload->time_us = 0;
+        upload->bytes_per_sec = 0;
+
+        /* The driver has no clock of its own; the sensor time keeps running across the upload */
+        rslt = bmi3_get_sensor_time(&start_time, dev);
 
         if (rslt == BMI3_OK)
         {
-            acc_data[0] = (reg_data[0] | (uint16_t)reg_data[1] << 8);
-            acc_data[1] = (reg_data[2] | (uint16_t)reg_data[3] << 8);
-            acc_data[2] = (reg_data[4] | (uint16_t)reg_data[5] << 8);
-            acc_data[3] = (reg_data[14] | (uint16_t)reg_data[15] << 8);
-            acc_data[4] = (reg_data[16] | (uint16_t)reg_data[17] << 8);
-            acc_data[5] = reg_data[18];
+            rslt = enhanced_flexibility_upload(upload, dev);
+        }
 
-            /* Get accelerometer data from the register */
-            get_acc_data(data, acc_data);
+        if (rslt == BMI3_OK)
+        {
+            rslt = bmi3_get_sensor_time(&end_time, dev);
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            upload->time_us = (uint32_t)BMI3_SENSOR_TIME_TO_US((uint32_t)(end_time - start_time));
+
+            if (upload->time_us != 0)
+            {
+                upload->bytes_per_sec = (uint32_t)(((uint64_t)upload->bytes * 1000000) / upload->time_us);
+            }
         }
     }
     else
@@ -4906,37 +5498,50 @@ static int8_t get_accel_sensor_data(struct bmi3_sens_axes_data *data, uint8_t re
 
     return rslt;
 }
+#endif
 
 /*!
- * @brief This internal API gets the gyroscope data from the register.
+ * @brief This API is used to get the config version.
  */
-static int8_t get_gyro_sensor_data(struct bmi3_sens_axes_data *data, uint8_t reg_addr, struct bmi3_dev *dev)
+int8_t bmi3_get_config_version(struct bmi3_config_version *config_version, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt;
+    int8_t rslt = BMI3_OK;
 
-    /* Array to define data stored in register */
-    uint8_t reg_data[BMI3_GYR_NUM_BYTES] = { 0 };
+    /* Array to store base address of config */
+    uint8_t data[2] = { BMI3_BASE_ADDR_CONFIG_VERSION, 0 };
 
-    /* Variable to store x, y and z axis gyro data */
-    uint16_t gyr_data[6];
+    /* Variable to store version number */
+    uint8_t version[6];
 
-    if (data != NULL)
+    uint16_t lsb_msb;
+
+    if (config_version != NULL)
     {
-        /* Read the sensor data */
-        rslt = bmi3_get_regs(reg_addr, reg_data, BMI3_GYR_NUM_BYTES, dev);
+        /* Set the config version base address to feature engine transmission address to start DMA transaction */
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, data, 2, dev);
 
         if (rslt == BMI3_OK)
         {
-            gyr_data[0] = (reg_data[0] | (uint16_t)reg_data[1] << 8);
-            gyr_data[1] = (reg_data[2] | (uint16_t)reg_data[3] << 8);
-            gyr_data[2] = (reg_data[4] | (uint16_t)reg_data[5] << 8);
-            gyr_data[3] = (reg_data[8] | (uint16_t)reg_data[9] << 8);
-            gyr_data[4] = (reg_data[10] | (uint16_t)reg_data[11] << 8);
-            gyr_data[5] = reg_data[12];
+            /* Get the configuration from the feature engine register */
+            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, version, 6, dev);
 
-            /* Get gyro data from the register */
-            get_gyr_data(data, gyr_data);
+            if (rslt == BMI3_OK)
+            {
+                /* Get word to calculate config major and minor version from same word */
+                lsb_msb = (uint16_t)(version[0] | ((uint16_t) version[1] << 8));
+
+                config_version->config1_minor_version = (uint8_t)(lsb_msb & BMI3_CONFIG_1_MINOR_MASK);
+
+                config_version->config1_major_version = (lsb_msb & BMI3_CONFIG_1_MAJOR_MASK) >> BMI3_CONFIG_POS;
+
+                /* Get word to calculate config major and minor version from same word */
+                lsb_msb = (uint16_t)(version[2] | ((uint16_t) version[3] << 8));
+
+                config_version->config2_minor_version = (uint8_t)(lsb_msb & BMI3_CONFIG_2_MINOR_MASK);
+
+                config_version->config2_major_version = (lsb_msb & BMI3_CONFIG_2_MAJOR_MASK) >> BMI3_CONFIG_POS;
+            }
         }
     }
     else
@@ -4948,28 +5553,34 @@ static int8_t get_gyro_sensor_data(struct bmi3_sens_axes_data *data, uint8_t reg
 }
 
 /*!
- * @brief This internal API gets the step counter data from the register.
+ * @brief This API is used to perform the self-calibration for either sensitivity or offset or both.
  */
-static int8_t get_step_counter_sensor_data(uint32_t *step_count, uint8_t reg_addr, struct bmi3_dev *dev)
+int8_t bmi3_perform_gyro_sc(uint8_t sc_selection,
+                            uint8_t apply_corr,
+                            struct bmi3_self_calib_rslt *sc_rslt,
+                            struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define data stored in register */
-    uint8_t reg_data[4] = { 0 };
+    /* Structure to store sensor configuration for accel */
+    struct bmi3_sens_config get_config;
 
-    if (step_count != NULL)
+    if (sc_rslt != NULL)
     {
-        /* Read the sensor data */
-        rslt = bmi3_get_regs(reg_addr, reg_data, 4, dev);
+        /* Set the preconditions and trigger the self-calibration */
+        rslt = start_gyro_sc(sc_selection, apply_corr, &get_config, dev);
 
         if (rslt == BMI3_OK)
         {
-            /* Get the step counter output in 4 bytes */
-            *step_count = (uint32_t) reg_data[0];
-            *step_count |= ((uint32_t) reg_data[1] << 8);
-            *step_count |= ((uint32_t) reg_data[2] << 16);
-            *step_count |= ((uint32_t) reg_data[3] << 24);
+            /* Get the self-calibration status and result */
+            rslt = get_sc_gyro_rslt(sc_rslt, dev);
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            /* Restore accel configurations */
+            rslt = bmi3_set_sensor_config(&get_config, 1, dev);
         }
     }
     else
@@ -4980,46 +5591,46 @@ static int8_t get_step_counter_sensor_data(uint32_t *step_count, uint8_t reg_add
     return rslt;
 }
 
+#ifndef BMI3_I3C_SYNC_DISABLE
 /*!
- * @brief This internal API gets the output values of orientation: portrait-
- * landscape and face up-down.
+ * @brief This API is used to set the data sample rate for i3c sync
  */
-static int8_t get_orient_output_data(struct bmi3_orientation_output *orient_out, uint8_t reg_addr, struct bmi3_dev *dev)
+int8_t bmi3_set_i3c_tc_sync_tph(uint16_t sample_rate, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define data stored in register */
-    uint8_t reg_data[2] = { 0 };
+    uint16_t reg_data;
 
-    if (orient_out != NULL)
-    {
-        /* Read the data from feature engine status register */
-        rslt = bmi3_get_regs(reg_addr, reg_data, 2, dev);
+    /* To get the second byte data in word calculation */
+    uint16_t tc_tph;
 
-        if (rslt == BMI3_OK)
-        {
-            /* Get the output value of the orientation detection feature */
-            orient_out->orientation_portrait_landscape = BMI3_GET_BIT_POS0(reg_data[0],
-                                                                           BMI3_ORIENTATION_PORTRAIT_LANDSCAPE);
+    /* Array to store data */
+    uint8_t data_array[2] = { 0 };
 
-            /* Get the output value of the orientation face up-down feature */
-            orient_out->orientation_faceup_down = BMI3_GET_BITS(reg_data[0], BMI3_ORIENTATION_FACEUP_DOWN);
-        }
-    }
-    else
+    /* Get the data sample rate of i3c sync */
+    rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_TPH, data_array, 2, dev);
+
+    if (rslt == BMI3_OK)
     {
-        rslt = BMI3_E_NULL_PTR;
+        data_array[0] = (uint8_t)BMI3_SET_BIT_POS0(data_array[0], BMI3_I3C_TC_SYNC_TPH, sample_rate);
+
+        reg_data = ((uint16_t)data_array[1] << 8);
+
+        tc_tph = (uint8_t)BMI3_SET_BIT_POS0(reg_data, BMI3_I3C_TC_SYNC_TPH, sample_rate);
+
+        data_array[1] = (uint8_t)(tc_tph >> 8);
+
+        rslt = bmi3_set_regs(BMI3_REG_I3C_TC_SYNC_TPH, data_array, 2, dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API gets gyroscope configurations like ODR, gyro mode,
- * bandwidth, averaging samples and range.
+ * @brief This API is used to get the data sample rate for i3c sync
  */
-static int8_t get_gyro_config(struct bmi3_gyro_config *config, struct bmi3_dev *dev)
+int8_t bmi3_get_i3c_tc_sync_tph(uint16_t *sample_rate, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
@@ -5027,33 +5638,15 @@ static int8_t get_gyro_config(struct bmi3_gyro_config *config, struct bmi3_dev *
     /* Array to store data */
     uint8_t data_array[2] = { 0 };
 
-    uint16_t reg_data;
-
-    if (config != NULL)
+    if (sample_rate != NULL)
     {
-        /* Read the sensor configuration details */
-        rslt = bmi3_get_regs(BMI3_REG_GYR_CONF, data_array, 2, dev);
+        /* Get the data sample rate of i3c sync */
+        rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_TPH, data_array, 2, dev);
 
         if (rslt == BMI3_OK)
         {
-            reg_data = data_array[0];
-
-            /* Get gyro ODR */
-            config->odr = BMI3_GET_BIT_POS0(reg_data, BMI3_GYR_ODR);
-
-            /* Get gyro range */
-            config->range = BMI3_GET_BITS(reg_data, BMI3_GYR_RANGE);
-
-            /* Get gyro bandwidth */
-            config->bwp = BMI3_GET_BITS(reg_data, BMI3_GYR_BW);
-
-            reg_data = (uint16_t)data_array[1] << 8;
-
-            /* Get gyro average sample */
-            config->avg_num = BMI3_GET_BITS(reg_data, BMI3_GYR_AVG_NUM);
-
-            /* Get gyro mode */
-            config->gyr_mode = BMI3_GET_BITS(reg_data, BMI3_GYR_MODE);
+            /* Get i3c sync tph sample rate */
+            *sample_rate = (uint16_t)(data_array[0] | (uint16_t)data_array[1] << 8);
         }
     }
     else
@@ -5065,224 +5658,105 @@ static int8_t get_gyro_config(struct bmi3_gyro_config *config, struct bmi3_dev *
 }
 
 /*!
- * @brief This internal API gets the accelerometer data.
- */
-static void get_acc_data(struct bmi3_sens_axes_data *data, const uint16_t *reg_data)
-{
-    /* Stores accel x-axis data */
-    data->x = (int16_t)reg_data[0];
-
-    /* Stores accel y-axis data */
-    data->y = (int16_t)reg_data[1];
-
-    /* Stores accel z-axis data */
-    data->z = (int16_t)reg_data[2];
-
-    /* Stores sensor time data */
-    data->sens_time = (reg_data[3] | ((uint32_t)reg_data[4] << 16));
-
-    /* Stores saturation x-axis data */
-    data->sat_x = (reg_data[5] & BMI3_SATF_ACC_X_MASK);
-
-    /* Stores saturation y-axis data */
-    data->sat_y = (reg_data[5] & BMI3_SATF_ACC_Y_MASK) >> BMI3_SATF_ACC_Y_POS;
-
-    /* Stores saturation z-axis data */
-    data->sat_z = (reg_data[5] & BMI3_SATF_ACC_Z_MASK) >> BMI3_SATF_ACC_Z_POS;
-}
-
-/*!
- * @brief This internal API gets the gyroscope data.
+ * @brief This API is used set the TU(time unit) value is used to scale the delay time payload
+ * according to the hosts needs
  */
-static void get_gyr_data(struct bmi3_sens_axes_data *data, const uint16_t *reg_data)
+int8_t bmi3_set_i3c_tc_sync_tu(uint8_t delay_time, struct bmi3_dev *dev)
 {
-    /* Stores accel x-axis data */
-    data->x = (int16_t)reg_data[0];
-
-    /* Stores accel y-axis data */
-    data->y = (int16_t)reg_data[1];
+    /* Variable to store result of API */
+    int8_t rslt;
 
-    /* Stores accel z-axis data */
-    data->z = (int16_t)reg_data[2];
+    /* Variable to define data array */
+    uint8_t data_array[2] = { 0 };
 
-    /* Stores sensor time data */
-    data->sens_time = (reg_data[3] | ((uint32_t)reg_data[4] << 16));
+    /* Get the i3c sync time unit */
+    rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_TU, data_array, 2, dev);
 
-    /* Stores saturation x-axis data */
-    data->sat_x = (reg_data[5] & BMI3_SATF_GYR_X_MASK) >> BMI3_SATF_GYR_X_POS;
+    if (rslt == BMI3_OK)
+    {
+        /* Set the i3c sync time unit */
+        data_array[0] = BMI3_SET_BIT_POS0(data_array[0], BMI3_I3C_TC_SYNC_TU, delay_time);
 
-    /* Stores saturation y-axis data */
-    data->sat_y = (reg_data[5] & BMI3_SATF_GYR_Y_MASK) >> BMI3_SATF_GYR_Y_POS;
+        rslt = bmi3_set_regs(BMI3_REG_I3C_TC_SYNC_TU, data_array, 2, dev);
+    }
 
-    /* Stores saturation z-axis data */
-    data->sat_z = (reg_data[5] & BMI3_SATF_GYR_Z_MASK) >> BMI3_SATF_GYR_Z_POS;
+    return rslt;
 }
 
 /*!
- * @brief This internal API is used to validate the device structure pointer for
- * null conditions.
+ * @brief This API is used get the TU(time unit) value is used to scale the delay time payload
+ * according to the hosts needs
  */
-static int8_t null_ptr_check(const struct bmi3_dev *dev)
+int8_t bmi3_get_i3c_tc_sync_tu(uint8_t *delay_time, struct bmi3_dev *dev)
 {
+    /* Variable to store result of API */
     int8_t rslt;
 
-    if ((dev == NULL) || (dev->read == NULL) || (dev->write == NULL) || (dev->delay_us == NULL))
+    /* Variable to define data array */
+    uint8_t data_array[2] = { 0 };
+
+    if (delay_time != NULL)
     {
-        rslt = BMI3_E_NULL_PTR;
+        /* Get the i3c sync time unit */
+        rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_TU, data_array, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            *delay_time = BMI3_GET_BIT_POS0(data_array[0], BMI3_I3C_TC_SYNC_TU);
+        }
     }
     else
     {
-        /* Device structure is fine */
-        rslt = BMI3_OK;
+        rslt = BMI3_E_NULL_PTR;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API is used to get the enabled feature.
+ * @brief This API is used to set the i3c sync ODR.
  */
-static int8_t get_feature_enable(struct bmi3_feature_enable *enable, struct bmi3_dev *dev)
+int8_t bmi3_set_i3c_tc_sync_odr(uint8_t odr, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt = BMI3_OK;
-
-    uint8_t feature[2];
-    uint8_t reg_data;
-    uint16_t feature_config;
+    int8_t rslt;
 
-    if (enable != NULL)
-    {
-        rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO0, feature, 2, dev);
+    /* Variable to define data array */
+    uint8_t data_array[2] = { 0 };
 
-        if (rslt == BMI3_OK)
-        {
-            reg_data = feature[0];
-            enable->no_motion_x_en = BMI3_GET_BIT_POS0(reg_data, BMI3_NO_MOTION_X_EN);
-            enable->no_motion_y_en = BMI3_GET_BITS(reg_data, BMI3_NO_MOTION_Y_EN);
-            enable->no_motion_z_en = BMI3_GET_BITS(reg_data, BMI3_NO_MOTION_Z_EN);
-            enable->any_motion_x_en = BMI3_GET_BITS(reg_data, BMI3_ANY_MOTION_X_EN);
-            enable->any_motion_y_en = BMI3_GET_BITS(reg_data, BMI3_ANY_MOTION_Y_EN);
-            enable->any_motion_z_en = BMI3_GET_BITS(reg_data, BMI3_ANY_MOTION_Z_EN);
-            enable->flat_en = BMI3_GET_BITS(reg_data, BMI3_FLAT_EN);
-            enable->orientation_en = BMI3_GET_BITS(reg_data, BMI3_ORIENTATION_EN);
+    /* Get the i3c sync ODR */
+    rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_ODR, data_array, 2, dev);
 
-            feature_config = (uint16_t)feature[1] << 8;
+    if (rslt == BMI3_OK)
+    {
+        /* Set the i3c sync ODR */
+        data_array[0] = BMI3_SET_BIT_POS0(data_array[0], BMI3_I3C_TC_SYNC_ODR, odr);
 
-            enable->step_detector_en = BMI3_GET_BITS(feature_config, BMI3_STEP_DETECTOR_EN);
-            enable->step_counter_en = BMI3_GET_BITS(feature_config, BMI3_STEP_COUNTER_EN);
-            enable->sig_motion_en = BMI3_GET_BITS(feature_config, BMI3_SIG_MOTION_EN);
-            enable->tilt_en = BMI3_GET_BITS(feature_config, BMI3_TILT_EN);
-            enable->tap_detector_s_tap_en = BMI3_GET_BITS(feature_config, BMI3_TAP_DETECTOR_S_TAP_EN);
-            enable->tap_detector_d_tap_en = BMI3_GET_BITS(feature_config, BMI3_TAP_DETECTOR_D_TAP_EN);
-            enable->tap_detector_t_tap_en = BMI3_GET_BITS(feature_config, BMI3_TAP_DETECTOR_T_TAP_EN);
-            enable->i3c_sync_en = BMI3_GET_BITS(feature_config, BMI3_I3C_SYNC_EN);
-        }
+        rslt = bmi3_set_regs(BMI3_REG_I3C_TC_SYNC_ODR, data_array, 2, dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API is used to set the feature.
+ * @brief This API is used to get the i3c sync ODR.
  */
-static int8_t set_feature_enable(const struct bmi3_feature_enable *enable, struct bmi3_dev *dev)
+int8_t bmi3_get_i3c_tc_sync_odr(uint8_t *odr, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    uint8_t feature[2] = { 0 };
-    uint8_t get_feature[2];
-
-    uint16_t no_motion_x_en;
-    uint16_t no_motion_y_en;
-    uint16_t no_motion_z_en;
-    uint16_t any_motion_x_en;
-    uint16_t any_motion_y_en;
-    uint16_t any_motion_z_en;
-    uint16_t flat_en;
-    uint16_t orientation_en;
-    uint16_t step_detector_en;
-    uint16_t step_counter_en;
-    uint16_t sig_motion_en;
-    uint16_t tilt_en;
-    uint16_t tap_detector_s_tap_en;
-    uint16_t tap_detector_d_tap_en;
-    uint16_t tap_detector_t_tap_en;
-    uint16_t i3c_sync_en;
-
-    /* Array variable to clear feature before enabling into register */
-    uint8_t reset[2] = { 0 };
-
-    /* Array to set feature_engine_gp_status in order to enable the feature */
-    uint8_t gp_status[2] = { 1, 0 };
+    /* Array to store data */
+    uint8_t data_array[2] = { 0 };
 
-    if (enable != NULL)
+    if (odr != NULL)
     {
-        rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO0, get_feature, 2, dev);
+        /* Get the i3c sync ODR */
+        rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_ODR, data_array, 2, dev);
 
         if (rslt == BMI3_OK)
         {
-            no_motion_x_en =
-                (BMI3_SET_BIT_POS0(get_feature[0], BMI3_NO_MOTION_X_EN,
-                                   enable->no_motion_x_en) & BMI3_NO_MOTION_X_EN_MASK);
-            no_motion_y_en =
-                (BMI3_SET_BITS(get_feature[0], BMI3_NO_MOTION_Y_EN, enable->no_motion_y_en) & BMI3_NO_MOTION_Y_EN_MASK);
-            no_motion_z_en =
-                (BMI3_SET_BITS(get_feature[0], BMI3_NO_MOTION_Z_EN, enable->no_motion_z_en) & BMI3_NO_MOTION_Z_EN_MASK);
-            any_motion_x_en =
-                (BMI3_SET_BITS(get_feature[0], BMI3_ANY_MOTION_X_EN,
-                               enable->any_motion_x_en) & BMI3_ANY_MOTION_X_EN_MASK);
-            any_motion_y_en =
-                (BMI3_SET_BITS(get_feature[0], BMI3_ANY_MOTION_Y_EN,
-                               enable->any_motion_y_en) & BMI3_ANY_MOTION_Y_EN_MASK);
-            any_motion_z_en =
-                (BMI3_SET_BITS(get_feature[0], BMI3_ANY_MOTION_Z_EN,
-                               enable->any_motion_z_en) & BMI3_ANY_MOTION_Z_EN_MASK);
-            flat_en = (BMI3_SET_BITS(get_feature[0], BMI3_FLAT_EN, enable->flat_en) & BMI3_FLAT_EN_MASK);
-            orientation_en =
-                (BMI3_SET_BITS(get_feature[0], BMI3_ORIENTATION_EN, enable->orientation_en) & BMI3_ORIENTATION_EN_MASK);
-
-            step_detector_en =
-                (BMI3_SET_BITS(get_feature[1], BMI3_STEP_DETECTOR_EN,
-                               enable->step_detector_en) & BMI3_STEP_DETECTOR_EN_MASK);
-            step_counter_en =
-                (BMI3_SET_BITS(get_feature[1], BMI3_STEP_COUNTER_EN,
-                               enable->step_counter_en) & BMI3_STEP_COUNTER_EN_MASK);
-            sig_motion_en =
-                (BMI3_SET_BITS(get_feature[1], BMI3_SIG_MOTION_EN, enable->sig_motion_en) & BMI3_SIG_MOTION_EN_MASK);
-            tilt_en = (BMI3_SET_BITS(get_feature[1], BMI3_TILT_EN, enable->tilt_en) & BMI3_TILT_EN_MASK);
-            tap_detector_s_tap_en =
-                (BMI3_SET_BITS(get_feature[1], BMI3_TAP_DETECTOR_S_TAP_EN,
-                               enable->tap_detector_s_tap_en) & BMI3_TAP_DETECTOR_S_TAP_EN_MASK);
-            tap_detector_d_tap_en =
-                (BMI3_SET_BITS(get_feature[1], BMI3_TAP_DETECTOR_D_TAP_EN,
-                               enable->tap_detector_d_tap_en) & BMI3_TAP_DETECTOR_D_TAP_EN_MASK);
-            tap_detector_t_tap_en =
-                (BMI3_SET_BITS(get_feature[1], BMI3_TAP_DETECTOR_T_TAP_EN,
-                               enable->tap_detector_t_tap_en) & BMI3_TAP_DETECTOR_T_TAP_EN_MASK);
-            i3c_sync_en =
-                (BMI3_SET_BITS(get_feature[1], BMI3_I3C_SYNC_EN, enable->i3c_sync_en) & BMI3_I3C_SYNC_EN_MASK);
-
-            feature[0] =
-                (uint8_t)(no_motion_x_en | no_motion_y_en | no_motion_z_en | any_motion_x_en | any_motion_y_en |
-                          any_motion_z_en | flat_en | orientation_en);
-            feature[1] =
-                (uint8_t)((step_detector_en | step_counter_en | sig_motion_en | tilt_en | tap_detector_s_tap_en |
-                           tap_detector_d_tap_en | tap_detector_t_tap_en | i3c_sync_en) >> 8);
-
-            /* Reset the register before updating new values */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_IO0, reset, 2, dev);
-
-            if (rslt == BMI3_OK)
-            {
-                rslt = bmi3_set_regs(BMI3_REG_FEATURE_IO0, feature, 2, dev);
-            }
-
-            if (rslt == BMI3_OK)
-            {
-                rslt = bmi3_set_regs(BMI3_REG_FEATURE_IO_STATUS, gp_status, 2, dev);
-            }
+            *odr = BMI3_GET_BIT_POS0(data_array[0], BMI3_I3C_TC_SYNC_ODR);
         }
     }
     else
@@ -5294,23 +5768,51 @@ static int8_t set_feature_enable(const struct bmi3_feature_enable *enable, struc
 }
 
 /*!
- * @brief This internal API gets the latch mode from register address
+ * @brief This internal API gets i3c sync i3c_tc_res
  */
-static int8_t get_latch_mode(struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev)
+int8_t bmi3_get_i3c_sync_i3c_tc_res(uint8_t *i3c_tc_res, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to define data array */
-    uint8_t data_array[2] = { 0 };
-
-    if (int_cfg != NULL)
+    /* Array to define the feature configuration */
+    uint8_t i3c_sync_i3c_tc_res[2] = { 0 };
+
+    /* Array to set the base address of i3c sync feature */
+    uint8_t base_addr[2] = { BMI3_BASE_ADDR_I3C_SYNC, 0 };
+
+    /* Variable to define array offset */
+    uint8_t idx = 0;
+
+    /* Variable to define LSB */
+    uint16_t lsb;
+
+    /* Variable to define MSB */
+    uint16_t msb;
+
+    /* Variable to define a word */
+    uint16_t lsb_msb;
+
+    if (i3c_tc_res != NULL)
     {
-        rslt = bmi3_get_regs(BMI3_REG_INT_CONF, data_array, 2, dev);
+        /* Set the tap base address to feature engine transmission address to start DMA transaction */
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
 
         if (rslt == BMI3_OK)
         {
-            int_cfg->int_latch = BMI3_GET_BIT_POS0(data_array[0], BMI3_INT_LATCH);
+            /* Get the configuration from the feature engine register where tap feature resides */
+            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, i3c_sync_i3c_tc_res, 2, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                /* Get word to calculate i3c_tc_res from the same word */
+                lsb = (uint16_t) i3c_sync_i3c_tc_res[idx++];
+                msb = ((uint16_t) i3c_sync_i3c_tc_res[idx++] << 8);
+                lsb_msb = lsb | msb;
+
+                /* Get i3c_tc_res */
+                *i3c_tc_res = (uint8_t)(lsb_msb & BMI3_I3C_SYNC_FILTER_EN_MASK);
+            }
         }
     }
     else
@@ -5322,104 +5824,127 @@ static int8_t get_latch_mode(struct bmi3_int_pin_config *int_cfg, struct bmi3_de
 }
 
 /*!
- * @brief This internal API sets the latch mode to register address
+ * @brief This internal API sets i3c sync i3c_tc_res
  */
-static int8_t set_latch_mode(const struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev)
+int8_t bmi3_set_i3c_sync_i3c_tc_res(uint8_t i3c_tc_res, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to define data array */
-    uint8_t data_array[2] = { 0 };
+    /* Array to define the feature configuration */
+    uint8_t i3c_sync_i3c_tc_res[2] = { 0 };
 
-    if (int_cfg != NULL)
-    {
-        rslt = bmi3_get_regs(BMI3_REG_INT_CONF, data_array, 2, dev);
+    /* Array to set the base address of i3c sync feature */
+    uint8_t base_addr[2] = { BMI3_BASE_ADDR_I3C_SYNC, 0 };
 
-        if (rslt == BMI3_OK)
-        {
-            /* Configure the interrupt mode */
-            data_array[0] = BMI3_SET_BIT_POS0(data_array[0], BMI3_INT_LATCH, int_cfg->int_latch);
+    /* Set the tap base address to feature engine transmission address to start DMA transaction */
+    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
 
-            rslt = bmi3_set_regs(BMI3_REG_INT_CONF, data_array, 2, dev);
-        }
-    }
-    else
+    if (rslt == BMI3_OK)
     {
-        rslt = BMI3_E_NULL_PTR;
+        /* Set i3c_tc_res */
+        i3c_sync_i3c_tc_res[0] = BMI3_SET_BIT_POS0(i3c_sync_i3c_tc_res[0], BMI3_I3C_SYNC_FILTER_EN, i3c_tc_res);
+
+        /* Left shift by 8 times so that we can set rest of the values of i3c_tc_res data in word */
+        i3c_sync_i3c_tc_res[1] = (uint8_t)(i3c_sync_i3c_tc_res[1] << 8);
+
+        /* Set the configuration back to the feature engine register */
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, i3c_sync_i3c_tc_res, 2, dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API gets any-motion configurations like threshold,
- * duration, accel reference up, hysteresis and wait time.
+ * @brief This API reads the I3C sync accel, gyro and temperature data of one sync epoch in one DMA burst.
  */
-static int8_t get_any_motion_config(struct bmi3_any_motion_config *config, struct bmi3_dev *dev)
+int8_t bmi3_get_i3c_sync_snapshot(struct bmi3_i3c_sync_snapshot *snapshot, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define the feature configuration */
-    uint8_t any_mot_config[6] = { 0 };
+    /* Array to define data stored in register, from the accel x-axis up to the sync time */
+    uint8_t reg_data[BMI3_NUM_BYTES_I3C_SYNC_SNAPSHOT] = { 0 };
 
-    /* Array to set the base address of any-motion feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ANY_MOTION, 0 };
+    /* Array to store the sync time read ahead of the burst */
+    uint8_t time_data[BMI3_NUM_BYTES_I3C_SYNC_TIME] = { 0 };
 
-    uint8_t idx = 0;
+    /* Array to set the base address of i3c sync accel data */
+    uint8_t base_addr[2] = { BMI3_BASE_ADDR_I3C_SYNC_ACC, 0 };
 
-    /* Variable to define LSB */
-    uint16_t lsb;
+    /* Array to set the base address of i3c sync time */
+    uint8_t time_addr[2] = { BMI3_BASE_ADDR_I3C_SYNC_TIME, 0 };
 
-    /* Variable to define MSB */
-    uint16_t msb;
+    /* Variable to store the sync time of the burst */
+    uint16_t sync_time = 0;
 
-    /* Variable to define a word */
-    uint16_t lsb_msb;
+    /* Variable to define the number of attempts */
+    uint8_t attempt = 0;
 
-    if (config != NULL)
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (snapshot != NULL))
     {
-        /* Set the any-motion base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        /* Keep the address write and the DMA reads of an attempt together */
+        lock_dev(dev);
 
-        if (rslt == BMI3_OK)
+        while (attempt <= BMI3_I3C_SYNC_SNAPSHOT_RETRIES)
         {
-            /* Get the configuration from the feature engine register where any-motion feature resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, any_mot_config, 6, dev);
+            /* Set the i3c sync time address to feature engine transmission address to start DMA transaction */
+            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, time_addr, 2, dev);
 
             if (rslt == BMI3_OK)
             {
-                /* Get word to calculate threshold and accel reference up from same word */
-                lsb = (uint16_t) any_mot_config[idx++];
-                msb = ((uint16_t) any_mot_config[idx++] << 8);
-                lsb_msb = (lsb | msb);
+                /* Read the sync time ahead of the data: the burst ends with the sync time, so a new epoch
+                 * published while the burst runs shows up as a different time at its end */
+                rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, time_data, BMI3_NUM_BYTES_I3C_SYNC_TIME, dev);
+            }
 
-                /* Get threshold */
-                config->slope_thres = (lsb_msb & BMI3_ANY_NO_SLOPE_THRESHOLD_MASK);
+            if (rslt == BMI3_OK)
+            {
+                /* Set the i3c sync accel base address to feature engine transmission address */
+                rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+            }
 
-                /* Get accel reference up */
-                config->acc_ref_up = (lsb_msb & BMI3_ANY_NO_ACC_REF_UP_MASK) >> BMI3_ANY_NO_ACC_REF_UP_POS;
+            if (rslt == BMI3_OK)
+            {
+                /* Accel, gyro, temperature and sync time are consecutive words of the feature engine */
+                rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, BMI3_NUM_BYTES_I3C_SYNC_SNAPSHOT, dev);
+            }
 
-                /* Get word to calculate hysteresis from the word */
-                lsb = (uint16_t) any_mot_config[idx++];
-                msb = ((uint16_t) any_mot_config[idx++] << 8);
-                lsb_msb = (lsb | msb);
+            if (rslt != BMI3_OK)
+            {
+                break;
+            }
 
-                /* Get hysteresis */
-                config->hysteresis = (lsb_msb & BMI3_ANY_NO_HYSTERESIS_MASK);
+            sync_time = (reg_data[14] | (uint16_t)reg_data[15] << 8);
 
-                /* Get word to calculate duration and wait time from the same word */
-                lsb = (uint16_t) any_mot_config[idx++];
-                msb = ((uint16_t) any_mot_config[idx++] << 8);
-                lsb_msb = (lsb | msb);
+            if (sync_time == (time_data[0] | (uint16_t)time_data[1] << 8))
+            {
+                break;
+            }
+
+            rslt = BMI3_E_I3C_SYNC_TORN;
+            attempt++;
+        }
 
-                /* Get duration */
-                config->duration = (lsb_msb & BMI3_ANY_NO_DURATION_MASK);
+        unlock_dev(dev);
 
-                /* Get wait time */
-                config->wait_time = (lsb_msb & BMI3_ANY_NO_WAIT_TIME_MASK) >> BMI3_ANY_NO_WAIT_TIME_POS;
-            }
+        if (rslt == BMI3_OK)
+        {
+            snapshot->acc.sync_x = (reg_data[0] | (uint16_t)reg_data[1] << 8);
+            snapshot->acc.sync_y = (reg_data[2] | (uint16_t)reg_data[3] << 8);
+            snapshot->acc.sync_z = (reg_data[4] | (uint16_t)reg_data[5] << 8);
+            snapshot->acc.sync_time = sync_time;
+
+            snapshot->gyr.sync_x = (reg_data[6] | (uint16_t)reg_data[7] << 8);
+            snapshot->gyr.sync_y = (reg_data[8] | (uint16_t)reg_data[9] << 8);
+            snapshot->gyr.sync_z = (reg_data[10] | (uint16_t)reg_data[11] << 8);
+            snapshot->gyr.sync_time = sync_time;
+
+            snapshot->temp.sync_temp = (reg_data[12] | (uint16_t)reg_data[13] << 8);
+            snapshot->temp.sync_time = sync_time;
         }
     }
     else
@@ -5429,87 +5954,50 @@ static int8_t get_any_motion_config(struct bmi3_any_motion_config *config, struc
 
     return rslt;
 }
+#endif
 
+#ifndef BMI3_ALT_CONFIG_DISABLE
 /*!
- * @brief This internal API sets any-motion configurations like threshold,
- * duration, accel reference up, hysteresis and wait time.
+ * @brief This API is used to enable accel and gyro for alternate configuration
  */
-static int8_t set_any_motion_config(const struct bmi3_any_motion_config *config, struct bmi3_dev *dev)
+int8_t bmi3_alternate_config_ctrl(uint8_t config_en, uint8_t alt_rst_conf, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to set the base address of any-motion feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ANY_MOTION, 0 };
-
-    /* Array to define the feature configuration */
-    uint8_t any_mot_config[6] = { 0 };
-
-    uint8_t data_array[6] = { 0 };
+    uint8_t data[2] = { 0 };
 
-    uint16_t duration1, duration2;
+    rslt = bmi3_get_regs(BMI3_REG_ALT_CONF, data, 2, dev);
 
-    uint16_t threshold1, threshold2;
+    if (rslt == BMI3_OK)
+    {
+        data[0] = (config_en & (BMI3_ALT_ACC_ENABLE | BMI3_ALT_GYR_ENABLE));
+        data[1] = (alt_rst_conf & BMI3_ALT_CONF_RESET_ON);
 
-    uint16_t hysteresis1, hysteresis2;
+        rslt = bmi3_set_regs(BMI3_REG_ALT_CONF, data, 2, dev);
+    }
 
-    uint16_t threshold, hysteresis, duration, wait_time1;
+    return rslt;
+}
 
-    uint16_t acc_ref_up;
+/*!
+ * @brief This API is used to read the status of alternate configuration
+ */
+int8_t bmi3_read_alternate_status(struct bmi3_alt_status *alt_status, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-    /* Wait time for clearing the event after slope is below threshold */
-    uint16_t wait_time;
+    uint8_t data[2] = { 0 };
 
-    if (config != NULL)
+    if (alt_status != NULL)
     {
-        /* Set the any-motion base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        rslt = bmi3_get_regs(BMI3_REG_ALT_STATUS, data, 2, dev);
 
         if (rslt == BMI3_OK)
         {
-            /* Set threshold for lsb 8 bits */
-            threshold1 = BMI3_SET_BIT_POS0(data_array[0], BMI3_ANY_NO_SLOPE_THRESHOLD, config->slope_thres);
-
-            threshold = ((uint16_t)data_array[1] << 8);
-
-            /* Set threshold for msb 8 bits */
-            threshold2 = BMI3_SET_BIT_POS0(threshold, BMI3_ANY_NO_SLOPE_THRESHOLD, config->slope_thres);
-
-            /* Set accel reference */
-            acc_ref_up = ((uint16_t)data_array[1] << 8);
-
-            acc_ref_up = BMI3_SET_BITS(acc_ref_up, BMI3_ANY_NO_ACC_REF_UP, config->acc_ref_up);
-
-            /* Set hysteresis for lsb 8 bits */
-            hysteresis1 = BMI3_SET_BIT_POS0(data_array[2], BMI3_ANY_NO_HYSTERESIS, config->hysteresis);
-
-            hysteresis = ((uint16_t)data_array[2] << 8);
-
-            /* Set hysteresis for msb 8 bits */
-            hysteresis2 = BMI3_SET_BIT_POS0(hysteresis, BMI3_ANY_NO_HYSTERESIS, config->hysteresis);
-
-            /* Set duration for lsb 8 bits */
-            duration1 = BMI3_SET_BIT_POS0(data_array[3], BMI3_ANY_NO_DURATION, config->duration);
-
-            duration = ((uint16_t)data_array[4] << 8);
-
-            /* Set duration for msb 8 bits */
-            duration2 = BMI3_SET_BIT_POS0(duration, BMI3_ANY_NO_DURATION, config->duration);
-
-            wait_time1 = ((uint16_t)data_array[5] << 8);
-
-            /* Set wait time */
-            wait_time = BMI3_SET_BITS(wait_time1, BMI3_ANY_NO_WAIT_TIME, config->wait_time);
-
-            any_mot_config[0] = (uint8_t)threshold1;
-            any_mot_config[1] = (uint8_t)((threshold2 | acc_ref_up) >> 8);
-            any_mot_config[2] = (uint8_t)(hysteresis1);
-            any_mot_config[3] = (uint8_t)((hysteresis2) >> 8);
-            any_mot_config[4] = (uint8_t)(duration1);
-            any_mot_config[5] = (uint8_t)((duration2 | wait_time) >> 8);
-
-            /* Set the configurations back to the feature engine register */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, any_mot_config, 6, dev);
+            alt_status->alt_accel_status = (data[0] & BMI3_ALT_ACCEL_STATUS_MASK);
+            alt_status->alt_gyro_status = (data[0] & BMI3_ALT_GYRO_STATUS_MASK) >> BMI3_ALT_GYRO_STATUS_POS;
         }
     }
     else
@@ -5519,76 +6007,42 @@ static int8_t set_any_motion_config(const struct bmi3_any_motion_config *config,
 
     return rslt;
 }
+#endif
 
 /*!
- * @brief This internal API gets no-motion configurations like threshold,
- * duration, accel reference up, hysteresis and wait time.
+ * @brief This API gets offset dgain for the sensor which stores self-calibrated values for accel.
  */
-static int8_t get_no_motion_config(struct bmi3_no_motion_config *config, struct bmi3_dev *dev)
+int8_t bmi3_get_acc_dp_off_dgain(struct bmi3_acc_dp_gain_offset *acc_dp_gain_offset, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define the feature configuration */
-    uint8_t no_mot_config[6] = { 0 };
-
-    /* Array to set the base address of no-motion feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_NO_MOTION, 0 };
-
-    /* Variable to define array offset */
-    uint8_t idx = 0;
-
-    /* Variable to define LSB */
-    uint16_t lsb;
-
-    /* Variable to define MSB */
-    uint16_t msb;
+    uint8_t reg_data[12] = { 0 };
 
-    /* Variable to define a word */
-    uint16_t lsb_msb;
+    uint16_t acc_dp_off_x, acc_dp_off_y, acc_dp_off_z;
+    uint8_t acc_dp_dgain_x, acc_dp_dgain_y, acc_dp_dgain_z;
 
-    if (config != NULL)
+    /* NULL pointer check */
+    if (acc_dp_gain_offset != NULL)
     {
-        /* Set the no-motion base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        /* Get temperature user offset for accel */
+        rslt = bmi3_get_regs(BMI3_REG_ACC_DP_OFF_X, reg_data, 12, dev);
 
         if (rslt == BMI3_OK)
         {
-            /* Get the configuration from the feature engine register where no-motion feature resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, no_mot_config, 6, dev);
-
-            if (rslt == BMI3_OK)
-            {
-                /* Get word to calculate threshold and accel reference up from same word */
-                lsb = (uint16_t) no_mot_config[idx++];
-                msb = ((uint16_t) no_mot_config[idx++] << 8);
-                lsb_msb = (uint16_t)(lsb | msb);
-
-                /* Get threshold */
-                config->slope_thres = (lsb_msb & BMI3_ANY_NO_SLOPE_THRESHOLD_MASK);
-
-                /* Get accel reference up */
-                config->acc_ref_up = (lsb_msb & BMI3_ANY_NO_ACC_REF_UP_MASK) >> BMI3_ANY_NO_ACC_REF_UP_POS;
-
-                /* Get word to calculate hysteresis */
-                lsb = (uint16_t) no_mot_config[idx++];
-                msb = ((uint16_t) no_mot_config[idx++] << 8);
-                lsb_msb = (uint16_t)(lsb | msb);
-
-                /* Get hysteresis */
-                config->hysteresis = (lsb_msb & BMI3_ANY_NO_HYSTERESIS_MASK);
-
-                /* Get word to calculate duration and wait time from same word */
-                lsb = (uint16_t) no_mot_config[idx++];
-                msb = ((uint16_t) no_mot_config[idx++] << 8);
-                lsb_msb = (uint16_t)(lsb | msb);
-
-                /* Get duration */
-                config->duration = (lsb_msb & BMI3_ANY_NO_DURATION_MASK);
+            acc_dp_off_x = (uint16_t)(((uint16_t)reg_data[1] << 8) | reg_data[0]);
+            acc_dp_dgain_x = reg_data[2];
+            acc_dp_off_y = (uint16_t)(((uint16_t)reg_data[5] << 8) | reg_data[4]);
+            acc_dp_dgain_y = reg_data[6];
+            acc_dp_off_z = (uint16_t)(((uint16_t)reg_data[9] << 8) | reg_data[8]);
+            acc_dp_dgain_z = reg_data[10];
 
-                /* Get wait time */
-                config->wait_time = (lsb_msb & BMI3_ANY_NO_WAIT_TIME_MASK) >> BMI3_ANY_NO_WAIT_TIME_POS;
-            }
+            acc_dp_gain_offset->acc_dp_off_x = (acc_dp_off_x & dev->accel_bit_width);
+            acc_dp_gain_offset->acc_dp_dgain_x = (acc_dp_dgain_x & BMI3_ACC_DP_DGAIN_X_MASK);
+            acc_dp_gain_offset->acc_dp_off_y = (acc_dp_off_y & dev->accel_bit_width);
+            acc_dp_gain_offset->acc_dp_dgain_y = (acc_dp_dgain_y & BMI3_ACC_DP_DGAIN_Y_MASK);
+            acc_dp_gain_offset->acc_dp_off_z = (acc_dp_off_z & dev->accel_bit_width);
+            acc_dp_gain_offset->acc_dp_dgain_z = (acc_dp_dgain_z & BMI3_ACC_DP_DGAIN_Z_MASK);
         }
     }
     else
@@ -5600,82 +6054,39 @@ static int8_t get_no_motion_config(struct bmi3_no_motion_config *config, struct
 }
 
 /*!
- * @brief This internal API sets no-motion configurations like threshold,
- * duration, accel reference up, hysteresis and wait time.
+ * @brief This API gets offset dgain for the sensor which stores self-calibrated values for gyro.
  */
-static int8_t set_no_motion_config(const struct bmi3_no_motion_config *config, struct bmi3_dev *dev)
+int8_t bmi3_get_gyro_dp_off_dgain(struct bmi3_gyr_dp_gain_offset *gyr_dp_gain_offset, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to set the base address of no-motion feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_NO_MOTION, 0 };
-
-    /* Array to define the feature configuration */
-    uint8_t no_mot_config[6] = { 0 };
-
-    uint8_t data_array[6] = { 0 };
-
-    uint16_t duration1, duration2;
-
-    uint16_t threshold1, threshold2;
-
-    uint16_t hysteresis1, hysteresis2;
-
-    uint16_t threshold, hysteresis, duration, wait_time1;
-
-    uint16_t acc_ref_up;
+    uint8_t reg_data[12];
 
-    uint16_t wait_time;
+    uint16_t gyr_dp_off_x, gyr_dp_off_y, gyr_dp_off_z;
+    uint8_t gyr_dp_dgain_x, gyr_dp_dgain_y, gyr_dp_dgain_z;
 
-    if (config != NULL)
+    /* NULL pointer check */
+    if (gyr_dp_gain_offset != NULL)
     {
-        /* Set the no-motion base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        /* Get temperature user offset for gyro */
+        rslt = bmi3_get_regs(BMI3_REG_GYR_DP_OFF_X, reg_data, 12, dev);
 
         if (rslt == BMI3_OK)
         {
-            /* Set threshold for lsb 8 bits */
-            threshold1 = BMI3_SET_BIT_POS0(data_array[0], BMI3_ANY_NO_SLOPE_THRESHOLD, config->slope_thres);
-
-            threshold = ((uint16_t)data_array[1] << 8);
-
-            /* Set threshold for msb 8 bits */
-            threshold2 = BMI3_SET_BIT_POS0(threshold, BMI3_ANY_NO_SLOPE_THRESHOLD, config->slope_thres);
-
-            /* Set accel reference */
-            acc_ref_up = BMI3_SET_BITS(threshold, BMI3_ANY_NO_ACC_REF_UP, config->acc_ref_up);
-
-            /* Set hysteresis for lsb 8 bits */
-            hysteresis1 = BMI3_SET_BIT_POS0(data_array[2], BMI3_ANY_NO_HYSTERESIS, config->hysteresis);
-
-            hysteresis = ((uint16_t)data_array[2] << 8);
-
-            /* Set hysteresis for msb 8 bits */
-            hysteresis2 = BMI3_SET_BIT_POS0(hysteresis, BMI3_ANY_NO_HYSTERESIS, config->hysteresis);
-
-            /* Set duration for lsb 8 bits */
-            duration1 = BMI3_SET_BIT_POS0(data_array[3], BMI3_ANY_NO_DURATION, config->duration);
-
-            duration = ((uint16_t)data_array[4] << 8);
-
-            /* Set duration for msb 8 bits */
-            duration2 = BMI3_SET_BIT_POS0(duration, BMI3_ANY_NO_DURATION, config->duration);
-
-            wait_time1 = ((uint16_t)data_array[5] << 8);
-
-            /* Set wait time */
-            wait_time = BMI3_SET_BITS(wait_time1, BMI3_ANY_NO_WAIT_TIME, config->wait_time);
-
-            no_mot_config[0] = (uint8_t)threshold1;
-            no_mot_config[1] = (uint8_t)((threshold2 | acc_ref_up) >> 8);
-            no_mot_config[2] = (uint8_t)(hysteresis1);
-            no_mot_config[3] = (uint8_t)((hysteresis2) >> 8);
-            no_mot_config[4] = (uint8_t)(duration1);
-            no_mot_config[5] = (uint8_t)((duration2 | wait_time) >> 8);
+            gyr_dp_off_x = (uint16_t)(((uint16_t)reg_data[1] << 8) | reg_data[0]);
+            gyr_dp_dgain_x = reg_data[2];
+            gyr_dp_off_y = (uint16_t)(((uint16_t)reg_data[5] << 8) | reg_data[4]);
+            gyr_dp_dgain_y = reg_data[6];
+            gyr_dp_off_z = (uint16_t)(((uint16_t)reg_data[9] << 8) | reg_data[8]);
+            gyr_dp_dgain_z = reg_data[10];
 
-            /* Set the configuration back to the feature engine register */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, no_mot_config, 6, dev);
+            gyr_dp_gain_offset->gyr_dp_off_x = BMI3_GET_BIT_POS0(gyr_dp_off_x, BMI3_GYR_DP_OFF_X);
+            gyr_dp_gain_offset->gyr_dp_dgain_x = BMI3_GET_BIT_POS0(gyr_dp_dgain_x, BMI3_GYR_DP_DGAIN_X);
+            gyr_dp_gain_offset->gyr_dp_off_y = BMI3_GET_BIT_POS0(gyr_dp_off_y, BMI3_GYR_DP_OFF_Y);
+            gyr_dp_gain_offset->gyr_dp_dgain_y = BMI3_GET_BIT_POS0(gyr_dp_dgain_y, BMI3_GYR_DP_DGAIN_Y);
+            gyr_dp_gain_offset->gyr_dp_off_z = BMI3_GET_BIT_POS0(gyr_dp_off_z, BMI3_GYR_DP_OFF_Z);
+            gyr_dp_gain_offset->gyr_dp_dgain_z = BMI3_GET_BIT_POS0(gyr_dp_dgain_z, BMI3_GYR_DP_DGAIN_Z);
         }
     }
     else
@@ -5687,70 +6098,49 @@ static int8_t set_no_motion_config(const struct bmi3_no_motion_config *config, s
 }
 
 /*!
- * @brief This internal API gets flat configurations like theta, blocking,
- * hold-time, hysteresis, and slope threshold.
+ * @brief This API sets offset dgain for the sensor which stores self-calibrated values for accel.
  */
-static int8_t get_flat_config(struct bmi3_flat_config *config, struct bmi3_dev *dev)
+int8_t bmi3_set_acc_dp_off_dgain(const struct bmi3_acc_dp_gain_offset *acc_dp_gain_offset, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define the feature configuration */
-    uint8_t flat_config[4] = { 0 };
+    uint8_t acc_dp_gain_x, acc_dp_gain_y, acc_dp_gain_z;
 
-    /* Array to set the base address of flat feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_FLAT, 0 };
+    uint16_t acc_dp_off_x1, acc_dp_off_y1, acc_dp_off_z1;
 
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
+    uint8_t acc_off_gain[12] = { 0 };
 
-    /* Variable to define LSB */
-    uint16_t lsb;
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-    /* Variable to define MSB */
-    uint16_t msb;
-
-    /* Variable to define a word */
-    uint16_t lsb_msb;
-
-    if (config != NULL)
+    /* NULL pointer check */
+    if ((rslt == BMI3_OK) && (acc_dp_gain_offset != NULL))
     {
-        /* Set the flat base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
-
-        if (rslt == BMI3_OK)
-        {
-            /* Get the configuration from the feature engine register where flat feature resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, flat_config, 4, dev);
+        acc_dp_off_x1 = (acc_dp_gain_offset->acc_dp_off_x & dev->accel_bit_width);
 
-            if (rslt == BMI3_OK)
-            {
-                /* Get word to calculate theta, blocking and hold time from the same word */
-                lsb = (uint16_t) flat_config[idx++];
-                msb = ((uint16_t) flat_config[idx++] << 8);
-                lsb_msb = (lsb | msb);
+        acc_dp_gain_x = (uint8_t)(acc_dp_gain_offset->acc_dp_dgain_x & BMI3_ACC_DP_DGAIN_X_MASK);
 
-                /* Get theta */
-                config->theta = lsb_msb & BMI3_FLAT_THETA_MASK;
+        acc_dp_off_y1 = (acc_dp_gain_offset->acc_dp_off_y & dev->accel_bit_width);
 
-                /* Get blocking */
-                config->blocking = (lsb_msb & BMI3_FLAT_BLOCKING_MASK) >> BMI3_FLAT_BLOCKING_POS;
+        acc_dp_gain_y = (uint8_t)(acc_dp_gain_offset->acc_dp_dgain_y & BMI3_ACC_DP_DGAIN_Y_MASK);
 
-                /* Get hold time */
-                config->hold_time = (lsb_msb & BMI3_FLAT_HOLD_TIME_MASK) >> BMI3_FLAT_HOLD_TIME_POS;
+        acc_dp_off_z1 = (acc_dp_gain_offset->acc_dp_off_z & dev->accel_bit_width);
 
-                /* Get word to calculate slope threshold and hysteresis from the same word */
-                lsb = (uint16_t) flat_config[idx++];
-                msb = ((uint16_t) flat_config[idx++] << 8);
-                lsb_msb = lsb | msb;
+        acc_dp_gain_z = (uint8_t)(acc_dp_gain_offset->acc_dp_dgain_z & BMI3_ACC_DP_DGAIN_Z_MASK);
 
-                /* Get slope threshold */
-                config->slope_thres = lsb_msb & BMI3_FLAT_SLOPE_THRES_MASK;
+        acc_off_gain[0] = (uint8_t)(acc_dp_off_x1 & BMI3_SET_LOW_BYTE);
+        acc_off_gain[1] = (acc_dp_off_x1 & BMI3_SET_HIGH_BYTE) >> 8;
+        acc_off_gain[2] = acc_dp_gain_x;
+        acc_off_gain[4] = (uint8_t)(acc_dp_off_y1 & BMI3_SET_LOW_BYTE);
+        acc_off_gain[5] = (acc_dp_off_y1 & BMI3_SET_HIGH_BYTE) >> 8;
+        acc_off_gain[6] = acc_dp_gain_y;
+        acc_off_gain[8] = (uint8_t)(acc_dp_off_z1 & BMI3_SET_LOW_BYTE);
+        acc_off_gain[9] = (acc_dp_off_z1 & BMI3_SET_HIGH_BYTE) >> 8;
+        acc_off_gain[10] = acc_dp_gain_z;
 
-                /* Get hysteresis */
-                config->hysteresis = (lsb_msb & BMI3_FLAT_HYST_MASK) >> BMI3_FLAT_HYST_POS;
-            }
-        }
+        /* Set dp offset for accel */
+        rslt = bmi3_set_regs(BMI3_REG_ACC_DP_OFF_X, acc_off_gain, 12, dev);
     }
     else
     {
@@ -5761,54 +6151,51 @@ static int8_t get_flat_config(struct bmi3_flat_config *config, struct bmi3_dev *
 }
 
 /*!
- * @brief This internal API sets flat configurations like theta, blocking,
- * hold-time, hysteresis, and slope threshold.
+ * @brief This API sets offset dgain for the sensor which stores self-calibrated values for gyro.
  */
-static int8_t set_flat_config(const struct bmi3_flat_config *config, struct bmi3_dev *dev)
+int8_t bmi3_set_gyro_dp_off_dgain(const struct bmi3_gyr_dp_gain_offset *gyr_dp_gain_offset, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define the feature configuration */
-    uint8_t flat_config[4] = { 0 };
+    uint8_t gyr_dp_gain_x, gyr_dp_gain_y, gyr_dp_gain_z;
 
-    /* Array to set the base address of flat feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_FLAT, 0 };
+    uint16_t gyr_dp_off_x1, gyr_dp_off_y1, gyr_dp_off_z1;
 
-    uint16_t theta, blocking, holdtime, slope_thres, hyst;
+    uint16_t reg_data[6] = { 0 };
 
-    if (config != NULL)
+    uint8_t gyr_off_gain[12] = { 0 };
+
+    /* NULL pointer check */
+    if (gyr_dp_gain_offset != NULL)
     {
-        /* Set the flat base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        gyr_dp_off_x1 = BMI3_SET_BIT_POS0(reg_data[0], BMI3_GYR_DP_OFF_X, gyr_dp_gain_offset->gyr_dp_off_x);
 
-        if (rslt == BMI3_OK)
-        {
-            /* Set theta */
-            theta = BMI3_SET_BIT_POS0(flat_config[0], BMI3_FLAT_THETA, config->theta);
+        gyr_dp_gain_x =
+            (uint8_t)BMI3_SET_BIT_POS0(reg_data[1], BMI3_GYR_DP_DGAIN_X, gyr_dp_gain_offset->gyr_dp_dgain_x);
 
-            /* Set blocking */
-            blocking = BMI3_SET_BITS(flat_config[0], BMI3_FLAT_BLOCKING, config->blocking);
+        gyr_dp_off_y1 = BMI3_SET_BIT_POS0(reg_data[2], BMI3_GYR_DP_OFF_Y, gyr_dp_gain_offset->gyr_dp_off_y);
 
-            /* Set hold time */
-            holdtime = ((uint16_t)flat_config[1] << 8);
-            holdtime = BMI3_SET_BITS(holdtime, BMI3_FLAT_HOLD_TIME, config->hold_time);
+        gyr_dp_gain_y =
+            (uint8_t)BMI3_SET_BIT_POS0(reg_data[3], BMI3_GYR_DP_DGAIN_Y, gyr_dp_gain_offset->gyr_dp_dgain_y);
 
-            /* Set slope threshold */
-            slope_thres = BMI3_SET_BIT_POS0(flat_config[2], BMI3_FLAT_SLOPE_THRES, config->slope_thres);
+        gyr_dp_off_z1 = BMI3_SET_BIT_POS0(reg_data[4], BMI3_GYR_DP_OFF_Z, gyr_dp_gain_offset->gyr_dp_off_z);
 
-            /* Set hysteresis */
-            hyst = ((uint16_t)flat_config[3] << 8);
-            hyst = BMI3_SET_BITS(hyst, BMI3_FLAT_HYST, config->hysteresis);
+        gyr_dp_gain_z =
+            (uint8_t)BMI3_SET_BIT_POS0(reg_data[5], BMI3_GYR_DP_DGAIN_Z, gyr_dp_gain_offset->gyr_dp_dgain_z);
 
-            flat_config[0] = (uint8_t)(theta | blocking);
-            flat_config[1] = (uint8_t)(holdtime >> 8);
-            flat_config[2] = (uint8_t)(slope_thres);
-            flat_config[3] = (uint8_t)(hyst >> 8);
+        gyr_off_gain[0] = (uint8_t)(gyr_dp_off_x1 & BMI3_SET_LOW_BYTE);
+        gyr_off_gain[1] = (gyr_dp_off_x1 & BMI3_SET_HIGH_BYTE) >> 8;
+        gyr_off_gain[2] = gyr_dp_gain_x;
+        gyr_off_gain[4] = (uint8_t)(gyr_dp_off_y1 & BMI3_SET_LOW_BYTE);
+        gyr_off_gain[5] = (gyr_dp_off_y1 & BMI3_SET_HIGH_BYTE) >> 8;
+        gyr_off_gain[6] = gyr_dp_gain_y;
+        gyr_off_gain[8] = (uint8_t)(gyr_dp_off_z1 & BMI3_SET_LOW_BYTE);
+        gyr_off_gain[9] = (gyr_dp_off_z1 & BMI3_SET_HIGH_BYTE) >> 8;
+        gyr_off_gain[10] = gyr_dp_gain_z;
 
-            /* Set the configuration back to the feature engine register */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, flat_config, 4, dev);
-        }
+        /* Set dp offset for gyro */
+        rslt = bmi3_set_regs(BMI3_REG_GYR_DP_OFF_X, gyr_off_gain, 12, dev);
     }
     else
     {
@@ -5819,73 +6206,39 @@ static int8_t set_flat_config(const struct bmi3_flat_config *config, struct bmi3
 }
 
 /*!
- * @brief This internal API gets sig-motion configurations like block size,
- * peak 2 peak min, mcr min, peak 2 peak max and mcr max.
+ * @brief This API gets user offset dgain for the sensor which stores self-calibrated values for accel.
  */
-static int8_t get_sig_motion_config(struct bmi3_sig_motion_config *config, struct bmi3_dev *dev)
+int8_t bmi3_get_user_acc_off_dgain(struct bmi3_acc_usr_gain_offset *acc_usr_gain_offset, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define the feature configuration */
-    uint8_t sig_mot_config[6];
-
-    /* Variable to define LSB */
-    uint16_t lsb;
-
-    /* Variable to define MSB */
-    uint16_t msb;
-
-    /* Variable to define a word */
-    uint16_t lsb_msb;
-
-    /* Array to set the base address of sig-motion feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_SIG_MOTION, 0 };
+    uint8_t reg_data[12];
 
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
+    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ACC_OFFSET_GAIN, 0 };
 
-    if (config != NULL)
+    /* NULL pointer check */
+    if (acc_usr_gain_offset != NULL)
     {
-        /* Set the sig-motion base address to feature engine transmission address to start DMA transaction */
+        /* Set the user accel offset base address to feature engine transmission address to start DMA transaction */
         rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
 
         if (rslt == BMI3_OK)
         {
-            /* Get the configuration from the feature engine register where sig motion feature resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, sig_mot_config, 6, dev);
+            /* Get the configuration from the feature engine register */
+            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, 12, dev);
 
             if (rslt == BMI3_OK)
             {
-                /* Get word to calculate block size */
-                lsb = (uint16_t) sig_mot_config[idx++];
-                msb = ((uint16_t) sig_mot_config[idx++] << 8);
-                lsb_msb = (lsb | msb);
-
-                /* Get block size */
-                config->block_size = lsb_msb & BMI3_SIG_BLOCK_SIZE_MASK;
-
-                /* Get word to calculate peak 2 peak minimum from the same word */
-                lsb = (uint16_t) sig_mot_config[idx++];
-                msb = ((uint16_t) sig_mot_config[idx++] << 8);
-                lsb_msb = (lsb | msb);
-
-                /* Get peak 2 peak minimum */
-                config->peak_2_peak_min = (lsb_msb & BMI3_SIG_P2P_MIN_MASK);
-
-                /* Get mcr minimum */
-                config->mcr_min = (lsb_msb & BMI3_SIG_MCR_MIN_MASK) >> BMI3_SIG_MCR_MIN_POS;
-
-                /* Get word to calculate peak 2 peak maximum and mcr maximum from the same word */
-                lsb = (uint16_t) sig_mot_config[idx++];
-                msb = ((uint16_t) sig_mot_config[idx++] << 8);
-                lsb_msb = (lsb | msb);
-
-                /* Get peak 2 peak maximum */
-                config->peak_2_peak_max = (lsb_msb & BMI3_SIG_P2P_MAX_MASK);
-
-                /* Get mcr maximum */
-                config->mcr_max = (lsb_msb & BMI3_MCR_MAX_MASK) >> BMI3_MCR_MAX_POS;
+                acc_usr_gain_offset->acc_usr_off_x =
+                    (uint16_t)((((uint16_t)reg_data[1] << 8) | reg_data[0]) & BMI3_ACC_USR_OFF_X_MASK);
+                acc_usr_gain_offset->acc_usr_off_y =
+                    (uint16_t)((((uint16_t)reg_data[3] << 8) | reg_data[2]) & BMI3_ACC_USR_OFF_Y_MASK);
+                acc_usr_gain_offset->acc_usr_off_z =
+                    (uint16_t)((((uint16_t)reg_data[5] << 8) | reg_data[4]) & BMI3_ACC_USR_OFF_Z_MASK);
+                acc_usr_gain_offset->acc_usr_gain_x = (uint8_t)(reg_data[6] & BMI3_ACC_USR_GAIN_X_MASK);
+                acc_usr_gain_offset->acc_usr_gain_y = (uint8_t)(reg_data[8] & BMI3_ACC_USR_GAIN_Y_MASK);
+                acc_usr_gain_offset->acc_usr_gain_z = (uint8_t)(reg_data[10] & BMI3_ACC_USR_GAIN_Z_MASK);
             }
         }
     }
@@ -5898,84 +6251,71 @@ static int8_t get_sig_motion_config(struct bmi3_sig_motion_config *config, struc
 }
 
 /*!
- * @brief This internal API sets sig-motion configurations like block size,
- * peak 2 peak min, mcr min, peak 2 peak max and mcr max.
+ * @brief This API sets user offset dgain for the sensor which stores self-calibrated values for accel.
  */
-static int8_t set_sig_motion_config(const struct bmi3_sig_motion_config *config, struct bmi3_dev *dev)
+int8_t bmi3_set_user_acc_off_dgain(const struct bmi3_acc_usr_gain_offset *acc_usr_gain_offset, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to set the base address of sig-motion feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_SIG_MOTION, 0 };
-
-    /* Array to define the feature configuration */
-    uint8_t sig_mot_config[6] = { 0 };
-
-    uint8_t data_array[6] = { 0 };
+    uint8_t acc_usr_gain_x, acc_usr_gain_y, acc_usr_gain_z;
 
-    uint16_t block_size1, block_size2;
+    uint16_t acc_usr_off_x1, acc_usr_off_y1, acc_usr_off_z1;
 
-    uint16_t p2p_min1, p2p_min2;
+    uint16_t acc_usr_off_x2, acc_usr_off_y2, acc_usr_off_z2;
 
-    uint16_t p2p_max1, p2p_max2;
+    uint16_t acc_usr_off_x, acc_usr_off_y, acc_usr_off_z;
 
-    uint16_t block_size, p2p_min, p2p_max;
+    uint8_t reg_data[12] = { 0 };
 
-    uint16_t mcr_min;
+    uint8_t user_acc_off_gain[12] = { 0 };
 
-    uint16_t mcr_max;
+    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ACC_OFFSET_GAIN, 0 };
 
-    if (config != NULL)
+    /* NULL pointer check */
+    if (acc_usr_gain_offset != NULL)
     {
-        /* Set the sig-motion base address to feature engine transmission address to start DMA transaction */
+        /* Set the user accel offset base address to feature engine transmission address to start DMA transaction */
         rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
 
         if (rslt == BMI3_OK)
         {
-            /* Set block size for lsb 8 bits */
-            block_size1 = BMI3_SET_BIT_POS0(data_array[0], BMI3_SIG_BLOCK_SIZE, config->block_size);
-
-            block_size = ((uint16_t)data_array[1] << 8);
+            acc_usr_off_x1 = BMI3_SET_BIT_POS0(reg_data[0], BMI3_ACC_USR_OFF_X, acc_usr_gain_offset->acc_usr_off_x);
 
-            /* Set block size for msb 8 bits */
-            block_size2 = BMI3_SET_BIT_POS0(block_size, BMI3_SIG_BLOCK_SIZE, config->block_size);
+            acc_usr_off_x = ((uint16_t)reg_data[1] << 8);
 
-            /* Set peak to peak minimum for lsb 8 bits */
-            p2p_min1 = BMI3_SET_BIT_POS0(data_array[2], BMI3_SIG_P2P_MIN, config->peak_2_peak_min);
+            acc_usr_off_x2 = BMI3_SET_BIT_POS0(acc_usr_off_x, BMI3_ACC_USR_OFF_X, acc_usr_gain_offset->acc_usr_off_x);
 
-            p2p_min = ((uint16_t)data_array[3] << 8);
+            acc_usr_off_y1 = BMI3_SET_BIT_POS0(reg_data[2], BMI3_ACC_USR_OFF_Y, acc_usr_gain_offset->acc_usr_off_y);
 
-            /* Set peak to peak minimum for msb 8 bits */
-            p2p_min2 = BMI3_SET_BIT_POS0(p2p_min, BMI3_SIG_P2P_MIN, config->peak_2_peak_min);
+            acc_usr_off_y = ((uint16_t)reg_data[3] << 8);
 
-            mcr_min = ((uint16_t)data_array[3] << 8);
+            acc_usr_off_y2 = BMI3_SET_BIT_POS0(acc_usr_off_y, BMI3_ACC_USR_OFF_Y, acc_usr_gain_offset->acc_usr_off_y);
 
-            /* Set mcr minimum */
-            mcr_min = BMI3_SET_BITS(mcr_min, BMI3_SIG_MCR_MIN, config->mcr_min);
+            acc_usr_off_z1 = BMI3_SET_BIT_POS0(reg_data[4], BMI3_ACC_USR_OFF_Z, acc_usr_gain_offset->acc_usr_off_z);
 
-            /* Set peak to peak maximum for lsb 8 bits */
-            p2p_max1 = BMI3_SET_BIT_POS0(data_array[4], BMI3_SIG_P2P_MAX, config->peak_2_peak_max);
+            acc_usr_off_z = ((uint16_t)reg_data[5] << 8);
 
-            p2p_max = ((uint16_t)data_array[5] << 8);
+            acc_usr_off_z2 = BMI3_SET_BIT_POS0(acc_usr_off_z, BMI3_ACC_USR_OFF_Z, acc_usr_gain_offset->acc_usr_off_z);
 
-            /* Set peak to peak maximum for msb 8 bits */
-            p2p_max2 = BMI3_SET_BIT_POS0(p2p_max, BMI3_SIG_P2P_MAX, config->peak_2_peak_max);
+            acc_usr_gain_x = BMI3_SET_BIT_POS0(reg_data[6], BMI3_ACC_USR_GAIN_X, acc_usr_gain_offset->acc_usr_gain_x);
 
-            mcr_max = ((uint16_t)data_array[5] << 8);
+            acc_usr_gain_y = BMI3_SET_BIT_POS0(reg_data[8], BMI3_ACC_USR_GAIN_Y, acc_usr_gain_offset->acc_usr_gain_y);
 
-            /* Set mcr maximum */
-            mcr_max = BMI3_SET_BITS(mcr_max, BMI3_MCR_MAX, config->mcr_max);
+            acc_usr_gain_z = BMI3_SET_BIT_POS0(reg_data[10], BMI3_ACC_USR_GAIN_Z, acc_usr_gain_offset->acc_usr_gain_z);
 
-            sig_mot_config[0] = (uint8_t)(block_size1);
-            sig_mot_config[1] = (uint8_t)(block_size2 >> 8);
-            sig_mot_config[2] = (uint8_t)(p2p_min1);
-            sig_mot_config[3] = (uint8_t)((p2p_min2 | mcr_min) >> 8);
-            sig_mot_config[4] = (uint8_t)(p2p_max1);
-            sig_mot_config[5] = (uint8_t)((p2p_max2 | mcr_max) >> 8);
+            user_acc_off_gain[0] = (uint8_t)acc_usr_off_x1;
+            user_acc_off_gain[1] = acc_usr_off_x2 >> 8;
+            user_acc_off_gain[2] = (uint8_t)acc_usr_off_y1;
+            user_acc_off_gain[3] = acc_usr_off_y2 >> 8;
+            user_acc_off_gain[4] = (uint8_t)acc_usr_off_z1;
+            user_acc_off_gain[5] = acc_usr_off_z2 >> 8;
+            user_acc_off_gain[6] = acc_usr_gain_x;
+            user_acc_off_gain[8] = acc_usr_gain_y;
+            user_acc_off_gain[10] = acc_usr_gain_z;
 
-            /* Set the configuration back to the feature engine register */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, sig_mot_config, 6, dev);
+            /* Set the configuration to the feature engine register */
+            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, user_acc_off_gain, 12, dev);
         }
     }
     else
@@ -5986,65 +6326,61 @@ static int8_t set_sig_motion_config(const struct bmi3_sig_motion_config *config,
     return rslt;
 }
 
+#ifndef BMI3_FOC_DISABLE
 /*!
- * @brief This internal API gets tilt configurations like segment size,
- * tilt angle, beta accel mean.
+ * @brief This API performs Fast Offset Compensation for accelerometer.
  */
-static int8_t get_tilt_config(struct bmi3_tilt_config *config, struct bmi3_dev *dev)
+int8_t bmi3_perform_accel_foc(const struct bmi3_accel_foc_g_value *accel_g_value, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define the feature configuration */
-    uint8_t tilt_config[4] = { 0 };
-
-    /* Array to set the base address of tilt feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_TILT, 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to define LSB */
-    uint16_t lsb;
+    /* Structure to define the accelerometer configurations */
+    struct bmi3_accel_config acc_cfg = { 0 };
+    struct bmi3_sens_config config = { 0 };
 
-    /* Variable to define MSB */
-    uint16_t msb;
+    /* Configure the type */
+    config.type = BMI3_ACCEL;
 
-    /* Variable to define word */
-    uint16_t lsb_msb;
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-    if (config != NULL)
+    if ((rslt == BMI3_OK) && (accel_g_value != NULL))
     {
-        /* Set the tilt base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
-
-        if (rslt == BMI3_OK)
+        /* Check for input validity */
+        if ((((BMI3_ABS(accel_g_value->x)) + (BMI3_ABS(accel_g_value->y)) + (BMI3_ABS(accel_g_value->z))) == 1) &&
+            ((accel_g_value->sign == 1) || (accel_g_value->sign == 0)))
         {
-            /* Get the configuration from the feature engine register where tilt feature resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, tilt_config, 4, dev);
+            rslt = verify_foc_position(BMI3_ACCEL, accel_g_value, dev);
 
             if (rslt == BMI3_OK)
             {
-                /* Get word to calculate segment size and minimum tilt angle from the same word */
-                lsb = ((uint16_t)tilt_config[idx++]);
-                msb = ((uint16_t)tilt_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
-
-                /* Get segment size */
-                config->segment_size = lsb_msb & BMI3_TILT_SEGMENT_SIZE_MASK;
+                /* Get accelerometer configurations */
+                rslt = bmi3_get_sensor_config(&config, 1, dev);
+            }
 
-                /* Get minimum tilt angle */
-                config->min_tilt_angle = (lsb_msb & BMI3_TILT_MIN_TILT_ANGLE_MASK) >> BMI3_TILT_MIN_TILT_ANGLE_POS;
+            /* Set configurations for FOC */
+            if (rslt == BMI3_OK)
+            {
+                rslt = set_accel_foc_config(dev);
+            }
 
-                /* Get word to calculate beta accel mean */
-                lsb = ((uint16_t)tilt_config[idx++]);
-                msb = ((uint16_t)tilt_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
+            /* Perform accelerometer FOC */
+            if (rslt == BMI3_OK)
+            {
+                rslt = perform_accel_foc(accel_g_value, &acc_cfg, dev);
+            }
 
-                /* Get beta accel mean */
-                config->beta_acc_mean = lsb_msb & BMI3_TILT_BETA_ACC_MEAN_MASK;
+            /* Set the configurations */
+            if (rslt == BMI3_OK)
+            {
+                rslt = bmi3_set_sensor_config(&config, 1, dev);
             }
         }
+        else
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
     }
     else
     {
@@ -6055,60 +6391,99 @@ static int8_t get_tilt_config(struct bmi3_tilt_config *config, struct bmi3_dev *
 }
 
 /*!
- * @brief This internal API sets tilt configurations like segment size,
- * tilt angle, beta accel mean.
+ * @brief This API performs Fast Offset Compensation for accelerometer on samples drained
+ * from the FIFO.
  */
-static int8_t set_tilt_config(const struct bmi3_tilt_config *config, struct bmi3_dev *dev)
+int8_t bmi3_perform_accel_foc_fifo(const struct bmi3_accel_foc_g_value *accel_g_value, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to set the base address of tilt feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_TILT, 0 };
+    /* Variable to store result of restoring the configurations */
+    int8_t restore_rslt;
 
-    /* Array to define the feature configuration */
-    uint8_t tilt_config[4] = { 0 };
+    /* Array to store the FIFO configuration */
+    uint8_t fifo_conf[2] = { 0 };
 
-    uint8_t data_array[4] = { 0 };
+    /* Structure to store the sums of the accelerometer samples */
+    struct bmi3_foc_temp_value temp = { 0, 0, 0 };
 
-    uint16_t min_tilt_angle1;
+    /* Structure to store the average of the accelerometer samples */
+    struct bmi3_foc_temp_value avg = { 0, 0, 0 };
 
-    uint16_t beta_acc_mean1, beta_acc_mean2;
+    /* Structure to define the accelerometer configurations */
+    struct bmi3_accel_config acc_cfg = { 0 };
+    struct bmi3_sens_config config = { 0 };
 
-    uint16_t min_tilt_angle, beta_acc_mean;
+    /* Configure the type */
+    config.type = BMI3_ACCEL;
 
-    uint16_t segment_size;
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-    if (config != NULL)
+    if ((rslt == BMI3_OK) && (accel_g_value != NULL))
     {
-        /* Set the tilt base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
-
-        if (rslt == BMI3_OK)
+        /* Check for input validity */
+        if ((((BMI3_ABS(accel_g_value->x)) + (BMI3_ABS(accel_g_value->y)) + (BMI3_ABS(accel_g_value->z))) == 1) &&
+            ((accel_g_value->sign == 1) || (accel_g_value->sign == 0)))
         {
-            /* Set segment size */
-            segment_size = BMI3_SET_BIT_POS0(data_array[0], BMI3_TILT_SEGMENT_SIZE, config->segment_size);
+            /* Get accelerometer and FIFO configurations */
+            rslt = bmi3_get_sensor_config(&config, 1, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                rslt = bmi3_get_regs(BMI3_REG_FIFO_CONF, fifo_conf, 2, dev);
+            }
+
+            if (rslt == BMI3_OK)
+            {
+                rslt = set_accel_foc_fifo_config(dev);
 
-            min_tilt_angle1 = ((uint16_t)data_array[1] << 8);
+                if (rslt == BMI3_OK)
+                {
+                    rslt = get_accel_foc_fifo_samples(&temp, dev);
+                }
 
-            /* Set minimum tilt angle */
-            min_tilt_angle = BMI3_SET_BITS(min_tilt_angle1, BMI3_TILT_MIN_TILT_ANGLE, config->min_tilt_angle);
+                /* Verify the position on the same samples */
+                if (rslt == BMI3_OK)
+                {
+                    avg.x = (temp.x / BMI3_FOC_SAMPLE_LIMIT);
+                    avg.y = (temp.y / BMI3_FOC_SAMPLE_LIMIT);
+                    avg.z = (temp.z / BMI3_FOC_SAMPLE_LIMIT);
 
-            /* Set beta accel mean for lsb 8 bits */
-            beta_acc_mean1 = BMI3_SET_BIT_POS0(data_array[2], BMI3_TILT_BETA_ACC_MEAN, config->beta_acc_mean);
+                    rslt = validate_foc_average(BMI3_ACCEL, accel_g_value, &avg, dev);
+                }
 
-            beta_acc_mean = ((uint16_t)data_array[3] << 8);
+                if (rslt == BMI3_OK)
+                {
+                    rslt = apply_accel_foc(accel_g_value, &temp, &acc_cfg, dev);
+                }
 
-            /* Set beta accel mean for msb 8 bits */
-            beta_acc_mean2 = BMI3_SET_BIT_POS0(beta_acc_mean, BMI3_TILT_BETA_ACC_MEAN, config->beta_acc_mean);
+                /* Restore the configurations and drop the FOC frames, also when the FOC failed */
+                restore_rslt = bmi3_set_regs(BMI3_REG_FIFO_CONF, fifo_conf, 2, dev);
 
-            tilt_config[0] = (uint8_t)segment_size;
-            tilt_config[1] = (uint8_t)(min_tilt_angle >> 8);
-            tilt_config[2] = (uint8_t)(beta_acc_mean1);
-            tilt_config[3] = (uint8_t)(beta_acc_mean2 >> 8);
+                if (restore_rslt == BMI3_OK)
+                {
+                    restore_rslt = bmi3_set_sensor_config(&config, 1, dev);
+                }
 
-            /* Set the configuration back to the feature engine register */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, tilt_config, 4, dev);
+                if (restore_rslt == BMI3_OK)
+                {
+                    fifo_conf[0] = BMI3_FIFO_FLUSH_MASK;
+                    fifo_conf[1] = 0;
+
+                    restore_rslt = bmi3_set_regs(BMI3_REG_FIFO_CTRL, fifo_conf, 2, dev);
+                }
+
+                if (rslt == BMI3_OK)
+                {
+                    rslt = restore_rslt;
+                }
+            }
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_INPUT;
         }
     }
     else
@@ -6118,78 +6493,81 @@ static int8_t set_tilt_config(const struct bmi3_tilt_config *config, struct bmi3
 
     return rslt;
 }
+#endif
 
+#ifndef BMI3_SELF_TEST_DISABLE
 /*!
- * @brief This internal API gets orientation configurations like upside enable,
- * mode, blocking, theta, hold time, slope threshold and hysteresis.
+ * @brief This API starts the self-test without blocking.
  */
-static int8_t get_orientation_config(struct bmi3_orientation_config *config, struct bmi3_dev *dev)
+int8_t bmi3_self_test_start(uint8_t st_selection,
+                            struct bmi3_st_result *st_result_status,
+                            struct bmi3_async_op *op,
+                            struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define the feature configuration */
-    uint8_t orient_config[4] = { 0 };
-
-    /* Array to set the base address of orient feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ORIENT, 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to define LSB */
-    uint16_t lsb;
-
-    /* Variable to define MSB */
-    uint16_t msb;
-
-    /* Variable to define a word */
-    uint16_t lsb_msb;
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-    if (config != NULL)
+    if ((rslt == BMI3_OK) && (st_result_status != NULL) && (op != NULL))
     {
-        /* Set the orient base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        op->op = BMI3_ASYNC_OP_NONE;
+
+        /* Sets the self-test preconditions and triggers the self-test in the
+         * command register. */
+        rslt = start_self_test(st_selection, &op->acc_cfg.cfg.acc, dev);
 
         if (rslt == BMI3_OK)
         {
-            /* Get the configuration from the feature engine register where orientation feature resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, orient_config, 4, dev);
+            st_result_status->self_test_err_rslt = 0;
 
-            if (rslt == BMI3_OK)
-            {
-                /* Get word to calculate upside down enable, mode, blocking, theta and hold time
-                 * from the same word */
-                lsb = (uint16_t) orient_config[idx++];
-                msb = ((uint16_t) orient_config[idx++] << 8);
-                lsb_msb = lsb | msb;
-
-                /* Get upside enable */
-                config->ud_en = lsb_msb & BMI3_ORIENT_UD_EN_MASK;
+            op->op = BMI3_ASYNC_OP_SELF_TEST;
+            op->selection = st_selection;
+            op->st_result = st_result_status;
+            op->tries = BMI3_ST_POLL_LIMIT;
+            op->wait_us = BMI3_ST_POLL_DELAY_US;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
-                /* Get mode */
-                config->mode = (lsb_msb & BMI3_ORIENT_MODE_MASK) >> BMI3_ORIENT_MODE_POS;
+    return rslt;
+}
+#endif
 
-                /* Get blocking */
-                config->blocking = (lsb_msb & BMI3_ORIENT_BLOCKING_MASK) >> BMI3_ORIENT_BLOCKING_POS;
+/*!
+ * @brief This API starts the gyro self-calibration without blocking.
+ */
+int8_t bmi3_gyro_sc_start(uint8_t sc_selection,
+                          uint8_t apply_corr,
+                          struct bmi3_self_calib_rslt *sc_rslt,
+                          struct bmi3_async_op *op,
+                          struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-                /* Get theta */
-                config->theta = (lsb_msb & BMI3_ORIENT_THETA_MASK) >> BMI3_ORIENT_THETA_POS;
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-                /* Get hold time */
-                config->hold_time = (lsb_msb & BMI3_ORIENT_HOLD_TIME_MASK) >> BMI3_ORIENT_HOLD_TIME_POS;
+    if ((rslt == BMI3_OK) && (sc_rslt != NULL) && (op != NULL))
+    {
+        op->op = BMI3_ASYNC_OP_NONE;
 
-                /* Get word to calculate slope threshold and hysteresis from the same word */
-                lsb = (uint16_t) orient_config[idx++];
-                msb = ((uint16_t) orient_config[idx++] << 8);
-                lsb_msb = lsb | msb;
+        /* Set the preconditions and trigger the self-calibration */
+        rslt = start_gyro_sc(sc_selection, apply_corr, &op->acc_cfg, dev);
 
-                /* Get slope threshold */
-                config->slope_thres = lsb_msb & BMI3_ORIENT_SLOPE_THRES_MASK;
+        if (rslt == BMI3_OK)
+        {
+            sc_rslt->sc_error_rslt = 0;
 
-                /* Get hysteresis */
-                config->hysteresis = (lsb_msb & BMI3_ORIENT_HYST_MASK) >> BMI3_ORIENT_HYST_POS;
-            }
+            op->op = BMI3_ASYNC_OP_GYRO_SC;
+            op->sc_rslt = sc_rslt;
+            op->tries = BMI3_SC_POLL_LIMIT;
+            op->wait_us = BMI3_ST_POLL_DELAY_US;
         }
     }
     else
@@ -6200,63 +6578,107 @@ static int8_t get_orientation_config(struct bmi3_orientation_config *config, str
     return rslt;
 }
 
+#ifndef BMI3_FOC_DISABLE
 /*!
- * @brief This internal API sets orientation configurations like upside enable,
- * mode, blocking, theta, hold time, slope threshold and hysteresis.
+ * @brief This API starts the accelerometer Fast Offset Compensation without blocking.
  */
-static int8_t set_orientation_config(const struct bmi3_orientation_config *config, struct bmi3_dev *dev)
+int8_t bmi3_accel_foc_start(const struct bmi3_accel_foc_g_value *accel_g_value,
+                            struct bmi3_async_op *op,
+                            struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define the feature configuration */
-    uint8_t orient_config[4] = { 0 };
-
-    /* Array to set the base address of orient feature */
-    uint8_t base_aadr[2] = { BMI3_BASE_ADDR_ORIENT, 0 };
-
-    uint16_t ud_en, mode, blocking, theta, theta1, holdtime, slope_thres, hyst;
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-    if (config != NULL)
+    if ((rslt == BMI3_OK) && (accel_g_value != NULL) && (op != NULL))
     {
-        /* Set the orient base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_aadr, 2, dev);
+        op->op = BMI3_ASYNC_OP_NONE;
 
-        if (rslt == BMI3_OK)
+        /* Check for input validity */
+        if ((((BMI3_ABS(accel_g_value->x)) + (BMI3_ABS(accel_g_value->y)) + (BMI3_ABS(accel_g_value->z))) == 1) &&
+            ((accel_g_value->sign == 1) || (accel_g_value->sign == 0)))
         {
-            /* Set upside down bit */
-            ud_en = BMI3_SET_BIT_POS0(orient_config[0], BMI3_ORIENT_UD_EN, config->ud_en);
+            op->op = BMI3_ASYNC_OP_ACCEL_FOC;
+            op->step = BMI3_ASYNC_FOC_VERIFY;
+            op->g_value = *accel_g_value;
+            op->count = 0;
+            op->sum.x = 0;
+            op->sum.y = 0;
+            op->sum.z = 0;
+            op->tries = BMI3_FOC_DRDY_TRIES;
+            op->wait_us = BMI3_FOC_POLL_DELAY_US;
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+#endif
 
-            /* Set mode */
-            mode = BMI3_SET_BITS(orient_config[0], BMI3_ORIENT_MODE, config->mode);
+/*!
+ * @brief This API sets the re-mapped x, y and z axes and starts the axis map update
+ * without blocking.
+ */
+int8_t bmi3_set_remap_axes_start(const struct bmi3_axes_remap remapped_axis,
+                                 struct bmi3_async_op *op,
+                                 struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-            /* Set blocking */
-            blocking = BMI3_SET_BITS(orient_config[0], BMI3_ORIENT_BLOCKING, config->blocking);
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-            /* Set theta for lsb 8 bits */
-            theta1 = BMI3_SET_BITS(orient_config[0], BMI3_ORIENT_THETA, config->theta);
+    if ((rslt == BMI3_OK) && (op != NULL))
+    {
+        op->op = BMI3_ASYNC_OP_NONE;
+        op->wait_us = 0;
 
-            theta = ((uint16_t)orient_config[1] << 8);
+        /* Set the re-mapped axes in the feature engine */
+        rslt = write_remap_axes(remapped_axis, dev);
 
-            /* Set theta for msb 8 bits */
-            theta = BMI3_SET_BITS(theta, BMI3_ORIENT_THETA, config->theta);
+        if (rslt == BMI3_OK)
+        {
+            op->acc_cfg.type = BMI3_ACCEL;
 
-            /* Set hold time */
-            holdtime = BMI3_SET_BITS(orient_config[1], BMI3_ORIENT_HOLD_TIME, config->hold_time);
+            rslt = bmi3_get_sensor_config(&op->acc_cfg, 1, dev);
+        }
 
-            /* Set slope threshold */
-            slope_thres = BMI3_SET_BIT_POS0(orient_config[2], BMI3_ORIENT_SLOPE_THRES, config->slope_thres);
+        if ((rslt == BMI3_OK) && (op->acc_cfg.cfg.acc.acc_mode != BMI3_ACC_MODE_DISABLE))
+        {
+            /* The accelerometer is powered down while the axis map is updated */
+            op->acc_mode = op->acc_cfg.cfg.acc.acc_mode;
+            op->acc_cfg.cfg.acc.acc_mode = BMI3_ACC_MODE_DISABLE;
 
-            /* Set hysteresis */
-            hyst = BMI3_SET_BITS(orient_config[3], BMI3_ORIENT_HYST, config->hysteresis);
+            rslt = bmi3_set_sensor_config(&op->acc_cfg, 1, dev);
 
-            orient_config[0] = (uint8_t)(ud_en | mode | blocking | theta1);
-            orient_config[1] = (uint8_t)((theta | holdtime) >> 8);
-            orient_config[2] = (uint8_t)(slope_thres);
-            orient_config[3] = (uint8_t)(hyst >> 8);
+            if (rslt == BMI3_OK)
+            {
+                /* Axis mapping gets updated */
+                rslt = bmi3_set_command_register(BMI3_CMD_AXIS_MAP_UPDATE, dev);
+            }
 
-            /* Set the configuration back to the feature engine register */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, orient_config, 4, dev);
+            if (rslt == BMI3_OK)
+            {
+                op->op = BMI3_ASYNC_OP_AXES_REMAP;
+                op->acc_cfg.cfg.acc.acc_mode = op->acc_mode;
+                op->tries = BMI3_AXIS_MAP_POLL_LIMIT;
+                op->wait_us = BMI3_AXIS_MAP_POLL_DELAY_US;
+            }
+        }
+        else if (rslt == BMI3_OK)
+        {
+            /* Axis mapping gets updated, nothing to wait for */
+            rslt = bmi3_set_command_register(BMI3_CMD_AXIS_MAP_UPDATE, dev);
         }
     }
     else
@@ -6268,410 +6690,568 @@ static int8_t set_orientation_config(const struct bmi3_orientation_config *confi
 }
 
 /*!
- * @brief This internal API gets step counter configurations like water-mark level,
- * reset counter, step counter parameters and sc_12_res.
+ * @brief This API advances a long-running operation without blocking.
  */
-static int8_t get_step_config(struct bmi3_step_counter_config *config, struct bmi3_dev *dev)
+int8_t bmi3_async_step(struct bmi3_async_op *op, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define the feature configuration */
-    uint8_t step_config[24] = { 0 };
-
-    /* Array to set the base address of step counter feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_STEP_CNT, 0 };
-
-    /* Variable to define array offset */
-    uint8_t idx = 0;
-
-    /* Variable to define LSB */
-    uint16_t lsb;
-
-    /* Variable to define MSB */
-    uint16_t msb;
-
-    /* Variable to define word */
-    uint16_t lsb_msb;
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-    if (config != NULL)
+    if ((rslt == BMI3_OK) && (op != NULL))
     {
-        /* Set the step counter base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        op->wait_us = 0;
 
-        if (rslt == BMI3_OK)
+        switch (op->op)
         {
-            /* Get the configuration from the feature engine register where step counter feature resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, step_config, 24, dev);
+#ifndef BMI3_SELF_TEST_DISABLE
+            case BMI3_ASYNC_OP_SELF_TEST:
+                rslt = step_self_test(op, dev);
+                break;
+#endif
+            case BMI3_ASYNC_OP_GYRO_SC:
+                rslt = step_gyro_sc(op, dev);
+                break;
+#ifndef BMI3_FOC_DISABLE
+            case BMI3_ASYNC_OP_ACCEL_FOC:
+                rslt = step_accel_foc(op, dev);
+                break;
+#endif
+            case BMI3_ASYNC_OP_AXES_REMAP:
+                rslt = step_axes_remap(op, dev);
+                break;
+            default:
+                rslt = BMI3_OK;
+                break;
+        }
 
-            if (rslt == BMI3_OK)
-            {
-                /* Get word to calculate water-mark level, reset counter from the same word */
-                lsb = ((uint16_t)step_config[idx++]);
-                msb = ((uint16_t)step_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
+        if (rslt != BMI3_W_IN_PROGRESS)
+        {
+            op->op = BMI3_ASYNC_OP_NONE;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
-                /* Get water-mark level */
-                config->watermark_level = lsb_msb & BMI3_STEP_WATERMARK_MASK;
+    return rslt;
+}
 
-                /* Get reset counter */
-                config->reset_counter = (lsb_msb & BMI3_STEP_RESET_COUNTER_MASK) >> BMI3_STEP_RESET_COUNTER_POS;
+/*!
+ * @brief This API initializes an empty device group.
+ */
+int8_t bmi3_group_init(struct bmi3_dev_group *group)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
 
-                /* Get word to calculate minimum distance up */
-                lsb = ((uint16_t)step_config[idx++]);
-                msb = ((uint16_t)step_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
+    /* Variable to define loop */
+    uint8_t index;
 
-                /* Get minimum distance up */
-                config->env_min_dist_up = (lsb_msb & BMI3_STEP_ENV_MIN_DIST_UP_MASK);
+    if (group != NULL)
+    {
+        for (index = 0; index < BMI3_GROUP_MAX_DEVS; index++)
+        {
+            group->member[index].dev = NULL;
+            group->member[index].ring = NULL;
+            group->member[index].op = NULL;
+        }
 
-                /* Get word to calculate env coefficient up */
-                lsb = ((uint16_t)step_config[idx++]);
-                msb = ((uint16_t)step_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
+        group->num_devs = 0;
+        group->next = 0;
+        group->fifo_cb = NULL;
+        group->cb_ctx = NULL;
+        group->started = BMI3_FALSE;
+        group->start_us = 0;
+        group->last_us = 0;
+        group->passes = 0;
+        group->drains = 0;
+        group->op_steps = 0;
+        group->errors = 0;
+        group->latency_sum_us = 0;
+        group->latency_count = 0;
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
-                /* Get env coefficient up */
-                config->env_coef_up = (lsb_msb & BMI3_STEP_ENV_COEF_UP_MASK);
+    return rslt;
+}
 
-                /* Get word to calculate env minimum distance down */
-                lsb = ((uint16_t)step_config[idx++]);
-                msb = ((uint16_t)step_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
+/*!
+ * @brief This API adds a device to a device group.
+ */
+int8_t bmi3_group_add(struct bmi3_dev_group *group,
+                      struct bmi3_dev *dev,
+                      struct bmi3_fifo_buf_ring *ring,
+                      uint8_t *index)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-                /* Get env minimum distance down */
-                config->env_min_dist_down = (lsb_msb & BMI3_STEP_ENV_MIN_DIST_DOWN_MASK);
+    /* Member to be added */
+    struct bmi3_group_member *member;
 
-                /* Get word to calculate env coefficient down */
-                lsb = ((uint16_t)step_config[idx++]);
-                msb = ((uint16_t)step_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-                /* Get env coefficient down */
-                config->env_coef_down = (lsb_msb & BMI3_STEP_ENV_COEF_DOWN_MASK);
+    if ((rslt == BMI3_OK) && (group != NULL) && (ring != NULL) && (index != NULL))
+    {
+        if (group->num_devs < BMI3_GROUP_MAX_DEVS)
+        {
+            member = &group->member[group->num_devs];
+            member->dev = dev;
+            member->ring = ring;
+            member->op = NULL;
+            member->op_due_us = 0;
+            member->op_rslt = BMI3_OK;
+            member->fifo_rslt = BMI3_OK;
+            member->drained = BMI3_FALSE;
+            member->last_drain_us = 0;
+            member->bytes = 0;
+            member->max_latency_us = 0;
 
-                /* Get word to calculate mean val decay */
-                lsb = ((uint16_t)step_config[idx++]);
-                msb = ((uint16_t)step_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
+            *index = group->num_devs;
+            group->num_devs++;
+        }
+        else
+        {
+            rslt = BMI3_E_OUT_OF_RANGE;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
-                /* Get mean val decay */
-                config->mean_val_decay = (lsb_msb & BMI3_STEP_MEAN_VAL_DECAY_MASK);
+    return rslt;
+}
 
-                /* Get word to calculate mean step duration */
-                lsb = ((uint16_t)step_config[idx++]);
-                msb = ((uint16_t)step_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
+/*!
+ * @brief This API hands a started long-running operation of a group member to the group.
+ */
+int8_t bmi3_group_submit_op(struct bmi3_dev_group *group, uint8_t index, struct bmi3_async_op *op, uint64_t now_us)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
 
-                /* Get mean step duration */
-                config->mean_step_dur = (lsb_msb & BMI3_STEP_MEAN_STEP_DUR_MASK);
+    if ((group != NULL) && (op != NULL))
+    {
+        if ((index >= group->num_devs) || (group->member[index].op != NULL))
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+        else if (op->op == BMI3_ASYNC_OP_NONE)
+        {
+            /* Nothing to wait for, e.g. an axis remap with the accel disabled */
+            group->member[index].op_rslt = BMI3_OK;
+        }
+        else
+        {
+            group->member[index].op = op;
+            group->member[index].op_due_us = now_us + op->wait_us;
+            group->member[index].op_rslt = BMI3_W_IN_PROGRESS;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
-                /* Get word to calculate step buffer size, filter cascade enabled and step counter increment
-                 * from the same word */
-                lsb = ((uint16_t)step_config[idx++]);
-                msb = ((uint16_t)step_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
+    return rslt;
+}
 
-                /* Get step buffer size */
-                config->step_buffer_size = lsb_msb & BMI3_STEP_BUFFER_SIZE_MASK;
+/*!
+ * @brief This API services every device of a group once: one FIFO read and, if due, one step
+ * of its long-running operation.
+ */
+int8_t bmi3_group_service(struct bmi3_dev_group *group, uint64_t now_us)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
 
-                /* Get filter cascade enable */
-                config->filter_cascade_enabled = (lsb_msb & BMI3_STEP_FILTER_CASCADE_ENABLED_MASK) >>
-                                                 BMI3_STEP_FILTER_CASCADE_ENABLED_POS;
+    /* Variable to store result of a member */
+    int8_t dev_rslt;
 
-                /* Get step counter increment */
-                config->step_counter_increment = (lsb_msb & BMI3_STEP_COUNTER_INCREMENT_MASK) >>
-                                                 BMI3_STEP_COUNTER_INCREMENT_POS;
+    /* Variable to define loop */
+    uint8_t count;
 
-                /* Get word to calculate peak duration minimum walking and peak duration minimum running */
-                lsb = ((uint16_t)step_config[idx++]);
-                msb = ((uint16_t)step_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
+    /* Index of the member being serviced */
+    uint8_t index;
 
-                /* Get peak duration minimum walking */
-                config->peak_duration_min_walking = lsb_msb & BMI3_STEP_PEAK_DURATION_MIN_WALKING_MASK;
+    if (group != NULL)
+    {
+        if (group->started == BMI3_FALSE)
+        {
+            group->started = BMI3_TRUE;
+            group->start_us = now_us;
+        }
 
-                /* Get peak duration minimum running */
-                config->peak_duration_min_running = (lsb_msb & BMI3_STEP_PEAK_DURATION_MIN_RUNNING_MASK) >>
-                                                    BMI3_STEP_PEAK_DURATION_MIN_RUNNING_POS;
+        /* The first member of a pass rotates so that no device always waits for the others */
+        for (count = 0; count < group->num_devs; count++)
+        {
+            index = (uint8_t)((group->next + count) % group->num_devs);
 
-                /* Get word to calculate activity detection factor and activity detection threshold
-                 * from the same word */
-                lsb = ((uint16_t)step_config[idx++]);
-                msb = ((uint16_t)step_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
+            dev_rslt = drain_group_member(group, index, now_us);
 
-                /* Get activity detection factor */
-                config->activity_detection_factor = lsb_msb & BMI3_STEP_ACTIVITY_DETECTION_FACTOR_MASK;
+            if ((dev_rslt < BMI3_OK) && (rslt == BMI3_OK))
+            {
+                rslt = dev_rslt;
+            }
 
-                /* Get activity detection threshold */
-                config->activity_detection_thres = (lsb_msb & BMI3_STEP_ACTIVITY_DETECTION_THRESHOLD_MASK) >>
-                                                   BMI3_STEP_ACTIVITY_DETECTION_THRESHOLD_POS;
+            dev_rslt = step_group_member(group, index, now_us);
 
-                /* Get word to calculate step duration max and step duration window from the same word */
-                lsb = ((uint16_t)step_config[idx++]);
-                msb = ((uint16_t)step_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
+            if ((dev_rslt < BMI3_OK) && (rslt == BMI3_OK))
+            {
+                rslt = dev_rslt;
+            }
+        }
 
-                /* Get step duration max */
-                config->step_duration_max = lsb_msb & BMI3_STEP_DURATION_MAX_MASK;
+        if (group->num_devs != 0)
+        {
+            group->next = (uint8_t)((group->next + 1) % group->num_devs);
+        }
 
-                /* Get step duration window */
-                config->step_duration_window = (lsb_msb & BMI3_STEP_DURATION_WINDOW_MASK) >>
-                                               BMI3_STEP_DURATION_WINDOW_POS;
+        group->passes++;
+        group->last_us = now_us;
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
-                /* Get word to calculate step duration pp enabled, duration threshold,
-                 * mean crossing pp enabled, mcr threshold, sc_12_res from the same word */
-                lsb = ((uint16_t)step_config[idx++]);
-                msb = ((uint16_t)step_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
+    return rslt;
+}
 
-                /* Get step duration pp enable */
-                config->step_duration_pp_enabled = lsb_msb & BMI3_STEP_DURATION_PP_ENABLED_MASK;
+/*!
+ * @brief This API gets the aggregate statistics of a device group.
+ */
+int8_t bmi3_group_get_stats(const struct bmi3_dev_group *group, struct bmi3_group_stats *stats)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
 
-                /* Get step duration threshold */
-                config->step_duration_thres = (lsb_msb & BMI3_STEP_DURATION_THRESHOLD_MASK) >>
-                                              BMI3_STEP_DURATION_THRESHOLD_POS;
+    /* Variable to define loop */
+    uint8_t index;
 
-                /* Get mean crossing pp enabled */
-                config->mean_crossing_pp_enabled = (lsb_msb & BMI3_STEP_MEAN_CROSSING_PP_ENABLED_MASK) >>
-                                                   BMI3_STEP_MEAN_CROSSING_PP_ENABLED_POS;
+    if ((group != NULL) && (stats != NULL))
+    {
+        stats->elapsed_us = group->last_us - group->start_us;
+        stats->bytes = 0;
+        stats->bytes_per_sec = 0;
+        stats->passes = group->passes;
+        stats->drains = group->drains;
+        stats->op_steps = group->op_steps;
+        stats->errors = group->errors;
+        stats->avg_latency_us = 0;
+        stats->max_latency_us = 0;
 
-                /* Get mcr threshold */
-                config->mcr_threshold = (lsb_msb & BMI3_STEP_MCR_THRESHOLD_MASK) >> BMI3_STEP_MCR_THRESHOLD_POS;
+        for (index = 0; index < group->num_devs; index++)
+        {
+            stats->bytes += group->member[index].bytes;
 
-                /* Get sc_12_res selection */
-                config->sc_12_res = (lsb_msb & BMI3_STEP_SC_12_RES_MASK) >> BMI3_STEP_SC_12_RES_POS;
+            if (group->member[index].max_latency_us > stats->max_latency_us)
+            {
+                stats->max_latency_us = group->member[index].max_latency_us;
             }
         }
+
+        if (stats->elapsed_us != 0)
+        {
+            stats->bytes_per_sec = (uint32_t)((stats->bytes * 1000000) / stats->elapsed_us);
+        }
+
+        if (group->latency_count != 0)
+        {
+            stats->avg_latency_us = (uint32_t)(group->latency_sum_us / group->latency_count);
+        }
     }
     else
     {
-        rslt = BMI3_E_INVALID_SENSOR;
+        rslt = BMI3_E_NULL_PTR;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API sets step counter configurations like water-mark level,
- * reset counter, step counter parameters and sc_12_res.
+ * @brief This API starts the interrupt-driven FIFO acquisition engine.
  */
-static int8_t set_step_config(const struct bmi3_step_counter_config *config, struct bmi3_dev *dev)
+int8_t bmi3_acq_start(struct bmi3_acq *acq, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to set the base address of step counter feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_STEP_CNT, 0 };
-
-    /* Array to define the feature configuration */
-    uint8_t step_config[24] = { 0 };
+    /* Variable to store the FIFO configuration */
+    uint16_t fifo_config = 0;
 
-    uint8_t data_array[24] = { 0 };
+    /* Accel and gyro configurations */
+    struct bmi3_sens_config sens_cfg[2] = { { 0 } };
 
-    uint16_t watermark1, watermark2, activity_detection_threshold1, activity_detection_threshold2;
+    /* Variable to store the fastest ODR in the FIFO */
+    uint8_t odr;
 
-    uint16_t env_min_dist_up1, env_min_dist_up2, env_coef_down1, env_coef_down2;
+    /* Variable to store the most frames a ring buffer holds */
+    uint16_t ring_frames;
 
-    uint16_t env_coef_up1, env_coef_up2, mean_val_decay1, mean_val_decay2, step_counter_increment1,
-             step_counter_increment2;
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-    uint16_t mean_step_dur1, mean_step_dur2, env_min_dist_down1, env_min_dist_down2;
+    if ((rslt == BMI3_OK) && (acq != NULL) && (acq->wait != NULL) && (acq->ring != NULL))
+    {
+        if (((acq->tune == BMI3_ACQ_TUNE_LATENCY) && (acq->target_latency_us == 0)) ||
+            ((acq->tune == BMI3_ACQ_TUNE_WAKEUPS) && (acq->max_wakeups == 0)) ||
+            (acq->tune > BMI3_ACQ_TUNE_WAKEUPS) || (acq->ring->buf_size <= dev->dummy_byte))
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
 
-    uint16_t step_buffer_size, filter_cascade_enabled, peak_duration_min_walking, peak_duration_min_running;
+        if (rslt == BMI3_OK)
+        {
+            rslt = bmi3_get_fifo_config(&fifo_config, dev);
+        }
 
-    uint16_t watermark, env_min_dist_up, env_coef_up, env_min_dist_down, env_coef_down, mean_val_decay;
+        if (rslt == BMI3_OK)
+        {
+            acq->frame_len = get_fifo_frame_length(fifo_config & BMI3_FIFO_ALL_EN);
 
-    uint16_t mean_step_dur, activity_detection_threshold, mcr_threshold;
+            sens_cfg[0].type = BMI3_ACCEL;
+            sens_cfg[1].type = BMI3_GYRO;
+            rslt = bmi3_get_sensor_config(sens_cfg, 2, dev);
+        }
 
-    uint16_t reset_counter, activity_detection_factor, step_duration_max, step_duration_window,
-             step_duration_pp_enabled;
+        if (rslt == BMI3_OK)
+        {
+            /* Frames come at the rate of the fastest sensor in the FIFO */
+            odr = sens_cfg[0].cfg.acc.odr;
 
-    uint16_t step_duration_threshold, mean_crossing_pp_enabled, mcr_threshold1, mcr_threshold2, sc_12_res;
+            if ((fifo_config & BMI3_FIFO_GYR_EN) &&
+                (((fifo_config & BMI3_FIFO_ACC_EN) == 0) || (sens_cfg[1].cfg.gyr.odr > odr)))
+            {
+                odr = sens_cfg[1].cfg.gyr.odr;
+            }
 
-    if (config != NULL)
-    {
-        /* Set the step counter base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+            if ((acq->frame_len == 0) || (odr < BMI3_ACC_ODR_0_78HZ) || (odr > BMI3_ACC_ODR_6400HZ))
+            {
+                rslt = BMI3_E_INVALID_INPUT;
+            }
+        }
 
         if (rslt == BMI3_OK)
         {
-            /* Set water-mark for lsb 8 bits */
-            watermark1 = BMI3_SET_BIT_POS0(data_array[0], BMI3_STEP_WATERMARK, config->watermark_level);
+            acq->frame_period = (uint32_t)BMI3_SENSOR_TIME_TICKS_6400HZ << (BMI3_ACC_ODR_6400HZ - odr);
 
-            watermark = ((uint16_t)data_array[1] << 8);
+            acq->max_frames = (uint16_t)((BMI3_FIFO_CAPACITY_WORDS * 2) / acq->frame_len);
+            ring_frames = (uint16_t)((acq->ring->buf_size - dev->dummy_byte) / acq->frame_len);
 
-            /* Set water-mark for msb 8 bits */
-            watermark2 = BMI3_SET_BIT_POS0(watermark, BMI3_STEP_WATERMARK, config->watermark_level);
+            if (ring_frames < acq->max_frames)
+            {
+                acq->max_frames = ring_frames;
+            }
 
-            reset_counter = ((uint16_t)data_array[1] << 8);
+            acq->wm_frames = 0;
+            acq->wm = 0;
+            acq->excess_x8 = 0;
+            acq->wakeups = 0;
+            acq->timeouts = 0;
+            acq->overflows = 0;
+            acq->retunes = 0;
+            acq->frames = 0;
 
-            /* Set reset counter */
-            reset_counter = BMI3_SET_BITS(reset_counter, BMI3_STEP_RESET_COUNTER, config->reset_counter);
+            if (acq->max_frames == 0)
+            {
+                rslt = BMI3_E_INVALID_INPUT;
+            }
+        }
 
-            /* Set env_min_dist_up for lsb 8 bits */
-            env_min_dist_up1 = BMI3_SET_BIT_POS0(data_array[2], BMI3_STEP_ENV_MIN_DIST_UP, config->env_min_dist_up);
-
-            env_min_dist_up = ((uint16_t)data_array[3] << 8);
-
-            /* Set env_min_dist_up for msb 8 bits */
-            env_min_dist_up2 = BMI3_SET_BIT_POS0(env_min_dist_up, BMI3_STEP_ENV_MIN_DIST_UP, config->env_min_dist_up);
-
-            /* Set env_coef_up for lsb 8 bits */
-            env_coef_up1 = BMI3_SET_BIT_POS0(data_array[4], BMI3_STEP_ENV_COEF_UP, config->env_coef_up);
-
-            env_coef_up = ((uint16_t)data_array[5] << 8);
-
-            /* Set env_coef_up for msb 8 bits */
-            env_coef_up2 = BMI3_SET_BIT_POS0(env_coef_up, BMI3_STEP_ENV_COEF_UP, config->env_coef_up);
-
-            /* Set env_min_dist_down for lsb 8 bits */
-            env_min_dist_down1 =
-                BMI3_SET_BIT_POS0(data_array[6], BMI3_STEP_ENV_MIN_DIST_DOWN, config->env_min_dist_down);
-
-            env_min_dist_down = ((uint16_t)data_array[7] << 8);
-
-            /* Set env_min_dist_down for msb 8 bits */
-            env_min_dist_down2 = BMI3_SET_BIT_POS0(env_min_dist_down,
-                                                   BMI3_STEP_ENV_MIN_DIST_DOWN,
-                                                   config->env_min_dist_down);
-
-            /* Set env_coef_down for lsb 8 bits */
-            env_coef_down1 = BMI3_SET_BIT_POS0(data_array[8], BMI3_STEP_ENV_COEF_DOWN, config->env_coef_down);
-
-            env_coef_down = ((uint16_t)data_array[9] << 8);
+        if (rslt == BMI3_OK)
+        {
+            rslt = tune_acq_wm(acq, dev);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
-            /* Set env_coef_down for msb 8 bits */
-            env_coef_down2 = BMI3_SET_BIT_POS0(env_coef_down, BMI3_STEP_ENV_COEF_DOWN, config->env_coef_down);
+    return rslt;
+}
 
-            /* Set mean_val_decay for lsb 8 bits */
-            mean_val_decay1 = BMI3_SET_BIT_POS0(data_array[10], BMI3_STEP_MEAN_VAL_DECAY, config->mean_val_decay);
+/*!
+ * @brief This API waits for the FIFO interrupt, reads the FIFO and retunes the water-mark.
+ */
+int8_t bmi3_acq_read(struct bmi3_acq *acq, struct bmi3_fifo_view *view, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-            mean_val_decay = ((uint16_t)data_array[11] << 8);
+    /* Variable to store the interrupt status */
+    uint16_t int_status = 0;
 
-            /* Set mean_val_decay for msb 8 bits */
-            mean_val_decay2 = BMI3_SET_BIT_POS0(mean_val_decay, BMI3_STEP_MEAN_VAL_DECAY, config->mean_val_decay);
+    /* Variable to store the number of frames read */
+    uint16_t frames;
 
-            /* Set mean_step_dur for lsb 8 bits */
-            mean_step_dur1 = BMI3_SET_BIT_POS0(data_array[12], BMI3_STEP_MEAN_STEP_DUR, config->mean_step_dur);
+    /* Variable to store the frames found beyond the water-mark */
+    uint16_t excess = 0;
 
-            mean_step_dur = ((uint16_t)data_array[13] << 8);
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-            /* Set mean_step_dur for msb 8 bits */
-            mean_step_dur2 = BMI3_SET_BIT_POS0(mean_step_dur, BMI3_STEP_MEAN_STEP_DUR, config->mean_step_dur);
+    if ((rslt == BMI3_OK) && (acq != NULL) && (acq->wait != NULL) && (view != NULL))
+    {
+        view->data = NULL;
+        view->length = 0;
 
-            /* Set step buffer size */
-            step_buffer_size = BMI3_SET_BIT_POS0(data_array[14], BMI3_STEP_BUFFER_SIZE, config->step_buffer_size);
+        /* A missed edge must not stall the acquisition: read the FIFO after a timeout as well */
+        if (acq->wait(acq->timeout_us, acq->wait_ctx) != BMI3_OK)
+        {
+            acq->timeouts++;
+        }
 
-            /* Set filter cascade */
-            filter_cascade_enabled = BMI3_SET_BITS(data_array[14],
-                                                   BMI3_STEP_FILTER_CASCADE_ENABLED,
-                                                   config->filter_cascade_enabled);
+        acq->wakeups++;
 
-            /* Set step_counter_increment for lsb 8 bits */
-            step_counter_increment1 = BMI3_SET_BITS(data_array[14],
-                                                    BMI3_STEP_COUNTER_INCREMENT,
-                                                    config->step_counter_increment);
+        /* Reading the status also clears a latched interrupt */
+        switch (acq->int_pin)
+        {
+            case BMI3_INT1:
+                rslt = bmi3_get_int1_status(&int_status, dev);
+                break;
+            case BMI3_INT2:
+                rslt = bmi3_get_int2_status(&int_status, dev);
+                break;
+            case BMI3_I3C_INT:
+                rslt = bmi3_get_i3c_ibi_status(&int_status, dev);
+                break;
+            default:
+                break;
+        }
 
-            step_counter_increment2 = ((uint16_t)data_array[15] << 8);
+        if (rslt == BMI3_OK)
+        {
+            rslt = bmi3_read_fifo_view(acq->ring, view, dev);
+        }
 
-            /* Set step_counter_increment for msb 8 bits */
-            step_counter_increment2 = BMI3_SET_BITS(step_counter_increment2,
-                                                    BMI3_STEP_COUNTER_INCREMENT,
-                                                    config->step_counter_increment);
+        if ((rslt == BMI3_OK) && (acq->frame_len != 0))
+        {
+            frames = (uint16_t)(view->length / acq->frame_len);
+            acq->frames += frames;
 
-            /* Set peak_duration_min_walking for lsb 8 bits */
-            peak_duration_min_walking = BMI3_SET_BIT_POS0(data_array[16],
-                                                          BMI3_STEP_PEAK_DURATION_MIN_WALKING,
-                                                          config->peak_duration_min_walking);
+            if (frames > acq->wm_frames)
+            {
+                excess = (uint16_t)(frames - acq->wm_frames);
+            }
 
-            peak_duration_min_running = ((uint16_t)data_array[17] << 8);
+            /* Frames have been lost: make room for at least half a water-mark more */
+            if (int_status & BMI3_INT_STATUS_FFULL)
+            {
+                acq->overflows++;
+                excess = (uint16_t)(excess + (acq->wm_frames / 2) + 1);
+            }
 
-            /* Set peak_duration_min_walking for msb 8 bits */
-            peak_duration_min_running = BMI3_SET_BITS(peak_duration_min_running,
-                                                      BMI3_STEP_PEAK_DURATION_MIN_RUNNING,
-                                                      config->peak_duration_min_running);
+            /* Interrupt service delay in frames, averaged over 8 wakeups */
+            acq->excess_x8 = (uint16_t)(acq->excess_x8 + excess - ((acq->excess_x8 + 4) / 8));
 
-            /* Set activity detection fsctor */
-            activity_detection_factor = BMI3_SET_BIT_POS0(data_array[18],
-                                                          BMI3_STEP_ACTIVITY_DETECTION_FACTOR,
-                                                          config->activity_detection_factor);
+            rslt = tune_acq_wm(acq, dev);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
-            /* Set activity_detection_threshold for lsb 8 bits */
-            activity_detection_threshold1 = BMI3_SET_BITS(data_array[18],
-                                                          BMI3_STEP_ACTIVITY_DETECTION_THRESHOLD,
-                                                          config->activity_detection_thres);
+    return rslt;
+}
 
-            activity_detection_threshold = ((uint16_t)data_array[19] << 8);
+/*!
+ * @brief This API gets the water-mark in use and the statistics of the acquisition engine.
+ */
+int8_t bmi3_acq_get_stats(const struct bmi3_acq *acq, struct bmi3_acq_stats *stats)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
 
-            /* Set activity_detection_threshold for msb 8 bits */
-            activity_detection_threshold2 = BMI3_SET_BITS(activity_detection_threshold,
-                                                          BMI3_STEP_ACTIVITY_DETECTION_THRESHOLD,
-                                                          config->activity_detection_thres);
+    if ((acq != NULL) && (stats != NULL))
+    {
+        stats->wm = acq->wm;
+        stats->wakeups = acq->wakeups;
+        stats->timeouts = acq->timeouts;
+        stats->overflows = acq->overflows;
+        stats->retunes = acq->retunes;
+        stats->frames = acq->frames;
+        stats->wakeups_per_sec = 0;
+        stats->avg_latency_us = 0;
 
-            /* Set maximum step duration */
-            step_duration_max = BMI3_SET_BIT_POS0(data_array[20], BMI3_STEP_DURATION_MAX, config->step_duration_max);
+        if ((acq->frames != 0) && (acq->frame_period != 0))
+        {
+            /* Per second of data: 25600 sensor time ticks */
+            stats->wakeups_per_sec =
+                (uint32_t)(((uint64_t)acq->wakeups * 25600) / (acq->frames * acq->frame_period));
+        }
 
-            step_duration_window = ((uint16_t)data_array[21] << 8);
+        if (acq->wakeups != 0)
+        {
+            stats->avg_latency_us =
+                (uint32_t)(BMI3_SENSOR_TIME_TO_US(acq->frames * acq->frame_period) / acq->wakeups);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
-            /* Set step duration window */
-            step_duration_window = BMI3_SET_BITS(step_duration_window,
-                                                 BMI3_STEP_DURATION_WINDOW,
-                                                 config->step_duration_window);
+    return rslt;
+}
 
-            step_duration_pp_enabled = BMI3_SET_BIT_POS0(data_array[22],
-                                                         BMI3_STEP_DURATION_PP_ENABLED,
-                                                         config->step_duration_pp_enabled);
+/*!
+ * @brief This API gets the data ready status of power on reset, accelerometer, gyroscope
+ * and temperature.
+ */
+int8_t bmi3_get_sensor_status(uint16_t *status, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-            step_duration_threshold = BMI3_SET_BITS(data_array[22],
-                                                    BMI3_STEP_DURATION_THRESHOLD,
-                                                    config->step_duration_thres);
+    uint8_t data[2] = { 0 };
 
-            mean_crossing_pp_enabled = BMI3_SET_BITS(data_array[22],
-                                                     BMI3_STEP_MEAN_CROSSING_PP_ENABLED,
-                                                     config->mean_crossing_pp_enabled);
+    if (status != NULL)
+    {
+        /* Read the status register */
+        rslt = bmi3_get_regs(BMI3_REG_STATUS, data, 2, dev);
 
-            /* Set mcr_threshold for lsb 8 bits */
-            mcr_threshold1 = BMI3_SET_BITS(data_array[22], BMI3_STEP_MCR_THRESHOLD, config->mcr_threshold);
+        *status = (uint16_t)(data[0] | ((uint16_t)data[1] << 8));
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
-            mcr_threshold = ((uint16_t)data_array[23] << 8);
+    return rslt;
+}
 
-            /* Set mcr_threshold for msb 8 bits */
-            mcr_threshold2 = BMI3_SET_BITS(mcr_threshold, BMI3_STEP_MCR_THRESHOLD, config->mcr_threshold);
+/*!
+ * @brief This API gets the I3C IBI status of both feature and data
+ * interrupts
+ */
+int8_t bmi3_get_i3c_ibi_status(uint16_t *int_status, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-            sc_12_res = ((uint16_t)data_array[23] << 8);
+    /* Array to store data */
+    uint8_t data_array[2] = { 0 };
 
-            sc_12_res = BMI3_SET_BITS(sc_12_res, BMI3_STEP_SC_12_RES, config->sc_12_res);
+    if (int_status != NULL)
+    {
+        /* Get the interrupt status */
+        rslt = bmi3_get_regs(BMI3_REG_INT_STATUS_IBI, data_array, 2, dev);
 
-            step_config[0] = (uint8_t)watermark1;
-            step_config[1] = (uint8_t)((watermark2 | reset_counter) >> 8);
-            step_config[2] = (uint8_t)env_min_dist_up1;
-            step_config[3] = (uint8_t)(env_min_dist_up2 >> 8);
-            step_config[4] = (uint8_t)env_coef_up1;
-            step_config[5] = (uint8_t)(env_coef_up2 >> 8);
-            step_config[6] = (uint8_t)env_min_dist_down1;
-            step_config[7] = (uint8_t)(env_min_dist_down2 >> 8);
-            step_config[8] = (uint8_t)env_coef_down1;
-            step_config[9] = (uint8_t)(env_coef_down2 >> 8);
-            step_config[10] = (uint8_t)mean_val_decay1;
-            step_config[11] = (uint8_t)(mean_val_decay2 >> 8);
-            step_config[12] = (uint8_t)mean_step_dur1;
-            step_config[13] = (uint8_t)(mean_step_dur2 >> 8);
-            step_config[14] = (uint8_t)(step_buffer_size | filter_cascade_enabled | step_counter_increment1);
-            step_config[15] = (uint8_t)(step_counter_increment2 >> 8);
-            step_config[16] = (uint8_t)peak_duration_min_walking;
-            step_config[17] = (uint8_t)(peak_duration_min_running >> 8);
-            step_config[18] = (uint8_t)(activity_detection_factor | activity_detection_threshold1);
-            step_config[19] = (uint8_t)(activity_detection_threshold2 >> 8);
-            step_config[20] = (uint8_t)step_duration_max;
-            step_config[21] = (uint8_t)(step_duration_window >> 8);
-            step_config[22] =
-                (uint8_t)(step_duration_pp_enabled | step_duration_threshold | mean_crossing_pp_enabled |
-                          mcr_threshold1);
-            step_config[23] = (uint8_t)((mcr_threshold2 | sc_12_res) >> 8);
-
-            /* Set the configuration back to feature engine register */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, step_config, 24, dev);
+        if (rslt == BMI3_OK)
+        {
+            *int_status = (uint16_t) data_array[0] | ((uint16_t) data_array[1] << 8);
         }
     }
     else
@@ -6683,22 +7263,19 @@ static int8_t set_step_config(const struct bmi3_step_counter_config *config, str
 }
 
 /*!
- * @brief This internal API gets tap configurations like axes select, wait for time out, mode,
- * max peaks for tap, duration, tap peak threshold, max gest duration, max dur bw peaks,
- * shock settling duration.
+ * @brief This API gets accel gyro offset gain reset values.
  */
-static int8_t get_tap_config(struct bmi3_tap_detector_config *config, struct bmi3_dev *dev)
+int8_t bmi3_get_acc_gyr_off_gain_reset(uint8_t *acc_off_gain_reset, uint8_t *gyr_off_gain_reset, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define the feature configuration */
-    uint8_t tap_config[6] = { 0 };
+    /* Array to define the accel gyro user gain offset reset values */
+    uint8_t acc_gyr_off_gain_reset[2] = { 0 };
 
-    /* Array to set the base address of tap feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_TAP, 0 };
+    /* Array to set the base address of accel gyro offset and gain reset */
+    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ACC_GYR_OFFSET_GAIN_RESET, 0 };
 
-    /* Variable to define array offset */
     uint8_t idx = 0;
 
     /* Variable to define LSB */
@@ -6710,67 +7287,30 @@ static int8_t get_tap_config(struct bmi3_tap_detector_config *config, struct bmi
     /* Variable to define a word */
     uint16_t lsb_msb;
 
-    if (config != NULL)
+    if ((acc_off_gain_reset != NULL) && (gyr_off_gain_reset != NULL))
     {
-        /* Set the tap base address to feature engine transmission address to start DMA transaction */
+        /* Set the accel gyro offset and gain reset base address to feature engine transmission address to start DMA
+         * transaction */
         rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
 
         if (rslt == BMI3_OK)
         {
-            /* Get the configuration from the feature engine register where tap feature resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, tap_config, 6, dev);
+            /* Get the configuration from the feature engine register where accel gyro offset and gain reset value
+             * resides */
+            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, acc_gyr_off_gain_reset, 2, dev);
 
             if (rslt == BMI3_OK)
             {
-                /* Get word to calculate axis select, wait for time out, max peaks for tap and mode
-                 * from the same word */
-                lsb = (uint16_t) tap_config[idx++];
-                msb = ((uint16_t) tap_config[idx++] << 8);
-                lsb_msb = lsb | msb;
-
-                /* Get axis selection */
-                config->axis_sel = lsb_msb & BMI3_TAP_AXIS_SEL_MASK;
-
-                /* Get wait for time out */
-                config->wait_for_timeout = (lsb_msb & BMI3_TAP_WAIT_FR_TIME_OUT_MASK) >> BMI3_TAP_WAIT_FR_TIME_OUT_POS;
-
-                /* Get max peaks for tap */
-                config->max_peaks_for_tap = (lsb_msb & BMI3_TAP_MAX_PEAKS_MASK) >> BMI3_TAP_MAX_PEAKS_POS;
-
-                /* Get mode */
-                config->mode = (lsb_msb & BMI3_TAP_MODE_MASK) >> BMI3_TAP_MODE_POS;
-
-                /* Get word to calculate threshold, output configuration from the same word */
-                lsb = (uint16_t) tap_config[idx++];
-                msb = ((uint16_t) tap_config[idx++] << 8);
-                lsb_msb = lsb | msb;
-
-                /* Get tap peak threshold */
-                config->tap_peak_thres = lsb_msb & BMI3_TAP_PEAK_THRES_MASK;
-
-                /* Get max gesture duration */
-                config->max_gest_dur = (lsb_msb & BMI3_TAP_MAX_GEST_DUR_MASK) >> BMI3_TAP_MAX_GEST_DUR_POS;
-
-                /* Get word to calculate max_dur_between_peaks, tap_shock_settling_dur, min_quite_dur_between_taps
-                 *  and quite_time_after_gest from the same word */
-                lsb = (uint16_t) tap_config[idx++];
-                msb = ((uint16_t) tap_config[idx++] << 8);
-                lsb_msb = lsb | msb;
-
-                /* Get maximum duration between peaks */
-                config->max_dur_between_peaks = lsb_msb & BMI3_TAP_MAX_DUR_BW_PEAKS_MASK;
-
-                /* Get tap shock settling duration */
-                config->tap_shock_settling_dur = (lsb_msb & BMI3_TAP_SHOCK_SETT_DUR_MASK) >>
-                                                 BMI3_TAP_SHOCK_SETT_DUR_POS;
+                /* Get word to calculate acc_off_gain_reset and gyr_off_gain_reset */
+                lsb = (uint16_t) acc_gyr_off_gain_reset[idx++];
+                msb = ((uint16_t) acc_gyr_off_gain_reset[idx++] << 8);
+                lsb_msb = (lsb | msb);
 
-                /* Get minimum quite duration between taps */
-                config->min_quite_dur_between_taps = (lsb_msb & BMI3_TAP_MIN_QUITE_DUR_BW_TAPS_MASK) >>
-                                                     BMI3_TAP_MIN_QUITE_DUR_BW_TAPS_POS;
+                /* Get accel offset gain reset */
+                *acc_off_gain_reset = (uint8_t)(lsb_msb & BMI3_ACC_OFF_GAIN_RESET_MASK);
 
-                /* Get quite time after gesture */
-                config->quite_time_after_gest = (lsb_msb & BMI3_TAP_QUITE_TIME_AFTR_GEST_MASK) >>
-                                                BMI3_TAP_QUITE_TIME_AFTR_GEST_POS;
+                /* Get gyro offset gain reset */
+                *gyr_off_gain_reset = (uint8_t)(lsb_msb & BMI3_GYR_OFF_GAIN_RESET_MASK) >> BMI3_GYR_OFF_GAIN_RESET_POS;
             }
         }
     }
@@ -6783,90 +7323,114 @@ static int8_t get_tap_config(struct bmi3_tap_detector_config *config, struct bmi
 }
 
 /*!
- * @brief This internal API sets tap configurations like axes select, wait for time out, mode,
- * max peaks for tap, duration, tap peak threshold, max gest duration, max dur bw peaks,
- * shock settling duration.
+ * @brief This API sets accel gyro offset gain reset values.
  */
-static int8_t set_tap_config(const struct bmi3_tap_detector_config *config, struct bmi3_dev *dev)
+int8_t bmi3_set_acc_gyr_off_gain_reset(uint8_t acc_off_gain_reset, uint8_t gyr_off_gain_reset, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define the feature configuration */
-    uint8_t tap_config[6] = { 0 };
+    /* Array to define the accel gyro user gain offset reset values */
+    uint8_t acc_gyr_off_gain_reset[2] = { 0 };
 
-    /* Array to set the base address of tap feature */
-    uint8_t base_aadr[2] = { BMI3_BASE_ADDR_TAP, 0 };
+    /* Array to set the base address of accel gyro offset and gain reset */
+    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ACC_GYR_OFFSET_GAIN_RESET, 0 };
 
-    uint16_t axis_sel, wait_fr_time_out, max_peaks_for_tap, mode;
-    uint16_t tap_peak_thres, tap_peak_thres1, tap_peak_thres2, max_gest_dur;
-    uint16_t max_dur_between_peaks, tap_shock_setting_dur, min_quite_dur_between_taps, quite_time_after_gest;
+    uint8_t data_array[2] = { 0 };
 
-    if (config != NULL)
+    /* Set the accel gyro offset and gain reset base address to feature engine transmission address to start DMA
+     * transaction */
+    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+
+    if (rslt == BMI3_OK)
     {
-        /* Set the tap base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_aadr, 2, dev);
+        /* Set accel offset gain reset */
+        acc_off_gain_reset = BMI3_SET_BIT_POS0(data_array[0], BMI3_ACC_OFF_GAIN_RESET, acc_off_gain_reset);
 
-        if (rslt == BMI3_OK)
-        {
-            /* Set axis_sel */
-            axis_sel = BMI3_SET_BIT_POS0(tap_config[0], BMI3_TAP_AXIS_SEL, config->axis_sel);
+        /* Set gyro offset gain reset */
+        gyr_off_gain_reset = BMI3_SET_BITS(data_array[0], BMI3_GYR_OFF_GAIN_RESET, gyr_off_gain_reset);
+
+        acc_gyr_off_gain_reset[0] = (acc_off_gain_reset | gyr_off_gain_reset);
+
+        /* Set the configurations back to the feature engine register */
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, acc_gyr_off_gain_reset, 2, dev);
+    }
+
+    return rslt;
+}
 
-            /* Set wait for time out */
-            wait_fr_time_out = BMI3_SET_BITS(tap_config[0], BMI3_TAP_WAIT_FR_TIME_OUT, config->wait_for_timeout);
+/***************************************************************************/
 
-            /* Set maximum peaks for tap */
-            max_peaks_for_tap = BMI3_SET_BITS(tap_config[0], BMI3_TAP_MAX_PEAKS, config->max_peaks_for_tap);
+/*!                   Local Function Definitions
+ ****************************************************************************/
 
-            /* Set mode */
-            mode = BMI3_SET_BITS(tap_config[0], BMI3_TAP_MODE, config->mode);
+/*!
+ * @brief This internal API sets accelerometer configurations like ODR, accel mode,
+ * bandwidth, average samples and range.
+ */
+static int8_t set_accel_config(struct bmi3_accel_config *config, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-            /* Set peak threshold first byte in word */
-            tap_peak_thres = BMI3_SET_BIT_POS0(tap_config[2], BMI3_TAP_PEAK_THRES, config->tap_peak_thres);
+    /* Variable to store data */
+    uint8_t reg_data[2] = { 0 };
 
-            /* Left shift by 8 times so that we can set rest of the values of tap peak threshold conf in word */
-            tap_peak_thres1 = ((uint16_t)tap_config[3] << 8);
+    uint16_t odr, range, bwp, avg_num, acc_mode;
 
-            /* Set peak threshold second byte in word */
-            tap_peak_thres2 = BMI3_SET_BIT_POS0(tap_peak_thres1, BMI3_TAP_PEAK_THRES, config->tap_peak_thres);
+    if (config != NULL)
+    {
+        /* Validate bandwidth and averaging samples */
+        rslt = validate_bw_avg_acc_mode(&config->bwp, &config->acc_mode, &config->avg_num, dev);
 
-            max_gest_dur = ((uint16_t)tap_config[3] << 8);
+        if (rslt == BMI3_OK)
+        {
+            /* Validate ODR and range */
+            rslt = validate_acc_odr_range(&config->odr, &config->range, dev);
+        }
 
-            /* Set max gesture duration */
-            max_gest_dur = BMI3_SET_BITS(max_gest_dur, BMI3_TAP_MAX_GEST_DUR, config->max_gest_dur);
+        if (rslt == BMI3_OK)
+        {
+            if (config->acc_mode == BMI3_ACC_MODE_LOW_PWR)
+            {
+                rslt = validate_acc_odr_avg(config->odr, config->avg_num);
+            }
 
-            /* Set max duration between peaks */
-            max_dur_between_peaks = BMI3_SET_BIT_POS0(tap_config[4],
-                                                      BMI3_TAP_MAX_DUR_BW_PEAKS,
-                                                      config->max_dur_between_peaks);
+            if ((config->acc_mode == BMI3_ACC_MODE_NORMAL) || (config->acc_mode == BMI3_ACC_MODE_HIGH_PERF))
+            {
+                if ((config->odr >= BMI3_ACC_ODR_0_78HZ) && (config->odr <= BMI3_ACC_ODR_6_25HZ))
+                {
+                    rslt = BMI3_E_ACC_INVALID_CFG;
+                }
+            }
+        }
 
-            /* Set shock settling duration */
-            tap_shock_setting_dur =
-                BMI3_SET_BITS(tap_config[4], BMI3_TAP_SHOCK_SETT_DUR, config->tap_shock_settling_dur);
+        if (rslt == BMI3_OK)
+        {
+            /* Set accelerometer ODR */
+            odr = BMI3_SET_BIT_POS0(reg_data[0], BMI3_ACC_ODR, config->odr);
 
-            min_quite_dur_between_taps = ((uint16_t)tap_config[5] << 8);
+            /* Set accelerometer range */
+            range = BMI3_SET_BITS(reg_data[0], BMI3_ACC_RANGE, config->range);
 
-            /* Set quite duration between taps */
-            min_quite_dur_between_taps = BMI3_SET_BITS(min_quite_dur_between_taps,
-                                                       BMI3_TAP_MIN_QUITE_DUR_BW_TAPS,
-                                                       config->min_quite_dur_between_taps);
+            /* Set accelerometer bandwidth */
+            bwp = BMI3_SET_BITS(reg_data[0], BMI3_ACC_BW, config->bwp);
 
-            quite_time_after_gest = ((uint16_t)tap_config[5] << 8);
+            /* Set accelerometer average number of samples */
+            avg_num = BMI3_SET_BITS(reg_data[1], BMI3_ACC_AVG_NUM, config->avg_num);
 
-            /* Set quite time after gesture */
-            quite_time_after_gest = BMI3_SET_BITS(quite_time_after_gest,
-                                                  BMI3_TAP_QUITE_TIME_AFTR_GEST,
-                                                  config->quite_time_after_gest);
+            /* Set accelerometer accel mode */
+            acc_mode = BMI3_SET_BITS(reg_data[1], BMI3_ACC_MODE, config->acc_mode);
 
-            /* Copy all the configurations back to the tap configuration array */
-            tap_config[0] = (uint8_t)(axis_sel | wait_fr_time_out | max_peaks_for_tap | mode);
-            tap_config[2] = (uint8_t)(tap_peak_thres);
-            tap_config[3] = (uint8_t)((tap_peak_thres2 | max_gest_dur) >> 8);
-            tap_config[4] = (uint8_t)(max_dur_between_peaks | tap_shock_setting_dur);
-            tap_config[5] = (uint8_t)((min_quite_dur_between_taps | quite_time_after_gest) >> 8);
+            reg_data[0] = (uint8_t)(odr | range | bwp);
+            reg_data[1] = (uint8_t)((avg_num | acc_mode) >> 8);
 
-            /* Set the configuration back to the feature engine register */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, tap_config, 6, dev);
+            /* Set configurations for accel */
+            rslt = bmi3_set_regs(BMI3_REG_ACC_CONF, reg_data, 2, dev);
+        }
+        else
+        {
+            rslt = BMI3_E_ACC_INVALID_CFG;
         }
     }
     else
@@ -6878,24 +7442,1626 @@ static int8_t set_tap_config(const struct bmi3_tap_detector_config *config, stru
 }
 
 /*!
- * @brief This internal API is used to update data index based on the frame length
+ * @brief This internal API gets accelerometer configurations like ODR,
+ * bandwidth, accel mode, average samples and gravity range.
  */
-static void update_data_index(uint16_t *idx, uint16_t *updated_frm_idx, uint8_t len, int8_t rslt)
+static int8_t get_accel_config(struct bmi3_accel_config *config, struct bmi3_dev *dev)
 {
-    /* Update data index */
-    (*idx) = (*idx) + len;
+    /* Variable to store result of API */
+    int8_t rslt;
 
-    if (rslt == 0 || rslt == BMI3_W_ST_PARTIAL_READ)
-    {
-        /* Update accelerometer, gyro and temperature frame index */
-        (*updated_frm_idx)++;
-    }
-}
+    /* Array to store data */
+    uint8_t data_array[2] = { 0 };
 
-/*!
- * @brief This internal API is used to parse the accelerometer, gyroscope and temperature data from the
- * FIFO data. It updates the current data byte to be parsed.
- */
+    uint16_t reg_data;
+
+    if (config != NULL)
+    {
+        /* Read the sensor configuration details */
+        rslt = bmi3_get_regs(BMI3_REG_ACC_CONF, data_array, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            reg_data = data_array[0];
+
+            /* Get accelerometer ODR */
+            config->odr = BMI3_GET_BIT_POS0(reg_data, BMI3_ACC_ODR);
+
+            /* Get accelerometer range */
+            config->range = BMI3_GET_BITS(reg_data, BMI3_ACC_RANGE);
+
+            /* Get accelerometer bandwidth */
+            config->bwp = BMI3_GET_BITS(reg_data, BMI3_ACC_BW);
+
+            reg_data = (uint16_t)data_array[1] << 8;
+
+            /* Get accelerometer average samples */
+            config->avg_num = BMI3_GET_BITS(reg_data, BMI3_ACC_AVG_NUM);
+
+            /* Get accel mode */
+            config->acc_mode = BMI3_GET_BITS(reg_data, BMI3_ACC_MODE);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API validates bandwidth and accel mode of the
+ * accelerometer set by the user.
+ */
+static int8_t validate_bw_avg_acc_mode(uint8_t *bandwidth, uint8_t *acc_mode, uint8_t *avg_num, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    if ((bandwidth != NULL) && (acc_mode != NULL) && (avg_num != NULL))
+    {
+        /* Validate and auto-correct accel mode */
+        rslt = check_boundary_val(acc_mode, BMI3_ACC_MODE_DISABLE, BMI3_ACC_MODE_HIGH_PERF, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Validate for averaging number of samples */
+            rslt = check_boundary_val(avg_num, BMI3_ACC_AVG1, BMI3_ACC_AVG64, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                /* Validate bandwidth */
+                rslt = check_boundary_val(bandwidth, BMI3_ACC_BW_ODR_HALF, BMI3_ACC_BW_ODR_QUARTER, dev);
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API validates ODR and range of the accelerometer set by
+ * the user.
+ */
+static int8_t validate_acc_odr_range(uint8_t *odr, uint8_t *range, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    if ((odr != NULL) && (range != NULL))
+    {
+        /* Validate and auto correct ODR */
+        rslt = check_boundary_val(odr, BMI3_ACC_ODR_0_78HZ, BMI3_ACC_ODR_6400HZ, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Validate and auto correct Range */
+            rslt = check_boundary_val(range, BMI3_ACC_RANGE_2G, BMI3_ACC_RANGE_16G, dev);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API is used to validate the boundary conditions.
+ */
+static int8_t check_boundary_val(uint8_t *val, uint8_t min, uint8_t max, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (val != NULL))
+    {
+        /* Check if value is below minimum value */
+        if (*val < min)
+        {
+            /* Auto correct the invalid value to minimum value */
+            *val = min;
+            dev->info |= BMI3_I_MIN_VALUE;
+        }
+
+        /* Check if value is above maximum value */
+        if (*val > max)
+        {
+            /* Auto correct the invalid value to maximum value */
+            *val = max;
+            dev->info |= BMI3_I_MAX_VALUE;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API sets gyroscope configurations like ODR,
+ * bandwidth, gyro mode, average samples and dps range.
+ */
+static int8_t set_gyro_config(struct bmi3_gyro_config *config, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store data */
+    uint8_t reg_data[2] = { 0 };
+
+    uint16_t odr, range, bwp, avg_num, gyr_mode;
+
+    if (config != NULL)
+    {
+        /* Validate bandwidth, average samples and mode */
+        rslt = validate_bw_avg_gyr_mode(&config->bwp, &config->gyr_mode, &config->avg_num, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Validate ODR and range */
+            rslt = validate_gyr_odr_range(&config->odr, &config->range, dev);
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            if (config->gyr_mode == BMI3_GYR_MODE_LOW_PWR)
+            {
+                rslt = validate_gyr_odr_avg(config->odr, config->avg_num);
+            }
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            /* Set gyroscope ODR */
+            odr = BMI3_SET_BIT_POS0(reg_data[0], BMI3_GYR_ODR, config->odr);
+
+            /* Set gyroscope range */
+            range = BMI3_SET_BITS(reg_data[0], BMI3_GYR_RANGE, config->range);
+
+            /* Set gyroscope bandwidth */
+            bwp = BMI3_SET_BITS(reg_data[0], BMI3_GYR_BW, config->bwp);
+
+            /* Set gyroscope average sample */
+            avg_num = BMI3_SET_BITS(reg_data[1], BMI3_GYR_AVG_NUM, config->avg_num);
+
+            /* Set gyroscope mode */
+            gyr_mode = BMI3_SET_BITS(reg_data[1], BMI3_GYR_MODE, config->gyr_mode);
+
+            reg_data[0] = (uint8_t)(odr | range | bwp);
+            reg_data[1] = (uint8_t)((avg_num | gyr_mode) >> 8);
+
+            /* Set gyro configurations */
+            rslt = bmi3_set_regs(BMI3_REG_GYR_CONF, reg_data, 2, dev);
+        }
+        else
+        {
+            rslt = BMI3_E_GYRO_INVALID_CFG;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API validates bandwidth, average samples and gyr mode of the
+ * gyroscope set by the user.
+ */
+static int8_t validate_bw_avg_gyr_mode(uint8_t *bandwidth,
+                                       uint8_t *gyr_mode,
+                                       const uint8_t *avg_num,
+                                       struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    if ((bandwidth != NULL) && (gyr_mode != NULL) && (avg_num != NULL))
+    {
+        /* Validate and auto-correct gyro mode */
+        rslt = check_boundary_val(gyr_mode, BMI3_GYR_MODE_DISABLE, BMI3_GYR_MODE_HIGH_PERF, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Validate for averaging mode */
+            rslt = check_boundary_val(bandwidth, BMI3_GYR_AVG1, BMI3_GYR_AVG64, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                /* Validate for bandwidth */
+                rslt = check_boundary_val(bandwidth, BMI3_GYR_BW_ODR_HALF, BMI3_GYR_BW_ODR_QUARTER, dev);
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API validates ODR and range of the gyroscope set by
+ * the user.
+ */
+static int8_t validate_gyr_odr_range(uint8_t *odr, uint8_t *range, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    if ((odr != NULL) && (range != NULL))
+    {
+        /* Validate and auto correct ODR */
+        rslt = check_boundary_val(odr, BMI3_GYR_ODR_0_78HZ, BMI3_GYR_ODR_6400HZ, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Validate and auto correct Range */
+            rslt = check_boundary_val(range, BMI3_GYR_RANGE_125DPS, BMI3_GYR_RANGE_2000DPS, dev);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API gets the accelerometer data from the register.
+ */
+static int8_t get_accel_sensor_data(struct bmi3_sens_axes_data *data, uint8_t reg_addr, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to define data stored in register */
+    uint8_t reg_data[BMI3_ACC_NUM_BYTES] = { 0 };
+
+    /* Stores the accel x, y and z axis data from register */
+    uint16_t acc_data[6];
+
+    if (data != NULL)
+    {
+        /* Read the sensor data */
+        rslt = bmi3_get_regs(reg_addr, reg_data, BMI3_ACC_NUM_BYTES, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            acc_data[0] = (reg_data[0] | (uint16_t)reg_data[1] << 8);
+            acc_data[1] = (reg_data[2] | (uint16_t)reg_data[3] << 8);
+            acc_data[2] = (reg_data[4] | (uint16_t)reg_data[5] << 8);
+            acc_data[3] = (reg_data[14] | (uint16_t)reg_data[15] << 8);
+            acc_data[4] = (reg_data[16] | (uint16_t)reg_data[17] << 8);
+            acc_data[5] = reg_data[18];
+
+            /* Get accelerometer data from the register */
+            get_acc_data(data, acc_data);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API gets the gyroscope data from the register.
+ */
+static int8_t get_gyro_sensor_data(struct bmi3_sens_axes_data *data, uint8_t reg_addr, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to define data stored in register */
+    uint8_t reg_data[BMI3_GYR_NUM_BYTES] = { 0 };
+
+    /* Variable to store x, y and z axis gyro data */
+    uint16_t gyr_data[6];
+
+    if (data != NULL)
+    {
+        /* Read the sensor data */
+        rslt = bmi3_get_regs(reg_addr, reg_data, BMI3_GYR_NUM_BYTES, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            gyr_data[0] = (reg_data[0] | (uint16_t)reg_data[1] << 8);
+            gyr_data[1] = (reg_data[2] | (uint16_t)reg_data[3] << 8);
+            gyr_data[2] = (reg_data[4] | (uint16_t)reg_data[5] << 8);
+            gyr_data[3] = (reg_data[8] | (uint16_t)reg_data[9] << 8);
+            gyr_data[4] = (reg_data[10] | (uint16_t)reg_data[11] << 8);
+            gyr_data[5] = reg_data[12];
+
+            /* Get gyro data from the register */
+            get_gyr_data(data, gyr_data);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+#ifndef BMI3_STEP_COUNTER_DISABLE
+/*!
+ * @brief This internal API gets the step counter data from the register.
+ */
+static int8_t get_step_counter_sensor_data(uint32_t *step_count, uint8_t reg_addr, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to define data stored in register */
+    uint8_t reg_data[4] = { 0 };
+
+    if (step_count != NULL)
+    {
+        /* Read the sensor data */
+        rslt = bmi3_get_regs(reg_addr, reg_data, 4, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Get the step counter output in 4 bytes */
+            *step_count = (uint32_t) reg_data[0];
+            *step_count |= ((uint32_t) reg_data[1] << 8);
+            *step_count |= ((uint32_t) reg_data[2] << 16);
+            *step_count |= ((uint32_t) reg_data[3] << 24);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+#endif
+
+#ifndef BMI3_ORIENTATION_DISABLE
+/*!
+ * @brief This internal API gets the output values of orientation: portrait-
+ * landscape and face up-down.
+ */
+static int8_t get_orient_output_data(struct bmi3_orientation_output *orient_out, uint8_t reg_addr, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to define data stored in register */
+    uint8_t reg_data[2] = { 0 };
+
+    if (orient_out != NULL)
+    {
+        /* Read the data from feature engine status register */
+        rslt = bmi3_get_regs(reg_addr, reg_data, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Get the output value of the orientation detection feature */
+            orient_out->orientation_portrait_landscape = BMI3_GET_BIT_POS0(reg_data[0],
+                                                                           BMI3_ORIENTATION_PORTRAIT_LANDSCAPE);
+
+            /* Get the output value of the orientation face up-down feature */
+            orient_out->orientation_faceup_down = BMI3_GET_BITS(reg_data[0], BMI3_ORIENTATION_FACEUP_DOWN);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+#endif
+
+/*!
+ * @brief This internal API gets gyroscope configurations like ODR, gyro mode,
+ * bandwidth, averaging samples and range.
+ */
+static int8_t get_gyro_config(struct bmi3_gyro_config *config, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to store data */
+    uint8_t data_array[2] = { 0 };
+
+    uint16_t reg_data;
+
+    if (config != NULL)
+    {
+        /* Read the sensor configuration details */
+        rslt = bmi3_get_regs(BMI3_REG_GYR_CONF, data_array, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            reg_data = data_array[0];
+
+            /* Get gyro ODR */
+            config->odr = BMI3_GET_BIT_POS0(reg_data, BMI3_GYR_ODR);
+
+            /* Get gyro range */
+            config->range = BMI3_GET_BITS(reg_data, BMI3_GYR_RANGE);
+
+            /* Get gyro bandwidth */
+            config->bwp = BMI3_GET_BITS(reg_data, BMI3_GYR_BW);
+
+            reg_data = (uint16_t)data_array[1] << 8;
+
+            /* Get gyro average sample */
+            config->avg_num = BMI3_GET_BITS(reg_data, BMI3_GYR_AVG_NUM);
+
+            /* Get gyro mode */
+            config->gyr_mode = BMI3_GET_BITS(reg_data, BMI3_GYR_MODE);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API gets the accelerometer data.
+ */
+static void get_acc_data(struct bmi3_sens_axes_data *data, const uint16_t *reg_data)
+{
+    /* Stores accel x-axis data */
+    data->x = (int16_t)reg_data[0];
+
+    /* Stores accel y-axis data */
+    data->y = (int16_t)reg_data[1];
+
+    /* Stores accel z-axis data */
+    data->z = (int16_t)reg_data[2];
+
+    /* Stores sensor time data */
+    data->sens_time = (reg_data[3] | ((uint32_t)reg_data[4] << 16));
+
+    /* Stores saturation x-axis data */
+    data->sat_x = (reg_data[5] & BMI3_SATF_ACC_X_MASK);
+
+    /* Stores saturation y-axis data */
+    data->sat_y = (reg_data[5] & BMI3_SATF_ACC_Y_MASK) >> BMI3_SATF_ACC_Y_POS;
+
+    /* Stores saturation z-axis data */
+    data->sat_z = (reg_data[5] & BMI3_SATF_ACC_Z_MASK) >> BMI3_SATF_ACC_Z_POS;
+}
+
+/*!
+ * @brief This internal API gets the gyroscope data.
+ */
+static void get_gyr_data(struct bmi3_sens_axes_data *data, const uint16_t *reg_data)
+{
+    /* Stores accel x-axis data */
+    data->x = (int16_t)reg_data[0];
+
+    /* Stores accel y-axis data */
+    data->y = (int16_t)reg_data[1];
+
+    /* Stores accel z-axis data */
+    data->z = (int16_t)reg_data[2];
+
+    /* Stores sensor time data */
+    data->sens_time = (reg_data[3] | ((uint32_t)reg_data[4] << 16));
+
+    /* Stores saturation x-axis data */
+    data->sat_x = (reg_data[5] & BMI3_SATF_GYR_X_MASK) >> BMI3_SATF_GYR_X_POS;
+
+    /* Stores saturation y-axis data */
+    data->sat_y = (reg_data[5] & BMI3_SATF_GYR_Y_MASK) >> BMI3_SATF_GYR_Y_POS;
+
+    /* Stores saturation z-axis data */
+    data->sat_z = (reg_data[5] & BMI3_SATF_GYR_Z_MASK) >> BMI3_SATF_GYR_Z_POS;
+}
+
+/*!
+ * @brief This internal API is used to validate the device structure pointer for
+ * null conditions.
+ */
+static int8_t null_ptr_check(const struct bmi3_dev *dev)
+{
+    int8_t rslt;
+
+    if ((dev == NULL) || (dev->read == NULL) || (dev->write == NULL) || (dev->delay_us == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else
+    {
+        /* Device structure is fine */
+        rslt = BMI3_OK;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API reads data from the given register address on the bus,
+ * after writing out the queued writes.
+ */
+static int8_t read_regs(uint8_t reg_addr, uint8_t *data, uint16_t len, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to define temporary buffer */
+    uint8_t temp_buf[BMI3_MAX_LEN];
+
+    /* Variable to define loop */
+    uint16_t index = 0;
+
+    /* Reads have to see the queued writes */
+    if ((dev->batch != NULL) && (dev->batch->num_ops != 0))
+    {
+        rslt = flush_batch(dev);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        /* Configuring reg_addr for SPI Interface */
+        if (dev->intf == BMI3_SPI_INTF)
+        {
+            reg_addr = (reg_addr | BMI3_SPI_RD_MASK);
+        }
+
+        dev->intf_rslt = dev->read(reg_addr, temp_buf, len + dev->dummy_byte, dev->intf_ptr);
+        dev->delay_us(2, dev->intf_ptr);
+
+        if (dev->intf_rslt == BMI3_INTF_RET_SUCCESS)
+        {
+            /* Read the data from the position next to dummy byte */
+            while (index < len)
+            {
+                data[index] = temp_buf[index + dev->dummy_byte];
+                index++;
+            }
+        }
+        else
+        {
+            rslt = BMI3_E_COM_FAIL;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API takes the lock of the device.
+ */
+static void lock_dev(const struct bmi3_dev *dev)
+{
+    if ((dev != NULL) && (dev->lock != NULL))
+    {
+        dev->lock(dev->lock_ctx);
+    }
+}
+
+/*!
+ * @brief This internal API releases the lock of the device.
+ */
+static void unlock_dev(const struct bmi3_dev *dev)
+{
+    if ((dev != NULL) && (dev->unlock != NULL))
+    {
+        dev->unlock(dev->lock_ctx);
+    }
+}
+
+/*!
+ * @brief This internal API writes data to the given register address, either on the bus
+ * or into the transaction queue.
+ */
+static int8_t send_regs(uint8_t reg_addr, const uint8_t *data, uint16_t len, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    if (dev->batch != NULL)
+    {
+        rslt = queue_regs(reg_addr, data, len, dev);
+    }
+    else
+    {
+        rslt = write_regs(reg_addr, data, len, dev);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API reads registers through the shadow cache.
+ */
+static int8_t shadow_get_regs(uint8_t reg_addr, uint8_t *data, uint16_t len, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Shadow cache */
+    struct bmi3_shadow *shadow = dev->shadow;
+
+    if ((shadow->user_page == BMI3_FALSE) || (reg_addr == BMI3_REG_FEATURE_DATA_ADDR))
+    {
+        rslt = shadow_sync_port(dev);
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = read_regs(reg_addr, data, len, dev);
+        }
+    }
+    else if (reg_addr == BMI3_REG_FEATURE_DATA_TX)
+    {
+        if ((shadow->feature_addr_valid == BMI3_TRUE) &&
+            (shadow_lookup(shadow, BMI3_SHADOW_PAGE_FEATURE, shadow->feature_addr, data, len) == BMI3_TRUE))
+        {
+            shadow->hits++;
+        }
+        else
+        {
+            shadow->misses++;
+            rslt = shadow_sync_port(dev);
+
+            if (rslt == BMI3_OK)
+            {
+                rslt = read_regs(reg_addr, data, len, dev);
+            }
+
+            if ((rslt == BMI3_OK) && (shadow->feature_addr_valid == BMI3_TRUE))
+            {
+                shadow_update(shadow, BMI3_SHADOW_PAGE_FEATURE, shadow->feature_addr, data, len);
+                shadow->port_addr = (uint16_t)(shadow->port_addr + (len / 2));
+            }
+            else
+            {
+                shadow->port_addr_valid = BMI3_FALSE;
+            }
+        }
+
+        /* The data port auto-increments on every word */
+        shadow->feature_addr = (uint16_t)(shadow->feature_addr + (len / 2));
+    }
+    else if (shadow_lookup(shadow, BMI3_SHADOW_PAGE_REG, reg_addr, data, len) == BMI3_TRUE)
+    {
+        shadow->hits++;
+    }
+    else
+    {
+        shadow->misses++;
+        rslt = read_regs(reg_addr, data, len, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            shadow_update(shadow, BMI3_SHADOW_PAGE_REG, reg_addr, data, len);
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API writes registers through the shadow cache.
+ */
+static int8_t shadow_set_regs(uint8_t reg_addr, const uint8_t *data, uint16_t len, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Shadow cache */
+    struct bmi3_shadow *shadow = dev->shadow;
+
+    if (reg_addr == BMI3_REG_CFG_RES)
+    {
+        /* Leaving or entering the user page: nothing cached stays meaningful */
+        rslt = shadow_sync_port(dev);
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = send_regs(reg_addr, data, len, dev);
+        }
+
+        shadow_invalidate(shadow);
+        shadow->user_page = (uint8_t)((len == 2) && (data[0] == 0) && (data[1] == 0));
+    }
+    else if (shadow->user_page == BMI3_FALSE)
+    {
+        rslt = send_regs(reg_addr, data, len, dev);
+    }
+    else if (reg_addr == BMI3_REG_CMD)
+    {
+        /* Commands (soft-reset, self-test, self-calibration, ...) may change any register */
+        rslt = shadow_sync_port(dev);
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = send_regs(reg_addr, data, len, dev);
+        }
+
+        shadow_invalidate(shadow);
+    }
+    else if ((reg_addr == BMI3_REG_FEATURE_DATA_ADDR) && (len == 2))
+    {
+        /* Deferred until the data port is accessed on the bus */
+        shadow->feature_addr = (uint16_t)(data[0] | ((uint16_t)data[1] << 8));
+        shadow->feature_addr_valid = BMI3_TRUE;
+    }
+    else if (reg_addr == BMI3_REG_FEATURE_DATA_TX)
+    {
+        rslt = shadow_sync_port(dev);
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = send_regs(reg_addr, data, len, dev);
+        }
+
+        if ((rslt == BMI3_OK) && (shadow->feature_addr_valid == BMI3_TRUE))
+        {
+            shadow_update(shadow, BMI3_SHADOW_PAGE_FEATURE, shadow->feature_addr, data, len);
+            shadow->feature_addr = (uint16_t)(shadow->feature_addr + (len / 2));
+            shadow->port_addr = shadow->feature_addr;
+        }
+        else
+        {
+            shadow_invalidate(shadow);
+        }
+    }
+    else
+    {
+        if (reg_addr == BMI3_REG_FEATURE_DATA_ADDR)
+        {
+            shadow->feature_addr_valid = BMI3_FALSE;
+            shadow->port_addr_valid = BMI3_FALSE;
+        }
+
+        rslt = send_regs(reg_addr, data, len, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            shadow_update(shadow, BMI3_SHADOW_PAGE_REG, reg_addr, data, len);
+        }
+        else
+        {
+            shadow_invalidate(shadow);
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API writes the deferred feature engine address to
+ * BMI3_REG_FEATURE_DATA_ADDR if the data port of the device points elsewhere.
+ */
+static int8_t shadow_sync_port(struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Shadow cache */
+    struct bmi3_shadow *shadow = dev->shadow;
+
+    /* Array to store the feature engine address */
+    uint8_t base_addr[2];
+
+    if ((shadow->feature_addr_valid == BMI3_TRUE) &&
+        ((shadow->port_addr_valid == BMI3_FALSE) || (shadow->port_addr != shadow->feature_addr)))
+    {
+        base_addr[0] = (uint8_t)(shadow->feature_addr & BMI3_SET_LOW_BYTE);
+        base_addr[1] = (uint8_t)((shadow->feature_addr & BMI3_SET_HIGH_BYTE) >> 8);
+
+        rslt = send_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            shadow->port_addr = shadow->feature_addr;
+            shadow->port_addr_valid = BMI3_TRUE;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API copies words from the shadow cache if all of them are valid.
+ */
+static uint8_t shadow_lookup(const struct bmi3_shadow *shadow, uint8_t page, uint16_t addr, uint8_t *data,
+                             uint16_t len)
+{
+    /* Variable to store the lookup result */
+    uint8_t hit = BMI3_FALSE;
+
+    /* Cached words and their valid bits */
+    const uint16_t *words = shadow->reg;
+    const uint32_t *valid = shadow->reg_valid;
+
+    /* Number of cached words of the page */
+    uint16_t num_words = BMI3_SHADOW_NUM_REGS;
+
+    /* Variable to define loop */
+    uint16_t index;
+
+    if (page == BMI3_SHADOW_PAGE_FEATURE)
+    {
+        words = shadow->feature;
+        valid = shadow->feature_valid;
+        num_words = BMI3_SHADOW_NUM_FEATURE_WORDS;
+    }
+
+    /* Only whole words can be served */
+    if ((len != 0) && ((len % 2) == 0) && ((addr + (len / 2)) <= num_words))
+    {
+        hit = BMI3_TRUE;
+
+        for (index = addr; (hit == BMI3_TRUE) && (index < (addr + (len / 2))); index++)
+        {
+            if (((valid[index / 32] >> (index % 32)) & 1U) == 0)
+            {
+                hit = BMI3_FALSE;
+            }
+        }
+
+        for (index = 0; (hit == BMI3_TRUE) && (index < (len / 2)); index++)
+        {
+            data[2 * index] = (uint8_t)(words[addr + index] & BMI3_SET_LOW_BYTE);
+            data[(2 * index) + 1] = (uint8_t)((words[addr + index] & BMI3_SET_HIGH_BYTE) >> 8);
+        }
+    }
+
+    return hit;
+}
+
+/*!
+ * @brief This internal API stores the cacheable words of a transfer in the shadow cache.
+ */
+static void shadow_update(struct bmi3_shadow *shadow, uint8_t page, uint16_t addr, const uint8_t *data,
+                          uint16_t len)
+{
+    /* Cached words and their valid bits */
+    uint16_t *words = shadow->reg;
+    uint32_t *valid = shadow->reg_valid;
+
+    /* Number of cached words of the page */
+    uint16_t num_words = BMI3_SHADOW_NUM_REGS;
+
+    /* Variable to store the word address */
+    uint16_t word_addr;
+
+    /* Variable to define loop */
+    uint16_t index;
+
+    if (page == BMI3_SHADOW_PAGE_FEATURE)
+    {
+        words = shadow->feature;
+        valid = shadow->feature_valid;
+        num_words = BMI3_SHADOW_NUM_FEATURE_WORDS;
+    }
+
+    for (index = 0; index < (len / 2); index++)
+    {
+        word_addr = (uint16_t)(addr + index);
+
+        if ((word_addr < num_words) && (shadow_cacheable(page, word_addr) == BMI3_TRUE))
+        {
+            words[word_addr] = (uint16_t)(data[2 * index] | ((uint16_t)data[(2 * index) + 1] << 8));
+            valid[word_addr / 32] |= (uint32_t)1U << (word_addr % 32);
+        }
+    }
+}
+
+/*!
+ * @brief This internal API tells whether a word only changes when the host writes it.
+ */
+static uint8_t shadow_cacheable(uint8_t page, uint16_t addr)
+{
+    /* Variable to store the result */
+    uint8_t cacheable = BMI3_FALSE;
+
+    if (page == BMI3_SHADOW_PAGE_FEATURE)
+    {
+        /*
+         * Feature configurations, except the step counter word holding the self-clearing
+         * counter reset bit; self-test results, gyro self-calibration coefficients and I3C sync
+         * data are written by the feature engine
+         */
+        if (((addr >= BMI3_BASE_ADDR_AXIS_REMAP) && (addr < BMI3_BASE_ADDR_ST_RESULT) &&
+             (addr != BMI3_BASE_ADDR_STEP_CNT)) ||
+            ((addr >= BMI3_BASE_ADDR_ST_SELECT) && (addr < BMI3_BASE_ADDR_GYRO_SC_ST_COEFFICIENTS)) ||
+            (addr == BMI3_BASE_ADDR_I3C_SYNC))
+        {
+            cacheable = BMI3_TRUE;
+        }
+    }
+    else
+    {
+        /*
+         * Sensor, alternate, FIFO, interrupt, feature engine control, interface and I3C sync
+         * configuration; the offset and gain registers are updated by the self-calibration
+         */
+        if ((addr == BMI3_REG_ACC_CONF) || (addr == BMI3_REG_GYR_CONF) ||
+            ((addr >= BMI3_REG_ALT_ACC_CONF) && (addr <= BMI3_REG_ALT_CONF)) ||
+            (addr == BMI3_REG_FIFO_WATERMARK) || (addr == BMI3_REG_FIFO_CONF) ||
+            ((addr >= BMI3_REG_IO_INT_CTRL) && (addr <= BMI3_REG_INT_MAP2)) || (addr == BMI3_REG_FEATURE_CTRL) ||
+            ((addr >= BMI3_REG_IO_PDN_CTRL) && (addr <= BMI3_REG_IO_I2C_IF)) ||
+            ((addr >= BMI3_REG_I3C_TC_SYNC_TPH) && (addr <= BMI3_REG_I3C_TC_SYNC_ODR)))
+        {
+            cacheable = BMI3_TRUE;
+        }
+    }
+
+    return cacheable;
+}
+
+/*!
+ * @brief This internal API drops all entries of the shadow cache.
+ */
+static void shadow_invalidate(struct bmi3_shadow *shadow)
+{
+    /* Variable to define loop */
+    uint8_t index;
+
+    for (index = 0; index < (BMI3_SHADOW_NUM_REGS / 32); index++)
+    {
+        shadow->reg_valid[index] = 0;
+    }
+
+    for (index = 0; index < (BMI3_SHADOW_NUM_FEATURE_WORDS / 32); index++)
+    {
+        shadow->feature_valid[index] = 0;
+    }
+
+    shadow->feature_addr_valid = BMI3_FALSE;
+    shadow->port_addr_valid = BMI3_FALSE;
+}
+
+/*!
+ * @brief This internal API writes data to the given register address on the bus.
+ */
+static int8_t write_regs(uint8_t reg_addr, const uint8_t *data, uint16_t len, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Configuring reg_addr for SPI Interface */
+    if (dev->intf == BMI3_SPI_INTF)
+    {
+        reg_addr = (reg_addr & BMI3_SPI_WR_MASK);
+    }
+
+    dev->intf_rslt = dev->write(reg_addr, data, len, dev->intf_ptr);
+    dev->delay_us(2, dev->intf_ptr);
+
+    if (dev->intf_rslt != BMI3_INTF_RET_SUCCESS)
+    {
+        rslt = BMI3_E_COM_FAIL;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API records a register write in the transaction queue,
+ * merging it with the previous write where the device sees the same result.
+ */
+static int8_t queue_regs(uint8_t reg_addr, const uint8_t *data, uint16_t len, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Transaction queue */
+    struct bmi3_batch *batch = dev->batch;
+
+    /* Last queued write */
+    struct bmi3_batch_op *last = NULL;
+
+    /* Variable to store the feature engine address written */
+    uint16_t feature_addr;
+
+    /* Variable to define loop */
+    uint16_t index;
+
+    batch->write_count++;
+
+    if (batch->num_ops != 0)
+    {
+        last = &batch->op[batch->num_ops - 1];
+    }
+
+    if ((reg_addr == BMI3_REG_CMD) || (len > BMI3_BATCH_BUF_SIZE))
+    {
+        /* Commands act immediately, keep them in order with the queued writes */
+        rslt = flush_batch(dev);
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = write_regs(reg_addr, data, len, dev);
+        }
+    }
+    else if ((reg_addr == BMI3_REG_FEATURE_DATA_ADDR) && (len == 2) && (last != NULL) &&
+             (last->reg_addr == BMI3_REG_FEATURE_DATA_TX) && (batch->feature_addr_valid == BMI3_TRUE) &&
+             (batch->feature_addr == (uint16_t)(data[0] | ((uint16_t)data[1] << 8))))
+    {
+        /* The data port already points at this feature engine address */
+    }
+    else
+    {
+        if ((batch->data_len + len) > BMI3_BATCH_BUF_SIZE)
+        {
+            rslt = flush_batch(dev);
+            last = NULL;
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            /* Data port writes stream on, other registers continue at the next address */
+            if ((last != NULL) && (last->reg_addr == BMI3_REG_FEATURE_DATA_TX) &&
+                (reg_addr == BMI3_REG_FEATURE_DATA_TX))
+            {
+                last->len += len;
+            }
+            else if ((last != NULL) && (reg_addr != BMI3_REG_FEATURE_DATA_TX) &&
+                     (reg_addr != BMI3_REG_FEATURE_DATA_ADDR) && (last->reg_addr != BMI3_REG_FEATURE_DATA_TX) &&
+                     (last->reg_addr != BMI3_REG_FEATURE_DATA_ADDR) && ((last->len % 2) == 0) &&
+                     ((uint16_t)(last->reg_addr + (last->len / 2)) == reg_addr))
+            {
+                last->len += len;
+            }
+            else
+            {
+                if (batch->num_ops == BMI3_BATCH_MAX_OPS)
+                {
+                    rslt = flush_batch(dev);
+                }
+
+                if (rslt == BMI3_OK)
+                {
+                    batch->op[batch->num_ops].reg_addr = reg_addr;
+                    batch->op[batch->num_ops].offset = batch->data_len;
+                    batch->op[batch->num_ops].len = len;
+                    batch->num_ops++;
+                }
+            }
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            for (index = 0; index < len; index++)
+            {
+                batch->data[batch->data_len++] = data[index];
+            }
+
+            if ((reg_addr == BMI3_REG_FEATURE_DATA_ADDR) && (len == 2))
+            {
+                feature_addr = (uint16_t)(data[0] | ((uint16_t)data[1] << 8));
+                batch->feature_addr = feature_addr;
+                batch->feature_addr_valid = BMI3_TRUE;
+            }
+            else if (reg_addr == BMI3_REG_FEATURE_DATA_TX)
+            {
+                batch->feature_addr = (uint16_t)(batch->feature_addr + (len / 2));
+            }
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API writes out the transaction queue in bursts of at most
+ * dev->read_write_len bytes.
+ */
+static int8_t flush_batch(struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Transaction queue */
+    struct bmi3_batch *batch = dev->batch;
+
+    /* Variables to store the burst length and bytes written of a queued write */
+    uint16_t burst, done;
+
+    /* Variable to define loop */
+    uint8_t loop;
+
+    for (loop = 0; (rslt == BMI3_OK) && (loop < batch->num_ops); loop++)
+    {
+        for (done = 0; (rslt == BMI3_OK) && (done < batch->op[loop].len); done += burst)
+        {
+            burst = (uint16_t)(batch->op[loop].len - done);
+
+            /* Keep bursts word aligned within the user set read/write length */
+            if ((dev->read_write_len >= 2) && (burst > dev->read_write_len))
+            {
+                burst = (uint16_t)(dev->read_write_len & (uint16_t)~1U);
+            }
+
+            if (batch->op[loop].reg_addr == BMI3_REG_FEATURE_DATA_TX)
+            {
+                rslt = write_regs(batch->op[loop].reg_addr, &batch->data[batch->op[loop].offset + done], burst, dev);
+            }
+            else
+            {
+                rslt = write_regs((uint8_t)(batch->op[loop].reg_addr + (done / 2)),
+                                  &batch->data[batch->op[loop].offset + done],
+                                  burst,
+                                  dev);
+            }
+
+            batch->burst_count++;
+        }
+    }
+
+    /* On failure the queue is kept and written again from the start by the next flush */
+    if (rslt == BMI3_OK)
+    {
+        batch->num_ops = 0;
+        batch->data_len = 0;
+        batch->feature_addr_valid = BMI3_FALSE;
+    }
+    else if (dev->shadow != NULL)
+    {
+        /* The shadow cache was written through ahead of the failed bus write */
+        shadow_invalidate(dev->shadow);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API writes out the queued register writes before waiting, so that the
+ * device acts on them during the delay rather than after it.
+ */
+static void flush_and_delay(uint32_t period, struct bmi3_dev *dev)
+{
+    if ((dev->batch != NULL) && (dev->batch->num_ops != 0))
+    {
+        /* A failed write stays queued and is reported by the register access after the delay */
+        (void)flush_batch(dev);
+    }
+
+    dev->delay_us(period, dev->intf_ptr);
+}
+
+/*!
+ * @brief This internal API is used to get the enabled feature.
+ */
+static int8_t get_feature_enable(struct bmi3_feature_enable *enable, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    uint8_t feature[2];
+    uint8_t reg_data;
+    uint16_t feature_config;
+
+    if (enable != NULL)
+    {
+        rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO0, feature, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            reg_data = feature[0];
+            enable->no_motion_x_en = BMI3_GET_BIT_POS0(reg_data, BMI3_NO_MOTION_X_EN);
+            enable->no_motion_y_en = BMI3_GET_BITS(reg_data, BMI3_NO_MOTION_Y_EN);
+            enable->no_motion_z_en = BMI3_GET_BITS(reg_data, BMI3_NO_MOTION_Z_EN);
+            enable->any_motion_x_en = BMI3_GET_BITS(reg_data, BMI3_ANY_MOTION_X_EN);
+            enable->any_motion_y_en = BMI3_GET_BITS(reg_data, BMI3_ANY_MOTION_Y_EN);
+            enable->any_motion_z_en = BMI3_GET_BITS(reg_data, BMI3_ANY_MOTION_Z_EN);
+            enable->flat_en = BMI3_GET_BITS(reg_data, BMI3_FLAT_EN);
+            enable->orientation_en = BMI3_GET_BITS(reg_data, BMI3_ORIENTATION_EN);
+
+            feature_config = (uint16_t)feature[1] << 8;
+
+            enable->step_detector_en = BMI3_GET_BITS(feature_config, BMI3_STEP_DETECTOR_EN);
+            enable->step_counter_en = BMI3_GET_BITS(feature_config, BMI3_STEP_COUNTER_EN);
+            enable->sig_motion_en = BMI3_GET_BITS(feature_config, BMI3_SIG_MOTION_EN);
+            enable->tilt_en = BMI3_GET_BITS(feature_config, BMI3_TILT_EN);
+            enable->tap_detector_s_tap_en = BMI3_GET_BITS(feature_config, BMI3_TAP_DETECTOR_S_TAP_EN);
+            enable->tap_detector_d_tap_en = BMI3_GET_BITS(feature_config, BMI3_TAP_DETECTOR_D_TAP_EN);
+            enable->tap_detector_t_tap_en = BMI3_GET_BITS(feature_config, BMI3_TAP_DETECTOR_T_TAP_EN);
+            enable->i3c_sync_en = BMI3_GET_BITS(feature_config, BMI3_I3C_SYNC_EN);
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API is used to set the feature.
+ */
+static int8_t set_feature_enable(const struct bmi3_feature_enable *enable, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    uint8_t feature[2] = { 0 };
+    uint8_t get_feature[2];
+
+    uint16_t no_motion_x_en;
+    uint16_t no_motion_y_en;
+    uint16_t no_motion_z_en;
+    uint16_t any_motion_x_en;
+    uint16_t any_motion_y_en;
+    uint16_t any_motion_z_en;
+    uint16_t flat_en;
+    uint16_t orientation_en;
+    uint16_t step_detector_en;
+    uint16_t step_counter_en;
+    uint16_t sig_motion_en;
+    uint16_t tilt_en;
+    uint16_t tap_detector_s_tap_en;
+    uint16_t tap_detector_d_tap_en;
+    uint16_t tap_detector_t_tap_en;
+    uint16_t i3c_sync_en;
+
+    /* Array variable to clear feature before enabling into register */
+    uint8_t reset[2] = { 0 };
+
+    /* Array to set feature_engine_gp_status in order to enable the feature */
+    uint8_t gp_status[2] = { 1, 0 };
+
+    if (enable != NULL)
+    {
+        rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO0, get_feature, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            no_motion_x_en =
+                (BMI3_SET_BIT_POS0(get_feature[0], BMI3_NO_MOTION_X_EN,
+                                   enable->no_motion_x_en) & BMI3_NO_MOTION_X_EN_MASK);
+            no_motion_y_en =
+                (BMI3_SET_BITS(get_feature[0], BMI3_NO_MOTION_Y_EN, enable->no_motion_y_en) & BMI3_NO_MOTION_Y_EN_MASK);
+            no_motion_z_en =
+                (BMI3_SET_BITS(get_feature[0], BMI3_NO_MOTION_Z_EN, enable->no_motion_z_en) & BMI3_NO_MOTION_Z_EN_MASK);
+            any_motion_x_en =
+                (BMI3_SET_BITS(get_feature[0], BMI3_ANY_MOTION_X_EN,
+                               enable->any_motion_x_en) & BMI3_ANY_MOTION_X_EN_MASK);
+            any_motion_y_en =
+                (BMI3_SET_BITS(get_feature[0], BMI3_ANY_MOTION_Y_EN,
+                               enable->any_motion_y_en) & BMI3_ANY_MOTION_Y_EN_MASK);
+            any_motion_z_en =
+                (BMI3_SET_BITS(get_feature[0], BMI3_ANY_MOTION_Z_EN,
+                               enable->any_motion_z_en) & BMI3_ANY_MOTION_Z_EN_MASK);
+            flat_en = (BMI3_SET_BITS(get_feature[0], BMI3_FLAT_EN, enable->flat_en) & BMI3_FLAT_EN_MASK);
+            orientation_en =
+                (BMI3_SET_BITS(get_feature[0], BMI3_ORIENTATION_EN, enable->orientation_en) & BMI3_ORIENTATION_EN_MASK);
+
+            step_detector_en =
+                (BMI3_SET_BITS(get_feature[1], BMI3_STEP_DETECTOR_EN,
+                               enable->step_detector_en) & BMI3_STEP_DETECTOR_EN_MASK);
+            step_counter_en =
+                (BMI3_SET_BITS(get_feature[1], BMI3_STEP_COUNTER_EN,
+                               enable->step_counter_en) & BMI3_STEP_COUNTER_EN_MASK);
+            sig_motion_en =
+                (BMI3_SET_BITS(get_feature[1], BMI3_SIG_MOTION_EN, enable->sig_motion_en) & BMI3_SIG_MOTION_EN_MASK);
+            tilt_en = (BMI3_SET_BITS(get_feature[1], BMI3_TILT_EN, enable->tilt_en) & BMI3_TILT_EN_MASK);
+            tap_detector_s_tap_en =
+                (BMI3_SET_BITS(get_feature[1], BMI3_TAP_DETECTOR_S_TAP_EN,
+                               enable->tap_detector_s_tap_en) & BMI3_TAP_DETECTOR_S_TAP_EN_MASK);
+            tap_detector_d_tap_en =
+                (BMI3_SET_BITS(get_feature[1], BMI3_TAP_DETECTOR_D_TAP_EN,
+                               enable->tap_detector_d_tap_en) & BMI3_TAP_DETECTOR_D_TAP_EN_MASK);
+            tap_detector_t_tap_en =
+                (BMI3_SET_BITS(get_feature[1], BMI3_TAP_DETECTOR_T_TAP_EN,
+                               enable->tap_detector_t_tap_en) & BMI3_TAP_DETECTOR_T_TAP_EN_MASK);
+            i3c_sync_en =
+                (BMI3_SET_BITS(get_feature[1], BMI3_I3C_SYNC_EN, enable->i3c_sync_en) & BMI3_I3C_SYNC_EN_MASK);
+
+            feature[0] =
+                (uint8_t)(no_motion_x_en | no_motion_y_en | no_motion_z_en | any_motion_x_en | any_motion_y_en |
+                          any_motion_z_en | flat_en | orientation_en);
+            feature[1] =
+                (uint8_t)((step_detector_en | step_counter_en | sig_motion_en | tilt_en | tap_detector_s_tap_en |
+                           tap_detector_d_tap_en | tap_detector_t_tap_en | i3c_sync_en) >> 8);
+
+            /* Reset the register before updating new values */
+            rslt = bmi3_set_regs(BMI3_REG_FEATURE_IO0, reset, 2, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                rslt = bmi3_set_regs(BMI3_REG_FEATURE_IO0, feature, 2, dev);
+            }
+
+            if (rslt == BMI3_OK)
+            {
+                rslt = bmi3_set_regs(BMI3_REG_FEATURE_IO_STATUS, gp_status, 2, dev);
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API reads the words of a feature and unpacks its fields into the configuration structure.
+ */
+static int8_t get_feature_config(uint8_t first_field, uint8_t end_field, void *config, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to store the words of the feature */
+    uint16_t words[BMI3_FEATURE_CONFIG_WORDS] = { 0 };
+
+    /* Pointer to the field descriptor */
+    const struct bmi3_feature_field *field;
+
+    /* Pointer to the field in the configuration structure */
+    uint8_t *member;
+
+    /* Variable to store the value of a field */
+    uint16_t value;
+
+    /* Variable to define loop */
+    uint8_t idx;
+
+    if (config != NULL)
+    {
+        /* The fields of a feature are ordered by word, so the last field gives the number of words */
+        rslt = bmi3_get_feature_words(bmi3_feature_fields[first_field].base_addr,
+                                      words,
+                                      (uint8_t)(bmi3_feature_fields[end_field - 1].word + 1),
+                                      dev);
+
+        for (idx = first_field; (rslt == BMI3_OK) && (idx < end_field); idx++)
+        {
+            field = &bmi3_feature_fields[idx];
+            value = (uint16_t)((words[field->word] & field->mask) >> field->pos);
+            member = (uint8_t *)config + field->offset;
+
+            if (field->size == 1)
+            {
+                *member = (uint8_t)value;
+            }
+            else
+            {
+                *(uint16_t *)(void *)member = value;
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API packs the fields of a configuration structure into the words of a feature
+ * and writes them.
+ */
+static int8_t set_feature_config(uint8_t first_field, uint8_t end_field, const void *config, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to store the words of the feature, reserved bits are written as zero */
+    uint16_t words[BMI3_FEATURE_CONFIG_WORDS] = { 0 };
+
+    /* Pointer to the field descriptor */
+    const struct bmi3_feature_field *field;
+
+    /* Pointer to the field in the configuration structure */
+    const uint8_t *member;
+
+    /* Variable to store the value of a field */
+    uint16_t value;
+
+    /* Variable to define loop */
+    uint8_t idx;
+
+    if (config != NULL)
+    {
+        for (idx = first_field; idx < end_field; idx++)
+        {
+            field = &bmi3_feature_fields[idx];
+            member = (const uint8_t *)config + field->offset;
+
+            if (field->size == 1)
+            {
+                value = *member;
+            }
+            else
+            {
+                value = *(const uint16_t *)(const void *)member;
+            }
+
+            words[field->word] |= (uint16_t)((value << field->pos) & field->mask);
+        }
+
+        rslt = bmi3_set_feature_words(bmi3_feature_fields[first_field].base_addr,
+                                      words,
+                                      (uint8_t)(bmi3_feature_fields[end_field - 1].word + 1),
+                                      dev);
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API gets the bits of a feature engine word that are covered by the fields.
+ */
+static uint16_t feature_word_mask(uint8_t addr)
+{
+    /* Variable to store the mask */
+    uint16_t mask = 0;
+
+    /* Variable to define loop */
+    uint8_t idx;
+
+    for (idx = 0; idx < BMI3_FIELD_MAX; idx++)
+    {
+        if ((uint8_t)(bmi3_feature_fields[idx].base_addr + bmi3_feature_fields[idx].word) == addr)
+        {
+            mask |= bmi3_feature_fields[idx].mask;
+        }
+    }
+
+    return mask;
+}
+
+/*!
+ * @brief This internal API validates a list of fields and gets the range of feature engine words they span.
+ */
+static int8_t get_field_span(const uint8_t *field_id, uint8_t n_fields, uint8_t *first_addr, uint8_t *num_words)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variables to store the first and the last word address */
+    uint8_t lo = UINT8_C(0xFF), hi = 0;
+
+    /* Variable to store the word address of a field */
+    uint8_t addr;
+
+    /* Variable to define loop */
+    uint8_t idx;
+
+    if (n_fields == 0)
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+
+    for (idx = 0; (rslt == BMI3_OK) && (idx < n_fields); idx++)
+    {
+        if (field_id[idx] >= BMI3_FIELD_MAX)
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+        else
+        {
+            addr = (uint8_t)(bmi3_feature_fields[field_id[idx]].base_addr + bmi3_feature_fields[field_id[idx]].word);
+
+            if (addr < lo)
+            {
+                lo = addr;
+            }
+
+            if (addr > hi)
+            {
+                hi = addr;
+            }
+        }
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        *first_addr = lo;
+        *num_words = (uint8_t)(hi - lo + 1);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API gets the latch mode from register address
+ */
+static int8_t get_latch_mode(struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to define data array */
+    uint8_t data_array[2] = { 0 };
+
+    if (int_cfg != NULL)
+    {
+        rslt = bmi3_get_regs(BMI3_REG_INT_CONF, data_array, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            int_cfg->int_latch = BMI3_GET_BIT_POS0(data_array[0], BMI3_INT_LATCH);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API sets the latch mode to register address
+ */
+static int8_t set_latch_mode(const struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to define data array */
+    uint8_t data_array[2] = { 0 };
+
+    if (int_cfg != NULL)
+    {
+        rslt = bmi3_get_regs(BMI3_REG_INT_CONF, data_array, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Configure the interrupt mode */
+            data_array[0] = BMI3_SET_BIT_POS0(data_array[0], BMI3_INT_LATCH, int_cfg->int_latch);
+
+            rslt = bmi3_set_regs(BMI3_REG_INT_CONF, data_array, 2, dev);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API is used to update data index based on the frame length
+ */
+static void update_data_index(uint16_t *idx, uint16_t *updated_frm_idx, uint8_t len, int8_t rslt)
+{
+    /* Update data index */
+    (*idx) = (*idx) + len;
+
+    if (rslt == 0 || rslt == BMI3_W_ST_PARTIAL_READ)
+    {
+        /* Update accelerometer, gyro and temperature frame index */
+        (*updated_frm_idx)++;
+    }
+}
+
+/*!
+ * @brief This internal API is used to parse the accelerometer, gyroscope and temperature data from the
+ * FIFO data. It updates the current data byte to be parsed.
+ */
 static int8_t unpack_fifo_data_frame(void *fifo_data,
                                      uint16_t *idx,
                                      uint16_t *updated_frm_idx,
@@ -6903,174 +9069,1515 @@ static int8_t unpack_fifo_data_frame(void *fifo_data,
                                      const struct bmi3_fifo_frame *fifo)
 {
     /* Variable to store result of API */
-    int8_t rslt = BMI3_OK;
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to store fifo available length in bytes */
+    uint16_t fifo_available_len_in_bytes;
+
+    struct bmi3_fifo_temperature_data *fifo_temp_data = (struct bmi3_fifo_temperature_data *)fifo_data;
+    struct bmi3_fifo_sens_axes_data *fifo_gyr_data = (struct bmi3_fifo_sens_axes_data *)fifo_data;
+    struct bmi3_fifo_sens_axes_data *fifo_acc_data = (struct bmi3_fifo_sens_axes_data *)fifo_data;
+
+    /* Convert available fifo length from word to byte */
+    fifo_available_len_in_bytes = (uint16_t)(fifo->available_fifo_len * 2);
+
+    switch (frame)
+    {
+        /* If frame contains only accelerometer data */
+        case BMI3_FIFO_HEAD_LESS_ACC_FRM:
+
+            /* Get the accelerometer data */
+            rslt = unpack_accel_data(&fifo_acc_data[(*updated_frm_idx)], *idx, fifo);
+
+            if (rslt == 0 || rslt == BMI3_W_FIFO_ACCEL_DUMMY_FRAME || rslt == BMI3_W_ST_PARTIAL_READ)
+            {
+                update_data_index(idx, updated_frm_idx, BMI3_LENGTH_FIFO_ACC, rslt);
+            }
+            else if (rslt == BMI3_W_PARTIAL_READ)
+            {
+                /* Since partial occur making data start index to FIFO available length
+                 * to end of the loop */
+                *idx = fifo_available_len_in_bytes;
+            }
+
+            break;
+
+        /* If frame contains gyro frame */
+        case BMI3_FIFO_HEAD_LESS_GYR_FRM:
+
+            /* Get the gyro data */
+            rslt = unpack_gyro_data(&fifo_gyr_data[(*updated_frm_idx)], *idx, fifo);
+
+            if (rslt == 0 || rslt == BMI3_W_FIFO_GYRO_DUMMY_FRAME || rslt == BMI3_W_ST_PARTIAL_READ)
+            {
+                update_data_index(idx, updated_frm_idx, BMI3_LENGTH_FIFO_GYR, rslt);
+            }
+            else if (rslt == BMI3_W_PARTIAL_READ)
+            {
+                /* Since partial occur making data start index to FIFO available length
+                 * to end of the loop */
+                *idx = fifo_available_len_in_bytes;
+            }
+
+            break;
+
+        /* If frame contains temperature frame */
+        case BMI3_FIFO_HEAD_LESS_TEMP_FRM:
+
+            /* Get the temperature data */
+            rslt = unpack_temperature_data(&fifo_temp_data[(*updated_frm_idx)], *idx, fifo);
+
+            if (rslt == BMI3_OK || rslt == BMI3_W_FIFO_TEMP_DUMMY_FRAME || rslt == BMI3_W_ST_PARTIAL_READ)
+            {
+                update_data_index(idx, updated_frm_idx, BMI3_LENGTH_TEMPERATURE, rslt);
+            }
+            else if (rslt == BMI3_W_PARTIAL_READ)
+            {
+                /* Since partial occur making data start index to FIFO available length
+                 * to end of the loop */
+                *idx = fifo_available_len_in_bytes;
+            }
+
+            break;
+
+        default:
+            rslt = BMI3_W_FIFO_INVALID_FRAME;
+
+            break;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API is used to parse accelerometer data from the
+ * FIFO data.
+ */
+static int8_t unpack_accel_data(struct bmi3_fifo_sens_axes_data *acc,
+                                uint16_t data_start_index,
+                                const struct bmi3_fifo_frame *fifo)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to store the sensor time index value */
+    uint16_t sens_time_data_idx;
+
+    /* Variable to store LSB value */
+    uint16_t data_lsb;
+
+    /* Variables to store MSB value */
+    uint16_t data_msb;
+
+    /* Variable to store dummy data value which will get in FIFO data */
+    uint16_t dummy_data;
+
+    /* Variable to store fifo available length in bytes */
+    uint16_t fifo_available_len_in_bytes;
+
+    /* Convert available fifo length from word to byte */
+    fifo_available_len_in_bytes = (uint16_t)(fifo->available_fifo_len * 2);
+
+    if ((data_start_index + BMI3_LENGTH_FIFO_ACC) <= fifo_available_len_in_bytes)
+    {
+        /* Accelerometer raw x data */
+        data_lsb = fifo->data[data_start_index++];
+        data_msb = fifo->data[data_start_index++];
+
+        /* To store the dummy data */
+        dummy_data = (uint16_t)(((uint16_t)data_msb << 8) | data_lsb);
+
+        if (dummy_data != BMI3_FIFO_ACCEL_DUMMY_FRAME)
+        {
+            acc->x = (int16_t)(((uint16_t)data_msb << 8) | data_lsb);
+
+            /* Accelerometer raw y data */
+            data_lsb = fifo->data[data_start_index++];
+            data_msb = fifo->data[data_start_index++];
+            acc->y = (int16_t)(((uint16_t)data_msb << 8) | data_lsb);
+
+            /* Accelerometer raw z data */
+            data_lsb = fifo->data[data_start_index++];
+            data_msb = fifo->data[data_start_index++];
+            acc->z = (int16_t)(((uint16_t)data_msb << 8) | data_lsb);
+        }
+        else
+        {
+            rslt = BMI3_W_FIFO_ACCEL_DUMMY_FRAME;
+        }
+    }
+    else
+    {
+        rslt = BMI3_W_PARTIAL_READ;
+    }
+
+    sens_time_data_idx = data_start_index;
+    acc->sensor_time = 0;
+
+    if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
+    {
+        if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_GYR_FRM)
+        {
+            sens_time_data_idx = sens_time_data_idx + BMI3_LENGTH_FIFO_GYR;
+        }
+
+        if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_TEMP_FRM)
+        {
+            sens_time_data_idx = sens_time_data_idx + BMI3_LENGTH_TEMPERATURE;
+        }
+
+        if ((sens_time_data_idx + BMI3_LENGTH_SENSOR_TIME) <= fifo_available_len_in_bytes)
+        {
+            /* Sensor time raw data */
+            data_lsb = fifo->data[sens_time_data_idx++];
+            data_msb = fifo->data[sens_time_data_idx++];
+
+            acc->sensor_time = (uint16_t)(((uint16_t)data_msb << 8) | data_lsb);
+        }
+        else
+        {
+            rslt = BMI3_W_ST_PARTIAL_READ;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API is used to parse temperature data from the
+ * FIFO data.
+ */
+static int8_t unpack_temperature_data(struct bmi3_fifo_temperature_data *temp,
+                                      uint16_t data_start_index,
+                                      const struct bmi3_fifo_frame *fifo)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to store the sensor time index value */
+    uint16_t sens_time_data_idx;
+
+    /* Variables to store LSB value */
+    uint16_t data_lsb;
+
+    /* Variables to store MSB value */
+    uint16_t data_msb;
+
+    /* Variable to store dummy data value which will get in FIFO data */
+    uint16_t dummy_data;
+
+    /* Variable to store fifo available length in bytes */
+    uint16_t fifo_available_len_in_bytes;
+
+    /* Convert available fifo length from word to byte */
+    fifo_available_len_in_bytes = (uint16_t)(fifo->available_fifo_len * 2);
+
+    if ((data_start_index + BMI3_LENGTH_TEMPERATURE) <= fifo_available_len_in_bytes)
+    {
+        /* Temperature raw data */
+        data_lsb = fifo->data[data_start_index++];
+        data_msb = fifo->data[data_start_index++];
+
+        /* To store the dummy data */
+        dummy_data = (uint16_t)(((uint16_t)data_msb << 8) | data_lsb);
+
+        temp->temp_data = (uint16_t)(((uint16_t)data_msb << 8) | data_lsb);
+
+        if (dummy_data != BMI3_FIFO_TEMP_DUMMY_FRAME)
+        {
+            temp->temp_data = (uint16_t)(((uint16_t)data_msb << 8) | data_lsb);
+        }
+        else
+        {
+            rslt = BMI3_W_FIFO_TEMP_DUMMY_FRAME;
+        }
+    }
+    else
+    {
+        rslt = BMI3_W_PARTIAL_READ;
+    }
+
+    sens_time_data_idx = data_start_index;
+    temp->sensor_time = 0;
+
+    if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
+    {
+        if ((sens_time_data_idx + BMI3_LENGTH_SENSOR_TIME) <= fifo_available_len_in_bytes)
+        {
+            /* Sensor time raw data */
+            data_lsb = fifo->data[sens_time_data_idx++];
+            data_msb = fifo->data[sens_time_data_idx++];
+            temp->sensor_time = (uint16_t)(((uint16_t)data_msb << 8) | data_lsb);
+        }
+        else
+        {
+            rslt = BMI3_W_ST_PARTIAL_READ;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API is used to parse gyro data from the
+ * FIFO data.
+ */
+static int8_t unpack_gyro_data(struct bmi3_fifo_sens_axes_data *gyro,
+                               uint16_t data_start_index,
+                               const struct bmi3_fifo_frame *fifo)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to store the sensor time index value */
+    uint16_t sens_time_data_idx;
+
+    /* Variables to store LSB value */
+    uint16_t data_lsb;
+
+    /* Variables to store MSB value */
+    uint16_t data_msb;
+
+    /* Variable to store dummy data value which will get in FIFO data */
+    uint16_t dummy_data;
+
+    /* Variable to store fifo available length in bytes */
+    uint16_t fifo_available_len_in_bytes;
+
+    /* Convert available fifo length from word to byte */
+    fifo_available_len_in_bytes = (uint16_t)(fifo->available_fifo_len * 2);
+
+    if ((data_start_index + BMI3_LENGTH_FIFO_GYR) <= fifo_available_len_in_bytes)
+    {
+        /* Gyro raw x data */
+        data_lsb = fifo->data[data_start_index++];
+        data_msb = fifo->data[data_start_index++];
+
+        /* To store the dummy data */
+        dummy_data = (uint16_t)(((uint16_t)data_msb << 8) | data_lsb);
+
+        gyro->x = (int16_t)(((uint16_t)data_msb << 8) | data_lsb);
+
+        /* Gyro raw y data */
+        data_lsb = fifo->data[data_start_index++];
+        data_msb = fifo->data[data_start_index++];
+        gyro->y = (int16_t)(((uint16_t)data_msb << 8) | data_lsb);
+
+        /* Gyro raw z data */
+        data_lsb = fifo->data[data_start_index++];
+        data_msb = fifo->data[data_start_index++];
+        gyro->z = (int16_t)(((uint16_t)data_msb << 8) | data_lsb);
+
+        if (dummy_data == BMI3_FIFO_GYRO_DUMMY_FRAME)
+        {
+            rslt = BMI3_W_FIFO_GYRO_DUMMY_FRAME;
+        }
+    }
+    else
+    {
+        rslt = BMI3_W_PARTIAL_READ;
+    }
+
+    sens_time_data_idx = data_start_index;
+    gyro->sensor_time = 0;
+
+    if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
+    {
+        if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_TEMP_FRM)
+        {
+            sens_time_data_idx = sens_time_data_idx + BMI3_LENGTH_TEMPERATURE;
+        }
+
+        if ((sens_time_data_idx + BMI3_LENGTH_SENSOR_TIME) <= fifo_available_len_in_bytes)
+        {
+            /* Sensor time raw data */
+            data_lsb = fifo->data[sens_time_data_idx++];
+            data_msb = fifo->data[sens_time_data_idx++];
+            gyro->sensor_time = (uint16_t)(((uint16_t)data_msb << 8) | data_lsb);
+        }
+        else
+        {
+            rslt = BMI3_W_ST_PARTIAL_READ;
+        }
+    }
+
+    return rslt;
+}
+
+#ifndef BMI3_SELF_TEST_DISABLE
+/*!
+ * @brief This internal API sets the precondition settings such as alternate accelerometer and
+ * gyroscope enable bits, accelerometer mode and output data rate.
+ */
+static int8_t st_precondition(uint8_t st_select, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Structure instance of sensor config */
+    struct bmi3_sens_config config = { 0 };
+
+    config.type = BMI3_ACCEL;
+
+    rslt = bmi3_get_sensor_config(&config, 1, dev);
+
+    if (rslt == BMI3_OK)
+    {
+        switch (st_select)
+        {
+            case BMI3_ST_ACCEL_ONLY:
+                rslt = BMI3_OK;
+                break;
+            case BMI3_ST_GYRO_ONLY:
+            case BMI3_ST_BOTH_ACC_GYR:
+                rslt = BMI3_OK;
+                config.cfg.acc.acc_mode = BMI3_ACC_MODE_HIGH_PERF;
+                config.cfg.acc.odr = BMI3_ACC_ODR_100HZ;
+                break;
+            default:
+                rslt = BMI3_E_INVALID_ST_SELECTION;
+                break;
+        }
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_set_sensor_config(&config, 1, dev);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API gets and sets the self-test mode given
+ *  by the user in the self-test dma register.
+ */
+static int8_t get_set_st_dma(uint8_t st_selection, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    uint8_t reg_data[2];
+
+    /* Array to set the base address of self-test feature */
+    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ST_SELECT, 0 };
+
+    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, 2, dev);
+
+        reg_data[0] = st_selection;
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, 2, dev);
+            }
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API sets the self-test preconditions and triggers the self-test in the command register.
+ */
+static int8_t self_test_conditions(uint8_t st_selection, struct bmi3_dev *dev)
+{
+    int8_t rslt;
+
+    /* Pre conditions to be checked */
+    rslt = st_precondition(st_selection, dev);
+
+    if (rslt == BMI3_OK)
+    {
+        /* Disable alternate accel and gyro mode */
+        rslt = disable_alt_conf_acc_gyr_mode(dev);
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = bmi3_set_command_register(BMI3_CMD_SELF_TEST_TRIGGER, dev);
+        }
+    }
+
+    return rslt;
+}
+#endif
+
+/*!
+ * @brief This internal API is used to disable alternate config accel and gyro mode for self-test precondition.
+ */
+static int8_t disable_alt_conf_acc_gyr_mode(struct bmi3_dev *dev)
+{
+    int8_t rslt;
+
+    struct bmi3_alt_accel_config alt_acc_cfg;
+
+    struct bmi3_alt_gyro_config alt_gyr_cfg;
+
+    rslt = get_alternate_accel_config(&alt_acc_cfg, dev);
+
+    if (rslt == BMI3_OK)
+    {
+        alt_acc_cfg.alt_acc_mode = BMI3_DISABLE;
+
+        rslt = set_alternate_accel_config(&alt_acc_cfg, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = get_alternate_gyro_config(&alt_gyr_cfg, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                alt_gyr_cfg.alt_gyro_mode = BMI3_DISABLE;
+
+                rslt = set_alternate_gyro_config(&alt_gyr_cfg, dev);
+            }
+        }
+    }
+
+    return rslt;
+}
+
+#ifndef BMI3_SELF_TEST_DISABLE
+/*!
+ * @brief This internal API is used to get the status of gyro self-test and the result of the event.
+ */
+static int8_t get_st_status_rslt(uint8_t st_selection, struct bmi3_st_result *st_result_status, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to define index */
+    uint8_t idx;
+
+    /* Variable to define the number of iterations */
+    uint8_t limit = BMI3_ST_POLL_LIMIT;
+
+    /* Variable to store the self-test completion */
+    uint8_t done = BMI3_FALSE;
+
+    st_result_status->self_test_err_rslt = 0;
+
+    for (idx = 0; (idx < limit) && (done == BMI3_FALSE); idx++)
+    {
+        /* A delay of 120ms is required to read the error status register */
+        flush_and_delay(BMI3_ST_POLL_DELAY_US, dev);
+
+        rslt = check_st_status(st_selection, st_result_status, &done, dev);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API reads the self-test status once and, if the self-test is
+ * complete, its result.
+ */
+static int8_t check_st_status(uint8_t st_selection,
+                              struct bmi3_st_result *st_result_status,
+                              uint8_t *done,
+                              struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to define data array */
+    uint8_t data_array[2];
+
+    /* Variable to define reg data */
+    uint8_t reg_data[2];
+
+    /* Variable to store the self-test status if it is ongoing or completed */
+    uint8_t st_status;
+
+    /* Variable to define feature engine errors */
+    uint8_t feature_engine_err_reg_lsb = 0, feature_engine_err_reg_msb = 0;
+
+    /* Array to set the base address of self-test feature */
+    uint8_t sc_st_base_addr[2] = { BMI3_BASE_ADDR_ST_RESULT, 0 };
+
+    rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO1, data_array, 2, dev);
+
+    if (rslt == BMI3_OK)
+    {
+        st_status = (data_array[0] & BMI3_SC_ST_STATUS_MASK) >> BMI3_SC_ST_COMPLETE_POS;
+
+        if (st_status == BMI3_TRUE)
+        {
+            st_result_status->self_test_rslt = (data_array[0] & BMI3_ST_RESULT_MASK) >> BMI3_ST_RESULT_POS;
+
+            if (st_result_status->self_test_rslt != BMI3_TRUE)
+            {
+                rslt = bmi3_get_feature_engine_error_status(&feature_engine_err_reg_lsb,
+                                                            &feature_engine_err_reg_msb,
+                                                            dev);
+                st_result_status->self_test_err_rslt = feature_engine_err_reg_lsb & BMI3_SET_LOW_NIBBLE;
+            }
+            else
+            {
+                rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, sc_st_base_addr, 2, dev);
+
+                if (rslt == BMI3_OK)
+                {
+                    rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, 2, dev);
+
+                    if ((rslt == BMI3_OK) && (st_selection == BMI3_ST_ACCEL_ONLY))
+                    {
+                        st_result_status->acc_sens_x_ok = reg_data[0] & BMI3_ST_ACC_X_OK_MASK;
+                        st_result_status->acc_sens_y_ok = (reg_data[0] & BMI3_ST_ACC_Y_OK_MASK) >>
+                                                          BMI3_ST_ACC_Y_OK_POS;
+                        st_result_status->acc_sens_z_ok = (reg_data[0] & BMI3_ST_ACC_Z_OK_MASK) >>
+                                                          BMI3_ST_ACC_Z_OK_POS;
+
+                        st_result_status->gyr_sens_x_ok = BMI3_DISABLE;
+                        st_result_status->gyr_sens_y_ok = BMI3_DISABLE;
+                        st_result_status->gyr_sens_z_ok = BMI3_DISABLE;
+                        st_result_status->gyr_drive_ok = BMI3_DISABLE;
+                    }
+
+                    if ((rslt == BMI3_OK) && (st_selection == BMI3_ST_GYRO_ONLY))
+                    {
+                        st_result_status->acc_sens_x_ok = BMI3_DISABLE;
+                        st_result_status->acc_sens_y_ok = BMI3_DISABLE;
+                        st_result_status->acc_sens_z_ok = BMI3_DISABLE;
+
+                        st_result_status->gyr_sens_x_ok = (reg_data[0] & BMI3_ST_GYR_X_OK_MASK) >>
+                                                          BMI3_ST_GYR_X_OK_POS;
+                        st_result_status->gyr_sens_y_ok = (reg_data[0] & BMI3_ST_GYR_Y_OK_MASK) >>
+                                                          BMI3_ST_GYR_Y_OK_POS;
+                        st_result_status->gyr_sens_z_ok = (reg_data[0] & BMI3_ST_GYR_Z_OK_MASK) >>
+                                                          BMI3_ST_GYR_Z_OK_POS;
+                        st_result_status->gyr_drive_ok = (reg_data[0] & BMI3_ST_GYR_DRIVE_OK_MASK) >>
+                                                         BMI3_ST_GYR_DRIVE_OK_POS;
+                    }
+
+                    if ((rslt == BMI3_OK) && (st_selection == BMI3_ST_BOTH_ACC_GYR))
+                    {
+                        st_result_status->acc_sens_x_ok = reg_data[0] & BMI3_ST_ACC_X_OK_MASK;
+                        st_result_status->acc_sens_y_ok = (reg_data[0] & BMI3_ST_ACC_Y_OK_MASK) >>
+                                                          BMI3_ST_ACC_Y_OK_POS;
+                        st_result_status->acc_sens_z_ok = (reg_data[0] & BMI3_ST_ACC_Z_OK_MASK) >>
+                                                          BMI3_ST_ACC_Z_OK_POS;
+
+                        st_result_status->gyr_sens_x_ok = (reg_data[0] & BMI3_ST_GYR_X_OK_MASK) >>
+                                                          BMI3_ST_GYR_X_OK_POS;
+                        st_result_status->gyr_sens_y_ok = (reg_data[0] & BMI3_ST_GYR_Y_OK_MASK) >>
+                                                          BMI3_ST_GYR_Y_OK_POS;
+                        st_result_status->gyr_sens_z_ok = (reg_data[0] & BMI3_ST_GYR_Z_OK_MASK) >>
+                                                          BMI3_ST_GYR_Z_OK_POS;
+                        st_result_status->gyr_drive_ok = (reg_data[0] & BMI3_ST_GYR_DRIVE_OK_MASK) >>
+                                                         BMI3_ST_GYR_DRIVE_OK_POS;
+                    }
+                }
+            }
+
+            *done = BMI3_TRUE;
+        }
+        else
+        {
+            /* If limit elapses returning the error code, error status is returned */
+            rslt = bmi3_get_feature_engine_error_status(&feature_engine_err_reg_lsb,
+                                                        &feature_engine_err_reg_msb,
+                                                        dev);
+            st_result_status->self_test_err_rslt = feature_engine_err_reg_lsb;
+
+            /* Checking the condition where the error status is no error */
+            if ((st_result_status->self_test_err_rslt & BMI3_SET_LOW_NIBBLE) == BMI3_NO_ERROR_MASK)
+            {
+                st_result_status->self_test_err_rslt = BMI3_OK;
+            }
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API prepares the self-test (gyro filter coefficients, self-test
+ * selection, accel configuration to restore) and triggers it.
+ */
+static int8_t start_self_test(uint8_t st_selection, struct bmi3_accel_config *acc_cfg, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    uint16_t reg_data[9];
+
+    uint8_t data_array[18] = { 0 };
+
+    /* Variable to store gyro filter coefficient base address */
+    uint8_t gyro_filter_coeff_base_addr[2] = { BMI3_BASE_ADDR_GYRO_SC_ST_COEFFICIENTS, 0 };
+
+    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, gyro_filter_coeff_base_addr, 2, dev);
+
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, data_array, 18, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, gyro_filter_coeff_base_addr, 2, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, data_array, 18, dev);
+            }
+        }
+    }
+
+    reg_data[0] = (uint16_t)(data_array[0] | (uint16_t)data_array[1] << 8);
+    reg_data[1] = (uint16_t)(data_array[2] | (uint16_t)data_array[3] << 8);
+    reg_data[2] = (uint16_t)(data_array[4] | (uint16_t)data_array[5] << 8);
+    reg_data[3] = (uint16_t)(data_array[6] | (uint16_t)data_array[7] << 8);
+    reg_data[4] = (uint16_t)(data_array[8] | (uint16_t)data_array[9] << 8);
+    reg_data[5] = (uint16_t)(data_array[10] | (uint16_t)data_array[11] << 8);
+    reg_data[6] = (uint16_t)(data_array[12] | (uint16_t)data_array[13] << 8);
+    reg_data[7] = (uint16_t)(data_array[14] | (uint16_t)data_array[15] << 8);
+    reg_data[8] = (uint16_t)(data_array[16] | (uint16_t)data_array[17] << 8);
+
+    if ((reg_data[3] != BMI3_SC_ST_VALUE_3) &&
+        ((reg_data[0] != BMI3_SC_ST_VALUE_0) || (reg_data[1] != BMI3_SC_ST_VALUE_1) ||
+         (reg_data[2] != BMI3_SC_ST_VALUE_2) || (reg_data[4] != BMI3_SC_ST_VALUE_4) ||
+         (reg_data[5] != BMI3_SC_ST_VALUE_5) || (reg_data[6] != BMI3_SC_ST_VALUE_6) ||
+         (reg_data[7] != BMI3_SC_ST_VALUE_7) || (reg_data[8] != BMI3_SC_ST_VALUE_8)))
+    {
+        rslt = set_gyro_filter_coefficients(dev);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        /* Get and set the self-test mode given by the user in the self-test dma register. */
+        rslt = get_set_st_dma(st_selection, dev);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        /* Get default accel configurations */
+        rslt = get_accel_config(acc_cfg, dev);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        /* Sets the self-test preconditions and triggers the self-test in the
+         * command register. */
+        rslt = self_test_conditions(st_selection, dev);
+    }
+
+    return rslt;
+}
+#endif
+
+/*!
+ * @brief This internal API gets and sets the self-calibration mode given
+ *  by the user in the self-calibration dma register.
+ */
+static int8_t get_set_sc_dma(uint8_t sc_selection, uint8_t apply_corr, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    uint8_t reg_data[2];
+
+    /* Array to set the base address of self-calibration feature */
+    uint8_t sc_base_addr[2] = { BMI3_BASE_ADDR_GYRO_SC_SELECT, 0 };
+
+    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, sc_base_addr, 2, dev);
+
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, 2, dev);
+
+        /* The value of apply correction is appended with the selection given by the user */
+        reg_data[0] = (apply_corr | sc_selection);
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, sc_base_addr, 2, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, 2, dev);
+            }
+        }
+    }
+
+    return rslt;
+}
+
+/* This internal API is used to get the status of gyro self-calibration and the result of the event */
+static int8_t get_sc_gyro_rslt(struct bmi3_self_calib_rslt *sc_rslt, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to define index */
+    uint8_t idx;
+
+    /* Variable to define limit */
+    uint8_t limit = BMI3_SC_POLL_LIMIT;
+
+    /* Variable to store the self-calibration completion */
+    uint8_t done = BMI3_FALSE;
+
+    sc_rslt->sc_error_rslt = 0;
+
+    for (idx = 0; (idx < limit) && (done == BMI3_FALSE); idx++)
+    {
+        /* A delay of 120ms is required to read the error status register */
+        flush_and_delay(BMI3_ST_POLL_DELAY_US, dev);
+
+        rslt = check_sc_status(sc_rslt, &done, dev);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API reads the self-calibration status and error status once.
+ */
+static int8_t check_sc_status(struct bmi3_self_calib_rslt *sc_rslt, uint8_t *done, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    uint8_t data_array[2] = { 0 };
+
+    uint8_t sc_status;
+
+    /* Variable to define feature engine errors */
+    uint8_t feature_engine_err_reg_lsb = 0, feature_engine_err_reg_msb = 0;
+
+    rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO1, data_array, 2, dev);
+
+    sc_status = (data_array[0] & BMI3_SC_ST_STATUS_MASK) >> BMI3_SC_ST_COMPLETE_POS;
+
+    if ((sc_status == BMI3_TRUE) && (rslt == BMI3_OK))
+    {
+        sc_rslt->gyro_sc_rslt = (data_array[0] & BMI3_GYRO_SC_RESULT_MASK) >> BMI3_GYRO_SC_RESULT_POS;
+
+        rslt = bmi3_get_feature_engine_error_status(&feature_engine_err_reg_lsb, &feature_engine_err_reg_msb, dev);
+        sc_rslt->sc_error_rslt = feature_engine_err_reg_lsb;
+
+        *done = BMI3_TRUE;
+    }
+    else
+    {
+        /* If limit elapses returning the error code, error status is returned */
+        rslt = bmi3_get_feature_engine_error_status(&feature_engine_err_reg_lsb, &feature_engine_err_reg_msb, dev);
+        sc_rslt->sc_error_rslt = feature_engine_err_reg_lsb;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API saves the accel configuration, sets the self-calibration
+ * preconditions and triggers the self-calibration.
+ */
+static int8_t start_gyro_sc(uint8_t sc_selection,
+                            uint8_t apply_corr,
+                            struct bmi3_sens_config *get_config,
+                            struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Structure to store sensor configuration for accel */
+    struct bmi3_sens_config set_config;
+
+    get_config->type = BMI3_ACCEL;
+
+    /* Get accel configurations */
+    rslt = bmi3_get_sensor_config(get_config, 1, dev);
+
+    if (rslt == BMI3_OK)
+    {
+        /* Enable accelerometer */
+        set_config.type = BMI3_ACCEL;
+
+        /* Definition of accel configuration which are the preconditions for self-calibration */
+        set_config.cfg.acc.acc_mode = BMI3_ACC_MODE_HIGH_PERF;
+        set_config.cfg.acc.odr = BMI3_ACC_ODR_100HZ;
+        set_config.cfg.acc.range = BMI3_ACC_RANGE_8G;
+
+        /* Write the sensor configurations */
+        rslt = bmi3_set_sensor_config(&set_config, 1, dev);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        /* Disable alternate accel and gyro mode */
+        rslt = disable_alt_conf_acc_gyr_mode(dev);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        /* Get and set the self-calibration mode given by the user in the self-calibration dma register. */
+        rslt = get_set_sc_dma(sc_selection, apply_corr, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Trigger the self-calibration command */
+            rslt = bmi3_set_command_register(BMI3_CMD_SELF_CALIB_TRIGGER, dev);
+        }
+    }
+
+    return rslt;
+}
+
+#ifndef BMI3_I3C_SYNC_DISABLE
+/*!
+ * @brief This internal API gets the i3c sync accelerometer data from the register.
+ */
+static int8_t get_i3c_sync_accel_sensor_data(struct bmi3_i3c_sync_data *data, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to define data stored in register */
+    uint8_t reg_data[BMI3_NUM_BYTES_I3C_SYNC_ACC] = { 0 };
+
+    /* Array to set the base address of i3c sync accel data */
+    uint8_t base_addr[2] = { BMI3_BASE_ADDR_I3C_SYNC_ACC, 0 };
+
+    if (data != NULL)
+    {
+        /* Set the i3c sync accelerometer base address to feature engine transmission address to start DMA transaction
+         * */
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Get the configuration from the feature engine register where i3c sync accel data resides */
+            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, BMI3_NUM_BYTES_I3C_SYNC_ACC, dev);
+
+            data->sync_x = (reg_data[0] | (uint16_t)reg_data[1] << 8);
+            data->sync_y = (reg_data[2] | (uint16_t)reg_data[3] << 8);
+            data->sync_z = (reg_data[4] | (uint16_t)reg_data[5] << 8);
+            data->sync_time = (reg_data[14] | (uint16_t)reg_data[15] << 8);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API gets the i3c sync gyroscope data from the register.
+ */
+static int8_t get_i3c_sync_gyro_sensor_data(struct bmi3_i3c_sync_data *data, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to define data stored in register */
+    uint8_t reg_data[BMI3_NUM_BYTES_I3C_SYNC_GYR] = { 0 };
+
+    /* Array to set the base address of i3c sync gyro data */
+    uint8_t base_addr[2] = { BMI3_BASE_ADDR_I3C_SYNC_GYR, 0 };
+
+    if (data != NULL)
+    {
+        /* Set the i3c sync gyroscope base address to feature engine transmission address to start DMA transaction */
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Get the configuration from the feature engine register where i3c sync gyro data resides */
+            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, BMI3_NUM_BYTES_I3C_SYNC_GYR, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                data->sync_x = (reg_data[0] | (uint16_t)reg_data[1] << 8);
+                data->sync_y = (reg_data[2] | (uint16_t)reg_data[3] << 8);
+                data->sync_z = (reg_data[4] | (uint16_t)reg_data[5] << 8);
+                data->sync_time = (reg_data[8] | (uint16_t)reg_data[9] << 8);
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API gets the i3c sync temperature data from the register.
+ */
+static int8_t get_i3c_sync_temp_data(struct bmi3_i3c_sync_data *data, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to define data stored in register */
+    uint8_t reg_data[BMI3_NUM_BYTES_I3C_SYNC_TEMP] = { 0 };
+
+    /* Array to set the base address of i3c sync temperature data */
+    uint8_t base_addr[2] = { BMI3_BASE_ADDR_I3C_SYNC_TEMP, 0 };
+
+    if (data != NULL)
+    {
+        /* Set the i3c sync temperature base address to feature engine transmission address to start DMA transaction */
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Get the configuration from the feature engine register where i3c sync temperature data resides */
+            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, BMI3_NUM_BYTES_I3C_SYNC_TEMP, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                data->sync_temp = (reg_data[0] | (uint16_t)reg_data[1] << 8);
+                data->sync_time = (reg_data[2] | (uint16_t)reg_data[3] << 8);
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+#endif
+
+/*!
+ * @brief This internal API sets alternate accelerometer configurations like ODR,
+ * accel mode and average number of samples.
+ */
+static int8_t set_alternate_accel_config(const struct bmi3_alt_accel_config *config, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store data */
+    uint8_t reg_data[2] = { 0 };
+
+    uint16_t alt_acc_odr, alt_acc_avg_num, alt_acc_mode;
+
+    if (config != NULL)
+    {
+        /* Set alternate accelerometer ODR */
+        alt_acc_odr = BMI3_SET_BIT_POS0(reg_data[0], BMI3_ALT_ACC_ODR, config->alt_acc_odr);
+
+        /* Set alternate accelerometer average number of samples */
+        alt_acc_avg_num = BMI3_SET_BITS(reg_data[1], BMI3_ALT_ACC_AVG_NUM, config->alt_acc_avg_num);
+
+        /* Set alternate accelerometer mode */
+        alt_acc_mode = BMI3_SET_BITS(reg_data[1], BMI3_ALT_ACC_MODE, config->alt_acc_mode);
+
+        reg_data[0] = (uint8_t)(alt_acc_odr);
+        reg_data[1] = (uint8_t)((alt_acc_avg_num | alt_acc_mode) >> 8);
+
+        /* Set configurations of alternate accel */
+        rslt = bmi3_set_regs(BMI3_REG_ALT_ACC_CONF, reg_data, 2, dev);
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API gets alternate accelerometer configurations like ODR,
+ * accel mode and average number of samples.
+ */
+static int8_t get_alternate_accel_config(struct bmi3_alt_accel_config *config, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to store data */
+    uint8_t data_array[2] = { 0 };
+
+    uint16_t reg_data;
+
+    if (config != NULL)
+    {
+        /* Read the sensor configuration details */
+        rslt = bmi3_get_regs(BMI3_REG_ALT_ACC_CONF, data_array, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            reg_data = data_array[0];
+
+            /* Get alternate accelerometer ODR */
+            config->alt_acc_odr = BMI3_GET_BIT_POS0(reg_data, BMI3_ALT_ACC_ODR);
+
+            reg_data = ((uint16_t)data_array[1] << 8);
+
+            /* Get alternate accelerometer average samples */
+            config->alt_acc_avg_num = BMI3_GET_BITS(reg_data, BMI3_ALT_ACC_AVG_NUM);
+
+            /* Get alternate accel mode */
+            config->alt_acc_mode = BMI3_GET_BITS(reg_data, BMI3_ALT_ACC_MODE);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API sets alternate gyro configurations like ODR,
+ * gyro mode and average number of samples.
+ */
+static int8_t set_alternate_gyro_config(const struct bmi3_alt_gyro_config *config, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store data */
+    uint8_t reg_data[2] = { 0 };
+
+    uint16_t alt_gyro_odr, alt_gyro_avg_num, alt_gyro_mode;
+
+    if (config != NULL)
+    {
+        /* Set alternate gyro ODR */
+        alt_gyro_odr = BMI3_SET_BIT_POS0(reg_data[0], BMI3_ALT_GYR_ODR, config->alt_gyro_odr);
+
+        /* Set alternate gyro average number of samples */
+        alt_gyro_avg_num = BMI3_SET_BITS(reg_data[1], BMI3_ALT_GYR_AVG_NUM, config->alt_gyro_avg_num);
+
+        /* Set alternate gyro mode */
+        alt_gyro_mode = BMI3_SET_BITS(reg_data[1], BMI3_ALT_GYR_MODE, config->alt_gyro_mode);
+
+        reg_data[0] = (uint8_t)(alt_gyro_odr);
+        reg_data[1] = (uint8_t)((alt_gyro_avg_num | alt_gyro_mode) >> 8);
+
+        /* Set configurations of alternate gyro */
+        rslt = bmi3_set_regs(BMI3_REG_ALT_GYR_CONF, reg_data, 2, dev);
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API gets alternate gyro configurations like ODR,
+ * gyro mode and average number of samples.
+ */
+static int8_t get_alternate_gyro_config(struct bmi3_alt_gyro_config *config, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to store data */
+    uint8_t data_array[2] = { 0 };
+
+    uint16_t reg_data;
+
+    if (config != NULL)
+    {
+        /* Read the sensor configuration details */
+        rslt = bmi3_get_regs(BMI3_REG_ALT_GYR_CONF, data_array, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            reg_data = data_array[0];
+
+            /* Get alternate gyro ODR */
+            config->alt_gyro_odr = BMI3_GET_BIT_POS0(reg_data, BMI3_ALT_GYR_ODR);
+
+            reg_data = ((uint16_t)data_array[1] << 8);
+
+            /* Get alternate gyro average samples */
+            config->alt_gyro_avg_num = BMI3_GET_BITS(reg_data, BMI3_ALT_GYR_AVG_NUM);
+
+            /* Get alternate gyro mode */
+            config->alt_gyro_mode = BMI3_GET_BITS(reg_data, BMI3_ALT_GYR_MODE);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+#ifndef BMI3_ALT_CONFIG_DISABLE
+/*!
+ * @brief This internal API sets alternate auto configurations for feature interrupts.
+ */
+static int8_t set_alternate_auto_config(const struct bmi3_auto_config_change *config, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to define the alternate auto configuration */
+    uint8_t alt_auto_config[2] = { 0 };
+
+    /* Array to set the base address of alternate auto config */
+    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ALT_AUTO_CONFIG, 0 };
+
+    uint8_t alt_switch, user_switch;
+
+    if (config != NULL)
+    {
+        /* Set the alternate auto config base address to feature engine transmission address to start DMA transaction */
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Set alternate switch config */
+            alt_switch = BMI3_SET_BIT_POS0(alt_auto_config[0],
+                                           BMI3_ALT_CONF_ALT_SWITCH,
+                                           config->alt_conf_alt_switch_src_select);
+
+            /* Set alternate user config */
+            user_switch = BMI3_SET_BITS(alt_auto_config[0],
+                                        BMI3_ALT_CONF_USER_SWITCH,
+                                        config->alt_conf_user_switch_src_select);
+
+            alt_auto_config[0] = alt_switch | user_switch;
+
+            /* Set the configuration back to the feature engine register */
+            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, alt_auto_config, 2, dev);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API gets alternate auto configurations for feature interrupts.
+ */
+static int8_t get_alternate_auto_config(struct bmi3_auto_config_change *config, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to define the alternate auto configuration */
+    uint8_t alt_auto_config[2] = { 0 };
+
+    /* Array to set the base address of alternate auto config */
+    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ALT_AUTO_CONFIG, 0 };
+
+    if (config != NULL)
+    {
+        /* Set the alternate auto config base address to feature engine transmission address to start DMA transaction */
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Get the configuration from the feature engine register where alternate config feature resides */
+            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, alt_auto_config, 2, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                /* Get alternate switch config */
+                config->alt_conf_alt_switch_src_select = alt_auto_config[0] & BMI3_ALT_CONF_ALT_SWITCH_MASK;
+
+                /* Get alternate user config */
+                config->alt_conf_user_switch_src_select = (alt_auto_config[0] & BMI3_ALT_CONF_USER_SWITCH_MASK) >>
+                                                          BMI3_ALT_CONF_USER_SWITCH_POS;
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+#endif
+
+/*!
+ * @brief This internal API writes the re-mapped axes to the feature engine.
+ */
+static int8_t write_remap_axes(const struct bmi3_axes_remap remapped_axis, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-    /* Variable to store fifo available length in bytes */
-    uint16_t fifo_available_len_in_bytes;
+    /* Variable to set the re-mapped axes in the sensor */
+    uint8_t axis_map;
 
-    struct bmi3_fifo_temperature_data *fifo_temp_data = (struct bmi3_fifo_temperature_data *)fifo_data;
-    struct bmi3_fifo_sens_axes_data *fifo_gyr_data = (struct bmi3_fifo_sens_axes_data *)fifo_data;
-    struct bmi3_fifo_sens_axes_data *fifo_acc_data = (struct bmi3_fifo_sens_axes_data *)fifo_data;
+    /* Variable to set the re-mapped x-axes sign in the sensor */
+    uint8_t invert_x;
 
-    /* Convert available fifo length from word to byte */
-    fifo_available_len_in_bytes = (uint16_t)(fifo->available_fifo_len * 2);
+    /* Variable to set the re-mapped y-axes sign in the sensor */
+    uint8_t invert_y;
 
-    switch (frame)
+    /* Variable to set the re-mapped z-axes sign in the sensor */
+    uint8_t invert_z;
+
+    /* Variable to define the register address */
+    uint8_t base_addr[2] = { BMI3_BASE_ADDR_AXIS_REMAP, 0 };
+
+    /* Array variable to get remapped axis data */
+    uint8_t remap_data[4];
+
+    /* Set the configuration to feature engine register */
+    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+
+    if (rslt == BMI3_OK)
     {
-        /* If frame contains only accelerometer data */
-        case BMI3_FIFO_HEAD_LESS_ACC_FRM:
+        /* Set the value of re-mapped axis */
+        axis_map = remapped_axis.axis_map & BMI3_XYZ_AXIS_MASK;
 
-            /* Get the accelerometer data */
-            rslt = unpack_accel_data(&fifo_acc_data[(*updated_frm_idx)], *idx, fifo);
+        /* Set the value of re-mapped x-axis sign */
+        invert_x = ((remapped_axis.invert_x << BMI3_X_AXIS_SIGN_POS) & BMI3_X_AXIS_SIGN_MASK);
 
-            if (rslt == 0 || rslt == BMI3_W_FIFO_ACCEL_DUMMY_FRAME || rslt == BMI3_W_ST_PARTIAL_READ)
-            {
-                update_data_index(idx, updated_frm_idx, BMI3_LENGTH_FIFO_ACC, rslt);
-            }
-            else if (rslt == BMI3_W_PARTIAL_READ)
-            {
-                /* Since partial occur making data start index to FIFO available length
-                 * to end of the loop */
-                *idx = fifo_available_len_in_bytes;
-            }
+        /* Set the value of re-mapped y-axis sign */
+        invert_y = ((remapped_axis.invert_y << BMI3_Y_AXIS_SIGN_POS) & BMI3_Y_AXIS_SIGN_MASK);
 
-            break;
+        /* Set the value of re-mapped z-axis sign */
+        invert_z = ((remapped_axis.invert_z << BMI3_Z_AXIS_SIGN_POS) & BMI3_Z_AXIS_SIGN_MASK);
 
-        /* If frame contains gyro frame */
-        case BMI3_FIFO_HEAD_LESS_GYR_FRM:
+        remap_data[0] = (axis_map | invert_x | invert_y | invert_z);
 
-            /* Get the gyro data */
-            rslt = unpack_gyro_data(&fifo_gyr_data[(*updated_frm_idx)], *idx, fifo);
+        /* Set the configuration back to the page */
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, remap_data, 2, dev);
+    }
 
-            if (rslt == 0 || rslt == BMI3_W_FIFO_GYRO_DUMMY_FRAME || rslt == BMI3_W_ST_PARTIAL_READ)
-            {
-                update_data_index(idx, updated_frm_idx, BMI3_LENGTH_FIFO_GYR, rslt);
-            }
-            else if (rslt == BMI3_W_PARTIAL_READ)
-            {
-                /* Since partial occur making data start index to FIFO available length
-                 * to end of the loop */
-                *idx = fifo_available_len_in_bytes;
-            }
+    return rslt;
+}
 
-            break;
+/*!
+ * @brief This internal API is used to monitor the accel power mode during the axis remap.
+ */
+static int8_t axes_remap_acc_power_mode_status(struct bmi3_sens_config config, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-        /* If frame contains temperature frame */
-        case BMI3_FIFO_HEAD_LESS_TEMP_FRM:
+    /* Variable to store the accel power mode during axis remap */
+    uint8_t acc_power_mode_status;
 
-            /* Get the temperature data */
-            rslt = unpack_temperature_data(&fifo_temp_data[(*updated_frm_idx)], *idx, fifo);
+    /* Variable to loop */
+    uint8_t index;
 
-            if (rslt == BMI3_OK || rslt == BMI3_W_FIFO_TEMP_DUMMY_FRAME || rslt == BMI3_W_ST_PARTIAL_READ)
+    /* Variable to store time out value */
+    uint8_t time_out = BMI3_AXIS_MAP_POLL_LIMIT;
+
+    /* Variable to store the axis map completion */
+    uint8_t done = BMI3_FALSE;
+
+    config.type = BMI3_ACCEL;
+
+    rslt = bmi3_get_sensor_config(&config, 1, dev);
+
+    if ((rslt == BMI3_OK) && (config.cfg.acc.acc_mode != BMI3_ACC_MODE_DISABLE))
+    {
+        acc_power_mode_status = config.cfg.acc.acc_mode;
+
+        config.cfg.acc.acc_mode = BMI3_ACC_MODE_DISABLE;
+
+        rslt = bmi3_set_sensor_config(&config, 1, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Axis mapping gets updated */
+            rslt = bmi3_set_command_register(BMI3_CMD_AXIS_MAP_UPDATE, dev);
+
+            for (index = 0; (index < time_out) && (done == BMI3_FALSE); index++)
             {
-                update_data_index(idx, updated_frm_idx, BMI3_LENGTH_TEMPERATURE, rslt);
+                flush_and_delay(BMI3_AXIS_MAP_POLL_DELAY_US, dev);
+
+                rslt = check_axis_map_status(&done, dev);
             }
-            else if (rslt == BMI3_W_PARTIAL_READ)
+
+            config.cfg.acc.acc_mode = acc_power_mode_status;
+
+            if (rslt == BMI3_OK)
             {
-                /* Since partial occur making data start index to FIFO available length
-                 * to end of the loop */
-                *idx = fifo_available_len_in_bytes;
+                rslt = restore_accel_after_remap(&config, dev);
             }
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        /* Axis mapping gets updated */
+        rslt = bmi3_set_command_register(BMI3_CMD_AXIS_MAP_UPDATE, dev);
+    }
 
-            break;
+    return rslt;
+}
 
-        default:
-            rslt = BMI3_W_FIFO_INVALID_FRAME;
+/*!
+ * @brief This internal API reads the feature engine error status once and reports whether
+ * the axis map update is complete.
+ */
+static int8_t check_axis_map_status(uint8_t *done, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-            break;
+    /* Variable to define feature engine errors */
+    uint8_t feature_engine_err_reg_lsb = 0, feature_engine_err_reg_msb = 0;
+
+    rslt = bmi3_get_feature_engine_error_status(&feature_engine_err_reg_lsb, &feature_engine_err_reg_msb, dev);
+
+    if ((feature_engine_err_reg_lsb & BMI3_NO_ERROR_MASK) &&
+        (feature_engine_err_reg_msb & (BMI3_AXIS_MAP_COMPLETE_MASK >> 8)))
+    {
+        *done = BMI3_TRUE;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API is used to parse accelerometer data from the
- * FIFO data.
+ * @brief This internal API powers the accelerometer up again after the axis map update.
  */
-static int8_t unpack_accel_data(struct bmi3_fifo_sens_axes_data *acc,
-                                uint16_t data_start_index,
-                                const struct bmi3_fifo_frame *fifo)
+static int8_t restore_accel_after_remap(const struct bmi3_sens_config *config, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt = BMI3_OK;
+    int8_t rslt;
 
-    /* Variable to store the sensor time index value */
-    uint16_t sens_time_data_idx;
+    uint16_t int_status;
 
-    /* Variable to store LSB value */
-    uint16_t data_lsb;
+    /* Structure instance of sensor config */
+    struct bmi3_sens_config acc_config = *config;
 
-    /* Variables to store MSB value */
-    uint16_t data_msb;
+    /* Clearing status registers by reading it, before powering up accelerometer */
+    rslt = bmi3_get_int1_status(&int_status, dev);
 
-    /* Variable to store dummy data value which will get in FIFO data */
-    uint16_t dummy_data;
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_set_sensor_config(&acc_config, 1, dev);
+    }
 
-    /* Variable to store fifo available length in bytes */
-    uint16_t fifo_available_len_in_bytes;
+    return rslt;
+}
 
-    /* Convert available fifo length from word to byte */
-    fifo_available_len_in_bytes = (uint16_t)(fifo->available_fifo_len * 2);
+#ifndef BMI3_FOC_DISABLE
+/*!
+ * @brief This internal API verifies and allows only the correct position to do Fast Offset Compensation for
+ * accelerometer.
+ */
+static int8_t verify_foc_position(uint8_t sens_list,
+                                  const struct bmi3_accel_foc_g_value *accel_g_axis,
+                                  struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-    if ((data_start_index + BMI3_LENGTH_FIFO_ACC) <= fifo_available_len_in_bytes)
-    {
-        /* Accelerometer raw x data */
-        data_lsb = fifo->data[data_start_index++];
-        data_msb = fifo->data[data_start_index++];
+    /* Structure to store temporary accelerometer values */
+    struct bmi3_foc_temp_value temp_foc_data = { 0 };
 
-        /* To store the dummy data */
-        dummy_data = (uint16_t)(((uint16_t)data_msb << 8) | data_lsb);
+    rslt = get_average_of_sensor_data(sens_list, &temp_foc_data, dev);
 
-        if (dummy_data != BMI3_FIFO_ACCEL_DUMMY_FRAME)
-        {
-            acc->x = (int16_t)(((uint16_t)data_msb << 8) | data_lsb);
+    if (rslt == BMI3_OK)
+    {
+        rslt = validate_foc_average(sens_list, accel_g_axis, &temp_foc_data, dev);
+    }
 
-            /* Accelerometer raw y data */
-            data_lsb = fifo->data[data_start_index++];
-            data_msb = fifo->data[data_start_index++];
-            acc->y = (int16_t)(((uint16_t)data_msb << 8) | data_lsb);
+    return rslt;
+}
 
-            /* Accelerometer raw z data */
-            data_lsb = fifo->data[data_start_index++];
-            data_msb = fifo->data[data_start_index++];
-            acc->z = (int16_t)(((uint16_t)data_msb << 8) | data_lsb);
+/*!
+ * @brief This internal API checks the averaged sensor data against the FOC position given by the user.
+ */
+static int8_t validate_foc_average(uint8_t sens_list,
+                                   const struct bmi3_accel_foc_g_value *accel_g_axis,
+                                   struct bmi3_foc_temp_value *temp_foc_data,
+                                   struct bmi3_dev *dev)
+{
+    /* Structure to define accelerometer sensor axes */
+    struct bmi3_sens_axes_data avg_foc_data = { 0 };
+
+    if (sens_list == BMI3_ACCEL)
+    {
+        /* Taking modulus to make negative values as positive */
+        if ((accel_g_axis->x == 1) && (accel_g_axis->sign == 1))
+        {
+            temp_foc_data->x = temp_foc_data->x * BMI3_FOC_INVERT_VALUE;
         }
-        else
+        else if ((accel_g_axis->y == 1) && (accel_g_axis->sign == 1))
         {
-            rslt = BMI3_W_FIFO_ACCEL_DUMMY_FRAME;
+            temp_foc_data->y = temp_foc_data->y * BMI3_FOC_INVERT_VALUE;
+        }
+        else if ((accel_g_axis->z == 1) && (accel_g_axis->sign == 1))
+        {
+            temp_foc_data->z = temp_foc_data->z * BMI3_FOC_INVERT_VALUE;
         }
-    }
-    else
-    {
-        rslt = BMI3_W_PARTIAL_READ;
     }
 
-    sens_time_data_idx = data_start_index;
-    acc->sensor_time = 0;
+    avg_foc_data.x = (int16_t)(temp_foc_data->x);
+    avg_foc_data.y = (int16_t)(temp_foc_data->y);
+    avg_foc_data.z = (int16_t)(temp_foc_data->z);
+
+    return validate_foc_position(sens_list, accel_g_axis, avg_foc_data, dev);
+}
+
+/*!
+ * @brief This internal API reads and provides average for 128 samples of sensor data for accel FOC.
+ */
+static int8_t get_average_of_sensor_data(uint8_t sens_list,
+                                         struct bmi3_foc_temp_value *temp_foc_data,
+                                         struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    uint8_t sample_count = 0;
+    uint8_t datardy_try_cnt;
+    uint16_t drdy_status = 0;
+
+    rslt = null_ptr_check(dev);
 
-    if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
+    if (rslt == BMI3_OK)
     {
-        if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_GYR_FRM)
+        /* Read sensor values before FOC */
+        while (sample_count < BMI3_FOC_SAMPLE_LIMIT)
         {
-            sens_time_data_idx = sens_time_data_idx + BMI3_LENGTH_FIFO_GYR;
-        }
+            datardy_try_cnt = BMI3_FOC_DRDY_TRIES;
+            do
+            {
+                flush_and_delay(BMI3_FOC_POLL_DELAY_US, dev);
+                rslt = bmi3_get_sensor_status(&drdy_status, dev);
+                datardy_try_cnt--;
+            } while ((rslt == BMI3_OK) && (!(drdy_status)) && (datardy_try_cnt));
 
-        if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_TEMP_FRM)
-        {
-            sens_time_data_idx = sens_time_data_idx + BMI3_LENGTH_TEMPERATURE;
-        }
+            if ((rslt != BMI3_OK) || (datardy_try_cnt == 0))
+            {
+                rslt = BMI3_E_DATA_RDY_INT_FAILED;
+                break;
+            }
 
-        if ((sens_time_data_idx + BMI3_LENGTH_SENSOR_TIME) <= fifo_available_len_in_bytes)
-        {
-            /* Sensor time raw data */
-            data_lsb = fifo->data[sens_time_data_idx++];
-            data_msb = fifo->data[sens_time_data_idx++];
+            rslt = accumulate_foc_sample(sens_list, temp_foc_data, dev);
 
-            acc->sensor_time = (uint16_t)(((uint16_t)data_msb << 8) | data_lsb);
+            if (rslt != BMI3_OK)
+            {
+                break;
+            }
+
+            sample_count++;
         }
-        else
+
+        if (rslt == BMI3_OK)
         {
-            rslt = BMI3_W_ST_PARTIAL_READ;
+            temp_foc_data->x = (temp_foc_data->x / BMI3_FOC_SAMPLE_LIMIT);
+            temp_foc_data->y = (temp_foc_data->y / BMI3_FOC_SAMPLE_LIMIT);
+            temp_foc_data->z = (temp_foc_data->z / BMI3_FOC_SAMPLE_LIMIT);
         }
     }
 
@@ -7078,74 +10585,64 @@ static int8_t unpack_accel_data(struct bmi3_fifo_sens_axes_data *acc,
 }
 
 /*!
- * @brief This internal API is used to parse temperature data from the
- * FIFO data.
+ * @brief This internal API reads one sample of sensor data and adds it to the FOC sums.
  */
-static int8_t unpack_temperature_data(struct bmi3_fifo_temperature_data *temp,
-                                      uint16_t data_start_index,
-                                      const struct bmi3_fifo_frame *fifo)
+static int8_t accumulate_foc_sample(uint8_t sens_list, struct bmi3_foc_temp_value *temp_foc_data, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt = BMI3_OK;
-
-    /* Variable to store the sensor time index value */
-    uint16_t sens_time_data_idx;
-
-    /* Variables to store LSB value */
-    uint16_t data_lsb;
-
-    /* Variables to store MSB value */
-    uint16_t data_msb;
+    int8_t rslt;
 
-    /* Variable to store dummy data value which will get in FIFO data */
-    uint16_t dummy_data;
+    /* Structure to store sensor data */
+    struct bmi3_sensor_data sensor_data = { 0 };
 
-    /* Variable to store fifo available length in bytes */
-    uint16_t fifo_available_len_in_bytes;
+    /* Assign sensor list to type */
+    sensor_data.type = sens_list;
 
-    /* Convert available fifo length from word to byte */
-    fifo_available_len_in_bytes = (uint16_t)(fifo->available_fifo_len * 2);
+    rslt = bmi3_get_sensor_data(&sensor_data, 1, dev);
 
-    if ((data_start_index + BMI3_LENGTH_TEMPERATURE) <= fifo_available_len_in_bytes)
+    if (rslt == BMI3_OK)
     {
-        /* Temperature raw data */
-        data_lsb = fifo->data[data_start_index++];
-        data_msb = fifo->data[data_start_index++];
-
-        /* To store the dummy data */
-        dummy_data = (uint16_t)(((uint16_t)data_msb << 8) | data_lsb);
-
-        temp->temp_data = (uint16_t)(((uint16_t)data_msb << 8) | data_lsb);
-
-        if (dummy_data != BMI3_FIFO_TEMP_DUMMY_FRAME)
+        if (sensor_data.type == BMI3_ACCEL)
         {
-            temp->temp_data = (uint16_t)(((uint16_t)data_msb << 8) | data_lsb);
+            temp_foc_data->x += sensor_data.sens_data.acc.x;
+            temp_foc_data->y += sensor_data.sens_data.acc.y;
+            temp_foc_data->z += sensor_data.sens_data.acc.z;
         }
-        else
+        else if (sensor_data.type == BMI3_GYRO)
         {
-            rslt = BMI3_W_FIFO_TEMP_DUMMY_FRAME;
+            temp_foc_data->x += sensor_data.sens_data.gyr.x;
+            temp_foc_data->y += sensor_data.sens_data.gyr.y;
+            temp_foc_data->z += sensor_data.sens_data.gyr.z;
         }
     }
-    else
-    {
-        rslt = BMI3_W_PARTIAL_READ;
-    }
 
-    sens_time_data_idx = data_start_index;
-    temp->sensor_time = 0;
+    return rslt;
+}
 
-    if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
+/*!
+ * @brief This internal API validates accel FOC position as per the range
+ */
+static int8_t validate_foc_position(uint8_t sens_list,
+                                    const struct bmi3_accel_foc_g_value *accel_g_axis,
+                                    struct bmi3_sens_axes_data avg_foc_data,
+                                    struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_E_INVALID_INPUT;
+
+    if (sens_list == BMI3_ACCEL)
     {
-        if ((sens_time_data_idx + BMI3_LENGTH_SENSOR_TIME) <= fifo_available_len_in_bytes)
+        if (accel_g_axis->x == 1)
         {
-            /* Sensor time raw data */
-            data_lsb = fifo->data[sens_time_data_idx++];
-            data_msb = fifo->data[sens_time_data_idx++];
-            temp->sensor_time = (uint16_t)(((uint16_t)data_msb << 8) | data_lsb);
+            rslt = validate_foc_accel_axis(avg_foc_data.x, dev);
+        }
+        else if (accel_g_axis->y == 1)
+        {
+            rslt = validate_foc_accel_axis(avg_foc_data.y, dev);
         }
         else
         {
-            rslt = BMI3_W_ST_PARTIAL_READ;
+            rslt = validate_foc_accel_axis(avg_foc_data.z, dev);
         }
     }
 
@@ -7153,85 +10650,57 @@ static int8_t unpack_temperature_data(struct bmi3_fifo_temperature_data *temp,
 }
 
 /*!
- * @brief This internal API is used to parse gyro data from the
- * FIFO data.
+ * @brief This internal API validates accel FOC axis given as input
  */
-static int8_t unpack_gyro_data(struct bmi3_fifo_sens_axes_data *gyro,
-                               uint16_t data_start_index,
-                               const struct bmi3_fifo_frame *fifo)
+static int8_t validate_foc_accel_axis(int16_t avg_foc_data, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt = BMI3_OK;
-
-    /* Variable to store the sensor time index value */
-    uint16_t sens_time_data_idx;
-
-    /* Variables to store LSB value */
-    uint16_t data_lsb;
+    int8_t rslt;
 
-    /* Variables to store MSB value */
-    uint16_t data_msb;
+    /* Structure to store sensor configurations */
+    struct bmi3_sens_config sens_cfg = { 0 };
 
-    /* Variable to store dummy data value which will get in FIFO data */
-    uint16_t dummy_data;
+    /* Variable to store accel range */
+    uint8_t range;
 
-    /* Variable to store fifo available length in bytes */
-    uint16_t fifo_available_len_in_bytes;
+    /* Assign the accel type */
+    sens_cfg.type = BMI3_ACCEL;
 
-    /* Convert available fifo length from word to byte */
-    fifo_available_len_in_bytes = (uint16_t)(fifo->available_fifo_len * 2);
+    /* Get accel configurations */
+    rslt = bmi3_get_sensor_config(&sens_cfg, 1, dev);
 
-    if ((data_start_index + BMI3_LENGTH_FIFO_GYR) <= fifo_available_len_in_bytes)
+    if (rslt == BMI3_OK)
     {
-        /* Gyro raw x data */
-        data_lsb = fifo->data[data_start_index++];
-        data_msb = fifo->data[data_start_index++];
-
-        /* To store the dummy data */
-        dummy_data = (uint16_t)(((uint16_t)data_msb << 8) | data_lsb);
-
-        gyro->x = (int16_t)(((uint16_t)data_msb << 8) | data_lsb);
-
-        /* Gyro raw y data */
-        data_lsb = fifo->data[data_start_index++];
-        data_msb = fifo->data[data_start_index++];
-        gyro->y = (int16_t)(((uint16_t)data_msb << 8) | data_lsb);
-
-        /* Gyro raw z data */
-        data_lsb = fifo->data[data_start_index++];
-        data_msb = fifo->data[data_start_index++];
-        gyro->z = (int16_t)(((uint16_t)data_msb << 8) | data_lsb);
+        /* Assign accel range to variable */
+        range = sens_cfg.cfg.acc.range;
 
-        if (dummy_data == BMI3_FIFO_GYRO_DUMMY_FRAME)
+        /* Reference LSB value of 2G */
+        if ((range == BMI3_ACC_RANGE_2G) && (avg_foc_data > BMI3_ACC_2G_MIN_NOISE_LIMIT) &&
+            (avg_foc_data < BMI3_ACC_2G_MAX_NOISE_LIMIT))
         {
-            rslt = BMI3_W_FIFO_GYRO_DUMMY_FRAME;
+            rslt = BMI3_OK;
         }
-    }
-    else
-    {
-        rslt = BMI3_W_PARTIAL_READ;
-    }
-
-    sens_time_data_idx = data_start_index;
-    gyro->sensor_time = 0;
-
-    if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
-    {
-        if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_TEMP_FRM)
+        /* Reference LSB value of 4G */
+        else if ((range == BMI3_ACC_RANGE_4G) && (avg_foc_data > BMI3_ACC_4G_MIN_NOISE_LIMIT) &&
+                 (avg_foc_data < BMI3_ACC_4G_MAX_NOISE_LIMIT))
         {
-            sens_time_data_idx = sens_time_data_idx + BMI3_LENGTH_TEMPERATURE;
+            rslt = BMI3_OK;
         }
-
-        if ((sens_time_data_idx + BMI3_LENGTH_SENSOR_TIME) <= fifo_available_len_in_bytes)
+        /* Reference LSB value of 8G */
+        else if ((range == BMI3_ACC_RANGE_8G) && (avg_foc_data > BMI3_ACC_8G_MIN_NOISE_LIMIT) &&
+                 (avg_foc_data < BMI3_ACC_8G_MAX_NOISE_LIMIT))
         {
-            /* Sensor time raw data */
-            data_lsb = fifo->data[sens_time_data_idx++];
-            data_msb = fifo->data[sens_time_data_idx++];
-            gyro->sensor_time = (uint16_t)(((uint16_t)data_msb << 8) | data_lsb);
+            rslt = BMI3_OK;
+        }
+        /* Reference LSB value of 16G */
+        else if ((range == BMI3_ACC_RANGE_16G) && (avg_foc_data > BMI3_ACC_16G_MIN_NOISE_LIMIT) &&
+                 (avg_foc_data < BMI3_ACC_16G_MAX_NOISE_LIMIT))
+        {
+            rslt = BMI3_OK;
         }
         else
         {
-            rslt = BMI3_W_ST_PARTIAL_READ;
+            rslt = BMI3_E_INVALID_FOC_POSITION;
         }
     }
 
@@ -7239,1353 +10708,1493 @@ static int8_t unpack_gyro_data(struct bmi3_fifo_sens_axes_data *gyro,
 }
 
 /*!
- * @brief This internal API sets the precondition settings such as alternate accelerometer and
- * gyroscope enable bits, accelerometer mode and output data rate.
+ * @brief This internal API sets configurations for performing accelerometer FOC.
  */
-static int8_t st_precondition(uint8_t st_select, struct bmi3_dev *dev)
+static int8_t set_accel_foc_config(struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Structure instance of sensor config */
-    struct bmi3_sens_config config = { 0 };
+    /* Variable to set the accelerometer configuration value */
+    uint8_t acc_conf_data[2] = { BMI3_FOC_ACC_CONF_VAL_LSB, BMI3_FOC_ACC_CONF_VAL_MSB };
 
-    config.type = BMI3_ACCEL;
+    /* Set accelerometer configurations to 50Hz */
+    rslt = bmi3_set_regs(BMI3_REG_ACC_CONF, acc_conf_data, 2, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API performs Fast Offset Compensation for accelerometer.
+ */
+static int8_t perform_accel_foc(const struct bmi3_accel_foc_g_value *accel_g_value,
+                                struct bmi3_accel_config *acc_cfg,
+                                struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_E_INVALID_STATUS;
+
+    /* Variable to define count */
+    uint8_t loop;
+
+    /* Variable to store status read from the status register */
+    uint16_t reg_status = 0;
+
+    /* Array of structure to store accelerometer data */
+    struct bmi3_sensor_data accel_value[128] = { { 0 } };
+
+    /* Structure to store accelerometer data temporarily */
+    struct bmi3_foc_temp_value temp = { 0, 0, 0 };
+
+    /* Variable tries max 5 times for interrupt then generates timeout */
+    uint8_t try_cnt;
+
+    for (loop = 0; loop < BMI3_FOC_SAMPLE_LIMIT; loop++)
+    {
+        try_cnt = BMI3_FOC_DRDY_TRIES;
+
+        while (try_cnt && (!(reg_status & BMI3_DRDY_ACC_MASK)))
+        {
+            /* 20ms delay for 50Hz ODR */
+            flush_and_delay(BMI3_FOC_POLL_DELAY_US, dev);
+            rslt = bmi3_get_sensor_status(&reg_status, dev);
+            try_cnt--;
+        }
 
-    rslt = bmi3_get_sensor_config(&config, 1, dev);
+        if ((rslt == BMI3_OK) && (reg_status & BMI3_DRDY_ACC_MASK))
+        {
+            rslt = get_accel_sensor_data(&accel_value[loop].sens_data.acc, BMI3_REG_ACC_DATA_X, dev);
+        }
 
-    if (rslt == BMI3_OK)
-    {
-        switch (st_select)
+        if (rslt == BMI3_OK)
         {
-            case BMI3_ST_ACCEL_ONLY:
-                rslt = BMI3_OK;
-                break;
-            case BMI3_ST_GYRO_ONLY:
-            case BMI3_ST_BOTH_ACC_GYR:
-                rslt = BMI3_OK;
-                config.cfg.acc.acc_mode = BMI3_ACC_MODE_HIGH_PERF;
-                config.cfg.acc.odr = BMI3_ACC_ODR_100HZ;
-                break;
-            default:
-                rslt = BMI3_E_INVALID_ST_SELECTION;
-                break;
+            /* Store the data in a temporary structure */
+            temp.x = temp.x + (int32_t)accel_value[loop].sens_data.acc.x;
+            temp.y = temp.y + (int32_t)accel_value[loop].sens_data.acc.y;
+            temp.z = temp.z + (int32_t)accel_value[loop].sens_data.acc.z;
+        }
+        else
+        {
+            break;
         }
     }
 
     if (rslt == BMI3_OK)
     {
-        rslt = bmi3_set_sensor_config(&config, 1, dev);
+        rslt = apply_accel_foc(accel_g_value, &temp, acc_cfg, dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API gets and sets the self-test mode given
- *  by the user in the self-test dma register.
+ * @brief This internal API computes the accel offsets from the summed FOC samples and
+ * writes them to the offset compensation registers.
  */
-static int8_t get_set_st_dma(uint8_t st_selection, struct bmi3_dev *dev)
+static int8_t apply_accel_foc(const struct bmi3_accel_foc_g_value *accel_g_value,
+                              const struct bmi3_foc_temp_value *temp,
+                              struct bmi3_accel_config *acc_cfg,
+                              struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    uint8_t reg_data[2];
+    /* Structure to store the average of accelerometer data */
+    struct bmi3_sens_axes_data accel_avg = { 0 };
 
-    /* Array to set the base address of self-test feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ST_SELECT, 0 };
+    /* Variable to define LSB per g value */
+    uint16_t lsb_per_g = 0;
 
-    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+    /* Variable to define range */
+    uint8_t range = 0;
 
-    if (rslt == BMI3_OK)
-    {
-        rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, 2, dev);
+    /* Structure to store accelerometer data deviation from ideal value */
+    struct bmi3_offset_delta delta = { 0, 0, 0 };
 
-        reg_data[0] = st_selection;
+    /* Structure to store accelerometer offset values */
+    struct bmi3_acc_dp_gain_offset offset = { 0 };
 
-        if (rslt == BMI3_OK)
-        {
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+    /* Take average of x, y and z data for lesser noise */
+    accel_avg.x = (int16_t)(temp->x / 128);
+    accel_avg.y = (int16_t)(temp->y / 128);
+    accel_avg.z = (int16_t)(temp->z / 128);
 
-            if (rslt == BMI3_OK)
-            {
-                rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, 2, dev);
-            }
-        }
-    }
+    rslt = get_accel_config(acc_cfg, dev);
 
-    return rslt;
-}
+    if (rslt == BMI3_OK)
+    {
+        /* Get the exact range value */
+        map_accel_range(acc_cfg->range, &range);
 
-/*!
- * @brief This internal API sets the self-test preconditions and triggers the self-test in the command register.
- */
-static int8_t self_test_conditions(uint8_t st_selection, struct bmi3_dev *dev)
-{
-    int8_t rslt;
+        /* Get the smallest possible measurable acceleration level given the range and
+         * resolution */
+        lsb_per_g = (uint16_t)(power(2, dev->resolution) / (2 * range));
 
-    /* Pre conditions to be checked */
-    rslt = st_precondition(st_selection, dev);
+        /* Compensate acceleration data against gravity */
+        comp_for_gravity(lsb_per_g, accel_g_value, &accel_avg, &delta);
 
-    if (rslt == BMI3_OK)
-    {
-        /* Disable alternate accel and gyro mode */
-        rslt = disable_alt_conf_acc_gyr_mode(dev);
+        /* Scale according to offset register resolution */
+        scale_accel_offset(range, &delta, &offset, dev);
 
-        if (rslt == BMI3_OK)
-        {
-            rslt = bmi3_set_command_register(BMI3_CMD_SELF_TEST_TRIGGER, dev);
-        }
+        /* Invert the accelerometer offset data */
+        invert_accel_offset(&offset);
+
+        /* Write offset data in the offset compensation register */
+        rslt = bmi3_set_acc_dp_off_dgain(&offset, dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API is used to disable alternate config accel and gyro mode for self-test precondition.
+ * @brief This internal API sets the accelerometer and FIFO configurations for the FIFO
+ * based accelerometer FOC and flushes the FIFO.
  */
-static int8_t disable_alt_conf_acc_gyr_mode(struct bmi3_dev *dev)
+static int8_t set_accel_foc_fifo_config(struct bmi3_dev *dev)
 {
+    /* Variable to store result of API */
     int8_t rslt;
 
-    struct bmi3_alt_accel_config alt_acc_cfg;
+    /* Variable to set the accelerometer configuration value */
+    uint8_t acc_conf_data[2] = { BMI3_FOC_FIFO_ACC_CONF_VAL_LSB, BMI3_FOC_ACC_CONF_VAL_MSB };
 
-    struct bmi3_alt_gyro_config alt_gyr_cfg;
+    /* Variable to store only accelerometer frames in the FIFO */
+    uint8_t fifo_conf[2] = { 0, (uint8_t)(BMI3_FIFO_ACC_EN >> 8) };
 
-    rslt = get_alternate_accel_config(&alt_acc_cfg, dev);
+    /* Variable to flush the FIFO */
+    uint8_t fifo_ctrl[2] = { BMI3_FIFO_FLUSH_MASK, 0 };
+
+    rslt = bmi3_set_regs(BMI3_REG_ACC_CONF, acc_conf_data, 2, dev);
 
     if (rslt == BMI3_OK)
     {
-        alt_acc_cfg.alt_acc_mode = BMI3_DISABLE;
-
-        rslt = set_alternate_accel_config(&alt_acc_cfg, dev);
-
-        if (rslt == BMI3_OK)
-        {
-            rslt = get_alternate_gyro_config(&alt_gyr_cfg, dev);
-
-            if (rslt == BMI3_OK)
-            {
-                alt_gyr_cfg.alt_gyro_mode = BMI3_DISABLE;
+        rslt = bmi3_set_regs(BMI3_REG_FIFO_CONF, fifo_conf, 2, dev);
+    }
 
-                rslt = set_alternate_gyro_config(&alt_gyr_cfg, dev);
-            }
-        }
+    /* Drop the frames taken with the previous configuration */
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_set_regs(BMI3_REG_FIFO_CTRL, fifo_ctrl, 2, dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API is used to get the status of gyro self-test and the result of the event.
+ * @brief This internal API drains BMI3_FOC_SAMPLE_LIMIT accelerometer frames from the FIFO
+ * and sums them.
  */
-static int8_t get_st_status_rslt(uint8_t st_selection, struct bmi3_st_result *st_result_status, struct bmi3_dev *dev)
+static int8_t get_accel_foc_fifo_samples(struct bmi3_foc_temp_value *temp, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt;
+    int8_t rslt = BMI3_OK;
 
-    /* Variable to define data array */
-    uint8_t data_array[2];
+    /* Array to store one burst of FIFO data */
+    uint8_t fifo_data[BMI3_FOC_FIFO_BUF_SIZE] = { 0 };
 
-    /* Variable to define reg data */
-    uint8_t reg_data[2];
+    /* Structure to define FIFO frame */
+    struct bmi3_fifo_frame fifo = { 0 };
 
-    /* Variable to store the self-test status if it is ongoing or completed */
-    uint8_t st_status;
+    /* Variable to store available FIFO length in words */
+    uint16_t fifo_len = 0;
 
-    /* Variable to define index */
-    uint8_t idx;
+    /* Variable to store number of frames summed */
+    uint16_t count = 0;
 
-    /* Variable to define the number of iterations */
-    uint8_t limit = 10;
+    /* Variables to store number of frames still to read from the FIFO and in the current burst */
+    uint16_t avail, frames;
 
-    /* Variable to define feature engine errors */
-    uint8_t feature_engine_err_reg_lsb, feature_engine_err_reg_msb;
+    /* Variable to store whether a FIFO read returned a valid frame */
+    uint8_t got_frame;
 
-    /* Array to set the base address of self-test feature */
-    uint8_t sc_st_base_addr[2] = { BMI3_BASE_ADDR_ST_RESULT, 0 };
+    /* Variable to define loop */
+    uint16_t idx;
 
-    st_result_status->self_test_err_rslt = 0;
+    /* Pointer to the frame being summed */
+    const uint8_t *frame;
 
-    for (idx = 0; idx < limit; idx++)
-    {
-        /* A delay of 120ms is required to read the error status register */
-        dev->delay_us(120000, dev->intf_ptr);
+    /* Variable tries max 5 times for new frames then generates timeout */
+    uint8_t try_cnt = BMI3_FOC_DRDY_TRIES;
 
-        rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO1, data_array, 2, dev);
+    fifo.data = fifo_data;
 
-        if (rslt == BMI3_OK)
+    /* Wait for the FIFO to fill, then read it in bursts of whole frames */
+    flush_and_delay(BMI3_FOC_SAMPLE_LIMIT * BMI3_FOC_FIFO_SAMPLE_US, dev);
+
+    while ((rslt == BMI3_OK) && (count < BMI3_FOC_SAMPLE_LIMIT))
+    {
+        rslt = bmi3_get_fifo_length(&fifo_len, dev);
+
+        if (rslt == BMI3_W_FIFO_EMPTY)
         {
-            st_status = (data_array[0] & BMI3_SC_ST_STATUS_MASK) >> BMI3_SC_ST_COMPLETE_POS;
+            fifo_len = 0;
+            rslt = BMI3_OK;
+        }
 
-            if (st_status == BMI3_TRUE)
-            {
-                st_result_status->self_test_rslt = (data_array[0] & BMI3_ST_RESULT_MASK) >> BMI3_ST_RESULT_POS;
+        /* Read whole frames only, and no more than still needed */
+        avail = (uint16_t)((fifo_len * 2) / BMI3_LENGTH_FIFO_ACC);
 
-                if (st_result_status->self_test_rslt != BMI3_TRUE)
-                {
-                    rslt = bmi3_get_feature_engine_error_status(&feature_engine_err_reg_lsb,
-                                                                &feature_engine_err_reg_msb,
-                                                                dev);
-                    st_result_status->self_test_err_rslt = feature_engine_err_reg_lsb & BMI3_SET_LOW_NIBBLE;
-                }
-                else
-                {
-                    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, sc_st_base_addr, 2, dev);
+        if (avail > (BMI3_FOC_SAMPLE_LIMIT - count))
+        {
+            avail = (uint16_t)(BMI3_FOC_SAMPLE_LIMIT - count);
+        }
 
-                    if (rslt == BMI3_OK)
-                    {
-                        rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, 2, dev);
+        got_frame = BMI3_FALSE;
 
-                        if ((rslt == BMI3_OK) && (st_selection == BMI3_ST_ACCEL_ONLY))
-                        {
-                            st_result_status->acc_sens_x_ok = reg_data[0] & BMI3_ST_ACC_X_OK_MASK;
-                            st_result_status->acc_sens_y_ok = (reg_data[0] & BMI3_ST_ACC_Y_OK_MASK) >>
-                                                              BMI3_ST_ACC_Y_OK_POS;
-                            st_result_status->acc_sens_z_ok = (reg_data[0] & BMI3_ST_ACC_Z_OK_MASK) >>
-                                                              BMI3_ST_ACC_Z_OK_POS;
-
-                            st_result_status->gyr_sens_x_ok = BMI3_DISABLE;
-                            st_result_status->gyr_sens_y_ok = BMI3_DISABLE;
-                            st_result_status->gyr_sens_z_ok = BMI3_DISABLE;
-                            st_result_status->gyr_drive_ok = BMI3_DISABLE;
-                        }
+        while ((rslt == BMI3_OK) && (avail != 0))
+        {
+            frames = (avail > BMI3_FOC_FIFO_BURST_FRAMES) ? BMI3_FOC_FIFO_BURST_FRAMES : avail;
+            fifo.length = (uint16_t)((frames * BMI3_LENGTH_FIFO_ACC) + dev->dummy_byte);
 
-                        if ((rslt == BMI3_OK) && (st_selection == BMI3_ST_GYRO_ONLY))
-                        {
-                            st_result_status->acc_sens_x_ok = BMI3_DISABLE;
-                            st_result_status->acc_sens_y_ok = BMI3_DISABLE;
-                            st_result_status->acc_sens_z_ok = BMI3_DISABLE;
-
-                            st_result_status->gyr_sens_x_ok = (reg_data[0] & BMI3_ST_GYR_X_OK_MASK) >>
-                                                              BMI3_ST_GYR_X_OK_POS;
-                            st_result_status->gyr_sens_y_ok = (reg_data[0] & BMI3_ST_GYR_Y_OK_MASK) >>
-                                                              BMI3_ST_GYR_Y_OK_POS;
-                            st_result_status->gyr_sens_z_ok = (reg_data[0] & BMI3_ST_GYR_Z_OK_MASK) >>
-                                                              BMI3_ST_GYR_Z_OK_POS;
-                            st_result_status->gyr_drive_ok = (reg_data[0] & BMI3_ST_GYR_DRIVE_OK_MASK) >>
-                                                             BMI3_ST_GYR_DRIVE_OK_POS;
-                        }
+            rslt = bmi3_read_fifo_data(&fifo, dev);
 
-                        if ((rslt == BMI3_OK) && (st_selection == BMI3_ST_BOTH_ACC_GYR))
-                        {
-                            st_result_status->acc_sens_x_ok = reg_data[0] & BMI3_ST_ACC_X_OK_MASK;
-                            st_result_status->acc_sens_y_ok = (reg_data[0] & BMI3_ST_ACC_Y_OK_MASK) >>
-                                                              BMI3_ST_ACC_Y_OK_POS;
-                            st_result_status->acc_sens_z_ok = (reg_data[0] & BMI3_ST_ACC_Z_OK_MASK) >>
-                                                              BMI3_ST_ACC_Z_OK_POS;
-
-                            st_result_status->gyr_sens_x_ok = (reg_data[0] & BMI3_ST_GYR_X_OK_MASK) >>
-                                                              BMI3_ST_GYR_X_OK_POS;
-                            st_result_status->gyr_sens_y_ok = (reg_data[0] & BMI3_ST_GYR_Y_OK_MASK) >>
-                                                              BMI3_ST_GYR_Y_OK_POS;
-                            st_result_status->gyr_sens_z_ok = (reg_data[0] & BMI3_ST_GYR_Z_OK_MASK) >>
-                                                              BMI3_ST_GYR_Z_OK_POS;
-                            st_result_status->gyr_drive_ok = (reg_data[0] & BMI3_ST_GYR_DRIVE_OK_MASK) >>
-                                                             BMI3_ST_GYR_DRIVE_OK_POS;
-                        }
-                    }
-                }
+            /* Sum the axes while decoding, frames the sensor marked invalid are skipped, not counted */
+            for (idx = 0; (rslt == BMI3_OK) && (idx < frames); idx++)
+            {
+                frame = &fifo_data[dev->dummy_byte + (idx * BMI3_LENGTH_FIFO_ACC)];
 
-                break;
+                if (get_fifo_word(frame) != BMI3_FIFO_ACCEL_DUMMY_FRAME)
+                {
+                    temp->x = temp->x + (int32_t)(int16_t)get_fifo_word(&frame[0]);
+                    temp->y = temp->y + (int32_t)(int16_t)get_fifo_word(&frame[2]);
+                    temp->z = temp->z + (int32_t)(int16_t)get_fifo_word(&frame[4]);
+                    count++;
+                    got_frame = BMI3_TRUE;
+                }
             }
-            else
+
+            avail = (uint16_t)(avail - frames);
+        }
+
+        if ((rslt == BMI3_OK) && (count < BMI3_FOC_SAMPLE_LIMIT))
+        {
+            if (got_frame == BMI3_FALSE)
             {
-                /* If limit elapses returning the error code, error status is returned */
-                rslt = bmi3_get_feature_engine_error_status(&feature_engine_err_reg_lsb,
-                                                            &feature_engine_err_reg_msb,
-                                                            dev);
-                st_result_status->self_test_err_rslt = feature_engine_err_reg_lsb;
+                try_cnt--;
             }
 
-            /* Checking the condition where the error status is no error */
-            if ((st_result_status->self_test_err_rslt & BMI3_SET_LOW_NIBBLE) == BMI3_NO_ERROR_MASK)
+            if (try_cnt == 0)
             {
-                st_result_status->self_test_err_rslt = BMI3_OK;
+                rslt = BMI3_E_DATA_RDY_INT_FAILED;
+            }
+            else
+            {
+                /* Wait for the missing frames */
+                flush_and_delay((BMI3_FOC_SAMPLE_LIMIT - count) * BMI3_FOC_FIFO_SAMPLE_US, dev);
             }
         }
     }
 
     return rslt;
 }
+#endif
 
+#ifndef BMI3_SELF_TEST_DISABLE
 /*!
- * @brief This internal API gets and sets the self-calibration mode given
- *  by the user in the self-calibration dma register.
+ * @brief This internal API advances the self-test by one status poll.
  */
-static int8_t get_set_sc_dma(uint8_t sc_selection, uint8_t apply_corr, struct bmi3_dev *dev)
+static int8_t step_self_test(struct bmi3_async_op *op, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    uint8_t reg_data[2];
+    /* Variable to store the self-test completion */
+    uint8_t done = BMI3_FALSE;
 
-    /* Array to set the base address of self-calibration feature */
-    uint8_t sc_base_addr[2] = { BMI3_BASE_ADDR_GYRO_SC_SELECT, 0 };
+    op->tries--;
 
-    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, sc_base_addr, 2, dev);
+    rslt = check_st_status(op->selection, op->st_result, &done, dev);
 
-    if (rslt == BMI3_OK)
+    if ((done == BMI3_FALSE) && (op->tries != 0))
     {
-        rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, 2, dev);
-
-        /* The value of apply correction is appended with the selection given by the user */
-        reg_data[0] = (apply_corr | sc_selection);
-
-        if (rslt == BMI3_OK)
-        {
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, sc_base_addr, 2, dev);
-
-            if (rslt == BMI3_OK)
-            {
-                rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, 2, dev);
-            }
-        }
+        op->wait_us = BMI3_ST_POLL_DELAY_US;
+        rslt = BMI3_W_IN_PROGRESS;
+    }
+    else if (rslt == BMI3_OK)
+    {
+        /* Restore accel configurations */
+        rslt = set_accel_config(&op->acc_cfg.cfg.acc, dev);
     }
 
     return rslt;
 }
+#endif
 
-/* This internal API is used to get the status of gyro self-calibration and the result of the event */
-static int8_t get_sc_gyro_rslt(struct bmi3_self_calib_rslt *sc_rslt, struct bmi3_dev *dev)
+/*!
+ * @brief This internal API advances the gyro self-calibration by one status poll.
+ */
+static int8_t step_gyro_sc(struct bmi3_async_op *op, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to define index */
-    uint8_t idx;
+    /* Variable to store the self-calibration completion */
+    uint8_t done = BMI3_FALSE;
 
-    /* Variable to define limit */
-    uint8_t limit = 25;
+    op->tries--;
 
-    uint8_t data_array[2];
+    rslt = check_sc_status(op->sc_rslt, &done, dev);
 
-    uint8_t sc_status;
+    if ((done == BMI3_FALSE) && (op->tries != 0))
+    {
+        op->wait_us = BMI3_ST_POLL_DELAY_US;
+        rslt = BMI3_W_IN_PROGRESS;
+    }
+    else if (rslt == BMI3_OK)
+    {
+        /* Restore accel configurations */
+        rslt = bmi3_set_sensor_config(&op->acc_cfg, 1, dev);
+    }
 
-    /* Variable to define feature engine errors */
-    uint8_t feature_engine_err_reg_lsb, feature_engine_err_reg_msb;
+    return rslt;
+}
 
-    sc_rslt->sc_error_rslt = 0;
+#ifndef BMI3_FOC_DISABLE
+/*!
+ * @brief This internal API advances the accel FOC by one data ready poll or sample.
+ */
+static int8_t step_accel_foc(struct bmi3_async_op *op, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-    for (idx = 0; idx < limit; idx++)
-    {
-        /* A delay of 120ms is required to read the error status register */
-        dev->delay_us(120000, dev->intf_ptr);
+    /* Variable to store status read from the status register */
+    uint16_t status = 0;
+
+    /* Variable to store whether a new sample is available */
+    uint8_t drdy;
 
-        rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO1, data_array, 2, dev);
+    /* Structure to receive the accel configuration used by the FOC */
+    struct bmi3_accel_config acc_cfg = { 0 };
 
-        sc_status = (data_array[0] & BMI3_SC_ST_STATUS_MASK) >> BMI3_SC_ST_COMPLETE_POS;
+    rslt = bmi3_get_sensor_status(&status, dev);
 
-        if ((sc_status == BMI3_TRUE) && (rslt == BMI3_OK))
+    if (rslt == BMI3_OK)
+    {
+        /* Position check runs at the user's ODR, the FOC itself on fresh accel samples */
+        if (op->step == BMI3_ASYNC_FOC_VERIFY)
+        {
+            drdy = (status != 0);
+        }
+        else
         {
-            sc_rslt->gyro_sc_rslt = (data_array[0] & BMI3_GYRO_SC_RESULT_MASK) >> BMI3_GYRO_SC_RESULT_POS;
+            drdy = ((status & BMI3_DRDY_ACC_MASK) != 0);
+        }
 
-            rslt = bmi3_get_feature_engine_error_status(&feature_engine_err_reg_lsb, &feature_engine_err_reg_msb, dev);
-            sc_rslt->sc_error_rslt = feature_engine_err_reg_lsb;
+        if (drdy)
+        {
+            rslt = accumulate_foc_sample(BMI3_ACCEL, &op->sum, dev);
+            op->count++;
+            op->tries = BMI3_FOC_DRDY_TRIES;
         }
         else
         {
-            /* If limit elapses returning the error code, error status is returned */
-            rslt = bmi3_get_feature_engine_error_status(&feature_engine_err_reg_lsb, &feature_engine_err_reg_msb, dev);
-            sc_rslt->sc_error_rslt = feature_engine_err_reg_lsb;
+            op->tries--;
+
+            if (op->tries == 0)
+            {
+                rslt = BMI3_E_DATA_RDY_INT_FAILED;
+            }
         }
     }
 
-    return rslt;
-}
+    if ((rslt == BMI3_OK) && (op->count == BMI3_FOC_SAMPLE_LIMIT) && (op->step == BMI3_ASYNC_FOC_VERIFY))
+    {
+        op->sum.x = (op->sum.x / BMI3_FOC_SAMPLE_LIMIT);
+        op->sum.y = (op->sum.y / BMI3_FOC_SAMPLE_LIMIT);
+        op->sum.z = (op->sum.z / BMI3_FOC_SAMPLE_LIMIT);
 
-/*!
- * @brief This internal API gets the i3c sync accelerometer data from the register.
- */
-static int8_t get_i3c_sync_accel_sensor_data(struct bmi3_i3c_sync_data *data, struct bmi3_dev *dev)
-{
-    /* Variable to store result of API */
-    int8_t rslt;
+        rslt = validate_foc_average(BMI3_ACCEL, &op->g_value, &op->sum, dev);
 
-    /* Array to define data stored in register */
-    uint8_t reg_data[BMI3_NUM_BYTES_I3C_SYNC_ACC] = { 0 };
+        if (rslt == BMI3_OK)
+        {
+            /* Get accelerometer configurations */
+            op->acc_cfg.type = BMI3_ACCEL;
 
-    /* Array to set the base address of i3c sync accel data */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_I3C_SYNC_ACC, 0 };
+            rslt = bmi3_get_sensor_config(&op->acc_cfg, 1, dev);
+        }
 
-    if (data != NULL)
-    {
-        /* Set the i3c sync accelerometer base address to feature engine transmission address to start DMA transaction
-         * */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        /* Set configurations for FOC */
+        if (rslt == BMI3_OK)
+        {
+            rslt = set_accel_foc_config(dev);
+        }
 
         if (rslt == BMI3_OK)
         {
-            /* Get the configuration from the feature engine register where i3c sync accel data resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, BMI3_NUM_BYTES_I3C_SYNC_ACC, dev);
+            op->step = BMI3_ASYNC_FOC_SAMPLE;
+            op->count = 0;
+            op->sum.x = 0;
+            op->sum.y = 0;
+            op->sum.z = 0;
+            op->wait_us = BMI3_FOC_POLL_DELAY_US;
+            rslt = BMI3_W_IN_PROGRESS;
+        }
+    }
+    else if ((rslt == BMI3_OK) && (op->count == BMI3_FOC_SAMPLE_LIMIT))
+    {
+        /* Perform accelerometer FOC */
+        rslt = apply_accel_foc(&op->g_value, &op->sum, &acc_cfg, dev);
 
-            data->sync_x = (reg_data[0] | (uint16_t)reg_data[1] << 8);
-            data->sync_y = (reg_data[2] | (uint16_t)reg_data[3] << 8);
-            data->sync_z = (reg_data[4] | (uint16_t)reg_data[5] << 8);
-            data->sync_time = (reg_data[14] | (uint16_t)reg_data[15] << 8);
+        /* Set the configurations */
+        if (rslt == BMI3_OK)
+        {
+            rslt = bmi3_set_sensor_config(&op->acc_cfg, 1, dev);
         }
     }
-    else
+    else if (rslt == BMI3_OK)
     {
-        rslt = BMI3_E_NULL_PTR;
+        op->wait_us = BMI3_FOC_POLL_DELAY_US;
+        rslt = BMI3_W_IN_PROGRESS;
     }
 
     return rslt;
 }
+#endif
 
 /*!
- * @brief This internal API gets the i3c sync gyroscope data from the register.
+ * @brief This internal API advances the axis remap by one status poll.
  */
-static int8_t get_i3c_sync_gyro_sensor_data(struct bmi3_i3c_sync_data *data, struct bmi3_dev *dev)
+static int8_t step_axes_remap(struct bmi3_async_op *op, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define data stored in register */
-    uint8_t reg_data[BMI3_NUM_BYTES_I3C_SYNC_GYR] = { 0 };
-
-    /* Array to set the base address of i3c sync gyro data */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_I3C_SYNC_GYR, 0 };
+    /* Variable to store the axis map completion */
+    uint8_t done = BMI3_FALSE;
 
-    if (data != NULL)
-    {
-        /* Set the i3c sync gyroscope base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+    op->tries--;
 
-        if (rslt == BMI3_OK)
-        {
-            /* Get the configuration from the feature engine register where i3c sync gyro data resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, BMI3_NUM_BYTES_I3C_SYNC_GYR, dev);
+    rslt = check_axis_map_status(&done, dev);
 
-            if (rslt == BMI3_OK)
-            {
-                data->sync_x = (reg_data[0] | (uint16_t)reg_data[1] << 8);
-                data->sync_y = (reg_data[2] | (uint16_t)reg_data[3] << 8);
-                data->sync_z = (reg_data[4] | (uint16_t)reg_data[5] << 8);
-                data->sync_time = (reg_data[8] | (uint16_t)reg_data[9] << 8);
-            }
-        }
+    if ((done == BMI3_FALSE) && (op->tries != 0))
+    {
+        op->wait_us = BMI3_AXIS_MAP_POLL_DELAY_US;
+        rslt = BMI3_W_IN_PROGRESS;
     }
-    else
+    else if (rslt == BMI3_OK)
     {
-        rslt = BMI3_E_NULL_PTR;
+        rslt = restore_accel_after_remap(&op->acc_cfg, dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API gets the i3c sync temperature data from the register.
+ * @brief This internal API reads the FIFO of one member of a device group.
  */
-static int8_t get_i3c_sync_temp_data(struct bmi3_i3c_sync_data *data, struct bmi3_dev *dev)
+static int8_t drain_group_member(struct bmi3_dev_group *group, uint8_t index, uint64_t now_us)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define data stored in register */
-    uint8_t reg_data[BMI3_NUM_BYTES_I3C_SYNC_TEMP] = { 0 };
+    /* Member to be serviced */
+    struct bmi3_group_member *member = &group->member[index];
 
-    /* Array to set the base address of i3c sync temperature data */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_I3C_SYNC_TEMP, 0 };
+    /* FIFO data read */
+    struct bmi3_fifo_view view = { 0 };
 
-    if (data != NULL)
+    /* Variable to store the time since the previous read */
+    uint64_t latency;
+
+    /* A single read of at most one ring buffer, so no device holds the bus for long */
+    rslt = bmi3_read_fifo_view(member->ring, &view, member->dev);
+    member->fifo_rslt = rslt;
+
+    if ((rslt == BMI3_OK) && (view.length != 0))
     {
-        /* Set the i3c sync temperature base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        group->drains++;
+        member->bytes += view.length;
 
-        if (rslt == BMI3_OK)
+        if (member->drained == BMI3_TRUE)
         {
-            /* Get the configuration from the feature engine register where i3c sync temperature data resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, BMI3_NUM_BYTES_I3C_SYNC_TEMP, dev);
+            latency = now_us - member->last_drain_us;
 
-            if (rslt == BMI3_OK)
+            if (latency > UINT32_MAX)
             {
-                data->sync_temp = (reg_data[0] | (uint16_t)reg_data[1] << 8);
-                data->sync_time = (reg_data[2] | (uint16_t)reg_data[3] << 8);
+                latency = UINT32_MAX;
+            }
+
+            group->latency_sum_us += latency;
+            group->latency_count++;
+
+            if ((uint32_t)latency > member->max_latency_us)
+            {
+                member->max_latency_us = (uint32_t)latency;
             }
         }
+
+        member->drained = BMI3_TRUE;
+        member->last_drain_us = now_us;
+
+        if (group->fifo_cb != NULL)
+        {
+            group->fifo_cb(index, &view, group->cb_ctx);
+        }
     }
-    else
+    else if (rslt < BMI3_OK)
     {
-        rslt = BMI3_E_NULL_PTR;
+        group->errors++;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API sets alternate accelerometer configurations like ODR,
- * accel mode and average number of samples.
+ * @brief This internal API computes and writes the water-mark of the acquisition engine.
  */
-static int8_t set_alternate_accel_config(const struct bmi3_alt_accel_config *config, struct bmi3_dev *dev)
+static int8_t tune_acq_wm(struct bmi3_acq *acq, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt;
+    int8_t rslt = BMI3_OK;
 
-    /* Variable to store data */
-    uint8_t reg_data[2] = { 0 };
+    /* Variable to store the frames per wakeup of the goal */
+    uint32_t frames;
 
-    uint16_t alt_acc_odr, alt_acc_avg_num, alt_acc_mode;
+    /* Variable to store the frames found beyond the water-mark */
+    uint16_t excess = (uint16_t)((acq->excess_x8 + 4) / 8);
 
-    if (config != NULL)
+    if (acq->tune == BMI3_ACQ_TUNE_WAKEUPS)
     {
-        /* Set alternate accelerometer ODR */
-        alt_acc_odr = BMI3_SET_BIT_POS0(reg_data[0], BMI3_ALT_ACC_ODR, config->alt_acc_odr);
-
-        /* Set alternate accelerometer average number of samples */
-        alt_acc_avg_num = BMI3_SET_BITS(reg_data[1], BMI3_ALT_ACC_AVG_NUM, config->alt_acc_avg_num);
+        /* Fewest frames per wakeup within the budget; 25600 frames per second at one tick each */
+        frames = (UINT32_C(25600) + ((uint32_t)acq->frame_period * acq->max_wakeups) - 1) /
+                 ((uint32_t)acq->frame_period * acq->max_wakeups);
+    }
+    else
+    {
+        /* Most frames per wakeup within the latency */
+        frames = (uint32_t)(((uint64_t)acq->target_latency_us * BMI3_SENSOR_TIME_LSB_US_DEN) /
+                            ((uint64_t)acq->frame_period * BMI3_SENSOR_TIME_LSB_US_NUM));
+    }
 
-        /* Set alternate accelerometer mode */
-        alt_acc_mode = BMI3_SET_BITS(reg_data[1], BMI3_ALT_ACC_MODE, config->alt_acc_mode);
+    /* The frames arriving between the interrupt and the read count towards both goals */
+    if (frames > excess)
+    {
+        frames -= excess;
+    }
+    else
+    {
+        frames = 1;
+    }
 
-        reg_data[0] = (uint8_t)(alt_acc_odr);
-        reg_data[1] = (uint8_t)((alt_acc_avg_num | alt_acc_mode) >> 8);
+    /* The FIFO has to hold the late frames as well */
+    if ((frames + excess) > acq->max_frames)
+    {
+        frames = (acq->max_frames > excess) ? (uint32_t)(acq->max_frames - excess) : 1;
+    }
 
-        /* Set configurations of alternate accel */
-        rslt = bmi3_set_regs(BMI3_REG_ALT_ACC_CONF, reg_data, 2, dev);
+    if (frames == 0)
+    {
+        frames = 1;
     }
-    else
+
+    if (frames != acq->wm_frames)
     {
-        rslt = BMI3_E_NULL_PTR;
+        rslt = bmi3_set_fifo_wm((uint16_t)((frames * acq->frame_len) / 2), dev);
+
+        if (rslt == BMI3_OK)
+        {
+            acq->wm_frames = (uint16_t)frames;
+            acq->wm = (uint16_t)((frames * acq->frame_len) / 2);
+            acq->retunes++;
+        }
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API gets alternate accelerometer configurations like ODR,
- * accel mode and average number of samples.
+ * @brief This internal API advances the long-running operation of one member of a device
+ * group if it is due.
  */
-static int8_t get_alternate_accel_config(struct bmi3_alt_accel_config *config, struct bmi3_dev *dev)
+static int8_t step_group_member(struct bmi3_dev_group *group, uint8_t index, uint64_t now_us)
 {
     /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Array to store data */
-    uint8_t data_array[2] = { 0 };
+    int8_t rslt = BMI3_OK;
 
-    uint16_t reg_data;
+    /* Member to be serviced */
+    struct bmi3_group_member *member = &group->member[index];
 
-    if (config != NULL)
+    if ((member->op != NULL) && (now_us >= member->op_due_us))
     {
-        /* Read the sensor configuration details */
-        rslt = bmi3_get_regs(BMI3_REG_ALT_ACC_CONF, data_array, 2, dev);
+        rslt = bmi3_async_step(member->op, member->dev);
+        group->op_steps++;
 
-        if (rslt == BMI3_OK)
+        if (rslt == BMI3_W_IN_PROGRESS)
         {
-            reg_data = data_array[0];
-
-            /* Get alternate accelerometer ODR */
-            config->alt_acc_odr = BMI3_GET_BIT_POS0(reg_data, BMI3_ALT_ACC_ODR);
-
-            reg_data = ((uint16_t)data_array[1] << 8);
-
-            /* Get alternate accelerometer average samples */
-            config->alt_acc_avg_num = BMI3_GET_BITS(reg_data, BMI3_ALT_ACC_AVG_NUM);
+            member->op_due_us = now_us + member->op->wait_us;
+            rslt = BMI3_OK;
+        }
+        else
+        {
+            /* Finished or abandoned */
+            member->op_rslt = rslt;
+            member->op = NULL;
 
-            /* Get alternate accel mode */
-            config->alt_acc_mode = BMI3_GET_BITS(reg_data, BMI3_ALT_ACC_MODE);
+            if (rslt < BMI3_OK)
+            {
+                group->errors++;
+            }
         }
     }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
-    }
 
     return rslt;
 }
 
+#ifndef BMI3_FOC_DISABLE
 /*!
- * @brief This internal API sets alternate gyro configurations like ODR,
- * gyro mode and average number of samples.
+ * @brief This internal API converts the accelerometer range value into
+ * corresponding integer value.
  */
-static int8_t set_alternate_gyro_config(const struct bmi3_alt_gyro_config *config, struct bmi3_dev *dev)
+static void map_accel_range(uint8_t range_in, uint8_t *range_out)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
+    switch (range_in)
+    {
+        case BMI3_ACC_RANGE_2G:
+            *range_out = 2;
+            break;
+        case BMI3_ACC_RANGE_4G:
+            *range_out = 4;
+            break;
+        case BMI3_ACC_RANGE_8G:
+            *range_out = 8;
+            break;
+        case BMI3_ACC_RANGE_16G:
+            *range_out = 16;
+            break;
+        default:
 
-    /* Variable to store data */
-    uint8_t reg_data[2] = { 0 };
+            /* By default RANGE 8G is set */
+            *range_out = 8;
+            break;
+    }
+}
 
-    uint16_t alt_gyro_odr, alt_gyro_avg_num, alt_gyro_mode;
+/*!
+ * @brief This internal API is used to calculate the power of a value.
+ */
+static int32_t power(int16_t base, uint8_t resolution)
+{
+    /* Initialize loop */
+    uint8_t loop = 1;
 
-    if (config != NULL)
+    /* Initialize variable to store the power of 2 value */
+    int32_t value = 1;
+
+    for (; loop <= resolution; loop++)
     {
-        /* Set alternate gyro ODR */
-        alt_gyro_odr = BMI3_SET_BIT_POS0(reg_data[0], BMI3_ALT_GYR_ODR, config->alt_gyro_odr);
+        value = (int32_t)(value * base);
+    }
 
-        /* Set alternate gyro average number of samples */
-        alt_gyro_avg_num = BMI3_SET_BITS(reg_data[1], BMI3_ALT_GYR_AVG_NUM, config->alt_gyro_avg_num);
+    return value;
+}
 
-        /* Set alternate gyro mode */
-        alt_gyro_mode = BMI3_SET_BITS(reg_data[1], BMI3_ALT_GYR_MODE, config->alt_gyro_mode);
+/*!
+ * @brief This internal API compensate the accelerometer data against gravity.
+ */
+static void comp_for_gravity(uint16_t lsb_per_g,
+                             const struct bmi3_accel_foc_g_value *g_val,
+                             const struct bmi3_sens_axes_data *data,
+                             struct bmi3_offset_delta *comp_data)
+{
+    /* Array to store the accelerometer values in LSB */
+    int16_t accel_value_lsb[3] = { 0 };
 
-        reg_data[0] = (uint8_t)(alt_gyro_odr);
-        reg_data[1] = (uint8_t)((alt_gyro_avg_num | alt_gyro_mode) >> 8);
+    /* Convert g-value to LSB */
+    accel_value_lsb[BMI3_X_AXIS] = (int16_t)(lsb_per_g * g_val->x);
+    accel_value_lsb[BMI3_Y_AXIS] = (int16_t)(lsb_per_g * g_val->y);
+    accel_value_lsb[BMI3_Z_AXIS] = (int16_t)(lsb_per_g * g_val->z);
 
-        /* Set configurations of alternate gyro */
-        rslt = bmi3_set_regs(BMI3_REG_ALT_GYR_CONF, reg_data, 2, dev);
-    }
-    else
+    /* Get the compensated values for X, Y and Z axis */
+    comp_data->x = (data->x - accel_value_lsb[BMI3_X_AXIS]);
+    comp_data->y = (data->y - accel_value_lsb[BMI3_Y_AXIS]);
+    comp_data->z = (data->z - accel_value_lsb[BMI3_Z_AXIS]);
+}
+
+/*!
+ * @brief This internal API scales the compensated accelerometer data according
+ * to the offset register resolution.
+ *
+ * @note The bit position is always greater than 0 since accelerometer data is
+ * 16 bit wide.
+ */
+static void scale_accel_offset(uint8_t range,
+                               const struct bmi3_offset_delta *comp_data,
+                               struct bmi3_acc_dp_gain_offset *data,
+                               const struct bmi3_dev *dev)
+{
+    uint8_t bit_pos;
+    uint8_t scale_factor;
+
+    switch (range)
     {
-        rslt = BMI3_E_NULL_PTR;
+        case BMI3_ACC_2G:
+            bit_pos = BMI3_ACC_2G_BIT_POS;
+            break;
+        case BMI3_ACC_4G:
+            bit_pos = BMI3_ACC_4G_BIT_POS;
+            break;
+        case BMI3_ACC_8G:
+            bit_pos = BMI3_ACC_8G_BIT_POS;
+            break;
+        case BMI3_ACC_16G:
+            bit_pos = BMI3_ACC_16G_BIT_POS;
+            break;
+        default:
+            bit_pos = 4;
+            break;
     }
 
-    return rslt;
+    scale_factor = (uint8_t)power(2, bit_pos);
+
+    data->acc_dp_off_x = (uint16_t)((comp_data->x * scale_factor) & dev->accel_bit_width);
+    data->acc_dp_off_y = (uint16_t)((comp_data->y * scale_factor) & dev->accel_bit_width);
+    data->acc_dp_off_z = (uint16_t)((comp_data->z * scale_factor) & dev->accel_bit_width);
 }
 
 /*!
- * @brief This internal API gets alternate gyro configurations like ODR,
- * gyro mode and average number of samples.
+ * @brief This internal API inverts the accelerometer offset data.
  */
-static int8_t get_alternate_gyro_config(struct bmi3_alt_gyro_config *config, struct bmi3_dev *dev)
+static void invert_accel_offset(struct bmi3_acc_dp_gain_offset *offset_data)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Array to store data */
-    uint8_t data_array[2] = { 0 };
-
-    uint16_t reg_data;
-
-    if (config != NULL)
-    {
-        /* Read the sensor configuration details */
-        rslt = bmi3_get_regs(BMI3_REG_ALT_GYR_CONF, data_array, 2, dev);
-
-        if (rslt == BMI3_OK)
-        {
-            reg_data = data_array[0];
-
-            /* Get alternate gyro ODR */
-            config->alt_gyro_odr = BMI3_GET_BIT_POS0(reg_data, BMI3_ALT_GYR_ODR);
-
-            reg_data = ((uint16_t)data_array[1] << 8);
-
-            /* Get alternate gyro average samples */
-            config->alt_gyro_avg_num = BMI3_GET_BITS(reg_data, BMI3_ALT_GYR_AVG_NUM);
-
-            /* Get alternate gyro mode */
-            config->alt_gyro_mode = BMI3_GET_BITS(reg_data, BMI3_ALT_GYR_MODE);
-        }
-    }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
-    }
-
-    return rslt;
+    /* Get the offset data */
+    offset_data->acc_dp_off_x = (uint16_t)((offset_data->acc_dp_off_x) * (BMI3_FOC_INVERT_VALUE));
+    offset_data->acc_dp_off_y = (uint16_t)((offset_data->acc_dp_off_y) * (BMI3_FOC_INVERT_VALUE));
+    offset_data->acc_dp_off_z = (uint16_t)((offset_data->acc_dp_off_z) * (BMI3_FOC_INVERT_VALUE));
 }
+#endif
 
+#ifndef BMI3_SELF_TEST_DISABLE
 /*!
- * @brief This internal API sets alternate auto configurations for feature interrupts.
+ * @brief This internal API sets the individual gyroscope
+ * filter coefficients in the respective dma registers.
  */
-static int8_t set_alternate_auto_config(const struct bmi3_auto_config_change *config, struct bmi3_dev *dev)
+static int8_t set_gyro_filter_coefficients(struct bmi3_dev *dev)
 {
-    /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define the alternate auto configuration */
-    uint8_t alt_auto_config[2] = { 0 };
-
-    /* Array to set the base address of alternate auto config */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ALT_AUTO_CONFIG, 0 };
+    uint8_t data_array[18];
 
-    uint8_t alt_switch, user_switch;
+    uint8_t gyro_filter_coeff_base_addr[2] = { BMI3_BASE_ADDR_GYRO_SC_ST_COEFFICIENTS, 0x00 };
 
-    if (config != NULL)
-    {
-        /* Set the alternate auto config base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+    data_array[0] = BMI3_SC_ST_VALUE_0 & BMI3_SET_LOW_BYTE;
+    data_array[1] = (BMI3_SC_ST_VALUE_0 & BMI3_SET_HIGH_BYTE) >> 8;
+    data_array[2] = BMI3_SC_ST_VALUE_1 & BMI3_SET_LOW_BYTE;
+    data_array[3] = (BMI3_SC_ST_VALUE_1 & BMI3_SET_HIGH_BYTE) >> 8;
+    data_array[4] = BMI3_SC_ST_VALUE_2 & BMI3_SET_LOW_BYTE;
+    data_array[5] = (BMI3_SC_ST_VALUE_2 & BMI3_SET_HIGH_BYTE) >> 8;
+    data_array[6] = BMI3_SC_ST_VALUE_3 & BMI3_SET_LOW_BYTE;
+    data_array[7] = (BMI3_SC_ST_VALUE_3 & BMI3_SET_HIGH_BYTE) >> 8;
+    data_array[8] = BMI3_SC_ST_VALUE_4 & BMI3_SET_LOW_BYTE;
+    data_array[9] = (BMI3_SC_ST_VALUE_4 & BMI3_SET_HIGH_BYTE) >> 8;
+    data_array[10] = BMI3_SC_ST_VALUE_5 & BMI3_SET_LOW_BYTE;
 
-        if (rslt == BMI3_OK)
-        {
-            /* Set alternate switch config */
-            alt_switch = BMI3_SET_BIT_POS0(alt_auto_config[0],
-                                           BMI3_ALT_CONF_ALT_SWITCH,
-                                           config->alt_conf_alt_switch_src_select);
+    /* Since high byte for BMI3_SC_ST_VALUE_5 is zero, this variable has been directly assigned to zero */
+    data_array[11] = 0;
 
-            /* Set alternate user config */
-            user_switch = BMI3_SET_BITS(alt_auto_config[0],
-                                        BMI3_ALT_CONF_USER_SWITCH,
-                                        config->alt_conf_user_switch_src_select);
+    data_array[12] = BMI3_SC_ST_VALUE_6 & BMI3_SET_LOW_BYTE;
+    data_array[13] = (BMI3_SC_ST_VALUE_6 & BMI3_SET_HIGH_BYTE) >> 8;
+    data_array[14] = BMI3_SC_ST_VALUE_7 & BMI3_SET_LOW_BYTE;
+    data_array[15] = (BMI3_SC_ST_VALUE_7 & BMI3_SET_HIGH_BYTE) >> 8;
+    data_array[16] = BMI3_SC_ST_VALUE_8 & BMI3_SET_LOW_BYTE;
+    data_array[17] = (BMI3_SC_ST_VALUE_8 & BMI3_SET_HIGH_BYTE) >> 8;
 
-            alt_auto_config[0] = alt_switch | user_switch;
+    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, gyro_filter_coeff_base_addr, 2, dev);
 
-            /* Set the configuration back to the feature engine register */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, alt_auto_config, 2, dev);
-        }
-    }
-    else
+    if (rslt == BMI3_OK)
     {
-        rslt = BMI3_E_NULL_PTR;
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, data_array, 18, dev);
     }
 
     return rslt;
 }
+#endif
 
 /*!
- * @brief This internal API gets alternate auto configurations for feature interrupts.
+ * @brief This internal API checks data index for data parsing.
  */
-static int8_t get_alternate_auto_config(struct bmi3_auto_config_change *config, struct bmi3_dev *dev)
+static int8_t check_data_index(uint16_t data_index, const struct bmi3_fifo_frame *fifo)
 {
-    /* Variable to store result of API */
     int8_t rslt;
+    uint16_t fifo_index = 0;
 
-    /* Array to define the alternate auto configuration */
-    uint8_t alt_auto_config[2] = { 0 };
-
-    /* Array to set the base address of alternate auto config */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ALT_AUTO_CONFIG, 0 };
+    if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_ACC_FRM)
+    {
+        fifo_index += BMI3_LENGTH_FIFO_ACC;
+    }
 
-    if (config != NULL)
+    if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_GYR_FRM)
     {
-        /* Set the alternate auto config base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        fifo_index += BMI3_LENGTH_FIFO_GYR;
+    }
 
-        if (rslt == BMI3_OK)
-        {
-            /* Get the configuration from the feature engine register where alternate config feature resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, alt_auto_config, 2, dev);
+    if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_TEMP_FRM)
+    {
+        fifo_index += BMI3_LENGTH_TEMPERATURE;
+    }
 
-            if (rslt == BMI3_OK)
-            {
-                /* Get alternate switch config */
-                config->alt_conf_alt_switch_src_select = alt_auto_config[0] & BMI3_ALT_CONF_ALT_SWITCH_MASK;
+    if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
+    {
+        fifo_index += BMI3_LENGTH_SENSOR_TIME;
+    }
 
-                /* Get alternate user config */
-                config->alt_conf_user_switch_src_select = (alt_auto_config[0] & BMI3_ALT_CONF_USER_SWITCH_MASK) >>
-                                                          BMI3_ALT_CONF_USER_SWITCH_POS;
-            }
-        }
+    if ((data_index + fifo_index) < fifo->length)
+    {
+        rslt = BMI3_OK;
     }
     else
     {
-        rslt = BMI3_E_NULL_PTR;
+        rslt = BMI3_W_FIFO_INVALID_FRAME;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API is used to monitor the accel power mode during the axis remap.
+ * @brief This internal API returns the length of one headerless FIFO frame.
  */
-static int8_t axes_remap_acc_power_mode_status(struct bmi3_sens_config config, struct bmi3_dev *dev)
+static uint16_t get_fifo_frame_length(uint16_t available_fifo_sens)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
-
-    uint16_t int_status;
-
-    /* Variable to define feature engine errors */
-    uint8_t feature_engine_err_reg_lsb, feature_engine_err_reg_msb;
-
-    /* Variable to store the accel power mode during axis remap */
-    uint8_t acc_power_mode_status;
-
-    /* Variable to loop */
-    uint8_t index;
-
-    /* Variable to store time out value */
-    uint8_t time_out = 20;
-
-    /* Delay to read feature engine error status */
-    uint16_t axis_remap_delay = 5000;
-
-    config.type = BMI3_ACCEL;
+    uint16_t frame_len = 0;
 
-    rslt = bmi3_get_sensor_config(&config, 1, dev);
-
-    if ((rslt == BMI3_OK) && (config.cfg.acc.acc_mode != BMI3_ACC_MODE_DISABLE))
+    if (available_fifo_sens & BMI3_FIFO_HEAD_LESS_ACC_FRM)
     {
-        acc_power_mode_status = config.cfg.acc.acc_mode;
-
-        config.cfg.acc.acc_mode = BMI3_ACC_MODE_DISABLE;
-
-        rslt = bmi3_set_sensor_config(&config, 1, dev);
-
-        if (rslt == BMI3_OK)
-        {
-            /* Axis mapping gets updated */
-            rslt = bmi3_set_command_register(BMI3_CMD_AXIS_MAP_UPDATE, dev);
-
-            for (index = 0; index < time_out; index++)
-            {
-                dev->delay_us(axis_remap_delay, dev->intf_ptr);
-
-                rslt = bmi3_get_feature_engine_error_status(&feature_engine_err_reg_lsb,
-                                                            &feature_engine_err_reg_msb,
-                                                            dev);
-
-                if ((feature_engine_err_reg_lsb & BMI3_NO_ERROR_MASK) &&
-                    (feature_engine_err_reg_msb & (BMI3_AXIS_MAP_COMPLETE_MASK >> 8)))
-                {
-                    break;
-                }
-            }
-
-            config.cfg.acc.acc_mode = acc_power_mode_status;
-
-            if (rslt == BMI3_OK)
-            {
-                /* Clearing status registers by reading it, before powering up accelerometer */
-                rslt = bmi3_get_int1_status(&int_status, dev);
-
-                if (rslt == BMI3_OK)
-                {
-                    rslt = bmi3_set_sensor_config(&config, 1, dev);
-                }
-            }
-        }
+        frame_len += BMI3_LENGTH_FIFO_ACC;
     }
-    else if (rslt == BMI3_OK)
+
+    if (available_fifo_sens & BMI3_FIFO_HEAD_LESS_GYR_FRM)
     {
-        /* Axis mapping gets updated */
-        rslt = bmi3_set_command_register(BMI3_CMD_AXIS_MAP_UPDATE, dev);
+        frame_len += BMI3_LENGTH_FIFO_GYR;
     }
 
-    return rslt;
-}
-
-/*!
- * @brief This internal API verifies and allows only the correct position to do Fast Offset Compensation for
- * accelerometer.
- */
-static int8_t verify_foc_position(uint8_t sens_list,
-                                  const struct bmi3_accel_foc_g_value *accel_g_axis,
-                                  struct bmi3_dev *dev)
-{
-    /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Structure to define accelerometer sensor axes */
-    struct bmi3_sens_axes_data avg_foc_data = { 0 };
-
-    /* Structure to store temporary accelerometer values */
-    struct bmi3_foc_temp_value temp_foc_data = { 0 };
-
-    rslt = get_average_of_sensor_data(sens_list, &temp_foc_data, dev);
-
-    if (rslt == BMI3_OK)
+    if (available_fifo_sens & BMI3_FIFO_HEAD_LESS_TEMP_FRM)
     {
-        if (sens_list == BMI3_ACCEL)
-        {
-            /* Taking modulus to make negative values as positive */
-            if ((accel_g_axis->x == 1) && (accel_g_axis->sign == 1))
-            {
-                temp_foc_data.x = temp_foc_data.x * BMI3_FOC_INVERT_VALUE;
-            }
-            else if ((accel_g_axis->y == 1) && (accel_g_axis->sign == 1))
-            {
-                temp_foc_data.y = temp_foc_data.y * BMI3_FOC_INVERT_VALUE;
-            }
-            else if ((accel_g_axis->z == 1) && (accel_g_axis->sign == 1))
-            {
-                temp_foc_data.z = temp_foc_data.z * BMI3_FOC_INVERT_VALUE;
-            }
-        }
-
-        avg_foc_data.x = (int16_t)(temp_foc_data.x);
-        avg_foc_data.y = (int16_t)(temp_foc_data.y);
-        avg_foc_data.z = (int16_t)(temp_foc_data.z);
+        frame_len += BMI3_LENGTH_TEMPERATURE;
+    }
 
-        rslt = validate_foc_position(sens_list, accel_g_axis, avg_foc_data, dev);
+    if (available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
+    {
+        frame_len += BMI3_LENGTH_SENSOR_TIME;
     }
 
-    return rslt;
+    return frame_len;
+}
+
+/*!
+ * @brief This internal API reads a little-endian word from FIFO data.
+ */
+static uint16_t get_fifo_word(const uint8_t *data)
+{
+    return (uint16_t)(data[0] | ((uint16_t)data[1] << 8));
 }
 
 /*!
- * @brief This internal API reads and provides average for 128 samples of sensor data for accel FOC.
+ * @brief This internal API gets the FIFO frame configuration, read from the sensor only
+ * if the device structure holds no valid copy.
  */
-static int8_t get_average_of_sensor_data(uint8_t sens_list,
-                                         struct bmi3_foc_temp_value *temp_foc_data,
-                                         struct bmi3_dev *dev)
+static int8_t get_fifo_sens(uint16_t *available_fifo_sens, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Structure to store sensor data */
-    struct bmi3_sensor_data sensor_data = { 0 };
-
-    uint8_t sample_count = 0;
-    uint8_t datardy_try_cnt;
-    uint16_t drdy_status = 0;
-
-    /* Assign sensor list to type */
-    sensor_data.type = sens_list;
+    int8_t rslt = BMI3_OK;
 
-    rslt = null_ptr_check(dev);
+    /* Array to store FIFO configuration data */
+    uint8_t config_data[2] = { 0 };
 
-    if (rslt == BMI3_OK)
+    if (dev->fifo_conf_valid != BMI3_TRUE)
     {
-        /* Read sensor values before FOC */
-        while (sample_count < BMI3_FOC_SAMPLE_LIMIT)
-        {
-            datardy_try_cnt = 5;
-            do
-            {
-                dev->delay_us(20000, dev->intf_ptr);
-                rslt = bmi3_get_sensor_status(&drdy_status, dev);
-                datardy_try_cnt--;
-            } while ((rslt == BMI3_OK) && (!(drdy_status)) && (datardy_try_cnt));
-
-            if ((rslt != BMI3_OK) || (datardy_try_cnt == 0))
-            {
-                rslt = BMI3_E_DATA_RDY_INT_FAILED;
-                break;
-            }
-
-            rslt = bmi3_get_sensor_data(&sensor_data, 1, dev);
-
-            if (rslt == BMI3_OK)
-            {
-                if (sensor_data.type == BMI3_ACCEL)
-                {
-                    temp_foc_data->x += sensor_data.sens_data.acc.x;
-                    temp_foc_data->y += sensor_data.sens_data.acc.y;
-                    temp_foc_data->z += sensor_data.sens_data.acc.z;
-                }
-                else if (sensor_data.type == BMI3_GYRO)
-                {
-                    temp_foc_data->x += sensor_data.sens_data.gyr.x;
-                    temp_foc_data->y += sensor_data.sens_data.gyr.y;
-                    temp_foc_data->z += sensor_data.sens_data.gyr.z;
-                }
-            }
-            else
-            {
-                break;
-            }
-
-            sample_count++;
-        }
+        rslt = bmi3_get_regs(BMI3_REG_FIFO_CONF, config_data, 2, dev);
 
         if (rslt == BMI3_OK)
         {
-            temp_foc_data->x = (temp_foc_data->x / BMI3_FOC_SAMPLE_LIMIT);
-            temp_foc_data->y = (temp_foc_data->y / BMI3_FOC_SAMPLE_LIMIT);
-            temp_foc_data->z = (temp_foc_data->z / BMI3_FOC_SAMPLE_LIMIT);
+            dev->fifo_conf = (uint16_t)(config_data[0] | ((uint16_t)config_data[1] << 8));
+            dev->fifo_conf_valid = BMI3_TRUE;
         }
     }
 
+    if (rslt == BMI3_OK)
+    {
+        *available_fifo_sens = (uint16_t)(dev->fifo_conf & BMI3_FIFO_ALL_EN);
+    }
+
     return rslt;
 }
 
 /*!
- * @brief This internal API validates accel FOC position as per the range
+ * @brief This internal API updates the copy of the FIFO configuration register from a
+ * register write covering it, and drops it on a command.
  */
-static int8_t validate_foc_position(uint8_t sens_list,
-                                    const struct bmi3_accel_foc_g_value *accel_g_axis,
-                                    struct bmi3_sens_axes_data avg_foc_data,
-                                    struct bmi3_dev *dev)
+static void track_fifo_conf(uint8_t reg_addr, const uint8_t *data, uint16_t len, struct bmi3_dev *dev)
 {
-    /* Variable to store result of API */
-    int8_t rslt = BMI3_E_INVALID_INPUT;
+    /* Variable to store the byte offset of the FIFO configuration register in data */
+    uint16_t offset;
 
-    if (sens_list == BMI3_ACCEL)
+    if (reg_addr == BMI3_REG_CMD)
     {
-        if (accel_g_axis->x == 1)
-        {
-            rslt = validate_foc_accel_axis(avg_foc_data.x, dev);
-        }
-        else if (accel_g_axis->y == 1)
-        {
-            rslt = validate_foc_accel_axis(avg_foc_data.y, dev);
-        }
-        else
+        /* A command, soft-reset included, may change the FIFO configuration */
+        dev->fifo_conf_valid = BMI3_FALSE;
+    }
+    else if ((reg_addr <= BMI3_REG_FIFO_CONF) && (len >= 2))
+    {
+        offset = (uint16_t)((BMI3_REG_FIFO_CONF - reg_addr) * 2);
+
+        if ((offset + 2) <= len)
         {
-            rslt = validate_foc_accel_axis(avg_foc_data.z, dev);
+            dev->fifo_conf = (uint16_t)(data[offset] | ((uint16_t)data[offset + 1] << 8));
+            dev->fifo_conf_valid = BMI3_TRUE;
         }
     }
-
-    return rslt;
 }
 
 /*!
- * @brief This internal API validates accel FOC axis given as input
+ * @brief This internal API finds the end of the FIFO data in a read beyond the fill level.
  */
-static int8_t validate_foc_accel_axis(int16_t avg_foc_data, struct bmi3_dev *dev)
+static uint16_t find_fifo_end(const uint8_t *data, uint16_t length, uint16_t available_fifo_sens)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
+    /* Variable to store the length of one frame */
+    uint16_t frame_len = get_fifo_frame_length(available_fifo_sens);
 
-    /* Structure to store sensor configurations */
-    struct bmi3_sens_config sens_cfg = { 0 };
+    /* Variable to store the number of axis words at the start of a frame */
+    uint16_t axis_words = 0;
 
-    /* Variable to store accel range */
-    uint8_t range;
+    /* Variable to store the index of the frame checked */
+    uint16_t frame_idx = 0;
 
-    /* Assign the accel type */
-    sens_cfg.type = BMI3_ACCEL;
+    /* Variable to store the index of the word checked */
+    uint16_t word_idx;
 
-    /* Get accel configurations */
-    rslt = bmi3_get_sensor_config(&sens_cfg, 1, dev);
+    /* Variable to store whether all axis words of the frame are empty */
+    uint8_t empty = BMI3_FALSE;
 
-    if (rslt == BMI3_OK)
+    if (available_fifo_sens & BMI3_FIFO_HEAD_LESS_ACC_FRM)
     {
-        /* Assign accel range to variable */
-        range = sens_cfg.cfg.acc.range;
+        axis_words += 3;
+    }
 
-        /* Reference LSB value of 2G */
-        if ((range == BMI3_ACC_RANGE_2G) && (avg_foc_data > BMI3_ACC_2G_MIN_NOISE_LIMIT) &&
-            (avg_foc_data < BMI3_ACC_2G_MAX_NOISE_LIMIT))
-        {
-            rslt = BMI3_OK;
-        }
-        /* Reference LSB value of 4G */
-        else if ((range == BMI3_ACC_RANGE_4G) && (avg_foc_data > BMI3_ACC_4G_MIN_NOISE_LIMIT) &&
-                 (avg_foc_data < BMI3_ACC_4G_MAX_NOISE_LIMIT))
-        {
-            rslt = BMI3_OK;
-        }
-        /* Reference LSB value of 8G */
-        else if ((range == BMI3_ACC_RANGE_8G) && (avg_foc_data > BMI3_ACC_8G_MIN_NOISE_LIMIT) &&
-                 (avg_foc_data < BMI3_ACC_8G_MAX_NOISE_LIMIT))
-        {
-            rslt = BMI3_OK;
-        }
-        /* Reference LSB value of 16G */
-        else if ((range == BMI3_ACC_RANGE_16G) && (avg_foc_data > BMI3_ACC_16G_MIN_NOISE_LIMIT) &&
-                 (avg_foc_data < BMI3_ACC_16G_MAX_NOISE_LIMIT))
+    if (available_fifo_sens & BMI3_FIFO_HEAD_LESS_GYR_FRM)
+    {
+        axis_words += 3;
+    }
+
+    while ((empty == BMI3_FALSE) && ((frame_idx + frame_len) <= length))
+    {
+        /* A valid sample may read 0x8000 on one axis, not on all of them */
+        empty = BMI3_TRUE;
+
+        for (word_idx = 0; (word_idx < axis_words) && (empty == BMI3_TRUE); word_idx++)
         {
-            rslt = BMI3_OK;
+            if (get_fifo_word(&data[frame_idx + (word_idx * 2)]) != BMI3_FIFO_EMPTY_WORD)
+            {
+                empty = BMI3_FALSE;
+            }
         }
-        else
+
+        if (empty == BMI3_FALSE)
         {
-            rslt = BMI3_E_INVALID_FOC_POSITION;
+            frame_idx = (uint16_t)(frame_idx + frame_len);
         }
     }
 
-    return rslt;
-}
-
-/*!
- * @brief This internal API sets configurations for performing accelerometer FOC.
- */
-static int8_t set_accel_foc_config(struct bmi3_dev *dev)
-{
-    /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Variable to set the accelerometer configuration value */
-    uint8_t acc_conf_data[2] = { BMI3_FOC_ACC_CONF_VAL_LSB, BMI3_FOC_ACC_CONF_VAL_MSB };
-
-    /* Set accelerometer configurations to 50Hz */
-    rslt = bmi3_set_regs(BMI3_REG_ACC_CONF, acc_conf_data, 2, dev);
-
-    return rslt;
+    return frame_idx;
 }
 
 /*!
- * @brief This internal API performs Fast Offset Compensation for accelerometer.
+ * @brief This internal API walks headerless FIFO frames once and demultiplexes
+ * accelerometer, gyroscope, temperature and sensor time data.
  */
-static int8_t perform_accel_foc(const struct bmi3_accel_foc_g_value *accel_g_value,
-                                struct bmi3_accel_config *acc_cfg,
-                                struct bmi3_dev *dev)
+static int8_t demux_fifo_frames(const uint8_t *data,
+                                uint16_t length,
+                                uint16_t available_fifo_sens,
+                                struct bmi3_fifo_demux *demux)
 {
     /* Variable to store result of API */
-    int8_t rslt = BMI3_E_INVALID_STATUS;
-
-    /* Variable to define count */
-    uint8_t loop;
-
-    /* Variable to store status read from the status register */
-    uint16_t reg_status = 0;
-
-    /* Array of structure to store accelerometer data */
-    struct bmi3_sensor_data accel_value[128] = { { 0 } };
+    int8_t rslt = BMI3_OK;
 
-    /* Structure to store accelerometer data temporarily */
-    struct bmi3_foc_temp_value temp = { 0, 0, 0 };
+    /* Structure to store the frame being parsed */
+    struct bmi3_fifo_frame_sample sample = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, 0, 0, 0 };
 
-    /* Structure to store the average of accelerometer data */
-    struct bmi3_sens_axes_data accel_avg = { 0 };
+    /* Byte offsets of each sensor inside a frame: accel, gyro, temperature, sensor time */
+    uint16_t gyr_offset, temp_offset, time_offset;
 
-    /* Variable to define LSB per g value */
-    uint16_t lsb_per_g = 0;
+    /* Frame length, computed once from the FIFO configuration */
+    uint16_t stride = get_fifo_frame_length(available_fifo_sens);
 
-    /* Variable to define range */
-    uint8_t range = 0;
+    /* Variable to index the frames */
+    uint32_t idx;
 
-    /* Structure to store accelerometer data deviation from ideal value */
-    struct bmi3_offset_delta delta = { 0, 0, 0 };
+    /* Pointer to the frame being parsed */
+    const uint8_t *frame;
 
-    /* Structure to store accelerometer offset values */
-    struct bmi3_acc_dp_gain_offset offset = { 0 };
+    gyr_offset = (available_fifo_sens & BMI3_FIFO_HEAD_LESS_ACC_FRM) ? BMI3_LENGTH_FIFO_ACC : 0;
+    temp_offset =
+        (uint16_t)(gyr_offset + ((available_fifo_sens & BMI3_FIFO_HEAD_LESS_GYR_FRM) ? BMI3_LENGTH_FIFO_GYR : 0));
+    time_offset =
+        (uint16_t)(temp_offset + ((available_fifo_sens & BMI3_FIFO_HEAD_LESS_TEMP_FRM) ? BMI3_LENGTH_TEMPERATURE : 0));
 
-    /* Variable tries max 5 times for interrupt then generates timeout */
-    uint8_t try_cnt;
+    /* Frames are only produced when accel or gyro is part of the FIFO */
+    if (!(available_fifo_sens & (BMI3_FIFO_HEAD_LESS_ACC_FRM | BMI3_FIFO_HEAD_LESS_GYR_FRM)))
+    {
+        rslt = BMI3_W_FIFO_INVALID_FRAME;
+    }
 
-    for (loop = 0; loop < BMI3_FOC_SAMPLE_LIMIT; loop++)
+    for (idx = 0; (rslt == BMI3_OK) && ((idx + stride) <= length); idx += stride)
     {
-        try_cnt = 5;
+        frame = &data[idx];
+        sample.valid = 0;
+        sample.sensor_time = 0;
 
-        while (try_cnt && (!(reg_status & BMI3_DRDY_ACC_MASK)))
+        if (available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
         {
-            /* 20ms delay for 50Hz ODR */
-            dev->delay_us(20000, dev->intf_ptr);
-            rslt = bmi3_get_sensor_status(&reg_status, dev);
-            try_cnt--;
-        }
+            sample.sensor_time = get_fifo_word(&frame[time_offset]);
+            sample.valid |= BMI3_FIFO_TIME_EN;
 
-        if ((rslt == BMI3_OK) && (reg_status & BMI3_DRDY_ACC_MASK))
-        {
-            rslt = get_accel_sensor_data(&accel_value[loop].sens_data.acc, BMI3_REG_ACC_DATA_X, dev);
+            if ((demux->sensor_time != NULL) && (demux->sensor_time_frames < demux->sensor_time_len))
+            {
+                demux->sensor_time[demux->sensor_time_frames++] = sample.sensor_time;
+            }
         }
 
-        if (rslt == BMI3_OK)
+        if (available_fifo_sens & BMI3_FIFO_HEAD_LESS_ACC_FRM)
         {
-            /* Store the data in a temporary structure */
-            temp.x = temp.x + (int32_t)accel_value[loop].sens_data.acc.x;
-            temp.y = temp.y + (int32_t)accel_value[loop].sens_data.acc.y;
-            temp.z = temp.z + (int32_t)accel_value[loop].sens_data.acc.z;
+            sample.acc.x = (int16_t)get_fifo_word(&frame[0]);
+            sample.acc.y = (int16_t)get_fifo_word(&frame[2]);
+            sample.acc.z = (int16_t)get_fifo_word(&frame[4]);
+            sample.acc.sensor_time = sample.sensor_time;
+
+            if ((uint16_t)sample.acc.x != BMI3_FIFO_ACCEL_DUMMY_FRAME)
+            {
+                sample.valid |= BMI3_FIFO_ACC_EN;
+
+                if ((demux->accel_data != NULL) && (demux->accel_frames < demux->accel_len))
+                {
+                    demux->accel_data[demux->accel_frames++] = sample.acc;
+                }
+            }
         }
-        else
+
+        if (available_fifo_sens & BMI3_FIFO_HEAD_LESS_GYR_FRM)
         {
-            break;
-        }
-    }
+            sample.gyr.x = (int16_t)get_fifo_word(&frame[gyr_offset]);
+            sample.gyr.y = (int16_t)get_fifo_word(&frame[gyr_offset + 2]);
+            sample.gyr.z = (int16_t)get_fifo_word(&frame[gyr_offset + 4]);
+            sample.gyr.sensor_time = sample.sensor_time;
 
-    if (rslt == BMI3_OK)
-    {
-        /* Take average of x, y and z data for lesser noise */
-        accel_avg.x = (int16_t)(temp.x / 128);
-        accel_avg.y = (int16_t)(temp.y / 128);
-        accel_avg.z = (int16_t)(temp.z / 128);
+            if ((uint16_t)sample.gyr.x != BMI3_FIFO_GYRO_DUMMY_FRAME)
+            {
+                sample.valid |= BMI3_FIFO_GYR_EN;
 
-        rslt = get_accel_config(acc_cfg, dev);
+                if ((demux->gyro_data != NULL) && (demux->gyro_frames < demux->gyro_len))
+                {
+                    demux->gyro_data[demux->gyro_frames++] = sample.gyr;
+                }
+            }
+        }
 
-        if (rslt == BMI3_OK)
+        if (available_fifo_sens & BMI3_FIFO_HEAD_LESS_TEMP_FRM)
         {
-            /* Get the exact range value */
-            map_accel_range(acc_cfg->range, &range);
-
-            /* Get the smallest possible measurable acceleration level given the range and
-             * resolution */
-            lsb_per_g = (uint16_t)(power(2, dev->resolution) / (2 * range));
+            sample.temp_data = get_fifo_word(&frame[temp_offset]);
 
-            /* Compensate acceleration data against gravity */
-            comp_for_gravity(lsb_per_g, accel_g_value, &accel_avg, &delta);
+            if (sample.temp_data != BMI3_FIFO_TEMP_DUMMY_FRAME)
+            {
+                sample.valid |= BMI3_FIFO_TEMP_EN;
 
-            /* Scale according to offset register resolution */
-            scale_accel_offset(range, &delta, &offset, dev);
+                if ((demux->temp_data != NULL) && (demux->temp_frames < demux->temp_len))
+                {
+                    demux->temp_data[demux->temp_frames].temp_data = sample.temp_data;
+                    demux->temp_data[demux->temp_frames].sensor_time = sample.sensor_time;
+                    demux->temp_frames++;
+                }
+            }
+        }
 
-            /* Invert the accelerometer offset data */
-            invert_accel_offset(&offset);
+        demux->total_frames++;
 
-            /* Write offset data in the offset compensation register */
-            rslt = bmi3_set_acc_dp_off_dgain(&offset, dev);
+        if (demux->frame_cb != NULL)
+        {
+            demux->frame_cb(&sample, demux->cb_ctx);
         }
     }
 
+    if ((rslt == BMI3_OK) && (demux->total_frames == 0))
+    {
+        rslt = (length == 0) ? BMI3_W_FIFO_EMPTY : BMI3_W_PARTIAL_READ;
+    }
+
     return rslt;
 }
 
 /*!
- * @brief This internal API converts the accelerometer range value into
- * corresponding integer value.
+ * @brief This internal API clears the frame counters of the FIFO demultiplexer.
  */
-static void map_accel_range(uint8_t range_in, uint8_t *range_out)
+static void reset_fifo_demux(struct bmi3_fifo_demux *demux)
 {
-    switch (range_in)
-    {
-        case BMI3_ACC_RANGE_2G:
-            *range_out = 2;
-            break;
-        case BMI3_ACC_RANGE_4G:
-            *range_out = 4;
-            break;
-        case BMI3_ACC_RANGE_8G:
-            *range_out = 8;
-            break;
-        case BMI3_ACC_RANGE_16G:
-            *range_out = 16;
-            break;
-        default:
+    demux->accel_frames = 0;
+    demux->gyro_frames = 0;
+    demux->temp_frames = 0;
+    demux->sensor_time_frames = 0;
+    demux->total_frames = 0;
+}
 
-            /* By default RANGE 8G is set */
-            *range_out = 8;
-            break;
+/*!
+ * @brief This internal API returns the anchor of the FIFO timestamp reconstruction
+ * extended to 64 bits.
+ */
+static uint64_t get_unwrapped_anchor(const struct bmi3_fifo_time_sync *sync)
+{
+    /* Variable to store the unwrapped anchor */
+    uint64_t anchor = sync->anchor;
+
+    /* The 32-bit counter may have wrapped since the last frame, only the distance counts */
+    if (sync->synced == BMI3_TRUE)
+    {
+        anchor = sync->last_time + (uint32_t)(sync->anchor - (uint32_t)sync->last_time);
     }
+
+    return anchor;
 }
 
 /*!
- * @brief This internal API is used to calculate the power of a value.
+ * @brief This internal API returns the number of FIFO data bytes following the
+ * interface dummy bytes, bounded by the FIFO fill level if it is known.
  */
-static int32_t power(int16_t base, uint8_t resolution)
+static uint16_t get_fifo_data_length(const struct bmi3_fifo_frame *fifo, const struct bmi3_dev *dev)
 {
-    /* Initialize loop */
-    uint8_t loop = 1;
+    /* Variable to store number of FIFO bytes */
+    uint16_t length = 0;
 
-    /* Initialize variable to store the power of 2 value */
-    int32_t value = 1;
+    if (fifo->length > dev->dummy_byte)
+    {
+        length = (uint16_t)(fifo->length - dev->dummy_byte);
+    }
 
-    for (; loop <= resolution; loop++)
+    /* Do not parse past the FIFO fill level if it is known */
+    if ((fifo->available_fifo_len != 0) && ((uint16_t)(fifo->available_fifo_len * 2) < length))
     {
-        value = (int32_t)(value * base);
+        length = (uint16_t)(fifo->available_fifo_len * 2);
     }
 
-    return value;
+    return length;
 }
 
 /*!
- * @brief This internal API compensate the accelerometer data against gravity.
+ * @brief This internal API deinterleaves the axes of one sensor from headerless
+ * FIFO frames into struct-of-arrays buffers, including dummy frames.
  */
-static void comp_for_gravity(uint16_t lsb_per_g,
-                             const struct bmi3_accel_foc_g_value *g_val,
-                             const struct bmi3_sens_axes_data *data,
-                             struct bmi3_offset_delta *comp_data)
+static void decode_fifo_axes(const uint8_t *data,
+                             uint16_t length,
+                             uint16_t stride,
+                             uint16_t offset,
+                             uint16_t time_offset,
+                             uint16_t dummy_frame,
+                             struct bmi3_fifo_axes_soa *soa)
 {
-    /* Array to store the accelerometer values in LSB */
-    int16_t accel_value_lsb[3] = { 0 };
+    /* Number of frames to be decoded */
+    uint16_t count = (uint16_t)(length / stride);
 
-    /* Convert g-value to LSB */
-    accel_value_lsb[BMI3_X_AXIS] = (int16_t)(lsb_per_g * g_val->x);
-    accel_value_lsb[BMI3_Y_AXIS] = (int16_t)(lsb_per_g * g_val->y);
-    accel_value_lsb[BMI3_Z_AXIS] = (int16_t)(lsb_per_g * g_val->z);
+    /* Variable to index the frames */
+    uint16_t idx = 0;
 
-    /* Get the compensated values for X, Y and Z axis */
-    comp_data->x = (data->x - accel_value_lsb[BMI3_X_AXIS]);
-    comp_data->y = (data->y - accel_value_lsb[BMI3_Y_AXIS]);
-    comp_data->z = (data->z - accel_value_lsb[BMI3_Z_AXIS]);
-}
+    /* Pointer to the frame being decoded */
+    const uint8_t *frame;
 
-/*!
- * @brief This internal API scales the compensated accelerometer data according
- * to the offset register resolution.
- *
- * @note The bit position is always greater than 0 since accelerometer data is
- * 16 bit wide.
- */
-static void scale_accel_offset(uint8_t range,
-                               const struct bmi3_offset_delta *comp_data,
-                               struct bmi3_acc_dp_gain_offset *data,
-                               const struct bmi3_dev *dev)
-{
-    uint8_t bit_pos;
-    uint8_t scale_factor;
+    if (count > soa->len)
+    {
+        count = soa->len;
+    }
 
-    switch (range)
+    if (soa->valid != NULL)
     {
-        case BMI3_ACC_2G:
-            bit_pos = BMI3_ACC_2G_BIT_POS;
-            break;
-        case BMI3_ACC_4G:
-            bit_pos = BMI3_ACC_4G_BIT_POS;
-            break;
-        case BMI3_ACC_8G:
-            bit_pos = BMI3_ACC_8G_BIT_POS;
-            break;
-        case BMI3_ACC_16G:
-            bit_pos = BMI3_ACC_16G_BIT_POS;
-            break;
-        default:
-            bit_pos = 4;
-            break;
+        for (idx = 0; idx < ((count + 31) / 32); idx++)
+        {
+            soa->valid[idx] = 0;
+        }
+
+        idx = 0;
     }
 
-    scale_factor = (uint8_t)power(2, bit_pos);
+#if defined(BMI3_FIFO_SIMD_SSE2) || defined(BMI3_FIFO_SIMD_NEON)
 
-    data->acc_dp_off_x = (uint16_t)((comp_data->x * scale_factor) & dev->accel_bit_width);
-    data->acc_dp_off_y = (uint16_t)((comp_data->y * scale_factor) & dev->accel_bit_width);
-    data->acc_dp_off_z = (uint16_t)((comp_data->z * scale_factor) & dev->accel_bit_width);
-}
+    /* Every frame of a block is loaded as 16 bytes, so the last load must stay inside the data */
+    for (; ((idx + BMI3_FIFO_SIMD_FRAMES) <= count) &&
+         (((uint32_t)(idx + BMI3_FIFO_SIMD_FRAMES - 1) * stride + 16) <= length);
+         idx += BMI3_FIFO_SIMD_FRAMES)
+    {
+        decode_fifo_block(&data[(uint32_t)idx * stride], stride, offset, time_offset, dummy_frame, idx, soa);
+    }
+#endif
 
-/*!
- * @brief This internal API inverts the accelerometer offset data.
- */
-static void invert_accel_offset(struct bmi3_acc_dp_gain_offset *offset_data)
-{
-    /* Get the offset data */
-    offset_data->acc_dp_off_x = (uint16_t)((offset_data->acc_dp_off_x) * (BMI3_FOC_INVERT_VALUE));
-    offset_data->acc_dp_off_y = (uint16_t)((offset_data->acc_dp_off_y) * (BMI3_FOC_INVERT_VALUE));
-    offset_data->acc_dp_off_z = (uint16_t)((offset_data->acc_dp_off_z) * (BMI3_FOC_INVERT_VALUE));
+    for (; idx < count; idx++)
+    {
+        frame = &data[(uint32_t)idx * stride];
+
+        soa->x[idx] = (int16_t)get_fifo_word(&frame[offset]);
+        soa->y[idx] = (int16_t)get_fifo_word(&frame[offset + 2]);
+        soa->z[idx] = (int16_t)get_fifo_word(&frame[offset + 4]);
+
+        if (soa->sensor_time != NULL)
+        {
+            soa->sensor_time[idx] = time_offset ? get_fifo_word(&frame[time_offset]) : 0;
+        }
+
+        if ((soa->valid != NULL) && ((uint16_t)soa->x[idx] != dummy_frame))
+        {
+            soa->valid[idx / 32] |= (uint32_t)1 << (idx % 32);
+        }
+    }
+
+    soa->frames = count;
 }
 
 /*!
- * @brief This internal API sets the individual gyroscope
- * filter coefficients in the respective dma registers.
+ * @brief This internal API extracts the non-dummy frames of one sensor from FIFO data
+ * into struct-of-arrays buffers.
  */
-static int8_t set_gyro_filter_coefficients(struct bmi3_dev *dev)
+static int8_t extract_axes_soa(struct bmi3_fifo_axes_soa *soa,
+                               uint16_t sensor,
+                               const struct bmi3_fifo_frame *fifo,
+                               const struct bmi3_dev *dev)
 {
+    /* Variable to store result of API */
     int8_t rslt;
 
-    uint8_t data_array[18];
+    /* Variables to store number of FIFO bytes, frame length and byte offsets inside a frame */
+    uint16_t length, stride, offset = 0, time_offset = 0;
 
-    uint8_t gyro_filter_coeff_base_addr[2] = { BMI3_BASE_ADDR_GYRO_SC_ST_COEFFICIENTS, 0x00 };
+    /* Variable to store the dummy frame marker of the sensor */
+    uint16_t dummy_frame = BMI3_FIFO_ACCEL_DUMMY_FRAME;
 
-    data_array[0] = BMI3_SC_ST_VALUE_0 & BMI3_SET_LOW_BYTE;
-    data_array[1] = (BMI3_SC_ST_VALUE_0 & BMI3_SET_HIGH_BYTE) >> 8;
-    data_array[2] = BMI3_SC_ST_VALUE_1 & BMI3_SET_LOW_BYTE;
-    data_array[3] = (BMI3_SC_ST_VALUE_1 & BMI3_SET_HIGH_BYTE) >> 8;
-    data_array[4] = BMI3_SC_ST_VALUE_2 & BMI3_SET_LOW_BYTE;
-    data_array[5] = (BMI3_SC_ST_VALUE_2 & BMI3_SET_HIGH_BYTE) >> 8;
-    data_array[6] = BMI3_SC_ST_VALUE_3 & BMI3_SET_LOW_BYTE;
-    data_array[7] = (BMI3_SC_ST_VALUE_3 & BMI3_SET_HIGH_BYTE) >> 8;
-    data_array[8] = BMI3_SC_ST_VALUE_4 & BMI3_SET_LOW_BYTE;
-    data_array[9] = (BMI3_SC_ST_VALUE_4 & BMI3_SET_HIGH_BYTE) >> 8;
-    data_array[10] = BMI3_SC_ST_VALUE_5 & BMI3_SET_LOW_BYTE;
+    /* Variable to store the number of FIFO bytes already decoded */
+    uint16_t pos = 0;
 
-    /* Since high byte for BMI3_SC_ST_VALUE_5 is zero, this variable has been directly assigned to zero */
-    data_array[11] = 0;
+    /* Variable to index the decoded frames */
+    uint16_t idx;
 
-    data_array[12] = BMI3_SC_ST_VALUE_6 & BMI3_SET_LOW_BYTE;
-    data_array[13] = (BMI3_SC_ST_VALUE_6 & BMI3_SET_HIGH_BYTE) >> 8;
-    data_array[14] = BMI3_SC_ST_VALUE_7 & BMI3_SET_LOW_BYTE;
-    data_array[15] = (BMI3_SC_ST_VALUE_7 & BMI3_SET_HIGH_BYTE) >> 8;
-    data_array[16] = BMI3_SC_ST_VALUE_8 & BMI3_SET_LOW_BYTE;
-    data_array[17] = (BMI3_SC_ST_VALUE_8 & BMI3_SET_HIGH_BYTE) >> 8;
+    /* Free part of the output buffers */
+    struct bmi3_fifo_axes_soa free_soa = { 0 };
 
-    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, gyro_filter_coeff_base_addr, 2, dev);
+    rslt = null_ptr_check(dev);
 
-    if (rslt == BMI3_OK)
+    if ((rslt == BMI3_OK) && (soa != NULL) && (soa->x != NULL) && (soa->y != NULL) && (soa->z != NULL) &&
+        (fifo != NULL) && (fifo->data != NULL))
     {
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, data_array, 18, dev);
+        soa->frames = 0;
+
+        if (fifo->available_fifo_sens & sensor)
+        {
+            length = get_fifo_data_length(fifo, dev);
+            stride = get_fifo_frame_length(fifo->available_fifo_sens);
+
+            if ((sensor == BMI3_FIFO_HEAD_LESS_GYR_FRM) && (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_ACC_FRM))
+            {
+                offset = BMI3_LENGTH_FIFO_ACC;
+            }
+
+            if (sensor == BMI3_FIFO_HEAD_LESS_GYR_FRM)
+            {
+                dummy_frame = BMI3_FIFO_GYRO_DUMMY_FRAME;
+            }
+
+            if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
+            {
+                time_offset = (uint16_t)(stride - BMI3_LENGTH_SENSOR_TIME);
+            }
+
+            /* Frames are decoded into the free part of the buffers and the dummy frames dropped afterwards,
+             * which frees space for the frames behind them
+             */
+            while ((soa->frames < soa->len) && ((pos + stride) <= length))
+            {
+                free_soa.x = &soa->x[soa->frames];
+                free_soa.y = &soa->y[soa->frames];
+                free_soa.z = &soa->z[soa->frames];
+                free_soa.sensor_time = (soa->sensor_time != NULL) ? &soa->sensor_time[soa->frames] : NULL;
+                free_soa.len = (uint16_t)(soa->len - soa->frames);
+
+                decode_fifo_axes(&fifo->data[dev->dummy_byte + pos], (uint16_t)(length - pos), stride, offset,
+                                 time_offset, dummy_frame, &free_soa);
+
+                pos = (uint16_t)(pos + free_soa.frames * stride);
+
+                for (idx = 0; idx < free_soa.frames; idx++)
+                {
+                    if ((uint16_t)free_soa.x[idx] != dummy_frame)
+                    {
+                        soa->x[soa->frames] = free_soa.x[idx];
+                        soa->y[soa->frames] = free_soa.y[idx];
+                        soa->z[soa->frames] = free_soa.z[idx];
+
+                        if (soa->sensor_time != NULL)
+                        {
+                            soa->sensor_time[soa->frames] = free_soa.sensor_time[idx];
+                        }
+
+                        soa->frames++;
+                    }
+                }
+            }
+
+            if (soa->frames == 0)
+            {
+                rslt = BMI3_W_FIFO_EMPTY;
+            }
+        }
+        else
+        {
+            rslt = BMI3_W_FIFO_INVALID_FRAME;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
     }
 
     return rslt;
 }
 
+#if defined(BMI3_FIFO_SIMD_SSE2)
+
 /*!
- * @brief This internal API checks data index for data parsing.
+ * @brief This internal API deinterleaves BMI3_FIFO_SIMD_FRAMES headerless FIFO
+ * frames with SSE2 by transposing 8 frames of 8 words.
  */
-static int8_t check_data_index(uint16_t data_index, const struct bmi3_fifo_frame *fifo)
-{
-    int8_t rslt;
-    uint16_t fifo_index = 0;
+static void decode_fifo_block(const uint8_t *data,
+                              uint16_t stride,
+                              uint16_t offset,
+                              uint16_t time_offset,
+                              uint16_t dummy_frame,
+                              uint16_t idx,
+                              struct bmi3_fifo_axes_soa *soa)
+{
+    /* Frames, intermediate stages and words of the transpose */
+    __m128i r0, r1, r2, r3, r4, r5, r6, r7;
+    __m128i s0, s1, s2, s3, s4, s5, s6, s7;
+    __m128i word[8];
+
+    /* Variable to store the dummy frame mask */
+    int mask;
+
+    /* Loops are written out, so that the transpose stays in registers without loop peeling */
+    r0 = _mm_loadu_si128((const __m128i *)&data[0]);
+    r1 = _mm_loadu_si128((const __m128i *)&data[stride]);
+    r2 = _mm_loadu_si128((const __m128i *)&data[2 * stride]);
+    r3 = _mm_loadu_si128((const __m128i *)&data[3 * stride]);
+    r4 = _mm_loadu_si128((const __m128i *)&data[4 * stride]);
+    r5 = _mm_loadu_si128((const __m128i *)&data[5 * stride]);
+    r6 = _mm_loadu_si128((const __m128i *)&data[6 * stride]);
+    r7 = _mm_loadu_si128((const __m128i *)&data[7 * stride]);
 
-    if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_ACC_FRM)
-    {
-        fifo_index += BMI3_LENGTH_FIFO_ACC;
-    }
+    s0 = _mm_unpacklo_epi16(r0, r1);
+    s1 = _mm_unpackhi_epi16(r0, r1);
+    s2 = _mm_unpacklo_epi16(r2, r3);
+    s3 = _mm_unpackhi_epi16(r2, r3);
+    s4 = _mm_unpacklo_epi16(r4, r5);
+    s5 = _mm_unpackhi_epi16(r4, r5);
+    s6 = _mm_unpacklo_epi16(r6, r7);
+    s7 = _mm_unpackhi_epi16(r6, r7);
 
-    if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_GYR_FRM)
-    {
-        fifo_index += BMI3_LENGTH_FIFO_GYR;
-    }
+    r0 = _mm_unpacklo_epi32(s0, s2);
+    r1 = _mm_unpackhi_epi32(s0, s2);
+    r2 = _mm_unpacklo_epi32(s1, s3);
+    r3 = _mm_unpackhi_epi32(s1, s3);
+    r4 = _mm_unpacklo_epi32(s4, s6);
+    r5 = _mm_unpackhi_epi32(s4, s6);
+    r6 = _mm_unpacklo_epi32(s5, s7);
+    r7 = _mm_unpackhi_epi32(s5, s7);
 
-    if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_TEMP_FRM)
+    word[0] = _mm_unpacklo_epi64(r0, r4);
+    word[1] = _mm_unpackhi_epi64(r0, r4);
+    word[2] = _mm_unpacklo_epi64(r1, r5);
+    word[3] = _mm_unpackhi_epi64(r1, r5);
+    word[4] = _mm_unpacklo_epi64(r2, r6);
+    word[5] = _mm_unpackhi_epi64(r2, r6);
+    word[6] = _mm_unpacklo_epi64(r3, r7);
+    word[7] = _mm_unpackhi_epi64(r3, r7);
+
+    _mm_storeu_si128((__m128i *)&soa->x[idx], word[offset / 2]);
+    _mm_storeu_si128((__m128i *)&soa->y[idx], word[offset / 2 + 1]);
+    _mm_storeu_si128((__m128i *)&soa->z[idx], word[offset / 2 + 2]);
+
+    if (soa->sensor_time != NULL)
     {
-        fifo_index += BMI3_LENGTH_TEMPERATURE;
+        _mm_storeu_si128((__m128i *)&soa->sensor_time[idx], time_offset ? word[time_offset / 2] : _mm_setzero_si128());
     }
 
-    if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
+    if (soa->valid != NULL)
     {
-        fifo_index += BMI3_LENGTH_SENSOR_TIME;
+        mask = _mm_movemask_epi8(_mm_packs_epi16(_mm_cmpeq_epi16(word[offset / 2], _mm_set1_epi16((short)dummy_frame)),
+                                                 _mm_setzero_si128()));
+        soa->valid[idx / 32] |= (uint32_t)(~mask & 0xFF) << (idx % 32);
     }
+}
 
-    if ((data_index + fifo_index) < fifo->length)
+#elif defined(BMI3_FIFO_SIMD_NEON)
+
+/*!
+ * @brief This internal API deinterleaves BMI3_FIFO_SIMD_FRAMES headerless FIFO
+ * frames with NEON by transposing 8 frames of 8 words.
+ */
+static void decode_fifo_block(const uint8_t *data,
+                              uint16_t stride,
+                              uint16_t offset,
+                              uint16_t time_offset,
+                              uint16_t dummy_frame,
+                              uint16_t idx,
+                              struct bmi3_fifo_axes_soa *soa)
+{
+    /* Words of the transpose */
+    uint16x8_t word[8];
+
+    /* Intermediate stages of the transpose */
+    uint16x8x2_t t0, t1, t2, t3;
+    uint32x4x2_t u0, u1, u2, u3;
+
+    /* Variable to store the dummy frame mask */
+    uint8x8_t mask;
+
+    /* Loops are written out, so that the transpose stays in registers without loop peeling */
+    t0 = vtrnq_u16(vreinterpretq_u16_u8(vld1q_u8(&data[0])), vreinterpretq_u16_u8(vld1q_u8(&data[stride])));
+    t1 = vtrnq_u16(vreinterpretq_u16_u8(vld1q_u8(&data[2 * stride])),
+                   vreinterpretq_u16_u8(vld1q_u8(&data[3 * stride])));
+    t2 = vtrnq_u16(vreinterpretq_u16_u8(vld1q_u8(&data[4 * stride])),
+                   vreinterpretq_u16_u8(vld1q_u8(&data[5 * stride])));
+    t3 = vtrnq_u16(vreinterpretq_u16_u8(vld1q_u8(&data[6 * stride])),
+                   vreinterpretq_u16_u8(vld1q_u8(&data[7 * stride])));
+
+    /* Words 0/4 and 2/6, then 1/5 and 3/7, of frames 0-3 and 4-7 */
+    u0 = vtrnq_u32(vreinterpretq_u32_u16(t0.val[0]), vreinterpretq_u32_u16(t1.val[0]));
+    u1 = vtrnq_u32(vreinterpretq_u32_u16(t0.val[1]), vreinterpretq_u32_u16(t1.val[1]));
+    u2 = vtrnq_u32(vreinterpretq_u32_u16(t2.val[0]), vreinterpretq_u32_u16(t3.val[0]));
+    u3 = vtrnq_u32(vreinterpretq_u32_u16(t2.val[1]), vreinterpretq_u32_u16(t3.val[1]));
+
+    word[0] = vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(u0.val[0]), vget_low_u32(u2.val[0])));
+    word[1] = vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(u1.val[0]), vget_low_u32(u3.val[0])));
+    word[2] = vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(u0.val[1]), vget_low_u32(u2.val[1])));
+    word[3] = vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(u1.val[1]), vget_low_u32(u3.val[1])));
+    word[4] = vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(u0.val[0]), vget_high_u32(u2.val[0])));
+    word[5] = vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(u1.val[0]), vget_high_u32(u3.val[0])));
+    word[6] = vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(u0.val[1]), vget_high_u32(u2.val[1])));
+    word[7] = vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(u1.val[1]), vget_high_u32(u3.val[1])));
+
+    vst1q_s16(&soa->x[idx], vreinterpretq_s16_u16(word[offset / 2]));
+    vst1q_s16(&soa->y[idx], vreinterpretq_s16_u16(word[offset / 2 + 1]));
+    vst1q_s16(&soa->z[idx], vreinterpretq_s16_u16(word[offset / 2 + 2]));
+
+    if (soa->sensor_time != NULL)
     {
-        rslt = BMI3_OK;
+        vst1q_u16(&soa->sensor_time[idx], time_offset ? word[time_offset / 2] : vdupq_n_u16(0));
     }
-    else
+
+    if (soa->valid != NULL)
     {
-        rslt = BMI3_W_FIFO_INVALID_FRAME;
+        /* One bit per frame, then a horizontal add of the 8 lanes */
+        mask = vand_u8(vmovn_u16(vceqq_u16(word[offset / 2], vdupq_n_u16(dummy_frame))),
+                       vcreate_u8(0x8040201008040201ULL));
+        mask = vpadd_u8(mask, mask);
+        mask = vpadd_u8(mask, mask);
+        mask = vpadd_u8(mask, mask);
+        soa->valid[idx / 32] |= (uint32_t)(~vget_lane_u8(mask, 0) & 0xFF) << (idx % 32);
     }
-
-    return rslt;
 }
+#endif
 
 /*!
  * @brief This internal API is used to validate ODR and AVG combinations for accel
@@ -8805,6 +12414,7 @@ static int8_t gyro_skipped_samples_check(float odr, float avg)
     return rslt;
 }
 
+#ifndef BMI3_ENHANCED_FLEXIBILITY_DISABLE
 /*!
  * @brief This internal API writes the command register value to enable cfg res.
  */
@@ -8871,7 +12481,7 @@ static int8_t config_array_set_value_one_page(struct bmi3_dev *dev)
 /*!
  * @brief This internal API writes the config array.
  */
-static int8_t write_config_array(struct bmi3_dev *dev)
+static int8_t write_config_array(struct bmi3_config_upload *upload, struct bmi3_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
@@ -8880,17 +12490,17 @@ static int8_t write_config_array(struct bmi3_dev *dev)
     uint8_t reset[2] = { 0 };
 
     /* Download config code array */
-    rslt = load_config_array(bmi3_config_array_code, sizeof(bmi3_config_array_code), dev);
+    rslt = load_config_array(bmi3_config_array_code, sizeof(bmi3_config_array_code), upload, dev);
 
     if (rslt == BMI3_OK)
     {
         /* Download config array table array */
-        rslt = load_config_array(bmi3_config_array_table, sizeof(bmi3_config_array_table), dev);
+        rslt = load_config_array(bmi3_config_array_table, sizeof(bmi3_config_array_table), upload, dev);
 
         if (rslt == BMI3_OK)
         {
-            /* Download config version */
-            rslt = write_config_version(dev);
+            /* Download config version, which has the same layout as the arrays */
+            rslt = load_config_array(bmi3_config_version, sizeof(bmi3_config_version), upload, dev);
         }
     }
 
@@ -8906,127 +12516,153 @@ static int8_t write_config_array(struct bmi3_dev *dev)
 /*!
  * @brief This internal API writes config array.
  */
-static int8_t load_config_array(const uint8_t *config_array, uint16_t config_size, struct bmi3_dev *dev)
+static int8_t load_config_array(const uint8_t *config_array,
+                                uint16_t config_size,
+                                struct bmi3_config_upload *upload,
+                                struct bmi3_dev *dev)
 {
     /* Variable to define error */
-    int8_t rslt = BMI3_OK;
+    int8_t rslt;
 
     /* Variable to loop */
-    uint16_t indx;
-
-    /* Variable to get the remainder */
-    uint8_t remain = (uint8_t)((config_size - BMI3_CONFIG_ARRAY_DATA_START_ADDR) % dev->read_write_len);
+    uint16_t indx = BMI3_CONFIG_ARRAY_DATA_START_ADDR;
 
-    /* Variable to get the balance bytes */
-    uint16_t bal_byte = 0;
+    /* Variable to store the number of bytes in a burst */
+    uint16_t burst;
 
-    /* Variable to define temporary read/write length */
-    uint16_t read_write_len = 0;
+    /* First two bytes of config array denote the base address. Set it to feature engine
+     * transmission address to start DMA transaction */
+    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, config_array, 2, dev);
 
-    /* Variable to store base address of config array */
-    uint16_t config_base_addr;
-
-    /* First two bytes of config array denotes the base address */
-    config_base_addr = (config_array[0] | (uint16_t)(config_array[1] << 8));
-
-    if (!remain)
-    {
-        for (indx = BMI3_CONFIG_ARRAY_DATA_START_ADDR; indx < config_size; indx += dev->read_write_len)
-        {
-            rslt = upload_file(config_base_addr, config_array, indx, dev);
-
-            /* Increment the base address */
-            config_base_addr = config_base_addr + (dev->read_write_len / 2);
-        }
-    }
-    else
+    /* The feature engine address auto-increments, so the bursts follow each other without
+     * re-sending it, and the last burst carries whatever is left */
+    while ((rslt == BMI3_OK) && (indx < config_size))
     {
-        /* Get the balance bytes */
-        bal_byte = (uint16_t) config_size - (uint16_t) remain;
+        burst = config_size - indx;
 
-        /* Write the configuration file for the balance bytes */
-        for (indx = BMI3_CONFIG_ARRAY_DATA_START_ADDR; indx < bal_byte; indx += dev->read_write_len)
+        if (burst > dev->read_write_len)
         {
-            rslt = upload_file(config_base_addr, config_array, indx, dev);
-
-            /* Increment the base address */
-            config_base_addr = config_base_addr + (dev->read_write_len / 2);
+            burst = dev->read_write_len;
         }
 
-        if (rslt == BMI3_OK)
-        {
-            /* Update length in a temporary variable */
-            read_write_len = dev->read_write_len;
-
-            /* Write the remaining bytes in 2 bytes length */
-            dev->read_write_len = 2;
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, &config_array[indx], burst, dev);
 
-            /* Check if balance byte is zero, then replace with config array data start address. */
-            if (bal_byte == 0)
-            {
-                bal_byte = BMI3_CONFIG_ARRAY_DATA_START_ADDR;
-            }
-
-            /* Write the configuration file for the remaining bytes */
-            for (indx = bal_byte; indx < config_size; indx += dev->read_write_len)
-            {
-                rslt = upload_file(config_base_addr, config_array, indx, dev);
+        if (upload != NULL)
+        {
+            upload->bytes += burst;
+            upload->bursts++;
+        }
 
-                /* Increment the base address */
-                config_base_addr = config_base_addr + (dev->read_write_len / 2);
-            }
+        indx += burst;
+    }
 
-            /* Restore the user set length back from the temporary variable */
-            dev->read_write_len = read_write_len;
-        }
+    if ((rslt == BMI3_OK) && (upload != NULL) && (upload->verify == BMI3_ENABLE))
+    {
+        rslt = verify_config_array(config_array, config_size, upload, dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API writes config array code array and table array to feature engine register.
+ * @brief This internal API reads back a config array and compares it with the array written.
  */
-static int8_t upload_file(uint16_t config_base_addr, const uint8_t *config_array, uint16_t indx, struct bmi3_dev *dev)
+static int8_t verify_config_array(const uint8_t *config_array,
+                                  uint16_t config_size,
+                                  struct bmi3_config_upload *upload,
+                                  struct bmi3_dev *dev)
 {
+    /* Variable to define error */
     int8_t rslt;
 
-    uint8_t base_addr[2];
+    /* Array to store one burst read back */
+    uint8_t data[BMI3_CONFIG_VERIFY_BURST] = { 0 };
 
-    base_addr[0] = config_base_addr & BMI3_SET_LOW_BYTE;
-    base_addr[1] = (uint8_t)((config_base_addr & BMI3_SET_HIGH_BYTE) >> 8);
+    /* Variable to loop */
+    uint16_t indx = BMI3_CONFIG_ARRAY_DATA_START_ADDR;
 
-    /* Set the config array base address to feature engine transmission address to start DMA transaction */
-    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+    /* Variable to store the number of bytes in a burst */
+    uint16_t burst;
 
-    if (rslt == BMI3_OK)
+    /* Variable to store the maximum number of bytes in a burst, a multiple of 2 */
+    uint16_t max_burst = dev->read_write_len;
+
+    /* Variable to compare the bytes of a burst */
+    uint16_t idx;
+
+    if (max_burst > BMI3_CONFIG_VERIFY_BURST)
+    {
+        max_burst = BMI3_CONFIG_VERIFY_BURST;
+    }
+
+    /* Rewind the feature engine address to the start of the array */
+    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, config_array, 2, dev);
+
+    while ((rslt == BMI3_OK) && (indx < config_size))
     {
-        /* Set the config array data to feature engine transmission data address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, &config_array[indx], dev->read_write_len, dev);
+        burst = config_size - indx;
+
+        if (burst > max_burst)
+        {
+            burst = max_burst;
+        }
+
+        rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, data, burst, dev);
+        upload->bursts++;
+
+        for (idx = 0; (rslt == BMI3_OK) && (idx < burst); idx++)
+        {
+            if (data[idx] != config_array[indx + idx])
+            {
+                rslt = BMI3_E_CONFIG_VERIFY;
+            }
+        }
+
+        indx += burst;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API writes config version array to feature engine register.
+ * @brief This internal API unlocks the config page and writes the config array, config
+ * array table and config version.
  */
-static int8_t write_config_version(struct bmi3_dev *dev)
+static int8_t enhanced_flexibility_upload(struct bmi3_config_upload *upload, struct bmi3_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    /* Index variable to store the start address of data */
-    uint8_t indx = BMI3_CONFIG_ARRAY_DATA_START_ADDR;
+    /* The user page is not accessible while the config page is selected */
+    lock_dev(dev);
+
+    /* Bytes written are multiples of 2 */
+    if ((dev->read_write_len % 2) != 0)
+    {
+        dev->read_write_len = dev->read_write_len - 1;
+    }
+
+    /* BMI3 has 16 bit address and hence the minimum read write length should be 2 bytes */
+    if (dev->read_write_len < 2)
+    {
+        dev->read_write_len = 2;
+    }
 
-    /* Set the config array base address to feature engine transmission address to start DMA transaction */
-    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, bmi3_config_version, 2, dev);
+    rslt = config_array_set_command(dev);
 
     if (rslt == BMI3_OK)
     {
-        /* Set the config version data to feature engine transmission data address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, &bmi3_config_version[indx], 2, dev);
+        rslt = config_array_set_value_one_page(dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Write the config array */
+            rslt = write_config_array(upload, dev);
+        }
     }
 
+    unlock_dev(dev);
+
     return rslt;
 }
+#endif
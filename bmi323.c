@@ -54,31 +54,29 @@
 /*!              Static Variable
  ****************************************************************************/
 
-/*! Any-motion context parameter set for smart phone, wearable and hearable */
-static uint16_t any_motion_param_set[BMI323_PARAM_LIMIT_CONTEXT][BMI323_PARAM_LIMIT_ANY_MOT] =
-{ { 8, 1, 5, 250, 5 }, { 8, 1, 5, 250, 5 }, { 8, 1, 6, 250, 5 } };
-
-/*! No-motion context parameter set for smart phone, wearable and hearable */
-static uint16_t no_motion_param_set[BMI323_PARAM_LIMIT_CONTEXT][BMI323_PARAM_LIMIT_NO_MOT] =
-{ { 30, 1, 5, 250, 5 }, { 30, 1, 3, 250, 5 }, { 10, 1, 3, 250, 5 } };
-
-/*! Tap context parameter set for smart phone, wearable and hearable */
-static uint16_t tap_param_set[BMI323_PARAM_LIMIT_CONTEXT][BMI323_PARAM_LIMIT_WAKEUP] =
-{ { 2, 1, 6, 1, 143, 25, 4, 6, 8, 6 }, { 2, 1, 6, 2, 250, 25, 4, 6, 8, 6 }, { 2, 1, 6, 1, 750, 25, 4, 6, 8, 6 } };
-
-/*! Step counter context parameter set for smart phone, wearable and hearable */
-static uint16_t step_counter_param_set[BMI323_PARAM_LIMIT_CONTEXT][BMI323_PARAM_LIMIT_STEP_COUNT] =
-{ { 0, 0, 306, 61900, 132, 55608, 60104, 64852, 7, 1, 256, 12, 12, 3, 3900, 74, 160, 0, 0, 0, 0, 0 },
-  { 0, 0, 307, 61932, 80, 55706, 63102, 58982, 4, 1, 256, 15, 14, 3, 3900, 150, 160, 1, 3, 1, 10, 3 },
-  { 0, 0, 307, 61932, 133, 55706, 62260, 58982, 7, 1, 256, 13, 12, 3, 3900, 74, 160, 1, 3, 1, 8, 2 } };
-
-/*! Sig-motion context parameter set for smart phone, wearable and hearable */
-static uint16_t sig_motion_param_set[BMI323_PARAM_LIMIT_CONTEXT][BMI323_PARAM_LIMIT_SIG_MOT] =
-{ { 250, 60, 11, 595, 17 }, { 250, 150, 8, 595, 17 }, { 250, 38, 8, 400, 17 } };
-
-/*! Orientation context parameter set for smart phone, wearable and hearable */
-static uint16_t orientation_param_set[BMI323_PARAM_LIMIT_CONTEXT][BMI323_PARAM_LIMIT_ORIENT] =
-{ { 0, 0, 3, 38, 10, 50, 32 }, { 0, 0, 3, 38, 10, 50, 32 }, { 0, 0, 3, 38, 10, 50, 32 } };
+/*! Any-motion and no-motion feature words for smart phone, wearable and hearable */
+static const uint16_t context_motion_image[BMI323_PARAM_LIMIT_CONTEXT][BMI323_CONTEXT_MOTION_WORDS] = {
+    { BMI3_ANY_NO_MOTION_WORDS(8, 1, 5, 250, 5), BMI3_ANY_NO_MOTION_WORDS(30, 1, 5, 250, 5) },
+    { BMI3_ANY_NO_MOTION_WORDS(8, 1, 5, 250, 5), BMI3_ANY_NO_MOTION_WORDS(30, 1, 3, 250, 5) },
+    { BMI3_ANY_NO_MOTION_WORDS(8, 1, 6, 250, 5), BMI3_ANY_NO_MOTION_WORDS(10, 1, 3, 250, 5) } };
+
+/*! Sig-motion, step counter, orientation and tap feature words for smart phone, wearable and hearable */
+static const uint16_t context_gesture_image[BMI323_PARAM_LIMIT_CONTEXT][BMI323_CONTEXT_GESTURE_WORDS] = {
+    { BMI3_SIG_MOTION_WORDS(250, 60, 11, 595, 17),
+      BMI3_STEP_COUNTER_WORDS(0, 0, 306, 61900, 132, 55608, 60104, 64852, 7, 1, 256, 12, 12, 3, 3900, 74, 160, 0, 0, 0,
+                              0, 0),
+      BMI3_ORIENT_WORDS(0, 0, 3, 38, 10, 50, 32),
+      BMI3_TAP_WORDS(2, 1, 6, 1, 143, 25, 4, 6, 8, 6) },
+    { BMI3_SIG_MOTION_WORDS(250, 150, 8, 595, 17),
+      BMI3_STEP_COUNTER_WORDS(0, 0, 307, 61932, 80, 55706, 63102, 58982, 4, 1, 256, 15, 14, 3, 3900, 150, 160, 1, 3, 1,
+                              10, 3),
+      BMI3_ORIENT_WORDS(0, 0, 3, 38, 10, 50, 32),
+      BMI3_TAP_WORDS(2, 1, 6, 2, 250, 25, 4, 6, 8, 6) },
+    { BMI3_SIG_MOTION_WORDS(250, 38, 8, 400, 17),
+      BMI3_STEP_COUNTER_WORDS(0, 0, 307, 61932, 133, 55706, 62260, 58982, 7, 1, 256, 13, 12, 3, 3900, 74, 160, 1, 3, 1,
+                              8, 2),
+      BMI3_ORIENT_WORDS(0, 0, 3, 38, 10, 50, 32),
+      BMI3_TAP_WORDS(2, 1, 6, 1, 750, 25, 4, 6, 8, 6) } };
 
 /******************************************************************************/
 
@@ -173,6 +171,186 @@ int8_t bmi323_set_regs(uint8_t reg_addr, const uint8_t *data, uint16_t len, stru
     return rslt;
 }
 
+/*!
+ * @brief This API starts recording register writes in a transaction queue.
+ */
+int8_t bmi323_batch_begin(struct bmi3_batch *batch, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_batch_begin(batch, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API writes out the queued register writes and keeps queuing.
+ */
+int8_t bmi323_batch_flush(struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_batch_flush(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API writes out the queued register writes and stops queuing.
+ */
+int8_t bmi323_batch_end(struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_batch_end(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API serves register reads from a write-through shadow cache.
+ */
+int8_t bmi323_shadow_enable(struct bmi3_shadow *shadow, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_shadow_enable(shadow, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API stops using the shadow cache.
+ */
+int8_t bmi323_shadow_disable(struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_shadow_disable(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API drops all entries of the shadow cache.
+ */
+int8_t bmi323_shadow_invalidate(struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_shadow_invalidate(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets the lock hooks that serialize the accesses to the device.
+ */
+int8_t bmi323_lock_enable(bmi3_lock_fptr_t lock, bmi3_lock_fptr_t unlock, void *lock_ctx, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_lock_enable(lock, unlock, lock_ctx, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API removes the lock hooks.
+ */
+int8_t bmi323_lock_disable(struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_lock_disable(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API takes the lock of the device to make a sequence of API calls atomic.
+ */
+int8_t bmi323_dev_lock(struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_dev_lock(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API releases the lock taken by bmi323_dev_lock.
+ */
+int8_t bmi323_dev_unlock(struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_dev_unlock(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes a single-producer/single-consumer ring of FIFO frames.
+ */
+int8_t bmi323_sample_ring_init(struct bmi3_sample_ring *ring, struct bmi3_fifo_frame_sample *buf, uint16_t size)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_sample_ring_init(ring, buf, size);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API adds a frame to the ring. Called by the producer thread only.
+ */
+int8_t bmi323_sample_ring_push(struct bmi3_sample_ring *ring, const struct bmi3_fifo_frame_sample *sample)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_sample_ring_push(ring, sample);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API adds a frame to the ring given as cb_ctx.
+ */
+void bmi323_sample_ring_push_cb(const struct bmi3_fifo_frame_sample *sample, void *cb_ctx)
+{
+    bmi3_sample_ring_push_cb(sample, cb_ctx);
+}
+
+/*!
+ * @brief This API takes up to max_samples frames from the ring. Called by the consumer thread only.
+ */
+int8_t bmi323_sample_ring_pop(struct bmi3_sample_ring *ring,
+                              struct bmi3_fifo_frame_sample *samples,
+                              uint16_t max_samples,
+                              uint16_t *num_samples)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_sample_ring_pop(ring, samples, max_samples, num_samples);
+
+    return rslt;
+}
+
 /*!
  * @brief This API resets bmi323 sensor. All registers are overwritten with
  * their default values.
@@ -292,6 +470,61 @@ int8_t bmi323_get_sensor_config(struct bmi3_sens_config *sens_cfg, uint8_t n_sen
     return rslt;
 }
 
+/*!
+ * @brief This API writes consecutive words of the feature engine configuration.
+ */
+int8_t bmi323_set_feature_words(uint8_t base_addr, const uint16_t *words, uint8_t num_words, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_set_feature_words(base_addr, words, num_words, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads consecutive words of the feature engine configuration.
+ */
+int8_t bmi323_get_feature_words(uint8_t base_addr, uint16_t *words, uint8_t num_words, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_feature_words(base_addr, words, num_words, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads any set of feature engine configuration fields in one burst.
+ */
+int8_t bmi323_get_feature_fields(const uint8_t *field_id, uint16_t *value, uint8_t n_fields, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_feature_fields(field_id, value, n_fields, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API writes any set of feature engine configuration fields with one read-modify-write burst.
+ */
+int8_t bmi323_set_feature_fields(const uint8_t *field_id,
+                                 const uint16_t *value,
+                                 uint8_t n_fields,
+                                 struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_set_feature_fields(field_id, value, n_fields, dev);
+
+    return rslt;
+}
+
 /*!
  * @brief This API maps/un-maps data interrupts to that of interrupt pins.
  */
@@ -334,6 +567,20 @@ int8_t bmi323_get_sensor_data(struct bmi3_sensor_data *sensor_data, uint8_t n_se
     return rslt;
 }
 
+/*!
+ * @brief This API reads the sensor status, accelerometer, gyroscope, temperature,
+ * sensor time, saturation flags and interrupt 1 status in one transaction.
+ */
+int8_t bmi323_get_sensor_burst_data(struct bmi3_sensor_burst_data *data, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_sensor_burst_data(data, dev);
+
+    return rslt;
+}
+
 /*!
  *  @brief This API reads the error status from the sensor.
  */
@@ -469,302 +716,536 @@ int8_t bmi323_extract_temperature(struct bmi3_fifo_temperature_data *temp_data,
 }
 
 /*!
- * @brief This API parses and extracts the gyro frames from FIFO data
- * read by the "bmi323_read_fifo_data" API and stores it in the "gyro_data"
- * structure instance.
+ * @brief This API parses accelerometer, gyroscope, temperature and sensor time frames from
+ * FIFO data read by the "bmi323_read_fifo_data" API in a single pass.
  */
-int8_t bmi323_extract_gyro(struct bmi3_fifo_sens_axes_data *gyro_data,
-                           struct bmi3_fifo_frame *fifo,
-                           const struct bmi3_dev *dev)
+int8_t bmi323_extract_fifo_data(struct bmi3_fifo_demux *demux,
+                                struct bmi3_fifo_frame *fifo,
+                                const struct bmi3_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_extract_gyro(gyro_data, fifo, dev);
+    rslt = bmi3_extract_fifo_data(demux, fifo, dev);
 
     return rslt;
 }
 
 /*!
- * @brief This API sets the FIFO water-mark level in words.
+ * @brief This API parses accelerometer, gyroscope, temperature and sensor time frames from
+ * a FIFO view returned by the "bmi323_read_fifo_view" API in a single pass.
  */
-int8_t bmi323_set_fifo_wm(uint16_t fifo_wm, struct bmi3_dev *dev)
+int8_t bmi323_extract_fifo_view(struct bmi3_fifo_demux *demux, const struct bmi3_fifo_view *view)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_set_fifo_wm(fifo_wm, dev);
+    rslt = bmi3_extract_fifo_view(demux, view);
 
     return rslt;
 }
 
 /*!
- * @brief This API reads the FIFO water-mark level in words.
+ * @brief This API resets the state of the streaming FIFO parser.
  */
-int8_t bmi323_get_fifo_wm(uint16_t *fifo_wm, struct bmi3_dev *dev)
+int8_t bmi323_fifo_stream_init(struct bmi3_fifo_stream *stream)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_fifo_wm(fifo_wm, dev);
+    rslt = bmi3_fifo_stream_init(stream);
 
     return rslt;
 }
 
 /*!
- * @brief This API sets the FIFO configuration in the sensor.
+ * @brief This API parses FIFO data read by the "bmi323_read_fifo_data" API in chunks of any
+ * length, carrying an incomplete frame at the end of one read over to the next.
  */
-int8_t bmi323_set_fifo_config(uint16_t config, uint8_t enable, struct bmi3_dev *dev)
+int8_t bmi323_fifo_stream_parse(struct bmi3_fifo_stream *stream,
+                                struct bmi3_fifo_demux *demux,
+                                const struct bmi3_fifo_frame *fifo,
+                                const struct bmi3_dev *dev)
 {
+    /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_set_fifo_config(config, enable, dev);
+    rslt = bmi3_fifo_stream_parse(stream, demux, fifo, dev);
 
     return rslt;
 }
 
 /*!
- * @brief This API reads the FIFO configuration from the sensor.
+ * @brief This API initializes the FIFO timestamp reconstruction.
  */
-int8_t bmi323_get_fifo_config(uint16_t *fifo_config, struct bmi3_dev *dev)
+int8_t bmi323_fifo_time_sync_init(struct bmi3_fifo_time_sync *sync, const struct bmi3_accel_config *acc_cfg)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_fifo_config(fifo_config, dev);
+    rslt = bmi3_fifo_time_sync_init(sync, acc_cfg);
 
     return rslt;
 }
 
 /*!
- * @brief This API gets the length of FIFO data available in the sensor in
- * words.
+ * @brief This API reads the full 32-bit sensor time once, to which the next FIFO
+ * batch is aligned.
  */
-int8_t bmi323_get_fifo_length(uint16_t *fifo_avail_len, struct bmi3_dev *dev)
+int8_t bmi323_fifo_time_sync_anchor(struct bmi3_fifo_time_sync *sync, struct bmi3_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_fifo_length(fifo_avail_len, dev);
+    rslt = bmi3_fifo_time_sync_anchor(sync, dev);
 
     return rslt;
 }
 
 /*!
- * @brief This API writes the configurations of context feature for smart phone, wearables and hearables.
+ * @brief This API converts the 16-bit sensor time of a batch of FIFO frames into
+ * monotonic 64-bit sensor time.
  */
-int8_t bmi323_context_switch_selection(uint8_t context_sel, struct bmi3_dev *dev)
+int8_t bmi323_fifo_time_sync_apply(struct bmi3_fifo_time_sync *sync,
+                                   const uint16_t *sensor_time,
+                                   uint64_t *timestamp,
+                                   uint16_t frames)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    struct bmi3_sens_config sens_cfg[BMI323_MAX_FEATURE];
-
-    uint8_t index = 0;
-
-    if (context_sel < BMI323_SEL_MAX)
-    {
-        /* Set any-motion configuration */
-        sens_cfg[0].type = BMI323_ANY_MOTION;
-        sens_cfg[0].cfg.any_motion.slope_thres = any_motion_param_set[context_sel][index++];
-        sens_cfg[0].cfg.any_motion.acc_ref_up = (uint8_t)(any_motion_param_set[context_sel][index++]);
-        sens_cfg[0].cfg.any_motion.hysteresis = any_motion_param_set[context_sel][index++];
-        sens_cfg[0].cfg.any_motion.duration = any_motion_param_set[context_sel][index++];
-        sens_cfg[0].cfg.any_motion.wait_time = any_motion_param_set[context_sel][index++];
-
-        /* Set no-motion configuration */
-        index = 0;
-        sens_cfg[1].type = BMI323_NO_MOTION;
-        sens_cfg[1].cfg.no_motion.slope_thres = no_motion_param_set[context_sel][index++];
-        sens_cfg[1].cfg.no_motion.acc_ref_up = (uint8_t)(no_motion_param_set[context_sel][index++]);
-        sens_cfg[1].cfg.no_motion.hysteresis = no_motion_param_set[context_sel][index++];
-        sens_cfg[1].cfg.no_motion.duration = no_motion_param_set[context_sel][index++];
-        sens_cfg[1].cfg.no_motion.wait_time = no_motion_param_set[context_sel][index++];
-
-        /* Set tap configuration */
-        index = 0;
-        sens_cfg[2].type = BMI323_TAP;
-        sens_cfg[2].cfg.tap.axis_sel = (uint8_t)tap_param_set[context_sel][index++];
-        sens_cfg[2].cfg.tap.wait_for_timeout = (uint8_t)tap_param_set[context_sel][index++];
-        sens_cfg[2].cfg.tap.max_peaks_for_tap = (uint8_t)tap_param_set[context_sel][index++];
-        sens_cfg[2].cfg.tap.mode = (uint8_t)tap_param_set[context_sel][index++];
-        sens_cfg[2].cfg.tap.tap_peak_thres = tap_param_set[context_sel][index++];
-        sens_cfg[2].cfg.tap.max_gest_dur = (uint8_t)tap_param_set[context_sel][index++];
-        sens_cfg[2].cfg.tap.max_dur_between_peaks = (uint8_t)tap_param_set[context_sel][index++];
-        sens_cfg[2].cfg.tap.tap_shock_settling_dur = (uint8_t)tap_param_set[context_sel][index++];
-        sens_cfg[2].cfg.tap.min_quite_dur_between_taps = (uint8_t)tap_param_set[context_sel][index++];
-        sens_cfg[2].cfg.tap.quite_time_after_gest = (uint8_t)tap_param_set[context_sel][index++];
-
-        /* Set step counter configuration */
-        index = 0;
-        sens_cfg[3].type = BMI323_STEP_COUNTER;
-        sens_cfg[3].cfg.step_counter.watermark_level = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.reset_counter = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.env_min_dist_up = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.env_coef_up = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.env_min_dist_down = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.env_coef_down = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.mean_val_decay = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.mean_step_dur = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.step_buffer_size = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.filter_cascade_enabled = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.step_counter_increment = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.peak_duration_min_walking = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.peak_duration_min_running = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.activity_detection_factor = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.activity_detection_thres = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.step_duration_max = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.step_duration_window = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.step_duration_pp_enabled = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.step_duration_thres = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.mean_crossing_pp_enabled = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.mcr_threshold = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.sc_12_res = step_counter_param_set[context_sel][index++];
-
-        /* Set significant motion configuration */
-        index = 0;
-        sens_cfg[4].type = BMI323_SIG_MOTION;
-        sens_cfg[4].cfg.sig_motion.block_size = sig_motion_param_set[context_sel][index++];
-        sens_cfg[4].cfg.sig_motion.peak_2_peak_min = sig_motion_param_set[context_sel][index++];
-        sens_cfg[4].cfg.sig_motion.mcr_min = (uint8_t)sig_motion_param_set[context_sel][index++];
-        sens_cfg[4].cfg.sig_motion.peak_2_peak_max = sig_motion_param_set[context_sel][index++];
-        sens_cfg[4].cfg.sig_motion.mcr_max = (uint8_t)sig_motion_param_set[context_sel][index++];
-
-        /* Set orientation configuration */
-        index = 0;
-        sens_cfg[5].type = BMI323_ORIENTATION;
-        sens_cfg[5].cfg.orientation.ud_en = (uint8_t)orientation_param_set[context_sel][index++];
-        sens_cfg[5].cfg.orientation.mode = (uint8_t)orientation_param_set[context_sel][index++];
-        sens_cfg[5].cfg.orientation.blocking = (uint8_t)orientation_param_set[context_sel][index++];
-        sens_cfg[5].cfg.orientation.theta = (uint8_t)orientation_param_set[context_sel][index++];
-        sens_cfg[5].cfg.orientation.hold_time = (uint8_t)orientation_param_set[context_sel][index++];
-        sens_cfg[5].cfg.orientation.slope_thres = (uint8_t)orientation_param_set[context_sel][index++];
-        sens_cfg[5].cfg.orientation.hysteresis = (uint8_t)orientation_param_set[context_sel][index++];
-
-        /* Set the context configurations */
-        rslt = bmi323_set_sensor_config(sens_cfg, BMI323_MAX_FEATURE, dev);
-    }
-    else
-    {
-        rslt = BMI323_E_INVALID_CONTEXT_SEL;
-    }
+    rslt = bmi3_fifo_time_sync_apply(sync, sensor_time, timestamp, frames);
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to perform the self-test for either accel or gyro or both.
+ * @brief This API deinterleaves accelerometer and gyroscope frames from FIFO data read by the
+ * "bmi323_read_fifo_data" API into struct-of-arrays buffers.
  */
-int8_t bmi323_perform_self_test(uint8_t st_selection, struct bmi3_st_result *st_result_status, struct bmi3_dev *dev)
+int8_t bmi323_decode_fifo_frames(struct bmi3_fifo_axes_soa *acc,
+                                 struct bmi3_fifo_axes_soa *gyr,
+                                 const struct bmi3_fifo_frame *fifo,
+                                 const struct bmi3_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_perform_self_test(st_selection, st_result_status, dev);
+    rslt = bmi3_decode_fifo_frames(acc, gyr, fifo, dev);
 
     return rslt;
 }
 
 /*!
- * @brief This API writes the config array and config version in cfg res.
+ * @brief This API extracts accelerometer frames from FIFO data read by the "bmi323_read_fifo_data"
+ * API into per-axis arrays.
  */
-int8_t bmi323_configure_enhanced_flexibility(struct bmi3_dev *dev)
+int8_t bmi323_extract_accel_soa(struct bmi3_fifo_axes_soa *accel_data,
+                                struct bmi3_fifo_frame *fifo,
+                                const struct bmi3_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_configure_enhanced_flexibility(dev);
+    rslt = bmi3_extract_accel_soa(accel_data, fifo, dev);
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to get the config version.
+ * @brief This API extracts gyroscope frames from FIFO data read by the "bmi323_read_fifo_data"
+ * API into per-axis arrays.
  */
-int8_t bmi323_get_config_version(struct bmi3_config_version *config_version, struct bmi3_dev *dev)
+int8_t bmi323_extract_gyro_soa(struct bmi3_fifo_axes_soa *gyro_data,
+                               struct bmi3_fifo_frame *fifo,
+                               const struct bmi3_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_config_version(config_version, dev);
+    rslt = bmi3_extract_gyro_soa(gyro_data, fifo, dev);
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to perform the self-calibration for either sensitivity or offset or both.
+ * @brief This API computes the unit conversion factors of a sensor configuration.
  */
-int8_t bmi323_perform_gyro_sc(uint8_t sc_selection,
-                              uint8_t apply_corr,
-                              struct bmi3_self_calib_rslt *sc_rslt,
-                              struct bmi3_dev *dev)
+int8_t bmi323_get_unit_scale(const struct bmi3_sens_config *config, struct bmi3_unit_scale *scale)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_perform_gyro_sc(sc_selection, apply_corr, sc_rslt, dev);
+    rslt = bmi3_get_unit_scale(config, scale);
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to set the data sample rate for i3c sync
+ * @brief This API converts raw samples to m/s^2 or dps.
  */
-int8_t bmi323_set_i3c_tc_sync_tph(uint16_t sample_rate, struct bmi3_dev *dev)
+int8_t bmi323_convert_f32(const struct bmi3_unit_scale *scale, const int16_t *raw, uint16_t num, float *out)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_set_i3c_tc_sync_tph(sample_rate, dev);
+    rslt = bmi3_convert_f32(scale, raw, num, out);
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to get the data sample rate for i3c sync
+ * @brief This API converts raw samples to Q31 fractions of the full scale.
  */
-int8_t bmi323_get_i3c_tc_sync_tph(uint16_t *sample_rate, struct bmi3_dev *dev)
+int8_t bmi323_convert_q31(const struct bmi3_unit_scale *scale, const int16_t *raw, uint16_t num, int32_t *out)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_i3c_tc_sync_tph(sample_rate, dev);
+    rslt = bmi3_convert_q31(scale, raw, num, out);
 
     return rslt;
 }
 
 /*!
- * @brief This API is used set the TU(time unit) value is used to scale the delay time payload
- * according to the hosts needs
+ * @brief This API converts raw samples to Q15 fractions of the full scale.
  */
-int8_t bmi323_set_i3c_tc_sync_tu(uint8_t delay_time, struct bmi3_dev *dev)
+int8_t bmi323_convert_q15(const struct bmi3_unit_scale *scale, const int16_t *raw, uint16_t num, int16_t *out)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_set_i3c_tc_sync_tu(delay_time, dev);
+    rslt = bmi3_convert_q15(scale, raw, num, out);
 
     return rslt;
 }
 
 /*!
- * @brief This API is used get the TU(time unit) value is used to scale the delay time payload
- * according to the hosts needs
+ * @brief This API converts FIFO frames to m/s^2 or dps.
  */
-int8_t bmi323_get_i3c_tc_sync_tu(uint8_t *delay_time, struct bmi3_dev *dev)
+int8_t bmi323_convert_axes_f32(const struct bmi3_unit_scale *scale,
+                               const struct bmi3_fifo_sens_axes_data *data,
+                               uint16_t num,
+                               float *out)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_i3c_tc_sync_tu(delay_time, dev);
+    rslt = bmi3_convert_axes_f32(scale, data, num, out);
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to set the i3c sync ODR.
+ * @brief This API converts FIFO frames to Q31 fractions of the full scale.
  */
-int8_t bmi323_set_i3c_tc_sync_odr(uint8_t odr, struct bmi3_dev *dev)
+int8_t bmi323_convert_axes_q31(const struct bmi3_unit_scale *scale,
+                               const struct bmi3_fifo_sens_axes_data *data,
+                               uint16_t num,
+                               int32_t *out)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_convert_axes_q31(scale, data, num, out);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API converts FIFO frames to Q15 fractions of the full scale.
+ */
+int8_t bmi323_convert_axes_q15(const struct bmi3_unit_scale *scale,
+                               const struct bmi3_fifo_sens_axes_data *data,
+                               uint16_t num,
+                               int16_t *out)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_convert_axes_q15(scale, data, num, out);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API parses and extracts the gyro frames from FIFO data
+ * read by the "bmi323_read_fifo_data" API and stores it in the "gyro_data"
+ * structure instance.
+ */
+int8_t bmi323_extract_gyro(struct bmi3_fifo_sens_axes_data *gyro_data,
+                           struct bmi3_fifo_frame *fifo,
+                           const struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_extract_gyro(gyro_data, fifo, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets the FIFO water-mark level in words.
+ */
+int8_t bmi323_set_fifo_wm(uint16_t fifo_wm, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_set_fifo_wm(fifo_wm, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the FIFO water-mark level in words.
+ */
+int8_t bmi323_get_fifo_wm(uint16_t *fifo_wm, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_fifo_wm(fifo_wm, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets the FIFO configuration in the sensor.
+ */
+int8_t bmi323_set_fifo_config(uint16_t config, uint8_t enable, struct bmi3_dev *dev)
+{
+    int8_t rslt;
+
+    rslt = bmi3_set_fifo_config(config, enable, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the FIFO configuration from the sensor.
+ */
+int8_t bmi323_get_fifo_config(uint16_t *fifo_config, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_fifo_config(fifo_config, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the length of FIFO data available in the sensor in
+ * words.
+ */
+int8_t bmi323_get_fifo_length(uint16_t *fifo_avail_len, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_fifo_length(fifo_avail_len, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the FIFO data into the next buffer of a ring and returns a view
+ * on it without the interface dummy bytes.
+ */
+int8_t bmi323_read_fifo_view(struct bmi3_fifo_buf_ring *ring, struct bmi3_fifo_view *view, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_read_fifo_view(ring, view, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API drains the FIFO into the next buffer of a ring in one bus transaction.
+ */
+int8_t bmi323_drain_fifo_view(struct bmi3_fifo_buf_ring *ring,
+                              struct bmi3_fifo_view *view,
+                              uint16_t max_len,
+                              struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_drain_fifo_view(ring, view, max_len, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API writes the configurations of context feature for smart phone, wearables and hearables.
+ */
+int8_t bmi323_context_switch_selection(uint8_t context_sel, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    if (context_sel < BMI323_SEL_MAX)
+    {
+        /* Set any-motion and no-motion configurations */
+        rslt = bmi3_set_feature_words(BMI3_BASE_ADDR_ANY_MOTION,
+                                      context_motion_image[context_sel],
+                                      BMI323_CONTEXT_MOTION_WORDS,
+                                      dev);
+
+        /* Set sig-motion, step counter, orientation and tap configurations; flat, which lies in
+         * between, is not part of the context */
+        if (rslt == BMI323_OK)
+        {
+            rslt = bmi3_set_feature_words(BMI3_BASE_ADDR_SIG_MOTION,
+                                          context_gesture_image[context_sel],
+                                          BMI323_CONTEXT_GESTURE_WORDS,
+                                          dev);
+        }
+    }
+    else
+    {
+        rslt = BMI323_E_INVALID_CONTEXT_SEL;
+    }
+
+    return rslt;
+}
+
+#ifndef BMI3_SELF_TEST_DISABLE
+/*!
+ * @brief This API is used to perform the self-test for either accel or gyro or both.
+ */
+int8_t bmi323_perform_self_test(uint8_t st_selection, struct bmi3_st_result *st_result_status, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_perform_self_test(st_selection, st_result_status, dev);
+
+    return rslt;
+}
+#endif
+
+#ifndef BMI3_ENHANCED_FLEXIBILITY_DISABLE
+/*!
+ * @brief This API writes the config array and config version in cfg res.
+ */
+int8_t bmi323_configure_enhanced_flexibility(struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_configure_enhanced_flexibility(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API writes the config array and config version in cfg res, optionally reads
+ * them back, and reports the upload statistics.
+ */
+int8_t bmi323_configure_enhanced_flexibility_ext(struct bmi3_config_upload *upload, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_configure_enhanced_flexibility_ext(upload, dev);
+
+    return rslt;
+}
+#endif
+
+/*!
+ * @brief This API is used to get the config version.
+ */
+int8_t bmi323_get_config_version(struct bmi3_config_version *config_version, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_config_version(config_version, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to perform the self-calibration for either sensitivity or offset or both.
+ */
+int8_t bmi323_perform_gyro_sc(uint8_t sc_selection,
+                              uint8_t apply_corr,
+                              struct bmi3_self_calib_rslt *sc_rslt,
+                              struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_perform_gyro_sc(sc_selection, apply_corr, sc_rslt, dev);
+
+    return rslt;
+}
+
+#ifndef BMI3_I3C_SYNC_DISABLE
+/*!
+ * @brief This API is used to set the data sample rate for i3c sync
+ */
+int8_t bmi323_set_i3c_tc_sync_tph(uint16_t sample_rate, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_set_i3c_tc_sync_tph(sample_rate, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to get the data sample rate for i3c sync
+ */
+int8_t bmi323_get_i3c_tc_sync_tph(uint16_t *sample_rate, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_i3c_tc_sync_tph(sample_rate, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used set the TU(time unit) value is used to scale the delay time payload
+ * according to the hosts needs
+ */
+int8_t bmi323_set_i3c_tc_sync_tu(uint8_t delay_time, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_set_i3c_tc_sync_tu(delay_time, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used get the TU(time unit) value is used to scale the delay time payload
+ * according to the hosts needs
+ */
+int8_t bmi323_get_i3c_tc_sync_tu(uint8_t *delay_time, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_i3c_tc_sync_tu(delay_time, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to set the i3c sync ODR.
+ */
+int8_t bmi323_set_i3c_tc_sync_odr(uint8_t odr, struct bmi3_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
@@ -813,6 +1294,21 @@ int8_t bmi323_set_i3c_sync_i3c_tc_res(uint8_t i3c_tc_res, struct bmi3_dev *dev)
     return rslt;
 }
 
+/*!
+ * @brief This API reads the I3C sync accel, gyro and temperature data of one sync epoch in one DMA burst.
+ */
+int8_t bmi323_get_i3c_sync_snapshot(struct bmi3_i3c_sync_snapshot *snapshot, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_i3c_sync_snapshot(snapshot, dev);
+
+    return rslt;
+}
+#endif
+
+#ifndef BMI3_ALT_CONFIG_DISABLE
 /*!
  * @brief This API is used to enable accel and gyro for alternate configuration
  */
@@ -838,6 +1334,7 @@ int8_t bmi323_read_alternate_status(struct bmi3_alt_status *alt_status, struct b
 
     return rslt;
 }
+#endif
 
 /*!
  * @brief This API gets offset dgain for the sensor which stores self-calibrated values for accel.
@@ -917,6 +1414,7 @@ int8_t bmi323_set_user_acc_off_dgain(const struct bmi3_acc_usr_gain_offset *acc_
     return rslt;
 }
 
+#ifndef BMI3_FOC_DISABLE
 /*!
  * @brief This API performs Fast Offset Compensation for accelerometer.
  */
@@ -930,6 +1428,208 @@ int8_t bmi323_perform_accel_foc(const struct bmi3_accel_foc_g_value *accel_g_val
     return rslt;
 }
 
+/*!
+ * @brief This API performs Fast Offset Compensation for accelerometer on samples drained
+ * from the FIFO.
+ */
+int8_t bmi323_perform_accel_foc_fifo(const struct bmi3_accel_foc_g_value *accel_g_value, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_perform_accel_foc_fifo(accel_g_value, dev);
+
+    return rslt;
+}
+#endif
+
+#ifndef BMI3_SELF_TEST_DISABLE
+/*!
+ * @brief This API starts the self-test without blocking.
+ */
+int8_t bmi323_self_test_start(uint8_t st_selection,
+                              struct bmi3_st_result *st_result_status,
+                              struct bmi3_async_op *op,
+                              struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_self_test_start(st_selection, st_result_status, op, dev);
+
+    return rslt;
+}
+#endif
+
+/*!
+ * @brief This API starts the gyro self-calibration without blocking.
+ */
+int8_t bmi323_gyro_sc_start(uint8_t sc_selection,
+                            uint8_t apply_corr,
+                            struct bmi3_self_calib_rslt *sc_rslt,
+                            struct bmi3_async_op *op,
+                            struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_gyro_sc_start(sc_selection, apply_corr, sc_rslt, op, dev);
+
+    return rslt;
+}
+
+#ifndef BMI3_FOC_DISABLE
+/*!
+ * @brief This API starts the accelerometer Fast Offset Compensation without blocking.
+ */
+int8_t bmi323_accel_foc_start(const struct bmi3_accel_foc_g_value *accel_g_value,
+                              struct bmi3_async_op *op,
+                              struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_accel_foc_start(accel_g_value, op, dev);
+
+    return rslt;
+}
+#endif
+
+/*!
+ * @brief This API sets the re-mapped axes and starts the axis map update without blocking.
+ */
+int8_t bmi323_set_remap_axes_start(const struct bmi3_axes_remap remapped_axis,
+                                   struct bmi3_async_op *op,
+                                   struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_set_remap_axes_start(remapped_axis, op, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API advances a long-running operation without blocking.
+ */
+int8_t bmi323_async_step(struct bmi3_async_op *op, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_async_step(op, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes an empty device group.
+ */
+int8_t bmi323_group_init(struct bmi3_dev_group *group)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_group_init(group);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API adds a device to a device group.
+ */
+int8_t bmi323_group_add(struct bmi3_dev_group *group,
+                        struct bmi3_dev *dev,
+                        struct bmi3_fifo_buf_ring *ring,
+                        uint8_t *index)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_group_add(group, dev, ring, index);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API hands a started long-running operation of a group member to the group.
+ */
+int8_t bmi323_group_submit_op(struct bmi3_dev_group *group, uint8_t index, struct bmi3_async_op *op, uint64_t now_us)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_group_submit_op(group, index, op, now_us);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API services every device of a group once.
+ */
+int8_t bmi323_group_service(struct bmi3_dev_group *group, uint64_t now_us)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_group_service(group, now_us);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the aggregate statistics of a device group.
+ */
+int8_t bmi323_group_get_stats(const struct bmi3_dev_group *group, struct bmi3_group_stats *stats)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_group_get_stats(group, stats);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API starts the interrupt-driven FIFO acquisition engine.
+ */
+int8_t bmi323_acq_start(struct bmi3_acq *acq, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_acq_start(acq, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API waits for the FIFO interrupt, reads the FIFO and retunes the water-mark.
+ */
+int8_t bmi323_acq_read(struct bmi3_acq *acq, struct bmi3_fifo_view *view, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_acq_read(acq, view, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the water-mark in use and the statistics of the acquisition engine.
+ */
+int8_t bmi323_acq_get_stats(const struct bmi3_acq *acq, struct bmi3_acq_stats *stats)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_acq_get_stats(acq, stats);
+
+    return rslt;
+}
+
 /*!
  * @brief This API gets the data ready status of power on reset, accelerometer, gyroscope
  * and temperature.
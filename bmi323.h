@@ -117,6 +117,312 @@ int8_t bmi323_init(struct bmi3_dev *dev);
  */
 int8_t bmi323_set_regs(uint8_t reg_addr, const uint8_t *data, uint16_t len, struct bmi3_dev *dev);
 
+/**
+ * \ingroup bmi323
+ * \defgroup bmi323ApiBatch Transaction queue
+ * @brief Merge the register writes of configuration sequences into bursts
+ */
+
+/*!
+ * \ingroup bmi323ApiBatch
+ * \page bmi323_api_bmi323_batch_begin bmi323_batch_begin
+ * \code
+ * int8_t bmi323_batch_begin(struct bmi3_batch *batch, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API starts recording the register writes of all following APIs in "batch"
+ * instead of sending them one by one. A write that continues the previous one (the next
+ * register, more FEATURE_DATA_TX data, or a FEATURE_DATA_ADDR the data port already points at)
+ * is merged into it. The queue is written out before any register read, before writes to
+ * BMI3_REG_CMD and when it is full, so read-modify-write sequences keep working. Bus errors of
+ * queued writes are returned by the API that causes the flush.
+ *
+ * @param[in] batch      : Transaction queue, owned by the caller until bmi323_batch_end.
+ * @param[in] dev        : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_batch_begin(struct bmi3_batch *batch, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi323ApiBatch
+ * \page bmi323_api_bmi323_batch_flush bmi323_batch_flush
+ * \code
+ * int8_t bmi323_batch_flush(struct bmi3_dev *dev);
+ * \endcode
+ * @details This API writes out the queued register writes in the fewest bursts allowed by
+ * dev->read_write_len and keeps queuing.
+ * If a bus write fails, the queue is kept and written again from the start on the next flush.
+ *
+ * @param[in] dev        : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_batch_flush(struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi323ApiBatch
+ * \page bmi323_api_bmi323_batch_end bmi323_batch_end
+ * \code
+ * int8_t bmi323_batch_end(struct bmi3_dev *dev);
+ * \endcode
+ * @details This API writes out the queued register writes and returns to direct writes.
+ *
+ * @param[in] dev        : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_batch_end(struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi323
+ * \defgroup bmi323ApiShadow Shadow cache
+ * @brief Serve configuration reads from a write-through copy of the registers
+ */
+
+/*!
+ * \ingroup bmi323ApiShadow
+ * \page bmi323_api_bmi323_shadow_enable bmi323_shadow_enable
+ * \code
+ * int8_t bmi323_shadow_enable(struct bmi3_shadow *shadow, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API keeps a copy of the configuration registers and of the feature
+ * configuration words in "shadow". Every write updates the copy; getters and the
+ * read-modify-write setters are served from it once a word has been read or written, so
+ * only the first access of a register goes to the bus. Writes to BMI3_REG_FEATURE_DATA_ADDR
+ * are deferred until the feature data port is used on the bus.
+ *
+ * Data, status and self-clearing registers, the offset and gain registers and the words the
+ * feature engine writes itself are always read from the bus. The cache is dropped on every
+ * command written to BMI3_REG_CMD (including bmi323_soft_reset) and on configuration
+ * uploads. Call bmi323_shadow_invalidate if the device was changed in any other way.
+ *
+ * @param[in] shadow     : Shadow cache, owned by the caller until bmi323_shadow_disable.
+ * @param[in] dev        : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_shadow_enable(struct bmi3_shadow *shadow, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi323ApiShadow
+ * \page bmi323_api_bmi323_shadow_disable bmi323_shadow_disable
+ * \code
+ * int8_t bmi323_shadow_disable(struct bmi3_dev *dev);
+ * \endcode
+ * @details This API writes a deferred feature engine address and returns to reading every
+ * register from the bus.
+ *
+ * @param[in] dev        : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_shadow_disable(struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi323ApiShadow
+ * \page bmi323_api_bmi323_shadow_invalidate bmi323_shadow_invalidate
+ * \code
+ * int8_t bmi323_shadow_invalidate(struct bmi3_dev *dev);
+ * \endcode
+ * @details This API drops all entries of the shadow cache, so that the next access of every
+ * register goes to the bus again.
+ *
+ * @param[in] dev        : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_shadow_invalidate(struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi323
+ * \defgroup bmi323ApiLock Concurrency
+ * @brief Share a device between threads
+ *
+ * The device structure holds state that is changed by every access (interface result,
+ * transaction queue, shadow cache, feature engine address). With lock hooks set, every
+ * register access, FIFO read, soft-reset and configuration upload runs under the lock of the
+ * device. A sequence of accesses that has to be atomic, e.g. a feature configuration
+ * read-modify-write without the shadow cache, is wrapped in bmi323_dev_lock and
+ * bmi323_dev_unlock; the lock must therefore be recursive.
+ *
+ * The sample ring moves decoded FIFO frames from the thread reading the FIFO to one consumer
+ * thread without locking.
+ */
+
+/*!
+ * \ingroup bmi323ApiLock
+ * \page bmi323_api_bmi323_lock_enable bmi323_lock_enable
+ * \code
+ * int8_t bmi323_lock_enable(bmi3_lock_fptr_t lock, bmi3_lock_fptr_t unlock, void *lock_ctx, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API sets the hooks that take and release the recursive mutex of the device.
+ * Call it after bmi323_init and before the device is shared.
+ *
+ * @param[in] lock       : Takes the mutex
+ * @param[in] unlock     : Releases the mutex
+ * @param[in] lock_ctx   : Context passed to the hooks, e.g. the mutex
+ * @param[in] dev        : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_lock_enable(bmi3_lock_fptr_t lock, bmi3_lock_fptr_t unlock, void *lock_ctx, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi323ApiLock
+ * \page bmi323_api_bmi323_lock_disable bmi323_lock_disable
+ * \code
+ * int8_t bmi323_lock_disable(struct bmi3_dev *dev);
+ * \endcode
+ * @details This API removes the lock hooks, once the device is used from one thread again.
+ *
+ * @param[in] dev        : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_lock_disable(struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi323ApiLock
+ * \page bmi323_api_bmi323_dev_lock bmi323_dev_lock
+ * \code
+ * int8_t bmi323_dev_lock(struct bmi3_dev *dev);
+ * \endcode
+ * @details This API takes the lock of the device, so that the following API calls run
+ * without accesses of other threads in between. Does nothing without lock hooks.
+ *
+ * @param[in] dev        : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_dev_lock(struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi323ApiLock
+ * \page bmi323_api_bmi323_dev_unlock bmi323_dev_unlock
+ * \code
+ * int8_t bmi323_dev_unlock(struct bmi3_dev *dev);
+ * \endcode
+ * @details This API releases the lock taken by bmi323_dev_lock.
+ *
+ * @param[in] dev        : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_dev_unlock(struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi323ApiLock
+ * \page bmi323_api_bmi323_sample_ring_init bmi323_sample_ring_init
+ * \code
+ * int8_t bmi323_sample_ring_init(struct bmi3_sample_ring *ring, struct bmi3_fifo_frame_sample *buf, uint16_t size);
+ * \endcode
+ * @details This API initializes an empty single-producer/single-consumer ring of FIFO frames.
+ *
+ * @param[out] ring      : Sample ring
+ * @param[in] buf        : Array of size frames, owned by the caller
+ * @param[in] size       : Number of frames in buf, a power of 2 not above 32768
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval BMI3_E_INVALID_INPUT -> size is not a power of 2
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_sample_ring_init(struct bmi3_sample_ring *ring, struct bmi3_fifo_frame_sample *buf, uint16_t size);
+
+/*!
+ * \ingroup bmi323ApiLock
+ * \page bmi323_api_bmi323_sample_ring_push bmi323_sample_ring_push
+ * \code
+ * int8_t bmi323_sample_ring_push(struct bmi3_sample_ring *ring, const struct bmi3_fifo_frame_sample *sample);
+ * \endcode
+ * @details This API adds a frame to the ring. It never blocks: if the ring is full the frame
+ * is dropped and counted in ring->dropped. To be called by the producer thread only.
+ *
+ * @param[in,out] ring   : Sample ring
+ * @param[in] sample     : Frame to be added
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval BMI3_W_RING_FULL -> Frame dropped
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_sample_ring_push(struct bmi3_sample_ring *ring, const struct bmi3_fifo_frame_sample *sample);
+
+/*!
+ * \ingroup bmi323ApiLock
+ * \page bmi323_api_bmi323_sample_ring_push_cb bmi323_sample_ring_push_cb
+ * \code
+ * void bmi323_sample_ring_push_cb(const struct bmi3_fifo_frame_sample *sample, void *cb_ctx);
+ * \endcode
+ * @details This API adds a frame to the ring given as cb_ctx. Set it as frame_cb of
+ * struct bmi3_fifo_demux, with the ring as cb_ctx, to feed the ring straight from the FIFO
+ * parsers.
+ *
+ * @param[in] sample     : Frame to be added
+ * @param[in,out] cb_ctx : Sample ring
+ */
+void bmi323_sample_ring_push_cb(const struct bmi3_fifo_frame_sample *sample, void *cb_ctx);
+
+/*!
+ * \ingroup bmi323ApiLock
+ * \page bmi323_api_bmi323_sample_ring_pop bmi323_sample_ring_pop
+ * \code
+ * int8_t bmi323_sample_ring_pop(struct bmi3_sample_ring *ring,
+ *                             struct bmi3_fifo_frame_sample *samples,
+ *                             uint16_t max_samples,
+ *                             uint16_t *num_samples);
+ * \endcode
+ * @details This API takes the oldest frames from the ring without blocking. To be called by
+ * the consumer thread only.
+ *
+ * @param[in,out] ring     : Sample ring
+ * @param[out] samples     : Frames taken
+ * @param[in] max_samples  : Capacity of samples
+ * @param[out] num_samples : Number of frames taken
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval BMI3_W_RING_EMPTY -> No frame available
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_sample_ring_pop(struct bmi3_sample_ring *ring,
+                              struct bmi3_fifo_frame_sample *samples,
+                              uint16_t max_samples,
+                              uint16_t *num_samples);
+
 /*!
  * \ingroup bmi323ApiRegs
  * \page bmi323_api_bmi323_get_regs bmi323_get_regs
@@ -198,6 +504,11 @@ int8_t bmi323_context_switch_selection(uint8_t context_sel, struct bmi3_dev *dev
  * @note If selected interface is SPI, an extra dummy byte is read to bring the
  * interface back to SPI from default, after the soft-reset command.
  *
+ * @note The feature engine is polled with an interval growing from
+ * BMI3_FEATURE_ENGINE_POLL_MIN_US to BMI3_FEATURE_ENGINE_POLL_MAX_US, for at most
+ * BMI3_FEATURE_ENGINE_READY_TIMEOUT_US. The time it took to get ready is stored in
+ * dev->feature_ready_us.
+ *
  * @param[in] dev : Structure instance of bmi3_dev.
  *
  *  @return Result of API execution status
@@ -590,6 +901,105 @@ int8_t bmi323_set_sensor_config(struct bmi3_sens_config *sens_cfg, uint8_t n_sen
  */
 int8_t bmi323_get_sensor_config(struct bmi3_sens_config *sens_cfg, uint8_t n_sens, struct bmi3_dev *dev);
 
+/*!
+ * \ingroup bmi323ApiSensorConfig
+ * \page bmi323_api_bmi323_set_feature_words bmi323_set_feature_words
+ * \code
+ * int8_t bmi323_set_feature_words(uint8_t base_addr, const uint16_t *words, uint8_t num_words, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API writes consecutive words of the feature engine configuration, starting
+ * at base_addr, in bursts of up to BMI3_FEATURE_WORDS_BURST words. The words are written as
+ * they are; BMI3_ANY_NO_MOTION_WORDS, BMI3_SIG_MOTION_WORDS, BMI3_STEP_COUNTER_WORDS,
+ * BMI3_ORIENT_WORDS and BMI3_TAP_WORDS pack feature configurations into words at compile time.
+ *
+ * @param[in]       base_addr    : Feature engine address of the first word, e.g. BMI3_BASE_ADDR_ANY_MOTION.
+ * @param[in]       words        : Words to be written.
+ * @param[in]       num_words    : Number of words.
+ * @param[in, out]  dev          : Structure instance of bmi3_dev.
+ *
+ *  @return Result of API execution status
+ *
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi323_set_feature_words(uint8_t base_addr, const uint16_t *words, uint8_t num_words, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi323ApiSensorConfig
+ * \page bmi323_api_bmi323_get_feature_words bmi323_get_feature_words
+ * \code
+ * int8_t bmi323_get_feature_words(uint8_t base_addr, uint16_t *words, uint8_t num_words, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API reads consecutive words of the feature engine configuration, starting
+ * at base_addr, in bursts of up to BMI3_FEATURE_WORDS_BURST words.
+ *
+ * @param[in]       base_addr    : Feature engine address of the first word, e.g. BMI3_BASE_ADDR_ANY_MOTION.
+ * @param[out]      words        : Words read.
+ * @param[in]       num_words    : Number of words.
+ * @param[in, out]  dev          : Structure instance of bmi3_dev.
+ *
+ *  @return Result of API execution status
+ *
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi323_get_feature_words(uint8_t base_addr, uint16_t *words, uint8_t num_words, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi323ApiSensorConfig
+ * \page bmi323_api_bmi323_get_feature_fields bmi323_get_feature_fields
+ * \code
+ * int8_t bmi323_get_feature_fields(const uint8_t *field_id, uint16_t *value, uint8_t n_fields, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API reads any set of feature configuration fields, e.g. BMI3_FIELD_ANY_MOTION_SLOPE_THRES
+ * and BMI3_FIELD_TAP_PEAK_THRES. The feature engine words from the first to the last field are read
+ * in one burst and each field is extracted with its mask and position.
+ *
+ * @param[in]       field_id     : List of fields, BMI3_FIELD_*.
+ * @param[out]      value        : Value of each field.
+ * @param[in]       n_fields     : Number of fields.
+ * @param[in, out]  dev          : Structure instance of bmi3_dev.
+ *
+ *  @return Result of API execution status
+ *
+ *  @retval 0 -> Success
+ *  @retval BMI3_E_INVALID_INPUT -> Unknown field or no field
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi323_get_feature_fields(const uint8_t *field_id, uint16_t *value, uint8_t n_fields, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi323ApiSensorConfig
+ * \page bmi323_api_bmi323_set_feature_fields bmi323_set_feature_fields
+ * \code
+ * int8_t bmi323_set_feature_fields(const uint8_t *field_id, const uint16_t *value, uint8_t n_fields,
+ *                                  struct bmi3_dev *dev);
+ * \endcode
+ * @details This API writes any set of feature configuration fields, transferring only the feature
+ * engine words holding them, e.g. a single word for BMI3_FIELD_ANY_MOTION_SLOPE_THRES or
+ * BMI3_FIELD_TAP_PEAK_THRES. A word is read back first only if it holds other fields, which are
+ * kept; a word whose fields are all given is written without being read, with its reserved bits
+ * cleared as bmi323_set_sensor_config does. Runs of consecutive words are read and written in one
+ * burst each, under the device lock. With the shadow cache enabled the read is served from the
+ * cache, so retuning a threshold costs only the write of its word.
+ * Values are truncated to the width of their field.
+ *
+ * @param[in]       field_id     : List of fields, BMI3_FIELD_*.
+ * @param[in]       value        : Value of each field.
+ * @param[in]       n_fields     : Number of fields.
+ * @param[in, out]  dev          : Structure instance of bmi3_dev.
+ *
+ *  @return Result of API execution status
+ *
+ *  @retval 0 -> Success
+ *  @retval BMI3_E_INVALID_INPUT -> Unknown field or no field
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi323_set_feature_fields(const uint8_t *field_id,
+                                 const uint16_t *value,
+                                 uint8_t n_fields,
+                                 struct bmi3_dev *dev);
+
 /**
  * \ingroup bmi323
  * \defgroup bmi323ApiSensorD Sensor Data
@@ -631,6 +1041,26 @@ int8_t bmi323_get_sensor_config(struct bmi3_sens_config *sens_cfg, uint8_t n_sen
  */
 int8_t bmi323_get_sensor_data(struct bmi3_sensor_data *sensor_data, uint8_t n_sens, struct bmi3_dev *dev);
 
+/*!
+ * \ingroup bmi323ApiSensorD
+ * \page bmi323_api_bmi323_get_sensor_burst_data bmi323_get_sensor_burst_data
+ * \code
+ * int8_t bmi323_get_sensor_burst_data(struct bmi3_sensor_burst_data *data, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API reads the sensor status, accelerometer, gyroscope, temperature, sensor time,
+ * saturation flags and interrupt 1 status with a single register burst, instead of one
+ * transaction per item. The status and interrupt 1 status registers are clear-on-read.
+ *
+ * @param[out] data          : Structure instance of bmi3_sensor_burst_data.
+ * @param[in]  dev           : Structure instance of bmi3_dev.
+ *
+ *  @return Result of API execution status
+ *
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi323_get_sensor_burst_data(struct bmi3_sensor_burst_data *data, struct bmi3_dev *dev);
+
 /*!
  * \ingroup bmi323ApiInt
  * \page bmi323_api_bmi323_map_interrupt bmi323_map_interrupt
@@ -889,53 +1319,491 @@ int8_t bmi323_extract_temperature(struct bmi3_fifo_temperature_data *temp_data,
 
 /**
  * \ingroup bmi323
- * \defgroup bmi323Apisetfifowatermark fifowatermark
- * @brief Read fifo data
+ * \defgroup bmi323Apiextractfifodata extractfifodata
+ * @brief Single-pass FIFO parsing
  */
 
 /*!
  * \ingroup bmi323ApiFIFO
- * \page bmi323_api_bmi323_set_fifo_wm bmi323_set_fifo_wm
+ * \page bmi323_api_bmi323_extract_fifo_data bmi323_extract_fifo_data
  * \code
- * int8_t bmi323_set_fifo_wm(uint16_t fifo_wm, struct bmi3_dev *dev);
+ * int8_t bmi323_extract_fifo_data(struct bmi3_fifo_demux *demux, struct bmi3_fifo_frame *fifo, const struct bmi3_dev *dev);
  * \endcode
- * @details This API sets the FIFO water-mark level in words.
+ * @details This API parses the FIFO data read by the "bmi323_read_fifo_data" API in a single
+ * pass and stores the accelerometer, gyroscope, temperature and sensor time frames in the
+ * output arrays of "demux", or hands every frame to its callback.
  *
- * @param[in] fifo_wm          : Variable to set FIFO water-mark level in words.
- * @param[in] dev              : Structure instance of bmi3_dev.
+ * @param[in,out] demux        : Output arrays with their capacity, optional callback,
+ *                               and the number of frames stored.
+ * @param[in,out] fifo         : Structure instance of bmi3_fifo_frame.
+ * @param[in]     dev          : Structure instance of bmi3_dev
  *
  * @return Result of API execution status
  *
  * @retval 0 -> Success
+ * @retval > 0 -> Warning, no complete frame
  * @retval < 0 -> Fail
  *
  */
-int8_t bmi323_set_fifo_wm(uint16_t fifo_wm, struct bmi3_dev *dev);
-
-/**
- * \ingroup bmi323
- * \defgroup bmi323Apisetfifowatermark fifo watermark
- * @brief Read fifo data
- */
+int8_t bmi323_extract_fifo_data(struct bmi3_fifo_demux *demux,
+                                struct bmi3_fifo_frame *fifo,
+                                const struct bmi3_dev *dev);
 
 /*!
  * \ingroup bmi323ApiFIFO
- * \page bmi323_api_bmi323_get_fifo_wm bmi323_get_fifo_wm
+ * \page bmi323_api_bmi323_extract_fifo_view bmi323_extract_fifo_view
  * \code
- * int8_t bmi323_get_fifo_wm(uint16_t *fifo_wm, struct bmi3_dev *dev);
+ * int8_t bmi323_extract_fifo_view(struct bmi3_fifo_demux *demux, const struct bmi3_fifo_view *view);
  * \endcode
- * @details This API reads the FIFO water-mark level in words.
+ * @details This API works as "bmi323_extract_fifo_data" on a view returned by the
+ * "bmi323_read_fifo_view" API.
  *
- * @param[out] fifo_wm         : Variable to get FIFO water-mark level in words.
- * @param[in] dev              : Structure instance of bmi3_dev.
+ * @param[in,out] demux        : Output arrays with their capacity, optional callback,
+ *                               and the number of frames stored.
+ * @param[in]     view         : FIFO view to be parsed.
  *
  * @return Result of API execution status
  *
  * @retval 0 -> Success
+ * @retval > 0 -> Warning, no complete frame
  * @retval < 0 -> Fail
  *
  */
-int8_t bmi323_get_fifo_wm(uint16_t *fifo_wm, struct bmi3_dev *dev);
+int8_t bmi323_extract_fifo_view(struct bmi3_fifo_demux *demux, const struct bmi3_fifo_view *view);
+
+/*!
+ * \ingroup bmi323ApiFIFO
+ * \page bmi323_api_bmi323_fifo_stream_init bmi323_fifo_stream_init
+ * \code
+ * int8_t bmi323_fifo_stream_init(struct bmi3_fifo_stream *stream);
+ * \endcode
+ * @details This API resets the state of the streaming FIFO parser. Call it once before the
+ * first "bmi323_fifo_stream_parse" and after the FIFO has been flushed.
+ *
+ * @param[out] stream          : Parser state.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi323_fifo_stream_init(struct bmi3_fifo_stream *stream);
+
+/*!
+ * \ingroup bmi323ApiFIFO
+ * \page bmi323_api_bmi323_fifo_stream_parse bmi323_fifo_stream_parse
+ * \code
+ * int8_t bmi323_fifo_stream_parse(struct bmi3_fifo_stream *stream,
+ *                                 struct bmi3_fifo_demux *demux,
+ *                                 const struct bmi3_fifo_frame *fifo,
+ *                                 const struct bmi3_dev *dev);
+ * \endcode
+ * @details This API parses FIFO data read by the "bmi323_read_fifo_data" API like
+ * "bmi323_extract_fifo_data", but the read does not have to end on a frame boundary. The
+ * bytes of an incomplete frame at the end of the read are kept in "stream" and completed by
+ * the next call, so the FIFO can be drained in small fixed chunks without losing or
+ * duplicating samples. "fifo->length" must not exceed the FIFO fill level.
+ *
+ * @param[in,out] stream       : Parser state.
+ * @param[in,out] demux        : Output arrays with their capacity, optional callback,
+ *                               and the number of frames stored by this call.
+ * @param[in]     fifo         : Structure instance of bmi3_fifo_frame.
+ * @param[in]     dev          : Structure instance of bmi3_dev
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning, no complete frame
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi323_fifo_stream_parse(struct bmi3_fifo_stream *stream,
+                                struct bmi3_fifo_demux *demux,
+                                const struct bmi3_fifo_frame *fifo,
+                                const struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi323ApiFIFO
+ * \page bmi323_api_bmi323_fifo_time_sync_init bmi323_fifo_time_sync_init
+ * \code
+ * int8_t bmi323_fifo_time_sync_init(struct bmi3_fifo_time_sync *sync, const struct bmi3_accel_config *acc_cfg);
+ * \endcode
+ * @details This API initializes the FIFO timestamp reconstruction. The accelerometer ODR gives
+ * the frame period used when sensor time is not part of the FIFO.
+ *
+ * @param[out] sync            : Timestamp reconstruction state.
+ * @param[in]  acc_cfg         : Accelerometer configuration.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi323_fifo_time_sync_init(struct bmi3_fifo_time_sync *sync, const struct bmi3_accel_config *acc_cfg);
+
+/*!
+ * \ingroup bmi323ApiFIFO
+ * \page bmi323_api_bmi323_fifo_time_sync_anchor bmi323_fifo_time_sync_anchor
+ * \code
+ * int8_t bmi323_fifo_time_sync_anchor(struct bmi3_fifo_time_sync *sync, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API reads the full 32-bit sensor time, at which the next batch passed to
+ * "bmi323_fifo_time_sync_apply" is assumed to end. It is called right after the FIFO read of the first
+ * batch; the last frame must lie within 1.28 s of the anchor. Later batches are unwrapped without a
+ * register read. Anchoring again, e.g. right after a FIFO read without sensor time, removes the
+ * drift of the ODR extrapolation.
+ *
+ * @param[in,out] sync         : Timestamp reconstruction state.
+ * @param[in]     dev          : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi323_fifo_time_sync_anchor(struct bmi3_fifo_time_sync *sync, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi323ApiFIFO
+ * \page bmi323_api_bmi323_fifo_time_sync_apply bmi323_fifo_time_sync_apply
+ * \code
+ * int8_t bmi323_fifo_time_sync_apply(struct bmi3_fifo_time_sync *sync,
+ *                                    const uint16_t *sensor_time,
+ *                                    uint64_t *timestamp,
+ *                                    uint16_t frames);
+ * \endcode
+ * @details This API converts the 16-bit FIFO sensor time of a batch of frames into monotonic
+ * 64-bit sensor time in ticks of 39.0625 us, see BMI3_SENSOR_TIME_TO_US. Consecutive stamps must
+ * be less than 2.56 s apart. A freshly anchored batch is assumed to end at the anchor, its last stamp
+ * is unwrapped against the anchor and the earlier frames are placed back from it. If "sensor_time"
+ * is NULL, the frames are spaced by the accelerometer ODR period.
+ *
+ * @param[in,out] sync         : Timestamp reconstruction state.
+ * @param[in]     sensor_time  : FIFO sensor time of each frame, or NULL.
+ * @param[out]    timestamp    : Unwrapped sensor time of each frame.
+ * @param[in]     frames       : Number of frames.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi323_fifo_time_sync_apply(struct bmi3_fifo_time_sync *sync,
+                                   const uint16_t *sensor_time,
+                                   uint64_t *timestamp,
+                                   uint16_t frames);
+
+/*!
+ * \ingroup bmi323ApiFIFO
+ * \page bmi323_api_bmi323_decode_fifo_frames bmi323_decode_fifo_frames
+ * \code
+ * int8_t bmi323_decode_fifo_frames(struct bmi3_fifo_axes_soa *acc,
+ *                                  struct bmi3_fifo_axes_soa *gyr,
+ *                                  const struct bmi3_fifo_frame *fifo,
+ *                                  const struct bmi3_dev *dev);
+ * \endcode
+ * @details This API deinterleaves the accelerometer and/or gyroscope axes of FIFO data read by the
+ * "bmi323_read_fifo_data" API into struct-of-arrays buffers. One element is written per FIFO frame,
+ * dummy frames included; they are marked by a cleared bit in the validity bitmask. Blocks of 8 frames
+ * are decoded with SSE2 or NEON when available, unless BMI3_FIFO_SIMD_DISABLE is defined.
+ *
+ * @param[in,out] acc          : Accelerometer output, NULL if not needed.
+ * @param[in,out] gyr          : Gyroscope output, NULL if not needed.
+ * @param[in]     fifo         : Structure instance of bmi3_fifo_frame.
+ * @param[in]     dev          : Structure instance of bmi3_dev
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi323_decode_fifo_frames(struct bmi3_fifo_axes_soa *acc,
+                                 struct bmi3_fifo_axes_soa *gyr,
+                                 const struct bmi3_fifo_frame *fifo,
+                                 const struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi323ApiFIFO
+ * \page bmi323_api_bmi323_extract_accel_soa bmi323_extract_accel_soa
+ * \code
+ * int8_t bmi323_extract_accel_soa(struct bmi3_fifo_axes_soa *accel_data,
+ *                                 struct bmi3_fifo_frame *fifo,
+ *                                 const struct bmi3_dev *dev);
+ * \endcode
+ * @details This API works as "bmi323_extract_accel" but writes the accelerometer frames into the
+ * per-axis x, y, z and sensor_time arrays of "accel_data", so that they can be filtered without a
+ * transpose. Dummy frames are skipped, the validity bitmask is not used.
+ *
+ * @param[out]    accel_data  : Per-axis output arrays, "len" gives their capacity and "frames"
+ *                              returns the number of frames stored.
+ * @param[in,out] fifo        : Structure instance of bmi3_fifo_frame.
+ * @param[in]     dev         : Structure instance of bmi3_dev
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi323_extract_accel_soa(struct bmi3_fifo_axes_soa *accel_data,
+                                struct bmi3_fifo_frame *fifo,
+                                const struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi323ApiFIFO
+ * \page bmi323_api_bmi323_extract_gyro_soa bmi323_extract_gyro_soa
+ * \code
+ * int8_t bmi323_extract_gyro_soa(struct bmi3_fifo_axes_soa *gyro_data,
+ *                                struct bmi3_fifo_frame *fifo,
+ *                                const struct bmi3_dev *dev);
+ * \endcode
+ * @details This API works as "bmi323_extract_gyro" but writes the gyroscope frames into the
+ * per-axis x, y, z and sensor_time arrays of "gyro_data", so that they can be filtered without a
+ * transpose. Dummy frames are skipped, the validity bitmask is not used.
+ *
+ * @param[out]    gyro_data   : Per-axis output arrays, "len" gives their capacity and "frames"
+ *                              returns the number of frames stored.
+ * @param[in,out] fifo        : Structure instance of bmi3_fifo_frame.
+ * @param[in]     dev         : Structure instance of bmi3_dev
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi323_extract_gyro_soa(struct bmi3_fifo_axes_soa *gyro_data,
+                               struct bmi3_fifo_frame *fifo,
+                               const struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi323
+ * \defgroup bmi323ApiUnits Unit conversion
+ * @brief Convert raw accelerometer and gyroscope samples to physical units
+ *
+ * The scale factors depend only on the range; bmi323_get_unit_scale computes them once, and
+ * the conversion loops do one multiply or shift per word. The loops are plain C that
+ * compilers vectorize; contiguous samples, e.g. the per-axis arrays of bmi3_fifo_axes_soa,
+ * vectorize on any target, while bmi3_fifo_sens_axes_data arrays need interleaved loads.
+ *
+ * The float conversions give m/s^2 and dps. The Q15 and Q31 conversions give fractions of
+ * BMI3_Q_ACC_FULL_SCALE_G or BMI3_Q_GYR_FULL_SCALE_DPS in every range, so that fixed-point
+ * code sees one scale whatever the range. Q31 is exact. Q15 drops the bits below the 16 g or
+ * 2000 dps LSB.
+ */
+
+/*!
+ * \ingroup bmi323ApiUnits
+ * \page bmi323_api_bmi323_get_unit_scale bmi323_get_unit_scale
+ * \code
+ * int8_t bmi323_get_unit_scale(const struct bmi3_sens_config *config, struct bmi3_unit_scale *scale);
+ * \endcode
+ * @details This API computes the unit conversion factors for the type and range of an
+ * accelerometer or gyroscope configuration, as set by bmi323_set_sensor_config.
+ *
+ * @param[in]  config : Accelerometer or gyroscope configuration
+ * @param[out] scale  : Conversion factors
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval BMI3_E_INVALID_SENSOR -> Neither accelerometer nor gyroscope
+ * @retval BMI3_E_ACC_INVALID_CFG, BMI3_E_GYRO_INVALID_CFG -> Invalid range
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_get_unit_scale(const struct bmi3_sens_config *config, struct bmi3_unit_scale *scale);
+
+/*!
+ * \ingroup bmi323ApiUnits
+ * \page bmi323_api_bmi323_convert_f32 bmi323_convert_f32
+ * \code
+ * int8_t bmi323_convert_f32(const struct bmi3_unit_scale *scale, const int16_t *raw, uint16_t num, float *out);
+ * \endcode
+ * @details This API converts num raw samples to m/s^2 or dps. raw may be one axis
+ * of a bmi3_fifo_axes_soa or interleaved axes.
+ *
+ * @param[in]  scale : Conversion factors of the sensor
+ * @param[in]  raw   : Raw samples
+ * @param[in]  num   : Number of samples
+ * @param[out] out   : num converted samples
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_convert_f32(const struct bmi3_unit_scale *scale, const int16_t *raw, uint16_t num, float *out);
+
+/*!
+ * \ingroup bmi323ApiUnits
+ * \page bmi323_api_bmi323_convert_q31 bmi323_convert_q31
+ * \code
+ * int8_t bmi323_convert_q31(const struct bmi3_unit_scale *scale, const int16_t *raw, uint16_t num, int32_t *out);
+ * \endcode
+ * @details This API converts num raw samples to Q31 fractions of the full scale. raw may be one axis
+ * of a bmi3_fifo_axes_soa or interleaved axes.
+ *
+ * @param[in]  scale : Conversion factors of the sensor
+ * @param[in]  raw   : Raw samples
+ * @param[in]  num   : Number of samples
+ * @param[out] out   : num converted samples
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_convert_q31(const struct bmi3_unit_scale *scale, const int16_t *raw, uint16_t num, int32_t *out);
+
+/*!
+ * \ingroup bmi323ApiUnits
+ * \page bmi323_api_bmi323_convert_q15 bmi323_convert_q15
+ * \code
+ * int8_t bmi323_convert_q15(const struct bmi3_unit_scale *scale, const int16_t *raw, uint16_t num, int16_t *out);
+ * \endcode
+ * @details This API converts num raw samples to Q15 fractions of the full scale. raw may be one axis
+ * of a bmi3_fifo_axes_soa or interleaved axes.
+ *
+ * @param[in]  scale : Conversion factors of the sensor
+ * @param[in]  raw   : Raw samples
+ * @param[in]  num   : Number of samples
+ * @param[out] out   : num converted samples
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_convert_q15(const struct bmi3_unit_scale *scale, const int16_t *raw, uint16_t num, int16_t *out);
+
+/*!
+ * \ingroup bmi323ApiUnits
+ * \page bmi323_api_bmi323_convert_axes_f32 bmi323_convert_axes_f32
+ * \code
+ * int8_t bmi323_convert_axes_f32(const struct bmi3_unit_scale *scale,
+ *                              const struct bmi3_fifo_sens_axes_data *data,
+ *                              uint16_t num,
+ *                              float *out);
+ * \endcode
+ * @details This API converts the x, y and z axes of num FIFO frames to m/s^2 or dps.
+ *
+ * @param[in]  scale : Conversion factors of the sensor
+ * @param[in]  data  : FIFO frames
+ * @param[in]  num   : Number of frames
+ * @param[out] out   : 3 * num converted samples, x, y and z of each frame
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_convert_axes_f32(const struct bmi3_unit_scale *scale,
+                               const struct bmi3_fifo_sens_axes_data *data,
+                               uint16_t num,
+                               float *out);
+
+/*!
+ * \ingroup bmi323ApiUnits
+ * \page bmi323_api_bmi323_convert_axes_q31 bmi323_convert_axes_q31
+ * \code
+ * int8_t bmi323_convert_axes_q31(const struct bmi3_unit_scale *scale,
+ *                              const struct bmi3_fifo_sens_axes_data *data,
+ *                              uint16_t num,
+ *                              int32_t *out);
+ * \endcode
+ * @details This API converts the x, y and z axes of num FIFO frames to Q31 fractions of the full scale.
+ *
+ * @param[in]  scale : Conversion factors of the sensor
+ * @param[in]  data  : FIFO frames
+ * @param[in]  num   : Number of frames
+ * @param[out] out   : 3 * num converted samples, x, y and z of each frame
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_convert_axes_q31(const struct bmi3_unit_scale *scale,
+                               const struct bmi3_fifo_sens_axes_data *data,
+                               uint16_t num,
+                               int32_t *out);
+
+/*!
+ * \ingroup bmi323ApiUnits
+ * \page bmi323_api_bmi323_convert_axes_q15 bmi323_convert_axes_q15
+ * \code
+ * int8_t bmi323_convert_axes_q15(const struct bmi3_unit_scale *scale,
+ *                              const struct bmi3_fifo_sens_axes_data *data,
+ *                              uint16_t num,
+ *                              int16_t *out);
+ * \endcode
+ * @details This API converts the x, y and z axes of num FIFO frames to Q15 fractions of the full scale.
+ *
+ * @param[in]  scale : Conversion factors of the sensor
+ * @param[in]  data  : FIFO frames
+ * @param[in]  num   : Number of frames
+ * @param[out] out   : 3 * num converted samples, x, y and z of each frame
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_convert_axes_q15(const struct bmi3_unit_scale *scale,
+                               const struct bmi3_fifo_sens_axes_data *data,
+                               uint16_t num,
+                               int16_t *out);
+
+/**
+ * \ingroup bmi323
+ * \defgroup bmi323Apisetfifowatermark fifowatermark
+ * @brief Read fifo data
+ */
+
+/*!
+ * \ingroup bmi323ApiFIFO
+ * \page bmi323_api_bmi323_set_fifo_wm bmi323_set_fifo_wm
+ * \code
+ * int8_t bmi323_set_fifo_wm(uint16_t fifo_wm, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API sets the FIFO water-mark level in words.
+ *
+ * @param[in] fifo_wm          : Variable to set FIFO water-mark level in words.
+ * @param[in] dev              : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi323_set_fifo_wm(uint16_t fifo_wm, struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi323
+ * \defgroup bmi323Apisetfifowatermark fifo watermark
+ * @brief Read fifo data
+ */
+
+/*!
+ * \ingroup bmi323ApiFIFO
+ * \page bmi323_api_bmi323_get_fifo_wm bmi323_get_fifo_wm
+ * \code
+ * int8_t bmi323_get_fifo_wm(uint16_t *fifo_wm, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API reads the FIFO water-mark level in words.
+ *
+ * @param[out] fifo_wm         : Variable to get FIFO water-mark level in words.
+ * @param[in] dev              : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi323_get_fifo_wm(uint16_t *fifo_wm, struct bmi3_dev *dev);
 
 /**
  * \ingroup bmi323
@@ -950,6 +1818,7 @@ int8_t bmi323_get_fifo_wm(uint16_t *fifo_wm, struct bmi3_dev *dev);
  * int8_t bmi323_set_fifo_config(uint16_t config, uint8_t enable, struct bmi3_dev *dev);
  * \endcode
  * @details This API sets the FIFO configuration in the sensor.
+ * The device structure keeps a copy of it, so that the FIFO reads need not read it back.
  *
  * @param[in] config        : FIFO configurations to be enabled/disabled.
  * @param[in] enable        : Enable/Disable FIFO configurations.
@@ -1025,12 +1894,79 @@ int8_t bmi323_get_fifo_config(uint16_t *fifo_config, struct bmi3_dev *dev);
  */
 int8_t bmi323_get_fifo_length(uint16_t *fifo_avail_len, struct bmi3_dev *dev);
 
+/**
+ * \ingroup bmi323
+ * \defgroup bmi323Apireadfifoview readfifoview
+ * @brief Zero-copy FIFO read
+ */
+
+/*!
+ * \ingroup bmi323ApiFIFO
+ * \page bmi323_api_bmi323_read_fifo_view bmi323_read_fifo_view
+ * \code
+ * int8_t bmi323_read_fifo_view(struct bmi3_fifo_buf_ring *ring, struct bmi3_fifo_view *view, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API burst-reads the FIFO content into the next buffer of the ring and
+ * returns a view on it that already excludes the interface dummy bytes.
+ *
+ * @param[in,out] ring     : Ring of caller-owned buffers, advanced by one on success.
+ * @param[out]    view     : Pointer and length of the FIFO data in the ring buffer.
+ * @param[in]     dev      : Structure instance of bmi3_dev.
+ *
+ * @note The view stays valid until the ring wraps around to the same buffer.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval BMI3_W_FIFO_EMPTY -> FIFO is empty, view length is 0
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi323_read_fifo_view(struct bmi3_fifo_buf_ring *ring, struct bmi3_fifo_view *view, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi323ApiFIFO
+ * \page bmi323_api_bmi323_drain_fifo_view bmi323_drain_fifo_view
+ * \code
+ * int8_t bmi323_drain_fifo_view(struct bmi3_fifo_buf_ring *ring,
+ *                             struct bmi3_fifo_view *view,
+ *                             uint16_t max_len,
+ *                             struct bmi3_dev *dev);
+ * \endcode
+ * @details This API drains the FIFO like bmi323_read_fifo_view, in one bus transaction: it reads
+ * a fixed number of bytes without reading the fill level first and ends the data at the first
+ * frame whose accelerometer and gyroscope words all read BMI3_FIFO_EMPTY_WORD, which the
+ * sensor returns beyond the fill level. The FIFO configuration is taken from the copy kept in
+ * the device structure. The bus time is that of max_len bytes whatever the fill level, so
+ * max_len is best set a little above the water-mark. With neither accelerometer nor gyroscope
+ * in the FIFO, the frames carry no end marker and the FIFO is read as by bmi323_read_fifo_view.
+ *
+ * @param[in,out] ring     : Ring of caller-owned buffers, advanced by one on success.
+ * @param[out]    view     : Pointer and length of the FIFO data in the ring buffer.
+ * @param[in]     max_len  : Bytes to read, rounded down to whole frames; 0 reads a whole buffer.
+ * @param[in]     dev      : Structure instance of bmi3_dev.
+ *
+ * @note If view length equals the bytes read, the FIFO may hold more frames.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval BMI3_W_FIFO_EMPTY -> FIFO is empty, view length is 0
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi323_drain_fifo_view(struct bmi3_fifo_buf_ring *ring,
+                              struct bmi3_fifo_view *view,
+                              uint16_t max_len,
+                              struct bmi3_dev *dev);
+
 /**
  * \ingroup bmi323
  * \defgroup bmi323Apiselftest Perform self-test
  * @brief Performs self-test for the sensor.
  */
 
+#ifndef BMI3_SELF_TEST_DISABLE
 /*!
  * \ingroup bmi323Apiselftest
  * \page bmi323_api_bmi323_perform_self_test bmi323_perform_self_test
@@ -1057,6 +1993,7 @@ int8_t bmi323_get_fifo_length(uint16_t *fifo_avail_len, struct bmi3_dev *dev);
  *  @retval < 0 -> Fail
  */
 int8_t bmi323_perform_self_test(uint8_t st_selection, struct bmi3_st_result *st_result_status, struct bmi3_dev *dev);
+#endif
 
 /**
  * \ingroup bmi323
@@ -1124,6 +2061,7 @@ int8_t bmi323_get_feature_engine_error_status(uint8_t *feature_engine_err_reg_ls
  * @brief Writes config array and config version
  */
 
+#ifndef BMI3_ENHANCED_FLEXIBILITY_DISABLE
 /*!
  * \ingroup bmi323WriteConfigArray
  * \page bmi323_api_bmi323_configure_enhanced_flexibility bmi323_configure_enhanced_flexibility
@@ -1142,6 +2080,37 @@ int8_t bmi323_get_feature_engine_error_status(uint8_t *feature_engine_err_reg_ls
  */
 int8_t bmi323_configure_enhanced_flexibility(struct bmi3_dev *dev);
 
+/*!
+ * \ingroup bmi323WriteConfigArray
+ * \page bmi323_api_bmi323_configure_enhanced_flexibility_ext bmi323_configure_enhanced_flexibility_ext
+ * \code
+ * int8_t bmi323_configure_enhanced_flexibility_ext(struct bmi3_config_upload *upload, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API writes the config array and config version in extended mode, like
+ * bmi323_configure_enhanced_flexibility, and reports the upload statistics. Each array is
+ * streamed in bursts of dev->read_write_len bytes behind a single address write, so
+ * read_write_len should be set to the largest transfer the bus driver supports.
+ *
+ * If upload->verify is BMI3_ENABLE, every array is read back after it is written and
+ * compared with the driver's copy.
+ *
+ * The upload time is measured on the sensor time, as the driver has no clock of its own.
+ *
+ * @param[in,out] upload       : Structure instance of bmi3_config_upload.
+ *                               verify is an input; bytes, bursts, time_us and
+ *                               bytes_per_sec are written on return.
+ * @param[in]  dev             : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval BMI3_E_CONFIG_VERIFY -> Read-back does not match the config array
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi323_configure_enhanced_flexibility_ext(struct bmi3_config_upload *upload, struct bmi3_dev *dev);
+#endif
+
 /**
  * \ingroup bmi323
  * \defgroup bmi323ConfigVersion Config version
@@ -1208,6 +2177,7 @@ int8_t bmi323_perform_gyro_sc(uint8_t sc_selection,
  * @brief i3c_sync configurations
  */
 
+#ifndef BMI3_I3C_SYNC_DISABLE
 /*!
  * \ingroup bmi323Apii3c_sync
  * \page bmi323_api_set_i3c_tc_sync_tph set_i3c_tc_sync_tph
@@ -1378,12 +2348,36 @@ int8_t bmi323_set_i3c_sync_i3c_tc_res(uint8_t i3c_tc_res, struct bmi3_dev *dev);
  */
 int8_t bmi323_get_i3c_sync_i3c_tc_res(uint8_t *i3c_tc_res, struct bmi3_dev *dev);
 
+/*!
+ * \ingroup bmi323Apii3c_sync
+ * \page bmi323_api_bmi323_get_i3c_sync_snapshot bmi323_get_i3c_sync_snapshot
+ * \code
+ * int8_t bmi323_get_i3c_sync_snapshot(struct bmi3_i3c_sync_snapshot *snapshot, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API reads the I3C sync accelerometer, gyroscope and temperature data with one
+ * feature engine DMA burst, instead of one DMA transaction per sensor. The sync time is read ahead
+ * of the burst and the burst is repeated if the sync time that ends it differs, so that all three
+ * values belong to the same sync epoch.
+ *
+ * @param[out] snapshot      : Structure instance of bmi3_i3c_sync_snapshot.
+ * @param[in]  dev           : Structure instance of bmi3_dev.
+ *
+ *  @return Result of API execution status
+ *
+ *  @retval 0 -> Success
+ *  @retval BMI3_E_I3C_SYNC_TORN -> Sync time changed on every attempt
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi323_get_i3c_sync_snapshot(struct bmi3_i3c_sync_snapshot *snapshot, struct bmi3_dev *dev);
+#endif
+
 /**
  * \ingroup bmi323
  * \defgroup bmi323Alternateconfig Alternate configuration control
  * @brief Enable/Disable alternate configuration for accel and gyro.
  */
 
+#ifndef BMI3_ALT_CONFIG_DISABLE
 /*!
  * \ingroup bmi323Alternateconfig
  * \page bmi323_api_bmi323_alternate_config_ctrl bmi323_alternate_config_ctrl
@@ -1416,6 +2410,7 @@ int8_t bmi323_get_i3c_sync_i3c_tc_res(uint8_t *i3c_tc_res, struct bmi3_dev *dev)
  *  @retval < 0 -> Fail
  */
 int8_t bmi323_alternate_config_ctrl(uint8_t config_en, uint8_t alt_rst_conf, struct bmi3_dev *dev);
+#endif
 
 /**
  * \ingroup bmi323
@@ -1423,6 +2418,7 @@ int8_t bmi323_alternate_config_ctrl(uint8_t config_en, uint8_t alt_rst_conf, str
  * @brief  Read alternate configuration status
  */
 
+#ifndef BMI3_ALT_CONFIG_DISABLE
 /*!
  * \ingroup bmi323Alternatestatus
  * \page bmi323_api_bmi323_read_alternate_status bmi323_read_alternate_status
@@ -1440,6 +2436,7 @@ int8_t bmi323_alternate_config_ctrl(uint8_t config_en, uint8_t alt_rst_conf, str
  *  @retval < 0 -> Fail
  */
 int8_t bmi323_read_alternate_status(struct bmi3_alt_status *alt_status, struct bmi3_dev *dev);
+#endif
 
 /**
  * \ingroup bmi323
@@ -1567,6 +2564,7 @@ int8_t bmi323_set_user_acc_off_dgain(const struct bmi3_acc_usr_gain_offset *acc_
  * @brief FOC operations of the sensor
  */
 
+#ifndef BMI3_FOC_DISABLE
 /*!
  * \ingroup bmi323ApiFOC
  * \page bmi323_api_bmi323_perform_accel_foc bmi323_perform_accel_foc
@@ -1592,6 +2590,357 @@ int8_t bmi323_set_user_acc_off_dgain(const struct bmi3_acc_usr_gain_offset *acc_
  */
 int8_t bmi323_perform_accel_foc(const struct bmi3_accel_foc_g_value *accel_g_value, struct bmi3_dev *dev);
 
+/*!
+ * \ingroup bmi323ApiFOC
+ * \page bmi323_api_bmi323_perform_accel_foc_fifo bmi323_perform_accel_foc_fifo
+ * \code
+ * int8_t bmi323_perform_accel_foc_fifo(const struct bmi3_accel_foc_g_value *accel_g_value, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API performs Fast Offset Compensation for accelerometer like
+ * bmi323_perform_accel_foc, but collects the samples at 400Hz in the FIFO and drains them in
+ * one burst instead of polling each of them. The position is checked on the same samples.
+ * The accelerometer and FIFO configurations are restored and the FIFO is flushed.
+ *
+ * @param[in] accel_g_value : This parameter selects the accel FOC
+ * axis to be performed, as for bmi323_perform_accel_foc
+ *
+ * @param[in]  dev              : Structure instance of bmi3_dev.
+ *
+ *  @return Result of API execution status
+ *
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi323_perform_accel_foc_fifo(const struct bmi3_accel_foc_g_value *accel_g_value, struct bmi3_dev *dev);
+#endif
+
+/**
+ * \ingroup bmi323
+ * \defgroup bmi323ApiAsync Non-blocking operations
+ * @brief Start long-running operations and advance them without blocking
+ *
+ * The self-test, gyro self-calibration, accel FOC and axis remap spend most of their time
+ * waiting for the sensor. Each *_start API triggers the operation and returns; the caller
+ * then calls bmi323_async_step after op->wait_us microseconds, for as long as it returns
+ * BMI3_W_IN_PROGRESS. No delay is called by these APIs, so several devices can be driven
+ * from one loop. The result is the same as the one of the blocking API.
+ */
+
+#ifndef BMI3_SELF_TEST_DISABLE
+/*!
+ * \ingroup bmi323ApiAsync
+ * \page bmi323_api_bmi323_self_test_start bmi323_self_test_start
+ * \code
+ * int8_t bmi323_self_test_start(uint8_t st_selection,
+ *                           struct bmi3_st_result *st_result_status,
+ *                           struct bmi3_async_op *op,
+ *                           struct bmi3_dev *dev);
+ * \endcode
+ * @details This API triggers the self-test without waiting for its completion.
+ * st_result_status is written when bmi323_async_step reports completion.
+ *
+ * @param[in] st_selection      : Self-test selection, as for bmi323_perform_self_test
+ * @param[out] st_result_status : Structure instance of bmi3_st_result
+ * @param[out] op               : State of the operation
+ * @param[in] dev               : Structure instance of bmi3_dev
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_self_test_start(uint8_t st_selection,
+                           struct bmi3_st_result *st_result_status,
+                           struct bmi3_async_op *op,
+                           struct bmi3_dev *dev);
+#endif
+
+/*!
+ * \ingroup bmi323ApiAsync
+ * \page bmi323_api_bmi323_gyro_sc_start bmi323_gyro_sc_start
+ * \code
+ * int8_t bmi323_gyro_sc_start(uint8_t sc_selection,
+ *                         uint8_t apply_corr,
+ *                         struct bmi3_self_calib_rslt *sc_rslt,
+ *                         struct bmi3_async_op *op,
+ *                         struct bmi3_dev *dev);
+ * \endcode
+ * @details This API triggers the gyro self-calibration without waiting for its completion.
+ * sc_rslt is written when bmi323_async_step reports completion.
+ *
+ * @param[in] sc_selection : Self-calibration selection, as for bmi323_perform_gyro_sc
+ * @param[in] apply_corr   : Apply the correction
+ * @param[out] sc_rslt     : Structure instance of bmi3_self_calib_rslt
+ * @param[out] op          : State of the operation
+ * @param[in] dev          : Structure instance of bmi3_dev
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_gyro_sc_start(uint8_t sc_selection,
+                         uint8_t apply_corr,
+                         struct bmi3_self_calib_rslt *sc_rslt,
+                         struct bmi3_async_op *op,
+                         struct bmi3_dev *dev);
+
+#ifndef BMI3_FOC_DISABLE
+/*!
+ * \ingroup bmi323ApiAsync
+ * \page bmi323_api_bmi323_accel_foc_start bmi323_accel_foc_start
+ * \code
+ * int8_t bmi323_accel_foc_start(const struct bmi3_accel_foc_g_value *accel_g_value,
+ *                           struct bmi3_async_op *op,
+ *                           struct bmi3_dev *dev);
+ * \endcode
+ * @details This API starts the accelerometer Fast Offset Compensation. The samples are
+ * collected one per call of bmi323_async_step.
+ *
+ * @param[in] accel_g_value : Accel FOC axis and sign, as for bmi323_perform_accel_foc
+ * @param[out] op           : State of the operation
+ * @param[in] dev           : Structure instance of bmi3_dev
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_accel_foc_start(const struct bmi3_accel_foc_g_value *accel_g_value,
+                           struct bmi3_async_op *op,
+                           struct bmi3_dev *dev);
+#endif
+
+/*!
+ * \ingroup bmi323ApiAsync
+ * \page bmi323_api_bmi323_set_remap_axes_start bmi323_set_remap_axes_start
+ * \code
+ * int8_t bmi323_set_remap_axes_start(const struct bmi3_axes_remap remapped_axis,
+ *                                struct bmi3_async_op *op,
+ *                                struct bmi3_dev *dev);
+ * \endcode
+ * @details This API sets the re-mapped axes and triggers the axis map update without
+ * waiting for it. If the accelerometer is disabled there is nothing to wait for and
+ * op is left idle.
+ *
+ * @param[in] remapped_axis : Structure instance of bmi3_axes_remap
+ * @param[out] op           : State of the operation
+ * @param[in] dev           : Structure instance of bmi3_dev
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_set_remap_axes_start(const struct bmi3_axes_remap remapped_axis,
+                                struct bmi3_async_op *op,
+                                struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi323ApiAsync
+ * \page bmi323_api_bmi323_async_step bmi323_async_step
+ * \code
+ * int8_t bmi323_async_step(struct bmi3_async_op *op, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API advances the running operation by one status poll. It never waits;
+ * op->wait_us tells how long to wait before the next call.
+ *
+ * @param[in,out] op : State of the operation
+ * @param[in] dev    : Structure instance of bmi3_dev
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Operation finished, or no operation running
+ * @retval BMI3_W_IN_PROGRESS -> Call again after op->wait_us microseconds
+ * @retval < 0 -> Fail, the operation is abandoned
+ */
+int8_t bmi323_async_step(struct bmi3_async_op *op, struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi323
+ * \defgroup bmi323ApiGroup Device group
+ * @brief Drive several devices sharing one bus from one loop
+ *
+ * A device group services its devices in round-robin order. Each call of
+ * bmi323_group_service gives every device one FIFO read of at most one buffer of its ring
+ * and, if due, one step of its long-running operation. The device serviced first rotates
+ * from pass to pass, so a device with a full FIFO cannot starve the others. The buffer size
+ * of each ring bounds the bus time a device gets per pass. The driver has no clock; the
+ * caller passes the current time to every pass.
+ */
+
+/*!
+ * \ingroup bmi323ApiGroup
+ * \page bmi323_api_bmi323_group_init bmi323_group_init
+ * \code
+ * int8_t bmi323_group_init(struct bmi3_dev_group *group);
+ * \endcode
+ * @details This API initializes an empty device group. fifo_cb and cb_ctx can be set after
+ * this call.
+ *
+ * @param[out] group : Device group
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_group_init(struct bmi3_dev_group *group);
+
+/*!
+ * \ingroup bmi323ApiGroup
+ * \page bmi323_api_bmi323_group_add bmi323_group_add
+ * \code
+ * int8_t bmi323_group_add(struct bmi3_dev_group *group,
+ *                       struct bmi3_dev *dev,
+ *                       struct bmi3_fifo_buf_ring *ring,
+ *                       uint8_t *index);
+ * \endcode
+ * @details This API adds an initialized device to a device group. Its FIFO is read into
+ * ring, as by bmi323_read_fifo_view.
+ *
+ * @param[in,out] group : Device group
+ * @param[in] dev       : Structure instance of bmi3_dev
+ * @param[in] ring      : Buffers the FIFO of the device is read into
+ * @param[out] index    : Index of the device in the group
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval BMI3_E_OUT_OF_RANGE -> The group already holds BMI3_GROUP_MAX_DEVS devices
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_group_add(struct bmi3_dev_group *group,
+                        struct bmi3_dev *dev,
+                        struct bmi3_fifo_buf_ring *ring,
+                        uint8_t *index);
+
+/*!
+ * \ingroup bmi323ApiGroup
+ * \page bmi323_api_bmi323_group_submit_op bmi323_group_submit_op
+ * \code
+ * int8_t bmi323_group_submit_op(struct bmi3_dev_group *group, uint8_t index, struct bmi3_async_op *op, uint64_t now_us);
+ * \endcode
+ * @details This API hands an operation started by one of the *_start APIs to the group,
+ * which then steps it from bmi323_group_service. member[index].op_rslt holds
+ * BMI3_W_IN_PROGRESS until the operation finishes, and its result afterwards.
+ *
+ * @param[in,out] group : Device group
+ * @param[in] index     : Index of the device the operation was started on
+ * @param[in] op        : State of the operation, kept by the caller until it finishes
+ * @param[in] now_us    : Current time in microseconds
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval BMI3_E_INVALID_INPUT -> Invalid index, or the device already runs an operation
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_group_submit_op(struct bmi3_dev_group *group, uint8_t index, struct bmi3_async_op *op, uint64_t now_us);
+
+/*!
+ * \ingroup bmi323ApiGroup
+ * \page bmi323_api_bmi323_group_service bmi323_group_service
+ * \code
+ * int8_t bmi323_group_service(struct bmi3_dev_group *group, uint64_t now_us);
+ * \endcode
+ * @details This API services every device of the group once. The FIFO data read is passed
+ * to group->fifo_cb. A failing device does not stop the pass; its result is kept in
+ * member[index].fifo_rslt or member[index].op_rslt.
+ *
+ * @param[in,out] group : Device group
+ * @param[in] now_us    : Current time in microseconds
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> First error of the pass
+ */
+int8_t bmi323_group_service(struct bmi3_dev_group *group, uint64_t now_us);
+
+/*!
+ * \ingroup bmi323ApiGroup
+ * \page bmi323_api_bmi323_group_get_stats bmi323_group_get_stats
+ * \code
+ * int8_t bmi323_group_get_stats(const struct bmi3_dev_group *group, struct bmi3_group_stats *stats);
+ * \endcode
+ * @details This API gets the aggregate FIFO throughput and the time between two FIFO reads
+ * of a device, which bounds the age of the data read.
+ *
+ * @param[in] group  : Device group
+ * @param[out] stats : Aggregate statistics
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_group_get_stats(const struct bmi3_dev_group *group, struct bmi3_group_stats *stats);
+
+/**
+ * \ingroup bmi323
+ * \defgroup bmi323ApiAcq Interrupt-driven acquisition
+ * @brief Read the FIFO on its interrupt with a self-tuning water-mark
+ *
+ * The acquisition engine sleeps in a user wait function until the FIFO water-mark or FIFO
+ * full interrupt fires, then reads the FIFO. It sets the water-mark from one of two goals:
+ * the longest time a frame may wait in the FIFO, or the most wakeups per second. The frames
+ * arriving while the host wakes up and reads are measured at every wakeup and taken off the
+ * water-mark, and a FIFO full interrupt widens this margin. The FIFO configuration, the
+ * sensor ODRs and the mapping of the FIFO interrupts to int_pin are left to the caller and
+ * are read once by bmi323_acq_start.
+ */
+
+/*!
+ * \ingroup bmi323ApiAcq
+ * \page bmi323_api_bmi323_acq_start bmi323_acq_start
+ * \code
+ * int8_t bmi323_acq_start(struct bmi3_acq *acq, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API reads the FIFO configuration and the ODRs and sets the first
+ * water-mark. It has to be called again after either changes.
+ *
+ * @param[in,out] acq : Acquisition engine, with wait, int_pin, timeout_us, ring, tune and
+ *                      the goal set
+ * @param[in] dev     : Structure instance of bmi3_dev
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval BMI3_E_INVALID_INPUT -> No goal, no sensor enabled in the FIFO or a ring buffer
+ *                                 too small for one frame
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_acq_start(struct bmi3_acq *acq, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi323ApiAcq
+ * \page bmi323_api_bmi323_acq_read bmi323_acq_read
+ * \code
+ * int8_t bmi323_acq_read(struct bmi3_acq *acq, struct bmi3_fifo_view *view, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API waits for the FIFO interrupt, clears it, reads the FIFO into the next
+ * buffer of the ring as by bmi323_read_fifo_view and retunes the water-mark. The FIFO is read
+ * after a wait timeout as well.
+ *
+ * @param[in,out] acq : Acquisition engine
+ * @param[out] view   : FIFO data read
+ * @param[in] dev     : Structure instance of bmi3_dev
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval BMI3_W_FIFO_EMPTY -> No frame was read
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_acq_read(struct bmi3_acq *acq, struct bmi3_fifo_view *view, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi323ApiAcq
+ * \page bmi323_api_bmi323_acq_get_stats bmi323_acq_get_stats
+ * \code
+ * int8_t bmi323_acq_get_stats(const struct bmi3_acq *acq, struct bmi3_acq_stats *stats);
+ * \endcode
+ * @details This API gets the water-mark in use, the wakeup rate and the average time
+ * between two reads, both per second of data read.
+ *
+ * @param[in] acq    : Acquisition engine
+ * @param[out] stats : Statistics
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi323_acq_get_stats(const struct bmi3_acq *acq, struct bmi3_acq_stats *stats);
+
 /**
  * \ingroup bmi323
  * \defgroup bmi323ApiStatus Sensor Status
@@ -181,6 +181,11 @@
 #define BMI323_PARAM_LIMIT_WAKEUP               UINT8_C(10)
 #define BMI323_PARAM_LIMIT_STEP_COUNT           UINT8_C(22)
 
+/*! Feature engine words of a context: any-motion and no-motion from BMI3_BASE_ADDR_ANY_MOTION,
+ *  sig-motion, step counter, orientation and tap from BMI3_BASE_ADDR_SIG_MOTION */
+#define BMI323_CONTEXT_MOTION_WORDS             UINT8_C(6)
+#define BMI323_CONTEXT_GESTURE_WORDS            UINT8_C(20)
+
 #define BMI323_16_BIT_RESOLUTION                BMI3_16_BIT_RESOLUTION
 
 /*! Maximum number of interrupt pins */
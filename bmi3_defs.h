@@ -49,6 +49,32 @@
 #include <stddef.h>
 #endif
 
+/********************************************************* */
+/*!             Build configuration                       */
+/********************************************************* */
+
+/*!
+ * The driver can be trimmed at build time. Define any of the following macros on the compiler
+ * command line, or in a header named by BMI3_USER_CONFIG (e.g. -DBMI3_USER_CONFIG=\"bmi3_user_config.h\"),
+ * to compile the feature out of bmi3.c and bmi323.c:
+ *
+ *  BMI3_STEP_COUNTER_DISABLE          : Step counter configuration and output
+ *  BMI3_TAP_DISABLE                   : Tap configuration
+ *  BMI3_ORIENTATION_DISABLE           : Orientation configuration and output
+ *  BMI3_ALT_CONFIG_DISABLE            : Alternate accel/gyro and auto-switch configuration
+ *  BMI3_I3C_SYNC_DISABLE              : I3C time synchronization
+ *  BMI3_FOC_DISABLE                   : Accelerometer fast offset compensation
+ *  BMI3_SELF_TEST_DISABLE             : Self-test
+ *  BMI3_ENHANCED_FLEXIBILITY_DISABLE  : Config array upload and the config arrays themselves
+ *
+ * The APIs of a disabled feature are not declared. bmi3_set_sensor_config, bmi3_get_sensor_config
+ * and bmi3_get_sensor_data return BMI3_E_INVALID_SENSOR for its sensor types. The same macros
+ * must be seen by the driver and by the application.
+ */
+#ifdef BMI3_USER_CONFIG
+#include BMI3_USER_CONFIG
+#endif
+
 /********************************************************* */
 /*!               Common Macros                           */
 /********************************************************* */
@@ -135,6 +161,18 @@
 #define BMI3_INTF_RET_SUCCESS                        INT8_C(0)
 #endif
 
+/*!
+ * BMI3_MEMORY_BARRIER orders the data and index accesses of the sample ring between the producer
+ * and the consumer thread. It can be overwritten by the build system, e.g. with __DMB() on Cortex-M.
+ */
+#ifndef BMI3_MEMORY_BARRIER
+#if defined(__GNUC__) || defined(__clang__)
+#define BMI3_MEMORY_BARRIER()                        __sync_synchronize()
+#else
+#define BMI3_MEMORY_BARRIER()
+#endif
+#endif
+
 /*! To define success code */
 #define BMI3_OK                                      INT8_C(0)
 
@@ -153,6 +191,8 @@
 #define BMI3_E_INVALID_ST_SELECTION                  INT8_C(-12)
 #define BMI3_E_OUT_OF_RANGE                          INT8_C(-13)
 #define BMI3_E_FEATURE_ENGINE_STATUS                 INT8_C(-14)
+#define BMI3_E_CONFIG_VERIFY                         INT8_C(-15)
+#define BMI3_E_I3C_SYNC_TORN                         INT8_C(-16)
 
 /*! BMI3 Commands */
 #define BMI3_CMD_SELF_TEST_TRIGGER                   UINT16_C(0x0100)
@@ -172,12 +212,18 @@
 #define BMI3_W_FIFO_ACCEL_DUMMY_FRAME                UINT8_C(5)
 #define BMI3_W_FIFO_TEMP_DUMMY_FRAME                 UINT8_C(6)
 #define BMI3_W_FIFO_INVALID_FRAME                    UINT8_C(7)
+#define BMI3_W_IN_PROGRESS                           UINT8_C(8)
+#define BMI3_W_RING_FULL                             UINT8_C(9)
+#define BMI3_W_RING_EMPTY                            UINT8_C(10)
 
 /*! Masks for FIFO dummy data frames */
 #define BMI3_FIFO_GYRO_DUMMY_FRAME                   UINT16_C(0x7f02)
 #define BMI3_FIFO_ACCEL_DUMMY_FRAME                  UINT16_C(0x7f01)
 #define BMI3_FIFO_TEMP_DUMMY_FRAME                   UINT16_C(0x8000)
 
+/*! Word read from the FIFO beyond its fill level */
+#define BMI3_FIFO_EMPTY_WORD                         UINT16_C(0x8000)
+
 /*! Bit wise to define information */
 #define BMI3_I_MIN_VALUE                             UINT8_C(1)
 #define BMI3_I_MAX_VALUE                             UINT8_C(2)
@@ -190,6 +236,23 @@
 /*! Soft-reset delay */
 #define BMI3_SOFT_RESET_DELAY                        UINT16_C(2000)
 
+/*!
+ * Feature engine readiness polling after soft-reset, in microseconds: the poll interval
+ * starts at BMI3_FEATURE_ENGINE_POLL_MIN_US and doubles up to BMI3_FEATURE_ENGINE_POLL_MAX_US
+ * until the engine is ready or BMI3_FEATURE_ENGINE_READY_TIMEOUT_US has passed
+ */
+#ifndef BMI3_FEATURE_ENGINE_POLL_MIN_US
+#define BMI3_FEATURE_ENGINE_POLL_MIN_US              UINT32_C(250)
+#endif
+
+#ifndef BMI3_FEATURE_ENGINE_POLL_MAX_US
+#define BMI3_FEATURE_ENGINE_POLL_MAX_US              UINT32_C(16000)
+#endif
+
+#ifndef BMI3_FEATURE_ENGINE_READY_TIMEOUT_US
+#define BMI3_FEATURE_ENGINE_READY_TIMEOUT_US         UINT32_C(1000000)
+#endif
+
 /***************************************************************************** */
 /*!         Sensor Macro Definitions                 */
 /***************************************************************************** */
@@ -440,6 +503,11 @@ in INT_STATUS_INT1/2. */
 /*! Macro to define start address of data in RAM patch */
 #define BMI3_CONFIG_ARRAY_DATA_START_ADDR            UINT8_C(4)
 
+/*! Maximum number of bytes read back per burst while verifying the config array */
+#ifndef BMI3_CONFIG_VERIFY_BURST
+#define BMI3_CONFIG_VERIFY_BURST                     UINT8_C(64)
+#endif
+
 /********************************************************* */
 /*!               Macros for bit masking                  */
 /********************************************************* */
@@ -1296,6 +1364,93 @@ in INT_STATUS_INT1/2. */
 #define BMI3_TAP_MIN_QUITE_DUR_BW_TAPS_POS           UINT8_C(0x08)
 #define BMI3_TAP_QUITE_TIME_AFTR_GEST_POS            UINT8_C(0x0C)
 
+/*! Macros to pack feature configurations into feature engine words at compile time, in the
+ *  order of the fields of the configuration structures */
+#define BMI3_ANY_NO_MOTION_WORDS(slope_thres, acc_ref_up, hysteresis, duration, wait_time) \
+    (BMI3_SET_BIT_POS0(0, BMI3_ANY_NO_SLOPE_THRESHOLD, slope_thres) | \
+     BMI3_SET_BITS(0, BMI3_ANY_NO_ACC_REF_UP, acc_ref_up)), \
+    BMI3_SET_BIT_POS0(0, BMI3_ANY_NO_HYSTERESIS, hysteresis), \
+    (BMI3_SET_BIT_POS0(0, BMI3_ANY_NO_DURATION, duration) | BMI3_SET_BITS(0, BMI3_ANY_NO_WAIT_TIME, wait_time))
+
+#define BMI3_SIG_MOTION_WORDS(block_size, p2p_min, mcr_min, p2p_max, mcr_max) \
+    BMI3_SET_BIT_POS0(0, BMI3_SIG_BLOCK_SIZE, block_size), \
+    (BMI3_SET_BIT_POS0(0, BMI3_SIG_P2P_MIN, p2p_min) | BMI3_SET_BITS(0, BMI3_SIG_MCR_MIN, mcr_min)), \
+    (BMI3_SET_BIT_POS0(0, BMI3_SIG_P2P_MAX, p2p_max) | BMI3_SET_BITS(0, BMI3_MCR_MAX, mcr_max))
+
+#define BMI3_STEP_COUNTER_WORDS(watermark_level, \
+                                reset_counter, \
+                                env_min_dist_up, \
+                                env_coef_up, \
+                                env_min_dist_down, \
+                                env_coef_down, \
+                                mean_val_decay, \
+                                mean_step_dur, \
+                                step_buffer_size, \
+                                filter_cascade_enabled, \
+                                step_counter_increment, \
+                                peak_duration_min_walking, \
+                                peak_duration_min_running, \
+                                activity_detection_factor, \
+                                activity_detection_thres, \
+                                step_duration_max, \
+                                step_duration_window, \
+                                step_duration_pp_enabled, \
+                                step_duration_thres, \
+                                mean_crossing_pp_enabled, \
+                                mcr_threshold, \
+                                sc_12_res) \
+    (BMI3_SET_BIT_POS0(0, BMI3_STEP_WATERMARK, watermark_level) | \
+     BMI3_SET_BITS(0, BMI3_STEP_RESET_COUNTER, reset_counter)), \
+    BMI3_SET_BIT_POS0(0, BMI3_STEP_ENV_MIN_DIST_UP, env_min_dist_up), \
+    BMI3_SET_BIT_POS0(0, BMI3_STEP_ENV_COEF_UP, env_coef_up), \
+    BMI3_SET_BIT_POS0(0, BMI3_STEP_ENV_MIN_DIST_DOWN, env_min_dist_down), \
+    BMI3_SET_BIT_POS0(0, BMI3_STEP_ENV_COEF_DOWN, env_coef_down), \
+    BMI3_SET_BIT_POS0(0, BMI3_STEP_MEAN_VAL_DECAY, mean_val_decay), \
+    BMI3_SET_BIT_POS0(0, BMI3_STEP_MEAN_STEP_DUR, mean_step_dur), \
+    (BMI3_SET_BIT_POS0(0, BMI3_STEP_BUFFER_SIZE, step_buffer_size) | \
+     BMI3_SET_BITS(0, BMI3_STEP_FILTER_CASCADE_ENABLED, filter_cascade_enabled) | \
+     BMI3_SET_BITS(0, BMI3_STEP_COUNTER_INCREMENT, step_counter_increment)), \
+    (BMI3_SET_BIT_POS0(0, BMI3_STEP_PEAK_DURATION_MIN_WALKING, peak_duration_min_walking) | \
+     BMI3_SET_BITS(0, BMI3_STEP_PEAK_DURATION_MIN_RUNNING, peak_duration_min_running)), \
+    (BMI3_SET_BIT_POS0(0, BMI3_STEP_ACTIVITY_DETECTION_FACTOR, activity_detection_factor) | \
+     BMI3_SET_BITS(0, BMI3_STEP_ACTIVITY_DETECTION_THRESHOLD, activity_detection_thres)), \
+    (BMI3_SET_BIT_POS0(0, BMI3_STEP_DURATION_MAX, step_duration_max) | \
+     BMI3_SET_BITS(0, BMI3_STEP_DURATION_WINDOW, step_duration_window)), \
+    (BMI3_SET_BIT_POS0(0, BMI3_STEP_DURATION_PP_ENABLED, step_duration_pp_enabled) | \
+     BMI3_SET_BITS(0, BMI3_STEP_DURATION_THRESHOLD, step_duration_thres) | \
+     BMI3_SET_BITS(0, BMI3_STEP_MEAN_CROSSING_PP_ENABLED, mean_crossing_pp_enabled) | \
+     BMI3_SET_BITS(0, BMI3_STEP_MCR_THRESHOLD, mcr_threshold) | BMI3_SET_BITS(0, BMI3_STEP_SC_12_RES, sc_12_res))
+
+#define BMI3_ORIENT_WORDS(ud_en, mode, blocking, theta, hold_time, slope_thres, hysteresis) \
+    (BMI3_SET_BIT_POS0(0, BMI3_ORIENT_UD_EN, ud_en) | BMI3_SET_BITS(0, BMI3_ORIENT_MODE, mode) | \
+     BMI3_SET_BITS(0, BMI3_ORIENT_BLOCKING, blocking) | BMI3_SET_BITS(0, BMI3_ORIENT_THETA, theta) | \
+     BMI3_SET_BITS(0, BMI3_ORIENT_HOLD_TIME, hold_time)), \
+    (BMI3_SET_BIT_POS0(0, BMI3_ORIENT_SLOPE_THRES, slope_thres) | BMI3_SET_BITS(0, BMI3_ORIENT_HYST, hysteresis))
+
+#define BMI3_TAP_WORDS(axis_sel, \
+                       wait_for_timeout, \
+                       max_peaks_for_tap, \
+                       mode, \
+                       tap_peak_thres, \
+                       max_gest_dur, \
+                       max_dur_between_peaks, \
+                       tap_shock_settling_dur, \
+                       min_quite_dur_between_taps, \
+                       quite_time_after_gest) \
+    (BMI3_SET_BIT_POS0(0, BMI3_TAP_AXIS_SEL, axis_sel) | \
+     BMI3_SET_BITS(0, BMI3_TAP_WAIT_FR_TIME_OUT, wait_for_timeout) | \
+     BMI3_SET_BITS(0, BMI3_TAP_MAX_PEAKS, max_peaks_for_tap) | BMI3_SET_BITS(0, BMI3_TAP_MODE, mode)), \
+    (BMI3_SET_BIT_POS0(0, BMI3_TAP_PEAK_THRES, tap_peak_thres) | BMI3_SET_BITS(0, BMI3_TAP_MAX_GEST_DUR, max_gest_dur)), \
+    (BMI3_SET_BIT_POS0(0, BMI3_TAP_MAX_DUR_BW_PEAKS, max_dur_between_peaks) | \
+     BMI3_SET_BITS(0, BMI3_TAP_SHOCK_SETT_DUR, tap_shock_settling_dur) | \
+     BMI3_SET_BITS(0, BMI3_TAP_MIN_QUITE_DUR_BW_TAPS, min_quite_dur_between_taps) | \
+     BMI3_SET_BITS(0, BMI3_TAP_QUITE_TIME_AFTR_GEST, quite_time_after_gest))
+
+/*! Number of feature engine words transferred per burst by bmi3_get_feature_words and bmi3_set_feature_words */
+#ifndef BMI3_FEATURE_WORDS_BURST
+#define BMI3_FEATURE_WORDS_BURST                     UINT8_C(32)
+#endif
+
 #define BMI3_TAP_DET_STATUS_SINGLE                   UINT16_C(0X0008)
 #define BMI3_TAP_DET_STATUS_DOUBLE                   UINT16_C(0X0010)
 #define BMI3_TAP_DET_STATUS_TRIPLE                   UINT16_C(0X0020)
@@ -1328,12 +1483,20 @@ in INT_STATUS_INT1/2. */
 /******************************************************************************/
 #define BMI3_ACC_NUM_BYTES                           UINT8_C(20)
 #define BMI3_GYR_NUM_BYTES                           UINT8_C(14)
+#define BMI3_BURST_NUM_BYTES                         UINT8_C(24)
 #define BMI3_CRT_CONFIG_FILE_SIZE                    UINT16_C(2048)
 #define BMI3_FEAT_SIZE_IN_BYTES                      UINT8_C(16)
 #define BMI3_ACC_CONFIG_LENGTH                       UINT8_C(2)
 #define BMI3_NUM_BYTES_I3C_SYNC_ACC                  UINT8_C(16)
 #define BMI3_NUM_BYTES_I3C_SYNC_GYR                  UINT8_C(10)
 #define BMI3_NUM_BYTES_I3C_SYNC_TEMP                 UINT8_C(4)
+#define BMI3_NUM_BYTES_I3C_SYNC_SNAPSHOT             UINT8_C(16)
+#define BMI3_NUM_BYTES_I3C_SYNC_TIME                 UINT8_C(2)
+
+/*! Number of times an I3C sync snapshot is re-read when sync_time changed under the burst */
+#ifndef BMI3_I3C_SYNC_SNAPSHOT_RETRIES
+#define BMI3_I3C_SYNC_SNAPSHOT_RETRIES               UINT8_C(3)
+#endif
 
 /******************************************************************************/
 /*!        Accelerometer Macro Definitions               */
@@ -1543,6 +1706,74 @@ in INT_STATUS_INT1/2. */
 #define BMI3_BASE_ADDR_ACC_OFFSET_GAIN               UINT8_C(0x40)
 #define BMI3_BASE_ADDR_GYRO_OFFSET_GAIN              UINT8_C(0x46)
 
+/*! Feature engine configuration fields, for bmi3_get_feature_fields and bmi3_set_feature_fields */
+#define BMI3_FIELD_ANY_MOTION_SLOPE_THRES            UINT8_C(0)
+#define BMI3_FIELD_ANY_MOTION_ACC_REF_UP             UINT8_C(1)
+#define BMI3_FIELD_ANY_MOTION_HYSTERESIS             UINT8_C(2)
+#define BMI3_FIELD_ANY_MOTION_DURATION               UINT8_C(3)
+#define BMI3_FIELD_ANY_MOTION_WAIT_TIME              UINT8_C(4)
+#define BMI3_FIELD_NO_MOTION_SLOPE_THRES             UINT8_C(5)
+#define BMI3_FIELD_NO_MOTION_ACC_REF_UP              UINT8_C(6)
+#define BMI3_FIELD_NO_MOTION_HYSTERESIS              UINT8_C(7)
+#define BMI3_FIELD_NO_MOTION_DURATION                UINT8_C(8)
+#define BMI3_FIELD_NO_MOTION_WAIT_TIME               UINT8_C(9)
+#define BMI3_FIELD_FLAT_THETA                        UINT8_C(10)
+#define BMI3_FIELD_FLAT_BLOCKING                     UINT8_C(11)
+#define BMI3_FIELD_FLAT_HOLD_TIME                    UINT8_C(12)
+#define BMI3_FIELD_FLAT_SLOPE_THRES                  UINT8_C(13)
+#define BMI3_FIELD_FLAT_HYSTERESIS                   UINT8_C(14)
+#define BMI3_FIELD_SIG_MOTION_BLOCK_SIZE             UINT8_C(15)
+#define BMI3_FIELD_SIG_MOTION_P2P_MIN                UINT8_C(16)
+#define BMI3_FIELD_SIG_MOTION_MCR_MIN                UINT8_C(17)
+#define BMI3_FIELD_SIG_MOTION_P2P_MAX                UINT8_C(18)
+#define BMI3_FIELD_SIG_MOTION_MCR_MAX                UINT8_C(19)
+#define BMI3_FIELD_STEP_WATERMARK_LEVEL              UINT8_C(20)
+#define BMI3_FIELD_STEP_RESET_COUNTER                UINT8_C(21)
+#define BMI3_FIELD_STEP_ENV_MIN_DIST_UP              UINT8_C(22)
+#define BMI3_FIELD_STEP_ENV_COEF_UP                  UINT8_C(23)
+#define BMI3_FIELD_STEP_ENV_MIN_DIST_DOWN            UINT8_C(24)
+#define BMI3_FIELD_STEP_ENV_COEF_DOWN                UINT8_C(25)
+#define BMI3_FIELD_STEP_MEAN_VAL_DECAY               UINT8_C(26)
+#define BMI3_FIELD_STEP_MEAN_STEP_DUR                UINT8_C(27)
+#define BMI3_FIELD_STEP_BUFFER_SIZE                  UINT8_C(28)
+#define BMI3_FIELD_STEP_FILTER_CASCADE_ENABLED       UINT8_C(29)
+#define BMI3_FIELD_STEP_COUNTER_INCREMENT            UINT8_C(30)
+#define BMI3_FIELD_STEP_PEAK_DURATION_MIN_WALKING    UINT8_C(31)
+#define BMI3_FIELD_STEP_PEAK_DURATION_MIN_RUNNING    UINT8_C(32)
+#define BMI3_FIELD_STEP_ACTIVITY_DETECTION_FACTOR    UINT8_C(33)
+#define BMI3_FIELD_STEP_ACTIVITY_DETECTION_THRES     UINT8_C(34)
+#define BMI3_FIELD_STEP_DURATION_MAX                 UINT8_C(35)
+#define BMI3_FIELD_STEP_DURATION_WINDOW              UINT8_C(36)
+#define BMI3_FIELD_STEP_DURATION_PP_ENABLED          UINT8_C(37)
+#define BMI3_FIELD_STEP_DURATION_THRES               UINT8_C(38)
+#define BMI3_FIELD_STEP_MEAN_CROSSING_PP_ENABLED     UINT8_C(39)
+#define BMI3_FIELD_STEP_MCR_THRESHOLD                UINT8_C(40)
+#define BMI3_FIELD_STEP_SC_12_RES                    UINT8_C(41)
+#define BMI3_FIELD_ORIENT_UD_EN                      UINT8_C(42)
+#define BMI3_FIELD_ORIENT_MODE                       UINT8_C(43)
+#define BMI3_FIELD_ORIENT_BLOCKING                   UINT8_C(44)
+#define BMI3_FIELD_ORIENT_THETA                      UINT8_C(45)
+#define BMI3_FIELD_ORIENT_HOLD_TIME                  UINT8_C(46)
+#define BMI3_FIELD_ORIENT_SLOPE_THRES                UINT8_C(47)
+#define BMI3_FIELD_ORIENT_HYSTERESIS                 UINT8_C(48)
+#define BMI3_FIELD_TAP_AXIS_SEL                      UINT8_C(49)
+#define BMI3_FIELD_TAP_WAIT_FOR_TIMEOUT              UINT8_C(50)
+#define BMI3_FIELD_TAP_MAX_PEAKS_FOR_TAP             UINT8_C(51)
+#define BMI3_FIELD_TAP_MODE                          UINT8_C(52)
+#define BMI3_FIELD_TAP_PEAK_THRES                    UINT8_C(53)
+#define BMI3_FIELD_TAP_MAX_GEST_DUR                  UINT8_C(54)
+#define BMI3_FIELD_TAP_MAX_DUR_BETWEEN_PEAKS         UINT8_C(55)
+#define BMI3_FIELD_TAP_SHOCK_SETTLING_DUR            UINT8_C(56)
+#define BMI3_FIELD_TAP_MIN_QUITE_DUR_BETWEEN_TAPS    UINT8_C(57)
+#define BMI3_FIELD_TAP_QUITE_TIME_AFTER_GEST         UINT8_C(58)
+#define BMI3_FIELD_TILT_SEGMENT_SIZE                 UINT8_C(59)
+#define BMI3_FIELD_TILT_MIN_TILT_ANGLE               UINT8_C(60)
+#define BMI3_FIELD_TILT_BETA_ACC_MEAN                UINT8_C(61)
+#define BMI3_FIELD_MAX                               UINT8_C(62)
+
+/*! Number of feature engine words from the any-motion up to the tilt configuration */
+#define BMI3_FEATURE_CONFIG_WORDS                    UINT8_C(30)
+
 /******************************************************************************/
 /*! @name BMI3 Interrupt Modes */
 /******************************************************************************/
@@ -1594,6 +1825,37 @@ in INT_STATUS_INT1/2. */
 #define BMI3_LENGTH_FIFO_WM                          UINT8_C(2)
 #define BMI3_LENGTH_MAX_FIFO_FILTER                  UINT8_C(1)
 #define BMI3_LENGTH_FIFO_DATA                        UINT8_C(2)
+
+/*! Transaction queue capacity: queued writes and their data bytes */
+#ifndef BMI3_BATCH_MAX_OPS
+#define BMI3_BATCH_MAX_OPS                           UINT8_C(16)
+#endif
+
+#ifndef BMI3_BATCH_BUF_SIZE
+#define BMI3_BATCH_BUF_SIZE                          UINT16_C(128)
+#endif
+
+/*! Shadow cache size: user-page registers and feature engine words */
+#define BMI3_SHADOW_NUM_REGS                         UINT8_C(128)
+#define BMI3_SHADOW_NUM_FEATURE_WORDS                UINT8_C(64)
+
+/*! Shadow cache pages */
+#define BMI3_SHADOW_PAGE_REG                         UINT8_C(0)
+#define BMI3_SHADOW_PAGE_FEATURE                     UINT8_C(1)
+
+/*! Longest headerless FIFO frame: accel, gyro, temperature and sensor time */
+#define BMI3_LENGTH_FIFO_MAX_FRAME                   UINT8_C(16)
+
+/*! Sensor time resolution, 1 LSB = 625 / 16 us = 39.0625 us */
+#define BMI3_SENSOR_TIME_LSB_US_NUM                  UINT16_C(625)
+#define BMI3_SENSOR_TIME_LSB_US_DEN                  UINT16_C(16)
+
+/*! Sensor time ticks per sample at 6.4 kHz, doubled for every lower ODR step */
+#define BMI3_SENSOR_TIME_TICKS_6400HZ                UINT8_C(4)
+
+/*! Converts unwrapped sensor time ticks to microseconds */
+#define BMI3_SENSOR_TIME_TO_US(ticks) \
+    (((uint64_t)(ticks) * BMI3_SENSOR_TIME_LSB_US_NUM) / BMI3_SENSOR_TIME_LSB_US_DEN)
 #define BMI3_LENGTH_FIFO_MSB_BYTE                    UINT8_C(1)
 
 /*! BMI3 Mask definitions of FIFO configuration registers */
@@ -1680,6 +1942,45 @@ in INT_STATUS_INT1/2. */
 
 #define BMI3_FOC_SAMPLE_LIMIT         UINT8_C(128)
 
+/*! Status polling of the long-running operations: interval in microseconds and number of polls */
+#define BMI3_FOC_POLL_DELAY_US        UINT32_C(20000)
+#define BMI3_FOC_DRDY_TRIES           UINT8_C(5)
+#define BMI3_ST_POLL_DELAY_US         UINT32_C(120000)
+#define BMI3_ST_POLL_LIMIT            UINT8_C(10)
+#define BMI3_SC_POLL_LIMIT            UINT8_C(25)
+#define BMI3_AXIS_MAP_POLL_DELAY_US   UINT32_C(5000)
+#define BMI3_AXIS_MAP_POLL_LIMIT      UINT8_C(20)
+
+/*! Operations driven by bmi3_async_step */
+#define BMI3_ASYNC_OP_NONE            UINT8_C(0)
+#define BMI3_ASYNC_OP_SELF_TEST       UINT8_C(1)
+#define BMI3_ASYNC_OP_GYRO_SC         UINT8_C(2)
+#define BMI3_ASYNC_OP_ACCEL_FOC       UINT8_C(3)
+#define BMI3_ASYNC_OP_AXES_REMAP      UINT8_C(4)
+
+/*! Steps of the accel FOC operation */
+#define BMI3_ASYNC_FOC_VERIFY         UINT8_C(0)
+#define BMI3_ASYNC_FOC_SAMPLE         UINT8_C(1)
+
+/*! Maximum number of devices sharing a bus in a device group */
+#ifndef BMI3_GROUP_MAX_DEVS
+#define BMI3_GROUP_MAX_DEVS           UINT8_C(16)
+#endif
+
+/*! Water-mark tuning goals of the acquisition engine */
+#define BMI3_ACQ_TUNE_LATENCY         UINT8_C(0)
+#define BMI3_ACQ_TUNE_WAKEUPS         UINT8_C(1)
+
+/*! FIFO capacity in words */
+#define BMI3_FIFO_CAPACITY_WORDS      UINT16_C(1024)
+
+/*! Standard gravity in m/s^2 */
+#define BMI3_GRAVITY_EARTH            (9.80665f)
+
+/*! Full scale of the Q15 and Q31 unit conversions: 1.0 is 16 g or 2000 dps in every range */
+#define BMI3_Q_ACC_FULL_SCALE_G       UINT8_C(16)
+#define BMI3_Q_GYR_FULL_SCALE_DPS     UINT16_C(2000)
+
 #define BMI3_ACC_2G_MAX_NOISE_LIMIT   (BMI3_ACC_FOC_2G_REF + BMI3_ACC_FOC_2G_OFFSET)
 #define BMI3_ACC_2G_MIN_NOISE_LIMIT   (BMI3_ACC_FOC_2G_REF - BMI3_ACC_FOC_2G_OFFSET)
 #define BMI3_ACC_4G_MAX_NOISE_LIMIT   (BMI3_ACC_FOC_4G_REF + BMI3_ACC_FOC_4G_OFFSET)
@@ -1693,6 +1994,25 @@ in INT_STATUS_INT1/2. */
 #define BMI3_FOC_ACC_CONF_VAL_LSB     UINT8_C(0xB7)
 #define BMI3_FOC_ACC_CONF_VAL_MSB     UINT8_C(0x40)
 
+/*! Macro to define accelerometer configuration value for FIFO based FOC: 400Hz, same range
+ *  and bandwidth as BMI3_FOC_ACC_CONF_VAL_LSB */
+#ifndef BMI3_FOC_FIFO_ACC_CONF_VAL_LSB
+#define BMI3_FOC_FIFO_ACC_CONF_VAL_LSB  UINT8_C(0xBA)
+#endif
+
+/*! Sample period of BMI3_FOC_FIFO_ACC_CONF_VAL_LSB in microseconds */
+#ifndef BMI3_FOC_FIFO_SAMPLE_US
+#define BMI3_FOC_FIFO_SAMPLE_US         UINT32_C(2500)
+#endif
+
+/*! Number of accel frames read from the FIFO per burst by the FIFO based FOC */
+#ifndef BMI3_FOC_FIFO_BURST_FRAMES
+#define BMI3_FOC_FIFO_BURST_FRAMES      UINT8_C(16)
+#endif
+
+/*! Buffer size for BMI3_FOC_FIFO_BURST_FRAMES headerless accel frames and the interface dummy bytes */
+#define BMI3_FOC_FIFO_BUF_SIZE          ((BMI3_FOC_FIFO_BURST_FRAMES * BMI3_LENGTH_FIFO_ACC) + 2)
+
 /*! Macro to define X Y and Z axis for an array */
 #define BMI3_X_AXIS                   UINT8_C(0)
 #define BMI3_Y_AXIS                   UINT8_C(1)
@@ -1786,6 +2106,15 @@ typedef BMI3_INTF_RET_TYPE (*bmi3_write_fptr_t)(uint8_t reg_addr, const uint8_t
  */
 typedef void (*bmi3_delay_us_fptr_t)(uint32_t period, void *intf_ptr);
 
+/*!
+ * @brief Lock or unlock function pointer which should be mapped to a recursive mutex
+ * of the device, see bmi3_lock_enable
+ *
+ * @param[in,out] lock_ctx : Context given to bmi3_lock_enable, e.g. the mutex
+ *
+ */
+typedef void (*bmi3_lock_fptr_t)(void *lock_ctx);
+
 /********************************************************* */
 /*!                  Enumerators                          */
 /********************************************************* */
@@ -1871,6 +2200,42 @@ struct bmi3_fifo_frame
     uint16_t avail_fifo_temp_frames;
 };
 
+/*!
+ * @brief Structure to define a ring of caller-owned buffers for zero-copy FIFO reads
+ */
+struct bmi3_fifo_buf_ring
+{
+    /*! Array of num_buf buffers of buf_size bytes each (e.g. DMA-capable memory) */
+    uint8_t **buf;
+
+    /*! Number of buffers in the ring */
+    uint8_t num_buf;
+
+    /*! Size of each buffer in bytes, including room for the interface dummy bytes */
+    uint16_t buf_size;
+
+    /*! Index of the buffer to be filled by the next read */
+    uint8_t next;
+};
+
+/*!
+ * @brief Structure to define a view on FIFO data held in a ring buffer
+ */
+struct bmi3_fifo_view
+{
+    /*! First FIFO byte; the interface dummy bytes are already skipped */
+    const uint8_t *data;
+
+    /*! Number of FIFO bytes available at data */
+    uint16_t length;
+
+    /*! FIFO frame configuration the data was read with */
+    uint16_t available_fifo_sens;
+
+    /*! Index of the ring buffer holding the data */
+    uint8_t buf_idx;
+};
+
 /*!
  * @brief Primary device structure
  */
@@ -1920,6 +2285,28 @@ struct bmi3_dev
 
     /*! Accel bit width */
     uint16_t accel_bit_width;
+
+    /*! Transaction queue of bmi3_batch_begin, NULL if writes go to the bus directly */
+    struct bmi3_batch *batch;
+
+    /*! Shadow register cache of bmi3_shadow_enable, NULL if registers are read from the bus */
+    struct bmi3_shadow *shadow;
+
+    /*! Time from the soft-reset command until the feature engine reported ready, measured by the
+     * last bmi3_soft_reset in microseconds (0 if it never got ready) */
+    uint32_t feature_ready_us;
+
+    /*! Lock and unlock hooks of bmi3_lock_enable, NULL if the device is used from one thread */
+    bmi3_lock_fptr_t lock;
+    bmi3_lock_fptr_t unlock;
+
+    /*! Context passed to the lock hooks, e.g. the mutex of the device */
+    void *lock_ctx;
+
+    /*! FIFO configuration register as last written or read, used by the FIFO reads if
+     * fifo_conf_valid is BMI3_TRUE */
+    uint16_t fifo_conf;
+    uint8_t fifo_conf_valid;
 };
 
 /*!
@@ -2002,6 +2389,21 @@ struct bmi3_i3c_sync_data
     uint16_t sync_time;
 };
 
+/*!
+ * @brief Structure to define accel, gyro and temperature data of one I3C sync epoch
+ */
+struct bmi3_i3c_sync_snapshot
+{
+    /*! I3C sync accelerometer data */
+    struct bmi3_i3c_sync_data acc;
+
+    /*! I3C sync gyroscope data */
+    struct bmi3_i3c_sync_data gyr;
+
+    /*! I3C sync temperature data */
+    struct bmi3_i3c_sync_data temp;
+};
+
 /*!
  * @brief Structure to define FIFO accel, gyro x, y and z axis and
  * sensor time
@@ -2033,6 +2435,259 @@ struct bmi3_fifo_temperature_data
     uint16_t sensor_time;
 };
 
+/*!
+ * @brief Structure to define one headerless FIFO frame as seen by the single-pass parser
+ */
+struct bmi3_fifo_frame_sample
+{
+    /*! Accelerometer data */
+    struct bmi3_fifo_sens_axes_data acc;
+
+    /*! Gyroscope data */
+    struct bmi3_fifo_sens_axes_data gyr;
+
+    /*! Temperature data */
+    uint16_t temp_data;
+
+    /*! Sensor time data */
+    uint16_t sensor_time;
+
+    /*! Parts of the frame holding valid (non-dummy) data: BMI3_FIFO_ACC_EN, BMI3_FIFO_GYR_EN,
+     *  BMI3_FIFO_TEMP_EN and BMI3_FIFO_TIME_EN bits */
+    uint16_t valid;
+};
+
+/*!
+ * @brief Function pointer called by the single-pass FIFO parser for every frame
+ *
+ * @param[in] sample       : Parsed frame
+ * @param[in,out] cb_ctx   : User context given in bmi3_fifo_demux
+ */
+typedef void (*bmi3_fifo_frame_fptr_t)(const struct bmi3_fifo_frame_sample *sample, void *cb_ctx);
+
+/*!
+ * @brief Structure to define the outputs of the single-pass FIFO parser.
+ * Any output array may be NULL, in which case that sensor is not stored.
+ */
+struct bmi3_fifo_demux
+{
+    /*! Accelerometer output and its capacity in frames */
+    struct bmi3_fifo_sens_axes_data *accel_data;
+    uint16_t accel_len;
+
+    /*! Gyroscope output and its capacity in frames */
+    struct bmi3_fifo_sens_axes_data *gyro_data;
+    uint16_t gyro_len;
+
+    /*! Temperature output and its capacity in frames */
+    struct bmi3_fifo_temperature_data *temp_data;
+    uint16_t temp_len;
+
+    /*! Sensor time output and its capacity in frames */
+    uint16_t *sensor_time;
+    uint16_t sensor_time_len;
+
+    /*! Optional per-frame callback and its context */
+    bmi3_fifo_frame_fptr_t frame_cb;
+    void *cb_ctx;
+
+    /*! Number of accelerometer frames stored */
+    uint16_t accel_frames;
+
+    /*! Number of gyroscope frames stored */
+    uint16_t gyro_frames;
+
+    /*! Number of temperature frames stored */
+    uint16_t temp_frames;
+
+    /*! Number of sensor time frames stored */
+    uint16_t sensor_time_frames;
+
+    /*! Number of complete frames walked */
+    uint16_t total_frames;
+};
+
+/*!
+ * @brief Structure to define one queued register write
+ */
+struct bmi3_batch_op
+{
+    /*! Register address */
+    uint8_t reg_addr;
+
+    /*! Offset of the data in bmi3_batch::data */
+    uint16_t offset;
+
+    /*! Number of data bytes */
+    uint16_t len;
+};
+
+/*!
+ * @brief Structure to define the register transaction queue, in which the writes of
+ * configuration sequences are recorded and merged into bursts
+ */
+struct bmi3_batch
+{
+    /*! Queued writes */
+    struct bmi3_batch_op op[BMI3_BATCH_MAX_OPS];
+
+    /*! Data of the queued writes */
+    uint8_t data[BMI3_BATCH_BUF_SIZE];
+
+    /*! Number of queued writes */
+    uint8_t num_ops;
+
+    /*! Number of used bytes in data */
+    uint16_t data_len;
+
+    /*! Feature engine word the next queued FEATURE_DATA_TX byte goes to */
+    uint16_t feature_addr;
+
+    /*! BMI3_TRUE if feature_addr is known */
+    uint8_t feature_addr_valid;
+
+    /*! Number of register writes requested while queuing */
+    uint16_t write_count;
+
+    /*! Number of bus writes issued by the flushes */
+    uint16_t burst_count;
+};
+
+/*!
+ * @brief Structure to define the write-through shadow cache of the configuration registers
+ * and feature engine words
+ */
+struct bmi3_shadow
+{
+    /*! Cached user-page registers, indexed by register address */
+    uint16_t reg[BMI3_SHADOW_NUM_REGS];
+
+    /*! Cached feature engine words, indexed by feature engine address */
+    uint16_t feature[BMI3_SHADOW_NUM_FEATURE_WORDS];
+
+    /*! Valid bits of reg */
+    uint32_t reg_valid[BMI3_SHADOW_NUM_REGS / 32];
+
+    /*! Valid bits of feature */
+    uint32_t feature_valid[BMI3_SHADOW_NUM_FEATURE_WORDS / 32];
+
+    /*! Feature engine address the next FEATURE_DATA_TX word is for */
+    uint16_t feature_addr;
+
+    /*! Feature engine address the data port of the device points at */
+    uint16_t port_addr;
+
+    /*! BMI3_TRUE if feature_addr is known */
+    uint8_t feature_addr_valid;
+
+    /*! BMI3_TRUE if port_addr is known */
+    uint8_t port_addr_valid;
+
+    /*! BMI3_TRUE while the device is on the user page (BMI3_REG_CFG_RES cleared) */
+    uint8_t user_page;
+
+    /*! Number of reads served from the cache */
+    uint32_t hits;
+
+    /*! Number of reads that went to the bus */
+    uint32_t misses;
+};
+
+/*!
+ * @brief Structure to define the state of the streaming FIFO parser, which keeps the
+ * bytes of a frame split across two FIFO reads
+ */
+struct bmi3_fifo_stream
+{
+    /*! FIFO configuration the pending bytes belong to */
+    uint16_t available_fifo_sens;
+
+    /*! Bytes of the incomplete frame at the end of the last read */
+    uint8_t tail[BMI3_LENGTH_FIFO_MAX_FRAME];
+
+    /*! Number of bytes in tail */
+    uint8_t tail_len;
+
+    /*! Sensor time of the last complete frame, if sensor time is enabled in the FIFO */
+    uint16_t sensor_time;
+
+    /*! Number of complete frames parsed since bmi3_fifo_stream_init */
+    uint32_t total_frames;
+};
+
+/*!
+ * @brief Structure to define the state of the FIFO timestamp reconstruction, which turns
+ * 16-bit FIFO sensor time stamps into monotonic 64-bit sensor time
+ */
+struct bmi3_fifo_time_sync
+{
+    /*! Unwrapped sensor time of the last frame in ticks of 39.0625 us */
+    uint64_t last_time;
+
+    /*! 32-bit sensor time read by the last anchor */
+    uint32_t anchor;
+
+    /*! Frame period in ticks, used when sensor time is not part of the FIFO */
+    uint32_t frame_period;
+
+    /*! BMI3_TRUE if the next frame is to be aligned to the anchor */
+    uint8_t anchor_pending;
+
+    /*! BMI3_TRUE once last_time is valid */
+    uint8_t synced;
+};
+
+/*!
+ * @brief Structure to define FIFO accelerometer or gyroscope data in
+ * struct-of-arrays layout, one element per FIFO frame
+ */
+struct bmi3_fifo_axes_soa
+{
+    /*! Data in x-axis */
+    int16_t *x;
+
+    /*! Data in y-axis */
+    int16_t *y;
+
+    /*! Data in z-axis */
+    int16_t *z;
+
+    /*! Sensor time data, may be NULL */
+    uint16_t *sensor_time;
+
+    /*! Validity bitmask of bmi3_decode_fifo_frames, bit (n % 32) of word (n / 32) is set if frame n is
+     *  not a dummy frame, may be NULL */
+    uint32_t *valid;
+
+    /*! Capacity of the arrays in frames */
+    uint16_t len;
+
+    /*! Number of frames stored */
+    uint16_t frames;
+};
+
+/*!
+ * @brief Structure to define the scale factors of the unit conversions, set by
+ * bmi3_get_unit_scale for one sensor and range
+ */
+struct bmi3_unit_scale
+{
+    /*! BMI3_ACCEL or BMI3_GYRO */
+    uint8_t type;
+
+    /*! Range the factors were computed for */
+    uint8_t range;
+
+    /*! m/s^2 or dps per LSB */
+    float si;
+
+    /*! Q31 value of one LSB, a power of 2 */
+    int32_t q31_mult;
+
+    /*! Right shift from LSB to Q15 */
+    uint8_t q15_shift;
+};
+
 /*!
  * @brief Structure to define orientation output
  */
@@ -2132,6 +2787,56 @@ struct bmi3_sensor_data
     union bmi3_sens_data sens_data;
 };
 
+/*!
+ * @brief Structure to define where a configuration field lives in the feature engine
+ * and in its configuration structure
+ */
+struct bmi3_feature_field
+{
+    /*! Feature engine address of the feature, e.g. BMI3_BASE_ADDR_ANY_MOTION */
+    uint8_t base_addr;
+
+    /*! Offset of the word holding the field from the base address */
+    uint8_t word;
+
+    /*! Mask of the field in the word */
+    uint16_t mask;
+
+    /*! Position of the field in the word */
+    uint8_t pos;
+
+    /*! Offset of the field in the configuration structure */
+    uint8_t offset;
+
+    /*! Size of the field in the configuration structure, 1 or 2 bytes */
+    uint8_t size;
+};
+
+/*!
+ * @brief Structure to define the data registers read in one burst, from the
+ * sensor status up to the interrupt 1 status
+ */
+struct bmi3_sensor_burst_data
+{
+    /*! Accelerometer data, sensor time and saturation flags */
+    struct bmi3_sens_axes_data acc;
+
+    /*! Gyroscope data, sensor time and saturation flags */
+    struct bmi3_sens_axes_data gyr;
+
+    /*! Sensor status, data ready bits */
+    uint16_t status;
+
+    /*! Raw temperature data, 0x8000 if invalid */
+    uint16_t temp_data;
+
+    /*! Sensor time */
+    uint32_t sens_time;
+
+    /*! Interrupt 1 status */
+    uint16_t int1_status;
+};
+
 /*!
  * @brief Structure to define accelerometer configuration
  */
@@ -2855,4 +3560,306 @@ struct bmi3_offset_delta
     int16_t z;
 };
 
+/*!
+ * @brief Structure to define the state of a long-running operation driven by bmi3_async_step
+ */
+struct bmi3_async_op
+{
+    /*! Running operation, BMI3_ASYNC_OP_NONE once finished */
+    uint8_t op;
+
+    /*! Step of the running operation */
+    uint8_t step;
+
+    /*! Status polls left before the current step times out */
+    uint8_t tries;
+
+    /*! Samples taken in the current step */
+    uint8_t count;
+
+    /*! Time to wait before the next call of bmi3_async_step, in microseconds */
+    uint32_t wait_us;
+
+    /*! Self-test selection */
+    uint8_t selection;
+
+    /*! Accel power mode to restore after the axis remap */
+    uint8_t acc_mode;
+
+    /*! Accel configuration to restore at the end of the operation */
+    struct bmi3_sens_config acc_cfg;
+
+    /*! Sums of the accel FOC samples */
+    struct bmi3_foc_temp_value sum;
+
+    /*! Accel FOC axis and sign */
+    struct bmi3_accel_foc_g_value g_value;
+
+    /*! Self-test result, written when the self-test completes */
+    struct bmi3_st_result *st_result;
+
+    /*! Self-calibration result, written when the self-calibration completes */
+    struct bmi3_self_calib_rslt *sc_rslt;
+};
+
+/*!
+ * @brief Structure to define the options and statistics of a config array upload
+ */
+struct bmi3_config_upload
+{
+    /*! Read back and compare the uploaded arrays, BMI3_ENABLE or BMI3_DISABLE */
+    uint8_t verify;
+
+    /*! Bytes written to the feature engine */
+    uint16_t bytes;
+
+    /*! Bus transactions spent on the data port, writes and read-backs */
+    uint16_t bursts;
+
+    /*! Upload time measured on the sensor time, in microseconds */
+    uint32_t time_us;
+
+    /*! Upload throughput, in bytes per second */
+    uint32_t bytes_per_sec;
+};
+
+/*!
+ * @brief Function pointer called by the device group for every FIFO read of a member
+ *
+ * @param[in] index        : Index of the member in the group
+ * @param[in] view         : FIFO data read; valid until the member's ring wraps around
+ * @param[in,out] cb_ctx   : User context given in bmi3_dev_group
+ */
+typedef void (*bmi3_group_fifo_fptr_t)(uint8_t index, const struct bmi3_fifo_view *view, void *cb_ctx);
+
+/*!
+ * @brief Structure to define one device of a device group
+ */
+struct bmi3_group_member
+{
+    /*! Device */
+    struct bmi3_dev *dev;
+
+    /*! Buffers the FIFO is read into; buf_size bounds the bytes read per turn */
+    struct bmi3_fifo_buf_ring *ring;
+
+    /*! Long-running operation being driven, NULL if none */
+    struct bmi3_async_op *op;
+
+    /*! Time at which op is due for its next step, in microseconds */
+    uint64_t op_due_us;
+
+    /*! Result of the last finished operation */
+    int8_t op_rslt;
+
+    /*! Result of the last FIFO read */
+    int8_t fifo_rslt;
+
+    /*! BMI3_TRUE once last_drain_us is valid */
+    uint8_t drained;
+
+    /*! Time of the last FIFO read returning data, in microseconds */
+    uint64_t last_drain_us;
+
+    /*! FIFO bytes read from this device */
+    uint64_t bytes;
+
+    /*! Longest time between two FIFO reads returning data, in microseconds */
+    uint32_t max_latency_us;
+};
+
+/*!
+ * @brief Structure to define several devices sharing one bus, serviced in round-robin order
+ */
+struct bmi3_dev_group
+{
+    /*! Devices of the group */
+    struct bmi3_group_member member[BMI3_GROUP_MAX_DEVS];
+
+    /*! Number of devices in the group */
+    uint8_t num_devs;
+
+    /*! Member serviced first by the next pass */
+    uint8_t next;
+
+    /*! Called for every FIFO read, may be NULL */
+    bmi3_group_fifo_fptr_t fifo_cb;
+
+    /*! User context passed to fifo_cb */
+    void *cb_ctx;
+
+    /*! BMI3_TRUE once start_us is valid */
+    uint8_t started;
+
+    /*! Time of the first and of the last pass, in microseconds */
+    uint64_t start_us;
+    uint64_t last_us;
+
+    /*! Number of passes */
+    uint32_t passes;
+
+    /*! Number of FIFO reads returning data */
+    uint32_t drains;
+
+    /*! Number of steps of long-running operations */
+    uint32_t op_steps;
+
+    /*! Number of failed FIFO reads and operation steps */
+    uint32_t errors;
+
+    /*! Sum of the times between two FIFO reads of a member, in microseconds */
+    uint64_t latency_sum_us;
+
+    /*! Number of times summed in latency_sum_us */
+    uint32_t latency_count;
+};
+
+/*!
+ * @brief Structure to define the aggregate statistics of a device group
+ */
+struct bmi3_group_stats
+{
+    /*! Time between the first and the last pass, in microseconds */
+    uint64_t elapsed_us;
+
+    /*! FIFO bytes read from all devices */
+    uint64_t bytes;
+
+    /*! FIFO throughput of all devices, in bytes per second */
+    uint32_t bytes_per_sec;
+
+    /*! Number of passes */
+    uint32_t passes;
+
+    /*! Number of FIFO reads returning data */
+    uint32_t drains;
+
+    /*! Number of steps of long-running operations */
+    uint32_t op_steps;
+
+    /*! Number of failed FIFO reads and operation steps */
+    uint32_t errors;
+
+    /*! Average and longest time between two FIFO reads of a device, in microseconds */
+    uint32_t avg_latency_us;
+    uint32_t max_latency_us;
+};
+
+/*!
+ * @brief Function pointer waiting for the interrupt line of the acquisition engine
+ *
+ * @param[in] timeout_us   : Longest time to wait, in microseconds
+ * @param[in,out] wait_ctx : User context given in bmi3_acq
+ *
+ * @retval BMI3_OK -> Interrupt
+ * @retval Other -> Timeout
+ */
+typedef int8_t (*bmi3_acq_wait_fptr_t)(uint32_t timeout_us, void *wait_ctx);
+
+/*!
+ * @brief Structure to define the interrupt-driven FIFO acquisition engine. The fields up to
+ * max_wakeups are set by the caller before bmi3_acq_start; the others are kept by the engine.
+ */
+struct bmi3_acq
+{
+    /*! Waits for the interrupt line the FIFO water-mark and full interrupts are mapped to */
+    bmi3_acq_wait_fptr_t wait;
+
+    /*! User context passed to wait */
+    void *wait_ctx;
+
+    /*! Interrupt line the FIFO interrupts are mapped to */
+    enum bmi3_hw_int_pin int_pin;
+
+    /*! Longest wait for the interrupt, after which the FIFO is read anyway, in microseconds */
+    uint32_t timeout_us;
+
+    /*! Buffers the FIFO is read into */
+    struct bmi3_fifo_buf_ring *ring;
+
+    /*! BMI3_ACQ_TUNE_LATENCY or BMI3_ACQ_TUNE_WAKEUPS */
+    uint8_t tune;
+
+    /*! Longest time a frame may wait in the FIFO, in microseconds, for BMI3_ACQ_TUNE_LATENCY */
+    uint32_t target_latency_us;
+
+    /*! Most wakeups per second, for BMI3_ACQ_TUNE_WAKEUPS */
+    uint16_t max_wakeups;
+
+    /*! Length of a FIFO frame in bytes */
+    uint16_t frame_len;
+
+    /*! Time between two FIFO frames in sensor time ticks */
+    uint32_t frame_period;
+
+    /*! Most frames the FIFO and one ring buffer hold */
+    uint16_t max_frames;
+
+    /*! Water-mark in frames and in words */
+    uint16_t wm_frames;
+    uint16_t wm;
+
+    /*! Average number of frames found beyond the water-mark, times 8 */
+    uint16_t excess_x8;
+
+    /*! Number of wakeups, of wait timeouts and of FIFO full interrupts */
+    uint32_t wakeups;
+    uint32_t timeouts;
+    uint32_t overflows;
+
+    /*! Number of water-mark changes */
+    uint32_t retunes;
+
+    /*! Number of frames read */
+    uint64_t frames;
+};
+
+/*!
+ * @brief Structure to define the statistics of the acquisition engine
+ */
+struct bmi3_acq_stats
+{
+    /*! Water-mark in use, in words */
+    uint16_t wm;
+
+    /*! Number of wakeups, of wait timeouts and of FIFO full interrupts */
+    uint32_t wakeups;
+    uint32_t timeouts;
+    uint32_t overflows;
+
+    /*! Number of water-mark changes */
+    uint32_t retunes;
+
+    /*! Number of frames read */
+    uint64_t frames;
+
+    /*! Wakeups per second of FIFO data */
+    uint32_t wakeups_per_sec;
+
+    /*! Average time the oldest frame of a read waited in the FIFO, in microseconds */
+    uint32_t avg_latency_us;
+};
+
+/*!
+ * @brief Structure to define a single-producer/single-consumer ring of decoded FIFO frames.
+ * One thread pushes and one thread pops without locking; each index is written by one side only.
+ */
+struct bmi3_sample_ring
+{
+    /*! Array of size frames */
+    struct bmi3_fifo_frame_sample *buf;
+
+    /*! Number of frames in buf, a power of 2 not above 32768 */
+    uint16_t size;
+
+    /*! Free-running count of frames pushed, written by the producer only */
+    volatile uint16_t head;
+
+    /*! Free-running count of frames popped, written by the consumer only */
+    volatile uint16_t tail;
+
+    /*! Frames dropped because the ring was full, written by the producer only */
+    volatile uint32_t dropped;
+};
+
 #endif /* _BMI3_DEFS_H */
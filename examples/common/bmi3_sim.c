@@ -0,0 +1,993 @@
+/**
+ * Copyright (C) 2023 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bmi3.h"
+#include "bmi3_sim.h"
+
+/******************************************************************************/
+/*!                Macro definition                                           */
+
+/*! BMI323 chip id */
+#define SIM_CHIP_ID                 UINT16_C(0x0043)
+
+/*! Reset values of the configuration registers */
+#define SIM_ACC_CONF_DEFAULT        UINT16_C(0x0028)
+#define SIM_GYR_CONF_DEFAULT        UINT16_C(0x0048)
+
+/*! Power-on-reset flag in the status register */
+#define SIM_STATUS_POR              UINT16_C(0x0001)
+
+/*! Register value returned for a disabled sensor and for an empty FIFO word */
+#define SIM_INVALID_DATA            UINT16_C(0x8000)
+
+/*! Sampling period at ODR 6.4 kHz (code 0x0E) in nanoseconds, every lower code doubles it */
+#define SIM_ODR_6400HZ_PERIOD_NS    UINT64_C(156250)
+#define SIM_ODR_MAX_CODE            UINT8_C(0x0E)
+
+/*! Lowest power mode in which a sensor produces samples */
+#define SIM_MODE_ACTIVE_MIN         UINT8_C(0x03)
+
+/*! Sensor time runs at 25.6 kHz: ticks = ns * 256 / 10^7 */
+#define SIM_SENSOR_TIME_MUL         UINT64_C(256)
+#define SIM_SENSOR_TIME_DIV         UINT64_C(10000000)
+
+/*! Feature engine status bits touched by command completion */
+#define SIM_FEATURE_IO1_CMD_MASK    (BMI3_ERROR_STATUS_MASK | BMI3_SC_ST_COMPLETE_MASK | BMI3_GYRO_SC_RESULT_MASK | \
+                                     BMI3_ST_RESULT_MASK | BMI3_AXIS_MAP_COMPLETE_MASK)
+
+/*! Self-test result word with every axis reported ok */
+#define SIM_ST_RESULT_ALL_OK        UINT16_C(0x007F)
+
+/******************************************************************************/
+/*!                Static function definition                                 */
+
+/*!
+ * @brief This internal API reads from the simulated register map.
+ *
+ * @param[in]     reg_addr : 8bit register address of the sensor
+ * @param[out]    reg_data : Data from the specified address
+ * @param[in]     len      : Length of the reg_data array
+ * @param[in,out] intf_ptr : Simulator instance
+ *
+ * @return Status of execution.
+ */
+static BMI3_INTF_RET_TYPE sim_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ * @brief This internal API writes to the simulated register map.
+ *
+ * @param[in]     reg_addr : 8bit register address of the sensor
+ * @param[in]     reg_data : Data to be written
+ * @param[in]     len      : Length of the reg_data array
+ * @param[in,out] intf_ptr : Simulator instance
+ *
+ * @return Status of execution.
+ */
+static BMI3_INTF_RET_TYPE sim_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ * @brief This internal API advances simulated time by the requested delay.
+ *
+ * @param[in] period       : The time period in microseconds
+ * @param[in,out] intf_ptr : Simulator instance
+ *
+ * @return void.
+ */
+static void sim_delay_us(uint32_t period, void *intf_ptr);
+
+/*!
+ * @brief This internal API puts the register file in its reset state.
+ *
+ * @param[in,out] sim : Simulator instance
+ *
+ * @return void.
+ */
+static void sim_reset(struct bmi3_sim *sim);
+
+/*!
+ * @brief This internal API generates every sensor and feature engine event up to time_ns.
+ *
+ * @param[in,out] sim     : Simulator instance
+ * @param[in]     time_ns : Simulated time to catch up to
+ *
+ * @return void.
+ */
+static void sim_run_events(struct bmi3_sim *sim, uint64_t time_ns);
+
+/*!
+ * @brief This internal API generates the sensor samples up to time_ns.
+ *
+ * @param[in,out] sim     : Simulator instance
+ * @param[in]     time_ns : Simulated time to catch up to
+ *
+ * @return void.
+ */
+static void sim_run_samples(struct bmi3_sim *sim, uint64_t time_ns);
+
+/*!
+ * @brief This internal API runs feature engine start-up and command completion up to time_ns.
+ *
+ * @param[in,out] sim     : Simulator instance
+ * @param[in]     time_ns : Simulated time to catch up to
+ *
+ * @return void.
+ */
+static void sim_run_feature_engine(struct bmi3_sim *sim, uint64_t time_ns);
+
+/*!
+ * @brief This internal API returns the cost of one bus transaction in nanoseconds.
+ *
+ * @param[in] sim     : Simulator instance
+ * @param[in] len     : Payload length in bytes
+ * @param[in] is_read : 1 for a read transaction
+ *
+ * @return Transaction time.
+ */
+static uint64_t sim_bus_cost_ns(const struct bmi3_sim *sim, uint32_t len, uint8_t is_read);
+
+/*!
+ * @brief This internal API returns the sampling period of a sensor, or 0 if it is disabled.
+ *
+ * @param[in] conf : Content of ACC_CONF or GYR_CONF
+ *
+ * @return Period in nanoseconds.
+ */
+static uint64_t sim_sensor_period_ns(uint16_t conf);
+
+/*!
+ * @brief This internal API returns the sensor time at a given simulated time.
+ *
+ * @param[in] time_ns : Simulated time
+ *
+ * @return Sensor time in 39.0625us ticks.
+ */
+static uint32_t sim_sensor_time(uint64_t time_ns);
+
+/*!
+ * @brief This internal API latches an interrupt status bit on the pin it is mapped to.
+ *
+ * @param[in,out] sim  : Simulator instance
+ * @param[in]     map  : Field of INT_MAP2 holding the pin mapping
+ * @param[in]     bit  : Status bit to latch
+ *
+ * @return void.
+ */
+static void sim_raise_int(struct bmi3_sim *sim, uint16_t map, uint16_t bit);
+
+/*!
+ * @brief This internal API pushes one headerless frame into the FIFO.
+ *
+ * @param[in,out] sim       : Simulator instance
+ * @param[in]     frame_ns  : Simulated time of the frame
+ * @param[in]     acc_valid : Accel has a new sample
+ * @param[in]     gyr_valid : Gyro has a new sample
+ *
+ * @return void.
+ */
+static void sim_fifo_push(struct bmi3_sim *sim, uint64_t frame_ns, uint8_t acc_valid, uint8_t gyr_valid);
+
+/*!
+ * @brief This internal API reads one register word and applies its read side effects.
+ *
+ * @param[in,out] sim  : Simulator instance
+ * @param[in]     addr : Register address
+ *
+ * @return Register value.
+ */
+static uint16_t sim_read_word(struct bmi3_sim *sim, uint8_t addr);
+
+/*!
+ * @brief This internal API writes one register word and applies its write side effects.
+ *
+ * @param[in,out] sim  : Simulator instance
+ * @param[in]     addr : Register address
+ * @param[in]     val  : Value to be written
+ *
+ * @return void.
+ */
+static void sim_write_word(struct bmi3_sim *sim, uint8_t addr, uint16_t val);
+
+/*!
+ * @brief This internal API executes a command written to the CMD register.
+ *
+ * @param[in,out] sim : Simulator instance
+ * @param[in]     cmd : Command
+ *
+ * @return void.
+ */
+static void sim_command(struct bmi3_sim *sim, uint16_t cmd);
+
+/******************************************************************************/
+/*!               User interface functions                                    */
+
+/*!
+ * @brief This function powers up the simulated sensor and maps the device callbacks onto it.
+ */
+int8_t bmi3_sim_interface_init(struct bmi3_dev *dev, struct bmi3_sim *sim, int8_t intf)
+{
+    int8_t rslt = BMI3_OK;
+
+    if ((dev != NULL) && (sim != NULL))
+    {
+        (void)memset(sim, 0, sizeof(*sim));
+
+        if (intf == BMI3_I2C_INTF)
+        {
+            sim->intf = BMI3_I2C_INTF;
+            sim->bus_clock_hz = BMI3_SIM_I2C_CLOCK_HZ;
+        }
+        else if (intf == BMI3_I3C_INTF)
+        {
+            sim->intf = BMI3_I3C_INTF;
+            sim->bus_clock_hz = BMI3_SIM_I3C_CLOCK_HZ;
+        }
+        else
+        {
+            sim->intf = BMI3_SPI_INTF;
+            sim->bus_clock_hz = BMI3_SIM_SPI_CLOCK_HZ;
+        }
+
+        sim->txn_overhead_ns = BMI3_SIM_TXN_OVERHEAD_NS;
+        sim->reset_time_us = BMI3_SIM_RESET_TIME_US;
+        sim->feature_boot_us = BMI3_SIM_FEATURE_BOOT_US;
+        sim->self_test_us = BMI3_SIM_SELF_TEST_US;
+        sim->self_calib_us = BMI3_SIM_SELF_CALIB_US;
+        sim->axis_map_us = BMI3_SIM_AXIS_MAP_US;
+
+        /* Power-on behaves like a soft reset; the host attaches once start-up is over */
+        sim_reset(sim);
+        sim->ready_ns = sim->now_ns;
+
+        dev->intf = sim->intf;
+        dev->read = sim_read;
+        dev->write = sim_write;
+        dev->delay_us = sim_delay_us;
+        dev->intf_ptr = sim;
+        dev->read_write_len = BMI3_SIM_READ_WRITE_LEN;
+        dev->batch = NULL;
+        dev->shadow = NULL;
+        dev->lock = NULL;
+        dev->unlock = NULL;
+        dev->lock_ctx = NULL;
+        dev->fifo_conf_valid = BMI3_FALSE;
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This function advances simulated time without bus traffic.
+ */
+void bmi3_sim_advance_us(struct bmi3_sim *sim, uint32_t period)
+{
+    sim->now_ns += (uint64_t)period * 1000;
+    sim_run_events(sim, sim->now_ns);
+}
+
+/*!
+ * @brief This function publishes a new I3C sync epoch in the feature engine memory.
+ */
+void bmi3_sim_i3c_sync_update(struct bmi3_sim *sim)
+{
+    uint8_t axis;
+
+    if (sim->sample_cb != NULL)
+    {
+        sim->sample_cb(sim, sim->now_ns);
+    }
+
+    for (axis = 0; axis < 3; axis++)
+    {
+        sim->feature_mem[BMI3_BASE_ADDR_I3C_SYNC_ACC + axis] = (uint16_t)sim->acc[axis];
+        sim->feature_mem[BMI3_BASE_ADDR_I3C_SYNC_GYR + axis] = (uint16_t)sim->gyr[axis];
+    }
+
+    sim->feature_mem[BMI3_BASE_ADDR_I3C_SYNC_TEMP] = (uint16_t)sim->temp;
+    sim->feature_mem[BMI3_BASE_ADDR_I3C_SYNC_TIME]++;
+}
+
+/*!
+ * @brief This function returns the level of an interrupt line.
+ */
+uint8_t bmi3_sim_int_pin_level(struct bmi3_sim *sim, uint8_t int_pin)
+{
+    uint16_t status = 0;
+
+    sim_run_events(sim, sim->now_ns);
+
+    if (int_pin == BMI3_INT1)
+    {
+        status = sim->regs[BMI3_REG_INT_STATUS_INT1];
+    }
+    else if (int_pin == BMI3_INT2)
+    {
+        status = sim->regs[BMI3_REG_INT_STATUS_INT2];
+    }
+    else if (int_pin == BMI3_I3C_INT)
+    {
+        status = sim->regs[BMI3_REG_INT_STATUS_IBI];
+    }
+
+    return (status != 0) ? 1 : 0;
+}
+
+/*!
+ * @brief This function returns the simulated time in microseconds.
+ */
+uint64_t bmi3_sim_get_time_us(const struct bmi3_sim *sim)
+{
+    return sim->now_ns / 1000;
+}
+
+/*!
+ * @brief This function clears the collected statistics.
+ */
+void bmi3_sim_reset_stats(struct bmi3_sim *sim)
+{
+    (void)memset(&sim->stats, 0, sizeof(sim->stats));
+}
+
+/*!
+ * @brief This function prints the collected statistics.
+ */
+void bmi3_sim_print_stats(const char label[], const struct bmi3_sim *sim)
+{
+    const struct bmi3_sim_stats *stats = &sim->stats;
+
+    printf("%s: %lu reads (%llu bytes), %lu writes (%llu bytes), bus %llu us, %lu delays (%llu us), "
+           "total %llu us\n",
+           label,
+           (unsigned long)stats->read_count,
+           (unsigned long long)stats->read_bytes,
+           (unsigned long)stats->write_count,
+           (unsigned long long)stats->write_bytes,
+           (unsigned long long)(stats->bus_time_ns / 1000),
+           (unsigned long)stats->delay_count,
+           (unsigned long long)(stats->delay_time_ns / 1000),
+           (unsigned long long)((stats->bus_time_ns + stats->delay_time_ns) / 1000));
+}
+
+/******************************************************************************/
+/*!               Static functions                                            */
+
+/*!
+ * @brief This internal API reads from the simulated register map.
+ */
+static BMI3_INTF_RET_TYPE sim_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct bmi3_sim *sim = (struct bmi3_sim *)intf_ptr;
+    BMI3_INTF_RET_TYPE rslt = BMI3_INTF_RET_SUCCESS;
+    uint8_t dummy_byte = (sim->intf == BMI3_SPI_INTF) ? 1 : 2;
+    uint8_t addr = reg_addr & BMI3_SPI_WR_MASK;
+    uint16_t word;
+    uint32_t idx;
+    uint64_t cost;
+
+    sim_run_events(sim, sim->now_ns);
+
+    (void)memset(reg_data, 0, len);
+
+    if (sim->now_ns < sim->ready_ns)
+    {
+        /* In reset: SPI clocks out garbage, I2C/I3C do not acknowledge */
+        sim->stats.ignored_count++;
+
+        if (sim->intf != BMI3_SPI_INTF)
+        {
+            rslt = -1;
+        }
+    }
+    else if ((sim->intf == BMI3_SPI_INTF) && (!sim->spi_en))
+    {
+        /* The first SPI access after reset only switches the interface to SPI */
+        sim->spi_en = 1;
+    }
+    else if (addr == BMI3_REG_FIFO_DATA)
+    {
+        /* The FIFO streams bytes; reads beyond the fill level return invalid words */
+        for (idx = dummy_byte; idx < len; idx++)
+        {
+            if (sim->fifo_len > 0)
+            {
+                reg_data[idx] = sim->fifo[sim->fifo_head];
+                sim->fifo_head = (uint16_t)((sim->fifo_head + 1) % BMI3_SIM_FIFO_SIZE);
+                sim->fifo_len--;
+            }
+            else
+            {
+                reg_data[idx] = ((idx - dummy_byte) & 1) ? BMI3_GET_MSB(SIM_INVALID_DATA) : BMI3_GET_LSB(
+                    SIM_INVALID_DATA);
+            }
+        }
+    }
+    else
+    {
+        for (idx = dummy_byte; idx < len; idx += 2)
+        {
+            word = sim_read_word(sim, addr);
+
+            reg_data[idx] = BMI3_GET_LSB(word);
+
+            if ((idx + 1) < len)
+            {
+                reg_data[idx + 1] = BMI3_GET_MSB(word);
+            }
+
+            /* The feature engine data port does not auto-increment the register address */
+            if (addr != BMI3_REG_FEATURE_DATA_TX)
+            {
+                addr = (addr + 1) & BMI3_SPI_WR_MASK;
+            }
+        }
+    }
+
+    cost = sim_bus_cost_ns(sim, len, 1);
+    sim->stats.read_count++;
+    sim->stats.read_bytes += len;
+    sim->stats.bus_time_ns += cost;
+    sim->now_ns += cost;
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API writes to the simulated register map.
+ */
+static BMI3_INTF_RET_TYPE sim_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct bmi3_sim *sim = (struct bmi3_sim *)intf_ptr;
+    BMI3_INTF_RET_TYPE rslt = BMI3_INTF_RET_SUCCESS;
+    uint8_t addr = reg_addr & BMI3_SPI_WR_MASK;
+    uint16_t word;
+    uint32_t idx;
+    uint64_t cost;
+
+    sim_run_events(sim, sim->now_ns);
+
+    if (sim->now_ns < sim->ready_ns)
+    {
+        sim->stats.ignored_count++;
+
+        if (sim->intf != BMI3_SPI_INTF)
+        {
+            rslt = -1;
+        }
+    }
+    else if ((sim->intf == BMI3_SPI_INTF) && (!sim->spi_en))
+    {
+        sim->spi_en = 1;
+    }
+    else
+    {
+        for (idx = 0; idx < len; idx += 2)
+        {
+            if ((idx + 1) < len)
+            {
+                word = (uint16_t)(reg_data[idx] | ((uint16_t)reg_data[idx + 1] << 8));
+            }
+            else
+            {
+                /* A lone trailing byte only replaces the LSB */
+                word = (uint16_t)((sim->regs[addr] & BMI3_SET_HIGH_BYTE) | reg_data[idx]);
+            }
+
+            sim_write_word(sim, addr, word);
+
+            if (addr != BMI3_REG_FEATURE_DATA_TX)
+            {
+                addr = (addr + 1) & BMI3_SPI_WR_MASK;
+            }
+        }
+    }
+
+    cost = sim_bus_cost_ns(sim, len, 0);
+    sim->stats.write_count++;
+    sim->stats.write_bytes += len;
+    sim->stats.bus_time_ns += cost;
+    sim->now_ns += cost;
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API advances simulated time by the requested delay.
+ */
+static void sim_delay_us(uint32_t period, void *intf_ptr)
+{
+    struct bmi3_sim *sim = (struct bmi3_sim *)intf_ptr;
+
+    sim->stats.delay_count++;
+    sim->stats.delay_time_ns += (uint64_t)period * 1000;
+    bmi3_sim_advance_us(sim, period);
+}
+
+/*!
+ * @brief This internal API puts the register file in its reset state.
+ */
+static void sim_reset(struct bmi3_sim *sim)
+{
+    (void)memset(sim->regs, 0, sizeof(sim->regs));
+    (void)memset(sim->feature_mem, 0, sizeof(sim->feature_mem));
+
+    sim->regs[BMI3_REG_CHIP_ID] = SIM_CHIP_ID;
+    sim->regs[BMI3_REG_STATUS] = SIM_STATUS_POR;
+    sim->regs[BMI3_REG_ACC_CONF] = SIM_ACC_CONF_DEFAULT;
+    sim->regs[BMI3_REG_GYR_CONF] = SIM_GYR_CONF_DEFAULT;
+
+    sim->feature_addr = 0;
+    sim->feature_ready_ns = 0;
+    sim->feature_cmd = 0;
+    sim->last_cmd = 0;
+    sim->spi_en = 0;
+    sim->fifo_head = 0;
+    sim->fifo_len = 0;
+    sim->event_ns = sim->now_ns;
+    sim->ready_ns = sim->now_ns + (uint64_t)sim->reset_time_us * 1000;
+}
+
+/*!
+ * @brief This internal API generates every sensor and feature engine event up to time_ns.
+ */
+static void sim_run_events(struct bmi3_sim *sim, uint64_t time_ns)
+{
+    if (time_ns > sim->event_ns)
+    {
+        sim_run_samples(sim, time_ns);
+        sim_run_feature_engine(sim, time_ns);
+        sim->event_ns = time_ns;
+    }
+}
+
+/*!
+ * @brief This internal API generates the sensor samples up to time_ns.
+ */
+static void sim_run_samples(struct bmi3_sim *sim, uint64_t time_ns)
+{
+    uint64_t acc_period = sim_sensor_period_ns(sim->regs[BMI3_REG_ACC_CONF]);
+    uint64_t gyr_period = sim_sensor_period_ns(sim->regs[BMI3_REG_GYR_CONF]);
+    uint64_t tick_period;
+    uint64_t tick_ns;
+    uint16_t fifo_conf = sim->regs[BMI3_REG_FIFO_CONF];
+    uint8_t acc_valid, gyr_valid;
+
+    /* Sensor samples are generated on an absolute grid of the fastest active ODR */
+    if ((acc_period != 0) && ((gyr_period == 0) || (acc_period < gyr_period)))
+    {
+        tick_period = acc_period;
+    }
+    else
+    {
+        tick_period = gyr_period;
+    }
+
+    if (tick_period != 0)
+    {
+        for (tick_ns = (sim->event_ns / tick_period + 1) * tick_period; tick_ns <= time_ns; tick_ns += tick_period)
+        {
+            acc_valid = (acc_period != 0) && ((tick_ns % acc_period) == 0);
+            gyr_valid = (gyr_period != 0) && ((tick_ns % gyr_period) == 0);
+
+            if (sim->sample_cb != NULL)
+            {
+                sim->sample_cb(sim, tick_ns);
+            }
+
+            if (acc_valid)
+            {
+                sim->regs[BMI3_REG_STATUS] |= BMI3_STATUS_DRDY_ACC;
+                sim_raise_int(sim, BMI3_ACC_DRDY_INT_MASK, BMI3_INT_STATUS_ACC_DRDY);
+            }
+
+            if (gyr_valid)
+            {
+                sim->regs[BMI3_REG_STATUS] |= BMI3_STATUS_DRDY_GYR;
+                sim_raise_int(sim, BMI3_GYR_DRDY_INT_MASK, BMI3_INT_STATUS_GYR_DRDY);
+            }
+
+            sim->regs[BMI3_REG_STATUS] |= BMI3_STATUS_DRDY_TEMP;
+            sim_raise_int(sim, BMI3_TEMP_DRDY_INT_MASK, BMI3_INT_STATUS_TEMP_DRDY);
+
+            if (((fifo_conf & BMI3_FIFO_ACC_EN) && acc_valid) || ((fifo_conf & BMI3_FIFO_GYR_EN) && gyr_valid))
+            {
+                sim_fifo_push(sim, tick_ns, acc_valid, gyr_valid);
+            }
+        }
+    }
+}
+
+/*!
+ * @brief This internal API runs feature engine start-up and command completion up to time_ns.
+ */
+static void sim_run_feature_engine(struct bmi3_sim *sim, uint64_t time_ns)
+{
+    uint16_t *io1 = &sim->regs[BMI3_REG_FEATURE_IO1];
+
+    /* Feature engine start-up */
+    if ((sim->feature_ready_ns != 0) && (sim->feature_ready_ns <= time_ns) &&
+        ((*io1 & BMI3_ERROR_STATUS_MASK) == BMI3_FEAT_ENG_INACT_MASK))
+    {
+        *io1 = (uint16_t)((*io1 & ~BMI3_ERROR_STATUS_MASK) | BMI3_FEAT_ENG_ACT_MASK);
+    }
+
+    /* Feature engine command completion */
+    if ((sim->feature_cmd != 0) && (sim->feature_cmd_ns <= time_ns))
+    {
+        *io1 = (uint16_t)((*io1 & ~SIM_FEATURE_IO1_CMD_MASK) | BMI3_NO_ERROR_MASK);
+
+        if (sim->feature_cmd == BMI3_CMD_SELF_TEST_TRIGGER)
+        {
+            *io1 |= (BMI3_SC_ST_COMPLETE_MASK | BMI3_ST_RESULT_MASK);
+            sim->feature_mem[BMI3_BASE_ADDR_ST_RESULT] = SIM_ST_RESULT_ALL_OK;
+        }
+        else if (sim->feature_cmd == BMI3_CMD_SELF_CALIB_TRIGGER)
+        {
+            *io1 |= (BMI3_SC_ST_COMPLETE_MASK | BMI3_GYRO_SC_RESULT_MASK);
+        }
+        else
+        {
+            *io1 |= BMI3_AXIS_MAP_COMPLETE_MASK;
+        }
+
+        sim->feature_cmd = 0;
+    }
+}
+
+/*!
+ * @brief This internal API returns the cost of one bus transaction in nanoseconds.
+ */
+static uint64_t sim_bus_cost_ns(const struct bmi3_sim *sim, uint32_t len, uint8_t is_read)
+{
+    uint64_t clocks;
+
+    if (sim->intf == BMI3_SPI_INTF)
+    {
+        /* Address byte followed by the payload, 8 clocks per byte */
+        clocks = 8 * ((uint64_t)len + 1);
+    }
+    else if (is_read)
+    {
+        /* START, address+W, register, repeated START, address+R, payload, STOP; 9 clocks per byte */
+        clocks = 9 * ((uint64_t)len + 3) + 3;
+    }
+    else
+    {
+        /* START, address+W, register, payload, STOP; 9 clocks per byte */
+        clocks = 9 * ((uint64_t)len + 2) + 2;
+    }
+
+    return (clocks * UINT64_C(1000000000)) / sim->bus_clock_hz + sim->txn_overhead_ns;
+}
+
+/*!
+ * @brief This internal API returns the sampling period of a sensor, or 0 if it is disabled.
+ */
+static uint64_t sim_sensor_period_ns(uint16_t conf)
+{
+    uint8_t odr = (uint8_t)(conf & BMI3_ACC_ODR_MASK);
+    uint8_t mode = (uint8_t)((conf & BMI3_ACC_MODE_MASK) >> BMI3_ACC_MODE_POS);
+    uint64_t period = 0;
+
+    if ((mode >= SIM_MODE_ACTIVE_MIN) && (odr >= BMI3_ACC_ODR_0_78HZ) && (odr <= SIM_ODR_MAX_CODE))
+    {
+        period = SIM_ODR_6400HZ_PERIOD_NS << (SIM_ODR_MAX_CODE - odr);
+    }
+
+    return period;
+}
+
+/*!
+ * @brief This internal API returns the sensor time at a given simulated time.
+ */
+static uint32_t sim_sensor_time(uint64_t time_ns)
+{
+    return (uint32_t)((time_ns * SIM_SENSOR_TIME_MUL) / SIM_SENSOR_TIME_DIV);
+}
+
+/*!
+ * @brief This internal API latches an interrupt status bit on the pin it is mapped to.
+ */
+static void sim_raise_int(struct bmi3_sim *sim, uint16_t map, uint16_t bit)
+{
+    uint16_t map2 = sim->regs[BMI3_REG_INT_MAP2] & map;
+
+    /* Every INT_MAP2 field is two bits wide: move it down to bit 0 */
+    while ((map & 1) == 0)
+    {
+        map >>= 1;
+        map2 >>= 1;
+    }
+
+    if (map2 == BMI3_INT1)
+    {
+        sim->regs[BMI3_REG_INT_STATUS_INT1] |= bit;
+    }
+    else if (map2 == BMI3_INT2)
+    {
+        sim->regs[BMI3_REG_INT_STATUS_INT2] |= bit;
+    }
+    else if (map2 == BMI3_I3C_INT)
+    {
+        sim->regs[BMI3_REG_INT_STATUS_IBI] |= bit;
+    }
+}
+
+/*!
+ * @brief This internal API pushes one headerless frame into the FIFO.
+ */
+static void sim_fifo_push(struct bmi3_sim *sim, uint64_t frame_ns, uint8_t acc_valid, uint8_t gyr_valid)
+{
+    uint16_t fifo_conf = sim->regs[BMI3_REG_FIFO_CONF];
+    uint16_t words[8];
+    uint8_t count = 0;
+    uint8_t idx;
+    uint16_t tail;
+    uint16_t frame_len;
+    uint16_t watermark = sim->regs[BMI3_REG_FIFO_WATERMARK] & BMI3_FIFO_WATERMARK_MASK;
+
+    if (fifo_conf & BMI3_FIFO_ACC_EN)
+    {
+        for (idx = 0; idx < 3; idx++)
+        {
+            words[count++] = acc_valid ? (uint16_t)sim->acc[idx] : BMI3_FIFO_ACCEL_DUMMY_FRAME;
+        }
+    }
+
+    if (fifo_conf & BMI3_FIFO_GYR_EN)
+    {
+        for (idx = 0; idx < 3; idx++)
+        {
+            words[count++] = gyr_valid ? (uint16_t)sim->gyr[idx] : BMI3_FIFO_GYRO_DUMMY_FRAME;
+        }
+    }
+
+    if (fifo_conf & BMI3_FIFO_TEMP_EN)
+    {
+        words[count++] = (uint16_t)sim->temp;
+    }
+
+    if (fifo_conf & BMI3_FIFO_TIME_EN)
+    {
+        words[count++] = (uint16_t)sim_sensor_time(frame_ns);
+    }
+
+    frame_len = (uint16_t)(count * 2);
+
+    if ((sim->fifo_len + frame_len) > BMI3_SIM_FIFO_SIZE)
+    {
+        sim->stats.fifo_overflows++;
+        sim_raise_int(sim, BMI3_FIFO_FULL_INT_MASK, BMI3_INT_STATUS_FFULL);
+
+        if (!(fifo_conf & BMI3_FIFO_STOP_ON_FULL))
+        {
+            /* Stream mode: the oldest frame is overwritten */
+            sim->fifo_head = (uint16_t)((sim->fifo_head + frame_len) % BMI3_SIM_FIFO_SIZE);
+            sim->fifo_len = (uint16_t)(sim->fifo_len - frame_len);
+        }
+    }
+
+    /* In stop-on-full mode a frame that does not fit is discarded */
+    if ((sim->fifo_len + frame_len) <= BMI3_SIM_FIFO_SIZE)
+    {
+        tail = (uint16_t)((sim->fifo_head + sim->fifo_len) % BMI3_SIM_FIFO_SIZE);
+
+        for (idx = 0; idx < count; idx++)
+        {
+            sim->fifo[tail] = BMI3_GET_LSB(words[idx]);
+            tail = (uint16_t)((tail + 1) % BMI3_SIM_FIFO_SIZE);
+            sim->fifo[tail] = BMI3_GET_MSB(words[idx]);
+            tail = (uint16_t)((tail + 1) % BMI3_SIM_FIFO_SIZE);
+        }
+
+        sim->fifo_len = (uint16_t)(sim->fifo_len + frame_len);
+        sim->stats.fifo_frames++;
+
+        if ((watermark != 0) && ((sim->fifo_len / 2) >= watermark))
+        {
+            sim_raise_int(sim, BMI3_FIFO_WATERMARK_INT_MASK, BMI3_INT_STATUS_FWM);
+        }
+    }
+}
+
+/*!
+ * @brief This internal API reads one register word and applies its read side effects.
+ */
+static uint16_t sim_read_word(struct bmi3_sim *sim, uint8_t addr)
+{
+    uint16_t val = sim->regs[addr];
+    uint8_t acc_on = sim_sensor_period_ns(sim->regs[BMI3_REG_ACC_CONF]) != 0;
+    uint8_t gyr_on = sim_sensor_period_ns(sim->regs[BMI3_REG_GYR_CONF]) != 0;
+
+    switch (addr)
+    {
+        case BMI3_REG_STATUS:
+
+            /* Data ready and power-on-reset flags are cleared on read */
+            sim->regs[addr] = 0;
+            break;
+
+        case BMI3_REG_ACC_DATA_X:
+        case BMI3_REG_ACC_DATA_Y:
+        case BMI3_REG_ACC_DATA_Z:
+            val = acc_on ? (uint16_t)sim->acc[addr - BMI3_REG_ACC_DATA_X] : SIM_INVALID_DATA;
+            break;
+
+        case BMI3_REG_GYR_DATA_X:
+        case BMI3_REG_GYR_DATA_Y:
+        case BMI3_REG_GYR_DATA_Z:
+            val = gyr_on ? (uint16_t)sim->gyr[addr - BMI3_REG_GYR_DATA_X] : SIM_INVALID_DATA;
+            break;
+
+        case BMI3_REG_TEMP_DATA:
+            val = (acc_on || gyr_on) ? (uint16_t)sim->temp : SIM_INVALID_DATA;
+            break;
+
+        case BMI3_REG_SENSOR_TIME_0:
+            val = (uint16_t)sim_sensor_time(sim->now_ns);
+            break;
+
+        case BMI3_REG_SENSOR_TIME_1:
+            val = (uint16_t)(sim_sensor_time(sim->now_ns) >> 16);
+            break;
+
+        case BMI3_REG_INT_STATUS_INT1:
+        case BMI3_REG_INT_STATUS_INT2:
+        case BMI3_REG_INT_STATUS_IBI:
+
+            /* Interrupt status is cleared on read */
+            sim->regs[addr] = 0;
+            break;
+
+        case BMI3_REG_FIFO_FILL_LEVEL:
+            val = (uint16_t)(sim->fifo_len / 2);
+            break;
+
+        case BMI3_REG_FEATURE_DATA_TX:
+            val = sim->feature_mem[sim->feature_addr];
+            sim->feature_addr = (uint16_t)((sim->feature_addr + 1) % BMI3_SIM_FEATURE_WORDS);
+
+            /* The feature engine may publish an I3C sync epoch between two words of a burst */
+            if ((sim->i3c_sync_countdown != 0) && (--sim->i3c_sync_countdown == 0))
+            {
+                bmi3_sim_i3c_sync_update(sim);
+                sim->i3c_sync_countdown = sim->i3c_sync_reload;
+            }
+
+            break;
+
+        default:
+            break;
+    }
+
+    return val;
+}
+
+/*!
+ * @brief This internal API writes one register word and applies its write side effects.
+ */
+static void sim_write_word(struct bmi3_sim *sim, uint8_t addr, uint16_t val)
+{
+    switch (addr)
+    {
+        case BMI3_REG_CMD:
+            sim_command(sim, val);
+            break;
+
+        case BMI3_REG_FIFO_CTRL:
+            if (val & BMI3_FIFO_FLUSH_MASK)
+            {
+                sim->fifo_head = 0;
+                sim->fifo_len = 0;
+            }
+
+            break;
+
+        case BMI3_REG_FEATURE_CTRL:
+            if ((val & BMI3_FEATURE_ENGINE_ENABLE_MASK) && (sim->feature_ready_ns == 0))
+            {
+                sim->feature_ready_ns = sim->now_ns + (uint64_t)sim->feature_boot_us * 1000;
+            }
+            else if (!(val & BMI3_FEATURE_ENGINE_ENABLE_MASK))
+            {
+                sim->feature_ready_ns = 0;
+                sim->regs[BMI3_REG_FEATURE_IO1] &= (uint16_t)~BMI3_ERROR_STATUS_MASK;
+            }
+
+            sim->regs[addr] = val;
+            break;
+
+        case BMI3_REG_FEATURE_DATA_ADDR:
+            sim->feature_addr = (uint16_t)(val % BMI3_SIM_FEATURE_WORDS);
+            sim->regs[addr] = val;
+            break;
+
+        case BMI3_REG_FEATURE_DATA_TX:
+            sim->feature_mem[sim->feature_addr] = val;
+            sim->feature_addr = (uint16_t)((sim->feature_addr + 1) % BMI3_SIM_FEATURE_WORDS);
+            break;
+
+        case BMI3_REG_FEATURE_IO0:
+        case BMI3_REG_FEATURE_IO1:
+        case BMI3_REG_FEATURE_IO2:
+        case BMI3_REG_FEATURE_IO3:
+        case BMI3_REG_FEATURE_IO_STATUS:
+            sim->regs[addr] = val;
+            break;
+
+        default:
+
+            /* Everything below the feature IOs is read-only, as are the FIFO data ports */
+            if ((addr > BMI3_REG_FIFO_DATA) && (addr != BMI3_REG_FEATURE_DATA_STATUS) &&
+                (addr != BMI3_REG_FEATURE_ENGINE_STATUS))
+            {
+                sim->regs[addr] = val;
+            }
+
+            break;
+    }
+}
+
+/*!
+ * @brief This internal API executes a command written to the CMD register.
+ */
+static void sim_command(struct bmi3_sim *sim, uint16_t cmd)
+{
+    uint32_t duration = 0;
+
+    switch (cmd)
+    {
+        case BMI3_CMD_SOFT_RESET:
+            sim->stats.soft_resets++;
+            sim_reset(sim);
+            break;
+
+        case BMI3_CMD_1:
+
+            /* CMD_2 followed by CMD_1 unlocks the configuration page */
+            if (sim->last_cmd == BMI3_CMD_2)
+            {
+                sim->regs[BMI3_REG_CFG_RES] |= ((uint16_t)BMI3_CFG_RES_MASK << 8);
+            }
+
+            break;
+
+        case BMI3_CMD_SELF_TEST_TRIGGER:
+            duration = sim->self_test_us;
+            break;
+
+        case BMI3_CMD_SELF_CALIB_TRIGGER:
+            duration = sim->self_calib_us;
+            break;
+
+        case BMI3_CMD_AXIS_MAP_UPDATE:
+            duration = sim->axis_map_us;
+            break;
+
+        default:
+            break;
+    }
+
+    /* Feature engine commands run only once the engine is up */
+    if ((duration != 0) && ((sim->regs[BMI3_REG_FEATURE_IO1] & BMI3_ERROR_STATUS_MASK) != BMI3_FEAT_ENG_INACT_MASK))
+    {
+        sim->regs[BMI3_REG_FEATURE_IO1] =
+            (uint16_t)((sim->regs[BMI3_REG_FEATURE_IO1] & ~SIM_FEATURE_IO1_CMD_MASK) | BMI3_FEAT_ENG_ACT_MASK);
+        sim->feature_cmd = cmd;
+        sim->feature_cmd_ns = sim->now_ns + (uint64_t)duration * 1000;
+    }
+
+    if (cmd != BMI3_CMD_SOFT_RESET)
+    {
+        sim->last_cmd = cmd;
+    }
+}
@@ -0,0 +1,266 @@
+/**
+ * Copyright (C) 2023 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _BMI3_SIM_H
+#define _BMI3_SIM_H
+
+/*! CPP guard */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus */
+
+#include "bmi3.h"
+
+/******************************************************************************/
+/*!                Macro definition                                           */
+
+/*! Number of 16-bit registers in the user page */
+#define BMI3_SIM_NUM_REGS                UINT8_C(128)
+
+/*! Number of 16-bit words addressable through the feature engine DMA window */
+#define BMI3_SIM_FEATURE_WORDS           UINT16_C(4096)
+
+/*! FIFO capacity in bytes (1024 words) */
+#define BMI3_SIM_FIFO_SIZE               UINT16_C(2048)
+
+/*! Default bus clocks in Hz */
+#define BMI3_SIM_SPI_CLOCK_HZ            UINT32_C(10000000)
+#define BMI3_SIM_I2C_CLOCK_HZ            UINT32_C(400000)
+#define BMI3_SIM_I3C_CLOCK_HZ            UINT32_C(12500000)
+
+/*! Default fixed cost of one bus transaction on the host side, in nanoseconds */
+#define BMI3_SIM_TXN_OVERHEAD_NS         UINT32_C(1000)
+
+/*! Default max read/write length handed to the driver (same as the COINES backend) */
+#define BMI3_SIM_READ_WRITE_LEN          UINT8_C(8)
+
+/*! Default time the device is unreachable after a soft reset or power-on, in microseconds */
+#define BMI3_SIM_RESET_TIME_US           UINT32_C(1000)
+
+/*! Default feature engine start-up time after FEATURE_CTRL is set, in microseconds */
+#define BMI3_SIM_FEATURE_BOOT_US         UINT32_C(3000)
+
+/*! Default durations of feature engine commands, in microseconds */
+#define BMI3_SIM_SELF_TEST_US            UINT32_C(150000)
+#define BMI3_SIM_SELF_CALIB_US           UINT32_C(350000)
+#define BMI3_SIM_AXIS_MAP_US             UINT32_C(1000)
+
+/******************************************************************************/
+/*!                Structure definition                                       */
+
+struct bmi3_sim;
+
+/*!
+ * @brief Optional hook called before every generated sample, so that the host can
+ * update the acc, gyr and temp fields of the simulator (e.g. to play back a waveform).
+ *
+ * @param[in,out] sim     : Simulator instance
+ * @param[in] sample_time : Simulated time of the sample in nanoseconds
+ */
+typedef void (*bmi3_sim_sample_fptr_t)(struct bmi3_sim *sim, uint64_t sample_time);
+
+/*!
+ * @brief Bus and time statistics collected by the simulator
+ */
+struct bmi3_sim_stats
+{
+    /*! Number of read transactions */
+    uint32_t read_count;
+
+    /*! Number of write transactions */
+    uint32_t write_count;
+
+    /*! Number of delay_us calls */
+    uint32_t delay_count;
+
+    /*! Bytes clocked out of the device, including interface dummy bytes */
+    uint64_t read_bytes;
+
+    /*! Bytes clocked into the device, excluding the register address */
+    uint64_t write_bytes;
+
+    /*! Time spent on the bus in nanoseconds */
+    uint64_t bus_time_ns;
+
+    /*! Time spent in delay_us in nanoseconds */
+    uint64_t delay_time_ns;
+
+    /*! Frames pushed into the FIFO */
+    uint32_t fifo_frames;
+
+    /*! Frames lost because the FIFO was full */
+    uint32_t fifo_overflows;
+
+    /*! Soft resets executed */
+    uint32_t soft_resets;
+
+    /*! Transactions ignored because the device was still in reset */
+    uint32_t ignored_count;
+};
+
+/*!
+ * @brief Simulated BMI323. All fields are host-visible so that tests can inspect
+ * and preset the device state; the timing parameters may be changed after
+ * bmi3_sim_interface_init.
+ */
+struct bmi3_sim
+{
+    /*! Interface the simulator is attached to */
+    enum bmi3_intf intf;
+
+    /*! Bus clock in Hz */
+    uint32_t bus_clock_hz;
+
+    /*! Fixed cost of one bus transaction in nanoseconds */
+    uint32_t txn_overhead_ns;
+
+    /*! Device start-up time after soft reset in microseconds */
+    uint32_t reset_time_us;
+
+    /*! Feature engine start-up time in microseconds */
+    uint32_t feature_boot_us;
+
+    /*! Self-test, self-calibration and axis map command durations in microseconds */
+    uint32_t self_test_us;
+    uint32_t self_calib_us;
+    uint32_t axis_map_us;
+
+    /*! Sensor values returned for the next sample */
+    int16_t acc[3];
+    int16_t gyr[3];
+    int16_t temp;
+
+    /*! Optional per-sample hook */
+    bmi3_sim_sample_fptr_t sample_cb;
+
+    /*! Host context for sample_cb */
+    void *ctx;
+
+    /*! Simulated time in nanoseconds */
+    uint64_t now_ns;
+
+    /*! Time up to which sensor events have been generated */
+    uint64_t event_ns;
+
+    /*! Time at which the device leaves reset */
+    uint64_t ready_ns;
+
+    /*! Time at which the feature engine becomes active, 0 if disabled */
+    uint64_t feature_ready_ns;
+
+    /*! Pending feature engine command and its completion time */
+    uint16_t feature_cmd;
+    uint64_t feature_cmd_ns;
+
+    /*! Last command written, used for the CFG_RES unlock sequence */
+    uint16_t last_cmd;
+
+    /*! SPI mode is latched by the first SPI access after reset */
+    uint8_t spi_en;
+
+    /*! User page registers */
+    uint16_t regs[BMI3_SIM_NUM_REGS];
+
+    /*! Feature engine memory and its DMA word pointer */
+    uint16_t feature_mem[BMI3_SIM_FEATURE_WORDS];
+    uint16_t feature_addr;
+
+    /*! The I3C sync block is updated after i3c_sync_countdown more words are read through the DMA window,
+     *  then every i3c_sync_reload words; 0 disables. Lets a test publish an epoch in the middle of a burst */
+    uint16_t i3c_sync_countdown;
+    uint16_t i3c_sync_reload;
+
+    /*! FIFO ring */
+    uint8_t fifo[BMI3_SIM_FIFO_SIZE];
+    uint16_t fifo_head;
+    uint16_t fifo_len;
+
+    /*! Collected statistics */
+    struct bmi3_sim_stats stats;
+};
+
+/******************************************************************************/
+/*!               User interface functions                                    */
+
+/*!
+ *  @brief This function powers up the simulated sensor and maps the read, write and
+ *  delay callbacks of the device structure onto it.
+ *
+ *  @param[in] dev       : Structure instance of bmi3_dev
+ *  @param[in] sim       : Simulator instance, owned by the caller
+ *  @param[in] intf      : Interface selection parameter
+ *
+ *  @return Status of execution
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Failure Info
+ */
+int8_t bmi3_sim_interface_init(struct bmi3_dev *dev, struct bmi3_sim *sim, int8_t intf);
+
+/*!
+ *  @brief This function advances simulated time without any bus traffic, e.g. to
+ *  model the host sleeping until an interrupt.
+ *
+ *  @param[in] sim       : Simulator instance
+ *  @param[in] period    : Time to advance in microseconds
+ *
+ *  @return void.
+ */
+void bmi3_sim_advance_us(struct bmi3_sim *sim, uint32_t period);
+
+/*!
+ *  @brief This function publishes a new I3C sync epoch in the feature engine memory: sample_cb is called,
+ *  acc, gyr and temp are latched and the sync time advances by one.
+ *
+ *  @param[in] sim       : Simulator instance
+ *
+ *  @return void.
+ */
+void bmi3_sim_i3c_sync_update(struct bmi3_sim *sim);
+
+/*!
+ *  @brief This function returns the level of an interrupt line, i.e. whether the
+ *  corresponding interrupt status register has any bit pending.
+ *
+ *  @param[in] sim       : Simulator instance
+ *  @param[in] int_pin   : BMI3_INT1, BMI3_INT2 or BMI3_I3C_INT
+ *
+ *  @return 1 if the line is asserted, 0 otherwise.
+ */
+uint8_t bmi3_sim_int_pin_level(struct bmi3_sim *sim, uint8_t int_pin);
+
+/*!
+ *  @brief This function returns the simulated time in microseconds.
+ *
+ *  @param[in] sim       : Simulator instance
+ *
+ *  @return Simulated time.
+ */
+uint64_t bmi3_sim_get_time_us(const struct bmi3_sim *sim);
+
+/*!
+ *  @brief This function clears the collected statistics.
+ *
+ *  @param[in] sim       : Simulator instance
+ *
+ *  @return void.
+ */
+void bmi3_sim_reset_stats(struct bmi3_sim *sim);
+
+/*!
+ *  @brief This function prints the collected statistics.
+ *
+ *  @param[in] label     : Name printed in front of the statistics
+ *  @param[in] sim       : Simulator instance
+ *
+ *  @return void.
+ */
+void bmi3_sim_print_stats(const char label[], const struct bmi3_sim *sim);
+
+#ifdef __cplusplus
+}
+#endif /* End of CPP guard */
+
+#endif /* _BMI3_SIM_H */
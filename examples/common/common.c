@@ -196,6 +196,20 @@ void bmi3_error_codes_print_result(const char api_name[], int8_t rslt)
                 rslt);
             break;
 
+        case BMI3_E_CONFIG_VERIFY:
+            printf("%s\t", api_name);
+            printf(
+                "Error [%d] : Config verify error. It occurs when the config array read back does not match the array written\r\n",
+                rslt);
+            break;
+
+        case BMI3_E_I3C_SYNC_TORN:
+            printf("%s\t", api_name);
+            printf(
+                "Error [%d] : I3C sync torn error. It occurs when the I3C sync data keeps changing while it is read\r\n",
+                rslt);
+            break;
+
         default:
             printf("%s\t", api_name);
             printf("Error [%d] : Unknown error code\r\n", rslt);
@@ -261,6 +275,12 @@ int8_t bmi3_interface_init(struct bmi3_dev *dev, int8_t intf)
 
         /* Configure max read/write length (in bytes) ( Supported length depends on target machine) */
         dev->read_write_len = READ_WRITE_LEN;
+        dev->batch = NULL;
+        dev->shadow = NULL;
+        dev->lock = NULL;
+        dev->unlock = NULL;
+        dev->lock_ctx = NULL;
+        dev->fifo_conf_valid = BMI3_FALSE;
     }
     else
     {
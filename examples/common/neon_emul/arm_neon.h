@@ -0,0 +1,426 @@
+/**
+ * Copyright (C) 2023 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Portable C model of the NEON intrinsics used by the vector FIFO decoder and unit conversion kernels in bmi3.c. It lets the NEON code path
+ * run on a host without an ARM toolchain: build bmi3.c with "-U__SSE2__ -D__ARM_NEON -I<this directory>".
+ * Every intrinsic follows the lane semantics of the Arm C Language Extensions on a little-endian target.
+ */
+
+#ifndef _BMI3_NEON_EMUL_ARM_NEON_H
+#define _BMI3_NEON_EMUL_ARM_NEON_H
+
+/*! CPP guard */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus */
+
+#include <stdint.h>
+#include <string.h>
+
+/******************************************************************************/
+/*!                Vector types                                               */
+
+typedef struct
+{
+    uint8_t val[8];
+} uint8x8_t;
+
+typedef struct
+{
+    uint8_t val[16];
+} uint8x16_t;
+
+typedef struct
+{
+    uint16_t val[8];
+} uint16x8_t;
+
+typedef struct
+{
+    int16_t val[8];
+} int16x8_t;
+
+typedef struct
+{
+    int16_t val[4];
+} int16x4_t;
+
+typedef struct
+{
+    uint32_t val[2];
+} uint32x2_t;
+
+typedef struct
+{
+    uint32_t val[4];
+} uint32x4_t;
+
+typedef struct
+{
+    int32_t val[4];
+} int32x4_t;
+
+typedef struct
+{
+    float val[4];
+} float32x4_t;
+
+typedef struct
+{
+    uint16x8_t val[2];
+} uint16x8x2_t;
+
+typedef struct
+{
+    uint32x4_t val[2];
+} uint32x4x2_t;
+
+/******************************************************************************/
+/*!                Loads, stores and constants                                */
+
+static inline uint8x16_t vld1q_u8(const uint8_t *ptr)
+{
+    uint8x16_t r;
+
+    memcpy(r.val, ptr, sizeof(r.val));
+
+    return r;
+}
+
+static inline int16x8_t vld1q_s16(const int16_t *ptr)
+{
+    int16x8_t r;
+
+    memcpy(r.val, ptr, sizeof(r.val));
+
+    return r;
+}
+
+static inline void vst1q_u16(uint16_t *ptr, uint16x8_t a)
+{
+    memcpy(ptr, a.val, sizeof(a.val));
+}
+
+static inline void vst1q_s16(int16_t *ptr, int16x8_t a)
+{
+    memcpy(ptr, a.val, sizeof(a.val));
+}
+
+static inline void vst1q_s32(int32_t *ptr, int32x4_t a)
+{
+    memcpy(ptr, a.val, sizeof(a.val));
+}
+
+static inline void vst1q_f32(float *ptr, float32x4_t a)
+{
+    memcpy(ptr, a.val, sizeof(a.val));
+}
+
+static inline uint16x8_t vdupq_n_u16(uint16_t value)
+{
+    uint16x8_t r;
+    int i;
+
+    for (i = 0; i < 8; i++)
+    {
+        r.val[i] = value;
+    }
+
+    return r;
+}
+
+static inline int16x8_t vdupq_n_s16(int16_t value)
+{
+    int16x8_t r;
+    int i;
+
+    for (i = 0; i < 8; i++)
+    {
+        r.val[i] = value;
+    }
+
+    return r;
+}
+
+static inline uint8x8_t vcreate_u8(uint64_t value)
+{
+    uint8x8_t r;
+    int i;
+
+    for (i = 0; i < 8; i++)
+    {
+        r.val[i] = (uint8_t)(value >> (8 * i));
+    }
+
+    return r;
+}
+
+static inline uint8_t vget_lane_u8(uint8x8_t a, int lane)
+{
+    return a.val[lane];
+}
+
+/******************************************************************************/
+/*!                Reinterpretation (little-endian byte image)                */
+
+static inline uint16x8_t vreinterpretq_u16_u8(uint8x16_t a)
+{
+    uint16x8_t r;
+
+    memcpy(r.val, a.val, sizeof(r.val));
+
+    return r;
+}
+
+static inline uint32x4_t vreinterpretq_u32_u16(uint16x8_t a)
+{
+    uint32x4_t r;
+
+    memcpy(r.val, a.val, sizeof(r.val));
+
+    return r;
+}
+
+static inline uint16x8_t vreinterpretq_u16_u32(uint32x4_t a)
+{
+    uint16x8_t r;
+
+    memcpy(r.val, a.val, sizeof(r.val));
+
+    return r;
+}
+
+static inline int16x8_t vreinterpretq_s16_u16(uint16x8_t a)
+{
+    int16x8_t r;
+
+    memcpy(r.val, a.val, sizeof(r.val));
+
+    return r;
+}
+
+/******************************************************************************/
+/*!                Permutes                                                   */
+
+/* val[0] holds the even lanes of a and b interleaved, val[1] the odd lanes */
+static inline uint16x8x2_t vtrnq_u16(uint16x8_t a, uint16x8_t b)
+{
+    uint16x8x2_t r;
+    int i;
+
+    for (i = 0; i < 8; i += 2)
+    {
+        r.val[0].val[i] = a.val[i];
+        r.val[0].val[i + 1] = b.val[i];
+        r.val[1].val[i] = a.val[i + 1];
+        r.val[1].val[i + 1] = b.val[i + 1];
+    }
+
+    return r;
+}
+
+static inline uint32x4x2_t vtrnq_u32(uint32x4_t a, uint32x4_t b)
+{
+    uint32x4x2_t r;
+    int i;
+
+    for (i = 0; i < 4; i += 2)
+    {
+        r.val[0].val[i] = a.val[i];
+        r.val[0].val[i + 1] = b.val[i];
+        r.val[1].val[i] = a.val[i + 1];
+        r.val[1].val[i + 1] = b.val[i + 1];
+    }
+
+    return r;
+}
+
+static inline uint32x2_t vget_low_u32(uint32x4_t a)
+{
+    uint32x2_t r = { { a.val[0], a.val[1] } };
+
+    return r;
+}
+
+static inline uint32x2_t vget_high_u32(uint32x4_t a)
+{
+    uint32x2_t r = { { a.val[2], a.val[3] } };
+
+    return r;
+}
+
+static inline int16x4_t vget_low_s16(int16x8_t a)
+{
+    int16x4_t r = { { a.val[0], a.val[1], a.val[2], a.val[3] } };
+
+    return r;
+}
+
+static inline int16x4_t vget_high_s16(int16x8_t a)
+{
+    int16x4_t r = { { a.val[4], a.val[5], a.val[6], a.val[7] } };
+
+    return r;
+}
+
+static inline uint32x4_t vcombine_u32(uint32x2_t low, uint32x2_t high)
+{
+    uint32x4_t r = { { low.val[0], low.val[1], high.val[0], high.val[1] } };
+
+    return r;
+}
+
+/******************************************************************************/
+/*!                Arithmetic and compare                                     */
+
+static inline uint16x8_t vceqq_u16(uint16x8_t a, uint16x8_t b)
+{
+    uint16x8_t r;
+    int i;
+
+    for (i = 0; i < 8; i++)
+    {
+        r.val[i] = (a.val[i] == b.val[i]) ? UINT16_C(0xFFFF) : 0;
+    }
+
+    return r;
+}
+
+static inline uint8x8_t vmovn_u16(uint16x8_t a)
+{
+    uint8x8_t r;
+    int i;
+
+    for (i = 0; i < 8; i++)
+    {
+        r.val[i] = (uint8_t)a.val[i];
+    }
+
+    return r;
+}
+
+static inline uint8x8_t vand_u8(uint8x8_t a, uint8x8_t b)
+{
+    uint8x8_t r;
+    int i;
+
+    for (i = 0; i < 8; i++)
+    {
+        r.val[i] = a.val[i] & b.val[i];
+    }
+
+    return r;
+}
+
+/* Lanes 0-3 are the pairwise sums of a, lanes 4-7 those of b */
+static inline uint8x8_t vpadd_u8(uint8x8_t a, uint8x8_t b)
+{
+    uint8x8_t r;
+    int i;
+
+    for (i = 0; i < 4; i++)
+    {
+        r.val[i] = (uint8_t)(a.val[2 * i] + a.val[2 * i + 1]);
+        r.val[i + 4] = (uint8_t)(b.val[2 * i] + b.val[2 * i + 1]);
+    }
+
+    return r;
+}
+
+/******************************************************************************/
+/*!                Widening, conversion and shifts                            */
+
+static inline int32x4_t vmovl_s16(int16x4_t a)
+{
+    int32x4_t r;
+    int i;
+
+    for (i = 0; i < 4; i++)
+    {
+        r.val[i] = a.val[i];
+    }
+
+    return r;
+}
+
+static inline float32x4_t vcvtq_f32_s32(int32x4_t a)
+{
+    float32x4_t r;
+    int i;
+
+    for (i = 0; i < 4; i++)
+    {
+        r.val[i] = (float)a.val[i];
+    }
+
+    return r;
+}
+
+static inline float32x4_t vmulq_n_f32(float32x4_t a, float b)
+{
+    float32x4_t r;
+    int i;
+
+    for (i = 0; i < 4; i++)
+    {
+        r.val[i] = a.val[i] * b;
+    }
+
+    return r;
+}
+
+/* The product wraps modulo 2^32 like the instruction */
+static inline int32x4_t vmulq_n_s32(int32x4_t a, int32_t b)
+{
+    int32x4_t r;
+    int i;
+
+    for (i = 0; i < 4; i++)
+    {
+        r.val[i] = (int32_t)((uint32_t)a.val[i] * (uint32_t)b);
+    }
+
+    return r;
+}
+
+/* Each lane of a is shifted left by the signed low byte of the lane of b, right with sign extension when negative */
+static inline int16x8_t vshlq_s16(int16x8_t a, int16x8_t b)
+{
+    int16x8_t r;
+    int8_t count;
+    int i;
+
+    for (i = 0; i < 8; i++)
+    {
+        count = (int8_t)b.val[i];
+
+        if (count >= 16)
+        {
+            r.val[i] = 0;
+        }
+        else if (count >= 0)
+        {
+            r.val[i] = (int16_t)(uint16_t)((uint16_t)a.val[i] << count);
+        }
+        else if (count > -16)
+        {
+            r.val[i] = (int16_t)(a.val[i] >> -count);
+        }
+        else
+        {
+            r.val[i] = (a.val[i] < 0) ? -1 : 0;
+        }
+    }
+
+    return r;
+}
+
+#ifdef __cplusplus
+}
+#endif /*__cplusplus */
+
+#endif /* _BMI3_NEON_EMUL_ARM_NEON_H */
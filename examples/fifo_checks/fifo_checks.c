@@ -0,0 +1,787 @@
+/**\
+ * Copyright (c) 2023 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stdio.h>
+#include "bmi323.h"
+#include "bmi3_sim.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+/*! Number of frames written into the FIFO buffer of a check */
+#define CHECK_FRAMES     UINT16_C(40)
+
+/*! Frame replaced by a dummy frame */
+#define CHECK_DUMMY      UINT16_C(5)
+
+/*! Size of the FIFO buffer, large enough for CHECK_FRAMES frames of every layout */
+#define FIFO_SIZE_BYTES  UINT16_C(1024)
+
+/*! Frames of a timestamp batch: 4 s at 50 Hz, longer than the 16-bit sensor time wraps */
+#define SYNC_FRAMES      UINT16_C(200)
+
+/*! Sensor time ticks between two frames at 50 Hz */
+#define SYNC_PERIOD      UINT32_C(512)
+
+/*! Samples of a unit conversion check: four vector blocks and a scalar tail */
+#define CONVERT_SAMPLES  UINT16_C(37)
+
+/******************************************************************************/
+/*!          Static variable definition                                       */
+
+/*! Simulated sensor, only used to provide the interface of the device structure */
+static struct bmi3_sim sim;
+
+/*! FIFO data including the interface dummy byte */
+static uint8_t fifo_data[FIFO_SIZE_BYTES + 2];
+
+/*! Frames extracted from the FIFO */
+static struct bmi3_fifo_sens_axes_data fifo_axes[CHECK_FRAMES];
+
+/*! Frames extracted from the FIFO by the struct-of-arrays extractors */
+static int16_t soa_x[CHECK_FRAMES], soa_y[CHECK_FRAMES], soa_z[CHECK_FRAMES];
+static uint16_t soa_t[CHECK_FRAMES];
+
+/*! FIFO sensor time, expected and reconstructed timestamps of a batch */
+static uint16_t sync_stamp[SYNC_FRAMES];
+static uint64_t sync_expected[SYNC_FRAMES], sync_time[SYNC_FRAMES];
+
+/*! Raw samples and converted values of a unit conversion check */
+static int16_t convert_raw[CONVERT_SAMPLES], convert_q15[CONVERT_SAMPLES];
+static int32_t convert_q31[CONVERT_SAMPLES];
+static float convert_f32[CONVERT_SAMPLES];
+
+/******************************************************************************/
+/*!         Static Function Declaration                                       */
+
+/*!
+ *  @brief This internal API writes CHECK_FRAMES headerless frames into the FIFO buffer. Frame n carries
+ *  the axes (n, 1000 + n, -n) and the sensor time 16 * n, frame CHECK_DUMMY is a dummy frame.
+ *
+ *  @param[in] fifo      : Structure instance of bmi3_fifo_frame.
+ *  @param[in] sens      : FIFO configuration, BMI3_FIFO_*_EN bits.
+ *  @param[in] dev       : Structure instance of bmi3_dev.
+ *
+ *  @return void.
+ */
+static void fill_fifo(struct bmi3_fifo_frame *fifo, uint16_t sens, const struct bmi3_dev *dev);
+
+/*!
+ *  @brief This internal API checks that one extractor returns every frame of a FIFO configuration once,
+ *  in order and without the dummy frame.
+ *
+ *  @param[in] label     : Name of the check.
+ *  @param[in] sens      : FIFO configuration, BMI3_FIFO_*_EN bits.
+ *  @param[in] gyro      : Checks bmi323_extract_gyro() if set, else bmi323_extract_accel().
+ *  @param[in] dev       : Structure instance of bmi3_dev.
+ *
+ *  @return Number of failed checks.
+ */
+static uint16_t check_extract(const char label[], uint16_t sens, uint8_t gyro, const struct bmi3_dev *dev);
+
+/*!
+ *  @brief This internal API checks that one struct-of-arrays extractor fills its buffers with the frames of a
+ *  FIFO configuration in order and without the dummy frame, also when the buffers are smaller than the FIFO.
+ *
+ *  @param[in] label     : Name of the check.
+ *  @param[in] sens      : FIFO configuration, BMI3_FIFO_*_EN bits.
+ *  @param[in] gyro      : Checks bmi323_extract_gyro_soa() if set, else bmi323_extract_accel_soa().
+ *  @param[in] len       : Capacity of the buffers in frames.
+ *  @param[in] dev       : Structure instance of bmi3_dev.
+ *
+ *  @return Number of failed checks.
+ */
+static uint16_t check_extract_soa(const char label[],
+                                  uint16_t sens,
+                                  uint8_t gyro,
+                                  uint16_t len,
+                                  const struct bmi3_dev *dev);
+
+/*!
+ *  @brief This internal API checks the FIFO timestamp reconstruction on batches longer than the 16-bit
+ *  sensor time wraps, with and without sensor time in the FIFO.
+ *
+ *  @param[in] dev       : Structure instance of bmi3_dev.
+ *
+ *  @return Number of failed checks.
+ */
+static uint16_t check_time_sync(struct bmi3_dev *dev);
+
+/*!
+ *  @brief This internal API checks that the FIFO read APIs reject a NULL device structure.
+ *
+ *  @return Number of failed checks.
+ */
+static uint16_t check_null_dev(void);
+
+/*!
+ *  @brief This internal API checks that the FIFO read APIs write out queued register writes before
+ *  reading FIFO data with the cached FIFO configuration.
+ *
+ *  @param[in] dev       : Structure instance of bmi3_dev.
+ *
+ *  @return Number of failed checks.
+ */
+static uint16_t check_batch_flush(struct bmi3_dev *dev);
+
+/*!
+ *  @brief This internal API checks that a soft-reset sent as a plain command drops the cached FIFO
+ *  configuration.
+ *
+ *  @param[in] dev       : Structure instance of bmi3_dev.
+ *
+ *  @return Number of failed checks.
+ */
+static uint16_t check_cmd_fifo_conf(struct bmi3_dev *dev);
+
+#ifndef BMI3_I3C_SYNC_DISABLE
+
+/*!
+ *  @brief This internal API checks that an I3C sync snapshot holds the data of one sync epoch when the
+ *  simulated feature engine publishes a new epoch in the middle of the DMA burst or right after it.
+ *
+ *  @param[in] dev       : Structure instance of bmi3_dev.
+ *
+ *  @return Number of failed checks.
+ */
+static uint16_t check_i3c_sync(struct bmi3_dev *dev);
+
+/*!
+ *  @brief This internal API reads an I3C sync snapshot and checks its result, the number of DMA bursts
+ *  it took and that every value carries the epoch of its sync time.
+ *
+ *  @param[in] label     : Name of the check.
+ *  @param[in] countdown : Feature engine words read before the sync block is updated, 0 for none.
+ *  @param[in] reload    : Feature engine words between two later updates, 0 for none.
+ *  @param[in] rslt_exp  : Expected result of the snapshot read.
+ *  @param[in] reads     : Expected number of read transactions.
+ *  @param[in] time_exp  : Expected sync time.
+ *  @param[in] dev       : Structure instance of bmi3_dev.
+ *
+ *  @return Number of failed checks.
+ */
+static uint16_t check_i3c_sync_read(const char label[],
+                                    uint16_t countdown,
+                                    uint16_t reload,
+                                    int8_t rslt_exp,
+                                    uint32_t reads,
+                                    uint16_t time_exp,
+                                    struct bmi3_dev *dev);
+
+/*!
+ *  @brief This internal API sets every simulated value to the sync time of the epoch being published.
+ *
+ *  @param[in,out] sim_ptr     : Simulator instance.
+ *  @param[in]     sample_time : Simulated time of the sample in nanoseconds.
+ *
+ *  @return void.
+ */
+static void i3c_sync_epoch_values(struct bmi3_sim *sim_ptr, uint64_t sample_time);
+#endif
+
+/*!
+ *  @brief This internal API checks the unit conversion kernels against a per-sample reference for every
+ *  range, and for a Q31 factor that is not a power of 2.
+ *
+ *  @return Number of failed checks.
+ */
+static uint16_t check_convert(void);
+
+/*!
+ *  @brief This internal API prints the result of a check.
+ *
+ *  @param[in] label     : Name of the check.
+ *  @param[in] failed    : Number of failed checks.
+ *
+ *  @return Number of failed checks.
+ */
+static uint16_t report(const char label[], uint16_t failed);
+
+/******************************************************************************/
+/*!            Functions                                        */
+
+/* This function starts the execution of program. */
+int main(void)
+{
+    /* Status of API are returned to this variable. */
+    int8_t rslt;
+
+    /* Sensor initialization configuration. */
+    struct bmi3_dev dev = { 0 };
+
+    /* Number of failed checks */
+    uint16_t failed = 0;
+
+    rslt = bmi3_sim_interface_init(&dev, &sim, BMI3_SPI_INTF);
+
+    if (rslt == BMI3_OK)
+    {
+        failed += check_extract("extract_accel acc", BMI3_FIFO_ACC_EN, 0, &dev);
+        failed += check_extract("extract_gyro gyr", BMI3_FIFO_GYR_EN, 1, &dev);
+        failed += check_extract("extract_accel acc+time", BMI3_FIFO_ACC_EN | BMI3_FIFO_TIME_EN, 0, &dev);
+        failed += check_extract("extract_gyro gyr+time", BMI3_FIFO_GYR_EN | BMI3_FIFO_TIME_EN, 1, &dev);
+        failed += check_extract_soa("extract_accel_soa acc", BMI3_FIFO_ACC_EN, 0, CHECK_FRAMES, &dev);
+        failed += check_extract_soa("extract_accel_soa acc+gyr+time",
+                                    BMI3_FIFO_ACC_EN | BMI3_FIFO_GYR_EN | BMI3_FIFO_TIME_EN,
+                                    0,
+                                    CHECK_FRAMES,
+                                    &dev);
+        failed += check_extract_soa("extract_gyro_soa acc+gyr, 11 frames", BMI3_FIFO_ACC_EN | BMI3_FIFO_GYR_EN, 1, 11,
+                                    &dev);
+        failed += check_extract_soa("extract_gyro_soa gyr+temp+time", BMI3_FIFO_ALL_EN & ~BMI3_FIFO_ACC_EN, 1, 20,
+                                    &dev);
+        failed += check_time_sync(&dev);
+        failed += check_null_dev();
+        failed += check_batch_flush(&dev);
+        failed += check_cmd_fifo_conf(&dev);
+        failed += check_convert();
+#ifndef BMI3_I3C_SYNC_DISABLE
+        failed += check_i3c_sync(&dev);
+#endif
+
+        printf("Failed checks: %u\n", failed);
+    }
+
+    return (rslt == BMI3_OK && failed == 0) ? 0 : 1;
+}
+
+/*!
+ * @brief This internal API checks that one extractor returns every frame of a FIFO configuration once,
+ * in order and without the dummy frame.
+ */
+static uint16_t check_extract(const char label[], uint16_t sens, uint8_t gyro, const struct bmi3_dev *dev)
+{
+    struct bmi3_fifo_frame fifo = { 0 };
+    uint16_t failed = 0;
+    uint16_t idx, frame, count;
+
+    fill_fifo(&fifo, sens, dev);
+
+    if (gyro)
+    {
+        fifo.avail_fifo_gyro_frames = CHECK_FRAMES;
+        (void)bmi323_extract_gyro(fifo_axes, &fifo, dev);
+        count = fifo.avail_fifo_gyro_frames;
+    }
+    else
+    {
+        fifo.avail_fifo_accel_frames = CHECK_FRAMES;
+        (void)bmi323_extract_accel(fifo_axes, &fifo, dev);
+        count = fifo.avail_fifo_accel_frames;
+    }
+
+    if (count != (CHECK_FRAMES - 1))
+    {
+        failed++;
+    }
+
+    for (idx = 0; idx < count; idx++)
+    {
+        /* The dummy frame is dropped, so the frames behind it move up by one */
+        frame = (idx < CHECK_DUMMY) ? idx : (uint16_t)(idx + 1);
+
+        if ((fifo_axes[idx].x != (int16_t)frame) || (fifo_axes[idx].y != (int16_t)(1000 + frame)) ||
+            (fifo_axes[idx].z != (int16_t)-frame) ||
+            ((sens & BMI3_FIFO_TIME_EN) && (fifo_axes[idx].sensor_time != (uint16_t)(16 * frame))))
+        {
+            failed++;
+        }
+    }
+
+    return report(label, failed);
+}
+
+/*!
+ * @brief This internal API checks that one struct-of-arrays extractor fills its buffers with the frames of a
+ * FIFO configuration in order and without the dummy frame, also when the buffers are smaller than the FIFO.
+ */
+static uint16_t check_extract_soa(const char label[],
+                                  uint16_t sens,
+                                  uint8_t gyro,
+                                  uint16_t len,
+                                  const struct bmi3_dev *dev)
+{
+    struct bmi3_fifo_frame fifo = { 0 };
+    struct bmi3_fifo_axes_soa soa = { soa_x, soa_y, soa_z, soa_t, NULL, 0, 0 };
+    uint16_t failed = 0;
+    uint16_t idx, frame;
+
+    soa.len = len;
+    fill_fifo(&fifo, sens, dev);
+
+    if (gyro)
+    {
+        (void)bmi323_extract_gyro_soa(&soa, &fifo, dev);
+    }
+    else
+    {
+        (void)bmi323_extract_accel_soa(&soa, &fifo, dev);
+    }
+
+    if (soa.frames != ((len < (CHECK_FRAMES - 1)) ? len : (CHECK_FRAMES - 1)))
+    {
+        failed++;
+    }
+
+    for (idx = 0; idx < soa.frames; idx++)
+    {
+        /* The dummy frame is dropped, so the frames behind it move up by one */
+        frame = (idx < CHECK_DUMMY) ? idx : (uint16_t)(idx + 1);
+
+        if ((soa_x[idx] != (int16_t)frame) || (soa_y[idx] != (int16_t)(1000 + frame)) ||
+            (soa_z[idx] != (int16_t)-frame) ||
+            (soa_t[idx] != ((sens & BMI3_FIFO_TIME_EN) ? (uint16_t)(16 * frame) : 0)))
+        {
+            failed++;
+        }
+    }
+
+    return report(label, failed);
+}
+
+/*!
+ * @brief This internal API checks the FIFO timestamp reconstruction on batches longer than the 16-bit
+ * sensor time wraps, with and without sensor time in the FIFO.
+ */
+static uint16_t check_time_sync(struct bmi3_dev *dev)
+{
+    int8_t rslt;
+    struct bmi3_fifo_time_sync sync;
+    struct bmi3_accel_config acc_cfg = { 0 };
+    uint16_t failed = 0, stamped = 0, batch = 0, unstamped = 0;
+    uint16_t idx;
+    uint64_t last;
+
+    acc_cfg.odr = BMI3_ACC_ODR_50HZ;
+
+    /* Let the simulated sensor time run long enough for a full batch before the anchor */
+    bmi3_sim_advance_us(&sim, 10000000);
+
+    rslt = bmi323_fifo_time_sync_init(&sync, &acc_cfg);
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_fifo_time_sync_anchor(&sync, dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        /* The anchor is read 100 ticks after the last frame of the drained batch */
+        last = (uint64_t)sync.anchor - 100;
+
+        for (idx = 0; idx < SYNC_FRAMES; idx++)
+        {
+            sync_expected[idx] = last - (uint64_t)(SYNC_FRAMES - 1 - idx) * SYNC_PERIOD;
+            sync_stamp[idx] = (uint16_t)sync_expected[idx];
+        }
+
+        rslt = bmi323_fifo_time_sync_apply(&sync, sync_stamp, sync_time, SYNC_FRAMES);
+
+        for (idx = 0; idx < SYNC_FRAMES; idx++)
+        {
+            stamped += (sync_time[idx] != sync_expected[idx]);
+        }
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        /* The next batch is unwrapped from the last frame without an anchor */
+        for (idx = 0; idx < SYNC_FRAMES; idx++)
+        {
+            sync_expected[idx] += (uint64_t)SYNC_FRAMES * SYNC_PERIOD;
+            sync_stamp[idx] = (uint16_t)sync_expected[idx];
+        }
+
+        rslt = bmi323_fifo_time_sync_apply(&sync, sync_stamp, sync_time, SYNC_FRAMES);
+
+        for (idx = 0; idx < SYNC_FRAMES; idx++)
+        {
+            batch += (sync_time[idx] != sync_expected[idx]);
+        }
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_fifo_time_sync_init(&sync, &acc_cfg);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_fifo_time_sync_anchor(&sync, dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        /* Without sensor time the batch ends at the anchor, the same as a stamped batch drained at the anchor */
+        for (idx = 0; idx < SYNC_FRAMES; idx++)
+        {
+            sync_expected[idx] = (uint64_t)sync.anchor - (uint64_t)(SYNC_FRAMES - 1 - idx) * SYNC_PERIOD;
+        }
+
+        rslt = bmi323_fifo_time_sync_apply(&sync, NULL, sync_time, SYNC_FRAMES);
+
+        for (idx = 0; idx < SYNC_FRAMES; idx++)
+        {
+            unstamped += (sync_time[idx] != sync_expected[idx]);
+        }
+    }
+
+    failed += report("time_sync stamped 4 s batch", (uint16_t)(stamped + (rslt != BMI323_OK)));
+    failed += report("time_sync stamped next batch", (uint16_t)(batch + (rslt != BMI323_OK)));
+    failed += report("time_sync unstamped 4 s batch", (uint16_t)(unstamped + (rslt != BMI323_OK)));
+
+    return failed;
+}
+
+/*!
+ * @brief This internal API checks that the FIFO read APIs reject a NULL device structure.
+ */
+static uint16_t check_null_dev(void)
+{
+    struct bmi3_fifo_frame fifo = { 0 };
+    uint8_t *buf = fifo_data;
+    struct bmi3_fifo_buf_ring ring = { 0 };
+    struct bmi3_fifo_view view = { 0 };
+    uint16_t failed = 0;
+
+    fifo.data = fifo_data;
+    fifo.length = FIFO_SIZE_BYTES;
+
+    ring.buf = &buf;
+    ring.num_buf = 1;
+    ring.buf_size = FIFO_SIZE_BYTES;
+
+    failed += (bmi323_read_fifo_data(&fifo, NULL) != BMI323_E_NULL_PTR);
+    failed += (bmi323_drain_fifo_view(&ring, &view, 0, NULL) != BMI323_E_NULL_PTR);
+
+    return report("FIFO reads with a NULL device", failed);
+}
+
+/*!
+ * @brief This internal API checks that the FIFO read APIs write out queued register writes before
+ * reading FIFO data with the cached FIFO configuration.
+ */
+static uint16_t check_batch_flush(struct bmi3_dev *dev)
+{
+    int8_t rslt;
+    struct bmi3_batch batch;
+    struct bmi3_fifo_frame fifo = { 0 };
+    uint8_t *buf = fifo_data;
+    struct bmi3_fifo_buf_ring ring = { 0 };
+    struct bmi3_fifo_view view = { 0 };
+    uint16_t failed = 0;
+
+    fifo.data = fifo_data;
+    fifo.length = (uint16_t)(BMI3_LENGTH_FIFO_ACC + dev->dummy_byte);
+
+    ring.buf = &buf;
+    ring.num_buf = 1;
+    ring.buf_size = FIFO_SIZE_BYTES;
+
+    /* Writing the FIFO configuration makes it cached, so the reads below do not read registers */
+    rslt = bmi323_set_fifo_config(BMI3_FIFO_ACC_EN, BMI323_ENABLE, dev);
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_batch_begin(&batch, dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_set_fifo_wm(16, dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        failed += (batch.num_ops == 0);
+        rslt = bmi323_read_fifo_data(&fifo, dev);
+        failed += (batch.num_ops != 0);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_set_fifo_wm(32, dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        failed += (batch.num_ops == 0);
+        rslt = bmi323_drain_fifo_view(&ring, &view, 0, dev);
+        failed += (batch.num_ops != 0);
+
+        /* The FIFO holds no frames, which is reported as a warning */
+        if (rslt > BMI323_OK)
+        {
+            rslt = BMI323_OK;
+        }
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_batch_end(dev);
+    }
+
+    return report("FIFO reads flush queued writes", (uint16_t)(failed + (rslt != BMI323_OK)));
+}
+
+/*!
+ * @brief This internal API checks that a soft-reset sent as a plain command drops the cached FIFO
+ * configuration.
+ */
+static uint16_t check_cmd_fifo_conf(struct bmi3_dev *dev)
+{
+    int8_t rslt;
+    struct bmi3_fifo_frame fifo = { 0 };
+    uint8_t dummy[2];
+
+    fifo.data = fifo_data;
+    fifo.length = (uint16_t)(BMI3_LENGTH_FIFO_ACC + dev->dummy_byte);
+
+    rslt = bmi323_set_fifo_config(BMI3_FIFO_ACC_EN | BMI3_FIFO_GYR_EN, BMI323_ENABLE, dev);
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_set_command_register(BMI3_CMD_SOFT_RESET, dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        /* Wait for the reset and switch the sensor back to SPI with a dummy read */
+        bmi3_sim_advance_us(&sim, BMI3_SOFT_RESET_DELAY);
+        rslt = bmi323_get_regs(BMI3_REG_CHIP_ID, dummy, 1, dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_read_fifo_data(&fifo, dev);
+    }
+
+    /* The reset cleared the FIFO configuration */
+    return report("soft-reset command drops the FIFO config",
+                  (uint16_t)((rslt != BMI323_OK) + (fifo.available_fifo_sens != 0)));
+}
+
+#ifndef BMI3_I3C_SYNC_DISABLE
+
+/*!
+ * @brief This internal API checks that an I3C sync snapshot holds the data of one sync epoch when the
+ * simulated feature engine publishes a new epoch in the middle of the DMA burst or right after it.
+ */
+static uint16_t check_i3c_sync(struct bmi3_dev *dev)
+{
+    uint16_t failed = 0;
+
+    /* The DMA reads need the interface dummy byte set up by the initialization */
+    failed += (bmi323_init(dev) != BMI323_OK);
+
+    sim.sample_cb = i3c_sync_epoch_values;
+    bmi3_sim_i3c_sync_update(&sim);
+
+    /* An attempt reads the sync time (1 word), then the data burst (8 words) ending with the sync time */
+    failed += check_i3c_sync_read("i3c_sync_snapshot no update", 0, 0, BMI323_OK, 2, 1, dev);
+    failed += check_i3c_sync_read("i3c_sync_snapshot update in the burst", 5, 0, BMI323_OK, 4, 2, dev);
+    failed += check_i3c_sync_read("i3c_sync_snapshot update after the burst", 9, 0, BMI323_OK, 2, 2, dev);
+    failed += check_i3c_sync_read("i3c_sync_snapshot update in every burst",
+                                  5,
+                                  9,
+                                  BMI3_E_I3C_SYNC_TORN,
+                                  2 * (BMI3_I3C_SYNC_SNAPSHOT_RETRIES + 1),
+                                  0,
+                                  dev);
+
+    sim.i3c_sync_countdown = 0;
+    sim.i3c_sync_reload = 0;
+    sim.sample_cb = NULL;
+
+    return failed;
+}
+
+/*!
+ * @brief This internal API reads an I3C sync snapshot and checks its result, the number of DMA bursts
+ * it took and that every value carries the epoch of its sync time.
+ */
+static uint16_t check_i3c_sync_read(const char label[],
+                                    uint16_t countdown,
+                                    uint16_t reload,
+                                    int8_t rslt_exp,
+                                    uint32_t reads,
+                                    uint16_t time_exp,
+                                    struct bmi3_dev *dev)
+{
+    int8_t rslt;
+    struct bmi3_i3c_sync_snapshot snapshot = { { 0 }, { 0 }, { 0 } };
+    uint16_t failed = 0, time;
+
+    sim.i3c_sync_countdown = countdown;
+    sim.i3c_sync_reload = reload;
+    bmi3_sim_reset_stats(&sim);
+
+    rslt = bmi323_get_i3c_sync_snapshot(&snapshot, dev);
+
+    failed += (rslt != rslt_exp);
+    failed += (sim.stats.read_count != reads);
+
+    if (rslt == BMI323_OK)
+    {
+        time = snapshot.acc.sync_time;
+
+        failed += (time != time_exp);
+        failed += (snapshot.gyr.sync_time != time) + (snapshot.temp.sync_time != time);
+        failed += (snapshot.acc.sync_x != time) + (snapshot.acc.sync_y != time) + (snapshot.acc.sync_z != time);
+        failed += (snapshot.gyr.sync_x != time) + (snapshot.gyr.sync_y != time) + (snapshot.gyr.sync_z != time);
+        failed += (snapshot.temp.sync_temp != time);
+    }
+
+    return report(label, failed);
+}
+
+/*!
+ * @brief This internal API sets every simulated value to the sync time of the epoch being published.
+ */
+static void i3c_sync_epoch_values(struct bmi3_sim *sim_ptr, uint64_t sample_time)
+{
+    int16_t epoch = (int16_t)(sim_ptr->feature_mem[BMI3_BASE_ADDR_I3C_SYNC_TIME] + 1);
+    uint8_t axis;
+
+    (void)sample_time;
+
+    for (axis = 0; axis < 3; axis++)
+    {
+        sim_ptr->acc[axis] = epoch;
+        sim_ptr->gyr[axis] = epoch;
+    }
+
+    sim_ptr->temp = epoch;
+}
+#endif
+
+/*!
+ * @brief This internal API checks the unit conversion kernels against a per-sample reference for every
+ * range, and for a Q31 factor that is not a power of 2.
+ */
+static uint16_t check_convert(void)
+{
+    struct bmi3_sens_config config = { 0 };
+    struct bmi3_unit_scale scale;
+    uint16_t failed = 0, idx;
+    uint8_t range;
+
+    for (idx = 0; idx < CONVERT_SAMPLES; idx++)
+    {
+        convert_raw[idx] = (int16_t)(-32768 + idx * 1771);
+    }
+
+    convert_raw[CONVERT_SAMPLES - 1] = INT16_C(32767);
+
+    for (range = 0; range < 9; range++)
+    {
+        /* Ranges 0-3 are the accelerometer ranges, 4-8 the gyroscope ranges, the last one with a Q31 factor of 3 */
+        if (range < 4)
+        {
+            config.type = BMI323_ACCEL;
+            config.cfg.acc.range = range;
+        }
+        else
+        {
+            config.type = BMI323_GYRO;
+            config.cfg.gyr.range = (uint8_t)(range - 4);
+        }
+
+        failed += (bmi323_get_unit_scale(&config, &scale) != BMI323_OK);
+
+        if (range == 8)
+        {
+            scale.q31_mult = 3;
+        }
+
+        failed += (bmi323_convert_f32(&scale, convert_raw, CONVERT_SAMPLES, convert_f32) != BMI323_OK);
+        failed += (bmi323_convert_q31(&scale, convert_raw, CONVERT_SAMPLES, convert_q31) != BMI323_OK);
+        failed += (bmi323_convert_q15(&scale, convert_raw, CONVERT_SAMPLES, convert_q15) != BMI323_OK);
+
+        for (idx = 0; idx < CONVERT_SAMPLES; idx++)
+        {
+            failed += (convert_f32[idx] != (float)convert_raw[idx] * scale.si);
+            failed += (convert_q31[idx] != (int32_t)convert_raw[idx] * scale.q31_mult);
+            failed += (convert_q15[idx] != (int16_t)(convert_raw[idx] >> scale.q15_shift));
+        }
+    }
+
+    return report("convert f32/q31/q15 every range", failed);
+}
+
+/*!
+ * @brief This internal API writes CHECK_FRAMES headerless frames into the FIFO buffer.
+ */
+static void fill_fifo(struct bmi3_fifo_frame *fifo, uint16_t sens, const struct bmi3_dev *dev)
+{
+    uint16_t frame, sensor, len = 0;
+    uint16_t word[8];
+    uint8_t num, pos;
+
+    for (frame = 0; frame < CHECK_FRAMES; frame++)
+    {
+        num = 0;
+
+        /* Words in FIFO order: acc x, y, z, gyr x, y, z, temp, time */
+        for (sensor = BMI3_FIFO_ACC_EN; sensor <= BMI3_FIFO_GYR_EN; sensor = (uint16_t)(sensor << 1))
+        {
+            if (sens & sensor)
+            {
+                word[num] = (uint16_t)frame;
+                word[num + 1] = (uint16_t)(1000 + frame);
+                word[num + 2] = (uint16_t)-frame;
+
+                if (frame == CHECK_DUMMY)
+                {
+                    word[num] = (sensor == BMI3_FIFO_ACC_EN) ? BMI3_FIFO_ACCEL_DUMMY_FRAME :
+                                BMI3_FIFO_GYRO_DUMMY_FRAME;
+                }
+
+                num += 3;
+            }
+        }
+
+        if (sens & BMI3_FIFO_TEMP_EN)
+        {
+            word[num++] = 0;
+        }
+
+        if (sens & BMI3_FIFO_TIME_EN)
+        {
+            word[num++] = (uint16_t)(16 * frame);
+        }
+
+        for (pos = 0; pos < num; pos++)
+        {
+            fifo_data[dev->dummy_byte + len] = (uint8_t)word[pos];
+            fifo_data[dev->dummy_byte + len + 1] = (uint8_t)(word[pos] >> 8);
+            len += 2;
+        }
+    }
+
+    /* The extractors only take a frame that ends before the last byte and compare their byte index,
+     * which starts behind the dummy byte, against the word count, so both lengths get a spare word
+     */
+    fifo_data[dev->dummy_byte + len] = 0;
+    fifo_data[dev->dummy_byte + len + 1] = 0;
+
+    fifo->data = fifo_data;
+    fifo->length = (uint16_t)(len + dev->dummy_byte + 2);
+    fifo->available_fifo_len = (uint16_t)(fifo->length / 2);
+    fifo->available_fifo_sens = sens;
+}
+
+/*!
+ * @brief This internal API prints the result of a check.
+ */
+static uint16_t report(const char label[], uint16_t failed)
+{
+    printf("%-40s %s\n", label, failed ? "FAIL" : "ok");
+
+    return failed;
+}
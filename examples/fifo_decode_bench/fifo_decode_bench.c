@@ -0,0 +1,275 @@
+/**\
+ * Copyright (c) 2023 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <time.h>
+#include "bmi323.h"
+#include "bmi3_sim.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+/*! Size of the FIFO in bytes */
+#define FIFO_SIZE_BYTES  UINT16_C(2048)
+
+/*! Maximum number of frames a full FIFO can hold (accelerometer only, 6 bytes per frame) */
+#define FIFO_MAX_FRAMES  UINT16_C(342)
+
+/*! Number of times the FIFO is decoded per measurement */
+#define BENCH_LOOPS      UINT32_C(20000)
+
+/*! Every n-th frame carries an accelerometer / gyroscope dummy frame */
+#define ACC_DUMMY_EVERY  UINT16_C(7)
+#define GYR_DUMMY_EVERY  UINT16_C(11)
+
+/******************************************************************************/
+/*!          Static variable definition                                       */
+
+/*! Simulated sensor, only used to provide the interface of the device structure */
+static struct bmi3_sim sim;
+
+/*! FIFO data including the interface dummy byte */
+static uint8_t fifo_data[FIFO_SIZE_BYTES + 2];
+
+/*! Outputs of the array-of-structs extractors */
+static struct bmi3_fifo_sens_axes_data acc_aos[FIFO_MAX_FRAMES], gyr_aos[FIFO_MAX_FRAMES];
+
+/*! Outputs of the struct-of-arrays decoder */
+static int16_t acc_x[FIFO_MAX_FRAMES], acc_y[FIFO_MAX_FRAMES], acc_z[FIFO_MAX_FRAMES];
+static int16_t gyr_x[FIFO_MAX_FRAMES], gyr_y[FIFO_MAX_FRAMES], gyr_z[FIFO_MAX_FRAMES];
+static uint16_t acc_t[FIFO_MAX_FRAMES], gyr_t[FIFO_MAX_FRAMES];
+static uint32_t acc_valid[(FIFO_MAX_FRAMES + 31) / 32], gyr_valid[(FIFO_MAX_FRAMES + 31) / 32];
+
+/******************************************************************************/
+/*!         Static Function Declaration                                       */
+
+/*!
+ *  @brief This internal API fills the FIFO buffer with pseudo random headerless frames.
+ *
+ *  @param[in] fifo      : Structure instance of bmi3_fifo_frame.
+ *  @param[in] dev       : Structure instance of bmi3_dev.
+ *
+ *  @return void.
+ */
+static void fill_fifo(struct bmi3_fifo_frame *fifo, const struct bmi3_dev *dev);
+
+/*!
+ *  @brief This internal API checks that the decoder output matches the extractors bit for bit.
+ *
+ *  @param[in] aos       : Output of the extractor.
+ *  @param[in] aos_len   : Number of frames returned by the extractor.
+ *  @param[in] soa       : Output of the decoder.
+ *
+ *  @return Number of mismatching frames.
+ */
+static uint16_t compare_output(const struct bmi3_fifo_sens_axes_data *aos,
+                               uint16_t aos_len,
+                               const struct bmi3_fifo_axes_soa *soa);
+
+/*!
+ *  @brief This internal API returns a monotonic time stamp in seconds.
+ *
+ *  @return Time stamp.
+ */
+static double now_sec(void);
+
+/*!
+ *  @brief This internal API runs both decoders on one FIFO configuration and prints the rates.
+ *
+ *  @param[in] label     : Name of the configuration.
+ *  @param[in] sens      : FIFO configuration, BMI3_FIFO_*_EN bits.
+ *  @param[in] dev       : Structure instance of bmi3_dev.
+ *
+ *  @return Number of mismatching frames.
+ */
+static uint16_t run_bench(const char label[], uint16_t sens, const struct bmi3_dev *dev);
+
+/******************************************************************************/
+/*!            Functions                                        */
+
+/* This function starts the execution of program. */
+int main(void)
+{
+    /* Status of API are returned to this variable. */
+    int8_t rslt;
+
+    /* Sensor initialization configuration. */
+    struct bmi3_dev dev;
+
+    /* Number of mismatching frames */
+    uint16_t mismatch = 0;
+
+    rslt = bmi3_sim_interface_init(&dev, &sim, BMI3_SPI_INTF);
+
+    if (rslt == BMI3_OK)
+    {
+        printf("%-22s %14s %14s %8s\n", "FIFO configuration", "AoS frames/s", "SoA frames/s", "speedup");
+
+        mismatch += run_bench("acc", BMI3_FIFO_ACC_EN, &dev);
+        mismatch += run_bench("gyr", BMI3_FIFO_GYR_EN, &dev);
+        mismatch += run_bench("acc+gyr", BMI3_FIFO_ACC_EN | BMI3_FIFO_GYR_EN, &dev);
+        mismatch += run_bench("acc+gyr+time", BMI3_FIFO_ACC_EN | BMI3_FIFO_GYR_EN | BMI3_FIFO_TIME_EN, &dev);
+        mismatch += run_bench("acc+gyr+temp+time", BMI3_FIFO_ALL_EN, &dev);
+
+        printf("Mismatching frames: %u\n", mismatch);
+    }
+
+    return (rslt == BMI3_OK && mismatch == 0) ? 0 : 1;
+}
+
+/*!
+ * @brief This internal API runs both decoders on one FIFO configuration and prints the rates.
+ */
+static uint16_t run_bench(const char label[], uint16_t sens, const struct bmi3_dev *dev)
+{
+    struct bmi3_fifo_frame fifo = { 0 };
+    struct bmi3_fifo_axes_soa acc = { acc_x, acc_y, acc_z, acc_t, acc_valid, FIFO_MAX_FRAMES, 0 };
+    struct bmi3_fifo_axes_soa gyr = { gyr_x, gyr_y, gyr_z, gyr_t, gyr_valid, FIFO_MAX_FRAMES, 0 };
+    struct bmi3_fifo_axes_soa *acc_soa = (sens & BMI3_FIFO_ACC_EN) ? &acc : NULL;
+    struct bmi3_fifo_axes_soa *gyr_soa = (sens & BMI3_FIFO_GYR_EN) ? &gyr : NULL;
+    uint16_t mismatch = 0;
+    uint16_t frames;
+    uint32_t loop;
+    double start, aos_sec, soa_sec;
+
+    fifo.data = fifo_data;
+    fifo.length = (uint16_t)(FIFO_SIZE_BYTES + dev->dummy_byte);
+    fifo.available_fifo_len = FIFO_SIZE_BYTES / 2;
+    fifo.available_fifo_sens = sens;
+    fill_fifo(&fifo, dev);
+
+    /* Frames per FIFO buffer, the rate of both paths is given against the same count */
+    (void)bmi323_decode_fifo_frames(acc_soa, gyr_soa, &fifo, dev);
+    frames = (acc_soa != NULL) ? acc.frames : gyr.frames;
+
+    start = now_sec();
+    for (loop = 0; loop < BENCH_LOOPS; loop++)
+    {
+        if (acc_soa != NULL)
+        {
+            fifo.avail_fifo_accel_frames = FIFO_MAX_FRAMES;
+            (void)bmi323_extract_accel(acc_aos, &fifo, dev);
+        }
+
+        if (gyr_soa != NULL)
+        {
+            fifo.avail_fifo_gyro_frames = FIFO_MAX_FRAMES;
+            (void)bmi323_extract_gyro(gyr_aos, &fifo, dev);
+        }
+    }
+
+    aos_sec = now_sec() - start;
+
+    start = now_sec();
+    for (loop = 0; loop < BENCH_LOOPS; loop++)
+    {
+        (void)bmi323_decode_fifo_frames(acc_soa, gyr_soa, &fifo, dev);
+    }
+
+    soa_sec = now_sec() - start;
+
+    if (acc_soa != NULL)
+    {
+        mismatch += compare_output(acc_aos, fifo.avail_fifo_accel_frames, &acc);
+    }
+
+    if (gyr_soa != NULL)
+    {
+        mismatch += compare_output(gyr_aos, fifo.avail_fifo_gyro_frames, &gyr);
+    }
+
+    printf("%-22s %14.0f %14.0f %7.1fx\n",
+           label,
+           (double)frames * BENCH_LOOPS / aos_sec,
+           (double)frames * BENCH_LOOPS / soa_sec,
+           aos_sec / soa_sec);
+
+    return mismatch;
+}
+
+/*!
+ * @brief This internal API fills the FIFO buffer with pseudo random headerless frames.
+ */
+static void fill_fifo(struct bmi3_fifo_frame *fifo, const struct bmi3_dev *dev)
+{
+    uint32_t seed = 0x1234567;
+    uint16_t idx, frame = 0, word, pos = 0;
+    uint8_t *data = &fifo->data[dev->dummy_byte];
+
+    for (idx = 0; (idx + 1) < FIFO_SIZE_BYTES; idx += 2)
+    {
+        seed = seed * 1103515245 + 12345;
+        word = (uint16_t)(seed >> 16);
+
+        /* Word position inside the frame: acc x, y, z, gyr x, y, z, temp, time */
+        if ((pos == 0) && (fifo->available_fifo_sens & BMI3_FIFO_ACC_EN) && ((frame % ACC_DUMMY_EVERY) == 3))
+        {
+            word = BMI3_FIFO_ACCEL_DUMMY_FRAME;
+        }
+
+        if ((pos == ((fifo->available_fifo_sens & BMI3_FIFO_ACC_EN) ? 3 : 0)) &&
+            (fifo->available_fifo_sens & BMI3_FIFO_GYR_EN) && ((frame % GYR_DUMMY_EVERY) == 5))
+        {
+            word = BMI3_FIFO_GYRO_DUMMY_FRAME;
+        }
+
+        data[idx] = (uint8_t)word;
+        data[idx + 1] = (uint8_t)(word >> 8);
+
+        pos++;
+
+        if ((uint16_t)(pos * 2) == (((fifo->available_fifo_sens & BMI3_FIFO_ACC_EN) ? BMI3_LENGTH_FIFO_ACC : 0) +
+                                    ((fifo->available_fifo_sens & BMI3_FIFO_GYR_EN) ? BMI3_LENGTH_FIFO_GYR : 0) +
+                                    ((fifo->available_fifo_sens & BMI3_FIFO_TEMP_EN) ? BMI3_LENGTH_TEMPERATURE : 0) +
+                                    ((fifo->available_fifo_sens & BMI3_FIFO_TIME_EN) ? BMI3_LENGTH_SENSOR_TIME : 0)))
+        {
+            pos = 0;
+            frame++;
+        }
+    }
+}
+
+/*!
+ * @brief This internal API checks that the decoder output matches the extractors bit for bit.
+ */
+static uint16_t compare_output(const struct bmi3_fifo_sens_axes_data *aos,
+                               uint16_t aos_len,
+                               const struct bmi3_fifo_axes_soa *soa)
+{
+    uint16_t idx, out = 0, mismatch = 0;
+
+    /* The extractors skip dummy frames, so walk the valid frames of the decoder output */
+    for (idx = 0; (idx < soa->frames) && (out < aos_len); idx++)
+    {
+        if (soa->valid[idx / 32] & ((uint32_t)1 << (idx % 32)))
+        {
+            if ((aos[out].x != soa->x[idx]) || (aos[out].y != soa->y[idx]) || (aos[out].z != soa->z[idx]) ||
+                (aos[out].sensor_time != soa->sensor_time[idx]))
+            {
+                mismatch++;
+            }
+
+            out++;
+        }
+    }
+
+    return (uint16_t)(mismatch + (aos_len - out));
+}
+
+/*!
+ * @brief This internal API returns a monotonic time stamp in seconds.
+ */
+static double now_sec(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
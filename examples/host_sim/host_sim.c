@@ -0,0 +1,215 @@
+/**\
+ * Copyright (c) 2023 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stdio.h>
+#include "bmi323.h"
+#include "bmi3_sim.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+#define BMI323_FIFO_RAW_DATA_BUFFER_SIZE  UINT16_C(2048)
+
+/*! FIFO water-mark level in words */
+#define FIFO_WATERMARK_LEVEL              UINT16_C(800)
+
+/*! 1g in LSB at 2G range for a 16 bit accelerometer */
+#define ACCEL_1G_LSB_2G                   INT16_C(16384)
+
+/******************************************************************************/
+/*!          Static variable definition                                       */
+
+/*! Simulated sensor */
+static struct bmi3_sim sim;
+
+/******************************************************************************/
+/*!         Static Function Declaration                                       */
+
+/*!
+ *  @brief This internal API is used to set configurations for FIFO, accelerometer and gyroscope.
+ *
+ *  @param[in] dev       : Structure instance of bmi3_dev.
+ *
+ *  @return Status of execution.
+ */
+static int8_t set_sensor_fifo_config(struct bmi3_dev *dev);
+
+/*!
+ *  @brief This internal API prints the API name and error code on failure.
+ *
+ *  @param[in] api_name  : Name of the API.
+ *  @param[in] rslt      : Error code returned by the API.
+ *
+ *  @return void.
+ */
+static void print_rslt(const char api_name[], int8_t rslt);
+
+/******************************************************************************/
+/*!               Functions                                                   */
+
+/* This function runs the driver against the simulated sensor and reports the bus cost of each step */
+int main(void)
+{
+    /* Sensor initialization configuration. */
+    struct bmi3_dev dev = { 0 };
+
+    /* Status of API are returned to this variable. */
+    int8_t rslt;
+
+    /* Number of bytes of FIFO data */
+    uint8_t fifo_data[BMI323_FIFO_RAW_DATA_BUFFER_SIZE] = { 0 };
+
+    /* Array of accelerometer frames */
+    struct bmi3_fifo_sens_axes_data fifo_accel_data[128];
+
+    /* Initialize FIFO frame structure */
+    struct bmi3_fifo_frame fifoframe = { 0 };
+
+    /* Structure to select accel FOC axis and sign */
+    struct bmi3_accel_foc_g_value g_value_foc = { 0, 0, 1, 0 };
+
+    /* Variable that contains interrupt status value */
+    uint16_t int_status = 0;
+
+    /* Attach the device structure to the simulated sensor on SPI */
+    rslt = bmi3_sim_interface_init(&dev, &sim, BMI3_SPI_INTF);
+    print_rslt("bmi3_sim_interface_init", rslt);
+
+    /* Initialize BMI323 */
+    rslt = bmi323_init(&dev);
+    print_rslt("bmi323_init", rslt);
+    bmi3_sim_print_stats("bmi323_init", &sim);
+
+    if (rslt == BMI323_OK)
+    {
+        bmi3_sim_reset_stats(&sim);
+
+        rslt = set_sensor_fifo_config(&dev);
+        print_rslt("set_sensor_fifo_config", rslt);
+        bmi3_sim_print_stats("set_sensor_fifo_config", &sim);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        /* Sleep until the water-mark interrupt line goes high */
+        while (!bmi3_sim_int_pin_level(&sim, BMI3_INT1))
+        {
+            bmi3_sim_advance_us(&sim, 1000);
+        }
+
+        bmi3_sim_reset_stats(&sim);
+
+        rslt = bmi323_get_int1_status(&int_status, &dev);
+        print_rslt("bmi323_get_int1_status", rslt);
+
+        if ((rslt == BMI323_OK) && (int_status & BMI3_INT_STATUS_FWM))
+        {
+            rslt = bmi323_get_fifo_length(&fifoframe.available_fifo_len, &dev);
+            print_rslt("bmi323_get_fifo_length", rslt);
+
+            fifoframe.data = fifo_data;
+            fifoframe.length = (uint16_t)(fifoframe.available_fifo_len * 2 + dev.dummy_byte);
+
+            rslt = bmi323_read_fifo_data(&fifoframe, &dev);
+            print_rslt("bmi323_read_fifo_data", rslt);
+            bmi3_sim_print_stats("bmi323_read_fifo_data", &sim);
+
+            (void)bmi323_extract_accel(fifo_accel_data, &fifoframe, &dev);
+            printf("FIFO words : %d, parsed accelerometer frames : %d\n",
+                   fifoframe.available_fifo_len,
+                   fifoframe.avail_fifo_accel_frames);
+        }
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        /* Lay the sensor flat with a small offset on every axis */
+        sim.acc[0] = 120;
+        sim.acc[1] = -80;
+        sim.acc[2] = ACCEL_1G_LSB_2G + 200;
+
+        bmi3_sim_reset_stats(&sim);
+
+        rslt = bmi323_perform_accel_foc(&g_value_foc, &dev);
+        print_rslt("bmi323_perform_accel_foc", rslt);
+        bmi3_sim_print_stats("bmi323_perform_accel_foc", &sim);
+    }
+
+    printf("Simulated time : %llu us\n", (unsigned long long)bmi3_sim_get_time_us(&sim));
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API is used to set configurations for accelerometer, gyroscope and FIFO.
+ */
+static int8_t set_sensor_fifo_config(struct bmi3_dev *dev)
+{
+    /* Status of API are returned to this variable. */
+    int8_t rslt;
+
+    /* Structure to define accelerometer and gyroscope configuration. */
+    struct bmi3_sens_config config[2] = { { 0 } };
+
+    struct bmi3_map_int map_int = { 0 };
+
+    /* Array to define set FIFO flush */
+    uint8_t data[2] = { BMI323_ENABLE, 0 };
+
+    config[0].type = BMI323_ACCEL;
+    config[1].type = BMI323_GYRO;
+
+    config[0].cfg.acc.odr = BMI3_ACC_ODR_800HZ;
+    config[0].cfg.acc.bwp = BMI3_ACC_BW_ODR_QUARTER;
+    config[0].cfg.acc.avg_num = BMI3_ACC_AVG1;
+    config[0].cfg.acc.range = BMI3_ACC_RANGE_2G;
+    config[0].cfg.acc.acc_mode = BMI3_ACC_MODE_HIGH_PERF;
+
+    config[1].cfg.gyr.odr = BMI3_GYR_ODR_800HZ;
+    config[1].cfg.gyr.bwp = BMI3_GYR_BW_ODR_HALF;
+    config[1].cfg.gyr.avg_num = BMI3_GYR_AVG1;
+    config[1].cfg.gyr.range = BMI3_GYR_RANGE_2000DPS;
+    config[1].cfg.gyr.gyr_mode = BMI3_GYR_MODE_HIGH_PERF;
+
+    rslt = bmi323_set_sensor_config(config, 2, dev);
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_set_fifo_config(BMI3_FIFO_ALL_EN, BMI323_ENABLE, dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_set_regs(BMI3_REG_FIFO_CTRL, data, 2, dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_set_fifo_wm(FIFO_WATERMARK_LEVEL, dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        map_int.fifo_watermark_int = BMI3_INT1;
+
+        rslt = bmi323_map_interrupt(map_int, dev);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API prints the API name and error code on failure.
+ */
+static void print_rslt(const char api_name[], int8_t rslt)
+{
+    if (rslt != BMI323_OK)
+    {
+        printf("%s\tError [%d]\n", api_name, rslt);
+    }
+}
@@ -0,0 +1,373 @@
+/**\
+ * Copyright (c) 2023 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <time.h>
+#include "bmi323.h"
+#include "bmi3_sim.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+/*! Size of the FIFO in bytes */
+#define FIFO_SIZE_BYTES  UINT16_C(2048)
+
+/*! Maximum number of accelerometer or gyroscope frames a FIFO read can return */
+#define FIFO_MAX_FRAMES  UINT16_C(342)
+
+/*! Time the FIFO fills between two drains, 80 frames at 800 Hz */
+#define FIFO_FILL_US     UINT32_C(100000)
+
+/*! Number of calls per measurement */
+#define BENCH_LOOPS      UINT32_C(2000)
+
+/*! Accelerometer and gyroscope values of the simulated sensor */
+#define SIM_ACC_X        INT16_C(120)
+#define SIM_GYR_Z        INT16_C(-345)
+
+/******************************************************************************/
+/*!          Static variable definition                                       */
+
+/*! Simulated sensor */
+static struct bmi3_sim sim;
+
+/*! Shadow cache used by the cached measurements */
+static struct bmi3_shadow shadow;
+
+/*! FIFO data including the interface dummy byte */
+static uint8_t fifo_data[FIFO_SIZE_BYTES + 2];
+
+/*! Frames extracted from the FIFO */
+static struct bmi3_fifo_sens_axes_data fifo_acc[FIFO_MAX_FRAMES], fifo_gyr[FIFO_MAX_FRAMES];
+
+/*! Number of frames of the last FIFO drain that did not carry the simulated values */
+static uint32_t bad_frames;
+
+/******************************************************************************/
+/*!         Static Function Declaration                                       */
+
+/*! Operation measured by run_bench */
+typedef int8_t (*bench_op_t)(struct bmi3_dev *dev);
+
+/*!
+ *  @brief This internal API configures accelerometer, gyroscope and the FIFO.
+ *
+ *  @param[in] dev       : Structure instance of bmi3_dev.
+ *
+ *  @return Status of execution.
+ */
+static int8_t set_sensor_fifo_config(struct bmi3_dev *dev);
+
+/*!
+ *  @brief This internal API calls an operation BENCH_LOOPS times and prints its host time and bus cost per call.
+ *
+ *  @param[in] label     : Name of the operation.
+ *  @param[in] op        : Operation.
+ *  @param[in] dev       : Structure instance of bmi3_dev.
+ *
+ *  @return Status of the last call.
+ */
+static int8_t run_bench(const char label[], bench_op_t op, struct bmi3_dev *dev);
+
+/*!
+ *  @brief These internal APIs are the measured operations.
+ *
+ *  @param[in] dev       : Structure instance of bmi3_dev.
+ *
+ *  @return Status of execution.
+ */
+static int8_t op_burst_data(struct bmi3_dev *dev);
+static int8_t op_set_acc_gyr_config(struct bmi3_dev *dev);
+static int8_t op_get_feature_config(struct bmi3_dev *dev);
+static int8_t op_set_feature_field(struct bmi3_dev *dev);
+static int8_t op_fifo_drain(struct bmi3_dev *dev);
+
+/*!
+ *  @brief This internal API returns a monotonic time stamp in seconds.
+ *
+ *  @return Time stamp.
+ */
+static double now_sec(void);
+
+/******************************************************************************/
+/*!            Functions                                        */
+
+/* This function starts the execution of program. */
+int main(void)
+{
+    /* Status of API are returned to this variable. */
+    int8_t rslt;
+
+    /* Sensor initialization configuration. */
+    struct bmi3_dev dev = { 0 };
+
+    rslt = bmi3_sim_interface_init(&dev, &sim, BMI3_SPI_INTF);
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_init(&dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = set_sensor_fifo_config(&dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        sim.acc[0] = SIM_ACC_X;
+        sim.gyr[2] = SIM_GYR_Z;
+
+        printf("%-40s %12s %8s %8s %10s\n", "operation", "host ns", "reads", "writes", "bus us");
+
+        rslt = run_bench("get_sensor_burst_data", op_burst_data, &dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = run_bench("set_sensor_config acc+gyr", op_set_acc_gyr_config, &dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = run_bench("get_sensor_config any-motion+flat", op_get_feature_config, &dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = run_bench("set_feature_fields slope", op_set_feature_field, &dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = run_bench("FIFO drain acc+gyr, 80 frames", op_fifo_drain, &dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_shadow_enable(&shadow, &dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = run_bench("set_sensor_config acc+gyr, cached", op_set_acc_gyr_config, &dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = run_bench("get_sensor_config any-motion+flat, cached", op_get_feature_config, &dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = run_bench("set_feature_fields slope, cached", op_set_feature_field, &dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_shadow_disable(&dev);
+    }
+
+    if (rslt != BMI323_OK)
+    {
+        printf("Error [%d]\n", rslt);
+    }
+
+    printf("Frames with wrong data: %lu\n", (unsigned long)bad_frames);
+
+    return (rslt == BMI323_OK && bad_frames == 0) ? 0 : 1;
+}
+
+/*!
+ * @brief This internal API calls an operation BENCH_LOOPS times and prints its host time and bus cost per call.
+ */
+static int8_t run_bench(const char label[], bench_op_t op, struct bmi3_dev *dev)
+{
+    int8_t rslt = BMI323_OK;
+    uint32_t loop;
+    double start, sec;
+
+    bmi3_sim_reset_stats(&sim);
+
+    start = now_sec();
+    for (loop = 0; (loop < BENCH_LOOPS) && (rslt == BMI323_OK); loop++)
+    {
+        rslt = op(dev);
+    }
+
+    sec = now_sec() - start;
+
+    printf("%-40s %12.0f %8.1f %8.1f %10.1f\n",
+           label,
+           sec * 1e9 / BENCH_LOOPS,
+           (double)sim.stats.read_count / BENCH_LOOPS,
+           (double)sim.stats.write_count / BENCH_LOOPS,
+           (double)sim.stats.bus_time_ns / 1000.0 / BENCH_LOOPS);
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API reads status, data, sensor time and interrupt status in one transaction.
+ */
+static int8_t op_burst_data(struct bmi3_dev *dev)
+{
+    struct bmi3_sensor_burst_data data;
+
+    return bmi323_get_sensor_burst_data(&data, dev);
+}
+
+/*!
+ * @brief This internal API writes the accelerometer and gyroscope configuration.
+ */
+static int8_t op_set_acc_gyr_config(struct bmi3_dev *dev)
+{
+    struct bmi3_sens_config config[2] = { { 0 } };
+
+    config[0].type = BMI323_ACCEL;
+    config[0].cfg.acc.odr = BMI3_ACC_ODR_800HZ;
+    config[0].cfg.acc.bwp = BMI3_ACC_BW_ODR_QUARTER;
+    config[0].cfg.acc.avg_num = BMI3_ACC_AVG1;
+    config[0].cfg.acc.range = BMI3_ACC_RANGE_2G;
+    config[0].cfg.acc.acc_mode = BMI3_ACC_MODE_HIGH_PERF;
+
+    config[1].type = BMI323_GYRO;
+    config[1].cfg.gyr.odr = BMI3_GYR_ODR_800HZ;
+    config[1].cfg.gyr.bwp = BMI3_GYR_BW_ODR_HALF;
+    config[1].cfg.gyr.avg_num = BMI3_GYR_AVG1;
+    config[1].cfg.gyr.range = BMI3_GYR_RANGE_2000DPS;
+    config[1].cfg.gyr.gyr_mode = BMI3_GYR_MODE_HIGH_PERF;
+
+    return bmi323_set_sensor_config(config, 2, dev);
+}
+
+/*!
+ * @brief This internal API reads two feature engine configurations.
+ */
+static int8_t op_get_feature_config(struct bmi3_dev *dev)
+{
+    struct bmi3_sens_config config[2] = { { 0 } };
+
+    config[0].type = BMI323_ANY_MOTION;
+    config[1].type = BMI323_FLAT;
+
+    return bmi323_get_sensor_config(config, 2, dev);
+}
+
+/*!
+ * @brief This internal API retunes the any-motion threshold.
+ */
+static int8_t op_set_feature_field(struct bmi3_dev *dev)
+{
+    static uint16_t slope_thres = 0;
+    uint8_t field = BMI3_FIELD_ANY_MOTION_SLOPE_THRES;
+
+    slope_thres = (uint16_t)((slope_thres + 1) & 0xFFF);
+
+    return bmi323_set_feature_fields(&field, &slope_thres, 1, dev);
+}
+
+/*!
+ * @brief This internal API lets the FIFO fill, reads it and extracts accelerometer and gyroscope frames.
+ */
+static int8_t op_fifo_drain(struct bmi3_dev *dev)
+{
+    int8_t rslt;
+    struct bmi3_fifo_frame fifo = { 0 };
+    uint16_t idx;
+
+    bmi3_sim_advance_us(&sim, FIFO_FILL_US);
+
+    rslt = bmi323_get_fifo_length(&fifo.available_fifo_len, dev);
+
+    if (rslt == BMI323_OK)
+    {
+        fifo.data = fifo_data;
+        fifo.length = (uint16_t)(fifo.available_fifo_len * 2 + dev->dummy_byte);
+
+        rslt = bmi323_read_fifo_data(&fifo, dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        fifo.avail_fifo_accel_frames = FIFO_MAX_FRAMES;
+        fifo.avail_fifo_gyro_frames = FIFO_MAX_FRAMES;
+
+        rslt = bmi323_extract_accel(fifo_acc, &fifo, dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_extract_gyro(fifo_gyr, &fifo, dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        if (fifo.avail_fifo_accel_frames == 0)
+        {
+            bad_frames++;
+        }
+
+        for (idx = 0; idx < fifo.avail_fifo_accel_frames; idx++)
+        {
+            if (fifo_acc[idx].x != SIM_ACC_X)
+            {
+                bad_frames++;
+            }
+        }
+
+        for (idx = 0; idx < fifo.avail_fifo_gyro_frames; idx++)
+        {
+            if (fifo_gyr[idx].z != SIM_GYR_Z)
+            {
+                bad_frames++;
+            }
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API is used to set configurations for accelerometer, gyroscope and FIFO.
+ */
+static int8_t set_sensor_fifo_config(struct bmi3_dev *dev)
+{
+    /* Status of API are returned to this variable. */
+    int8_t rslt;
+
+    /* Array to define set FIFO flush */
+    uint8_t data[2] = { BMI323_ENABLE, 0 };
+
+    rslt = op_set_acc_gyr_config(dev);
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_set_fifo_config(BMI3_FIFO_ACC_EN | BMI3_FIFO_GYR_EN, BMI323_ENABLE, dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_set_regs(BMI3_REG_FIFO_CTRL, data, 2, dev);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API returns a monotonic time stamp in seconds.
+ */
+static double now_sec(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}